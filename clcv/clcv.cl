@@ -21,6 +21,52 @@
 // (depending on the chipset).
 
 
+// Programs
+// The library builds one program per operator (family), with
+// -D CLCV_SECTIONS -D CLCV_SECTION_<name>, instead of the whole file. Each
+// section below is guarded by its name, the sections an operator depends on
+// are enabled here (dependents first). Without CLCV_SECTIONS, everything is
+// built, but NAIVE_JIT (see naive_morph_jit).
+#ifndef CLCV_SECTIONS
+# define CLCV_SECTION_BINARIZE
+# define CLCV_SECTION_NAIVE
+# define CLCV_SECTION_BITMAP
+# define CLCV_SECTION_RECT
+# define CLCV_SECTION_VHGW
+# define CLCV_SECTION_RUNS
+# define CLCV_SECTION_RECT_FUSED
+# define CLCV_SECTION_RUNS_FUSED
+# define CLCV_SECTION_HITORMISS
+# define CLCV_SECTION_RECONSTRUCT
+# define CLCV_SECTION_GRAY
+# define CLCV_SECTION_LABEL
+# define CLCV_SECTION_EDT
+# define CLCV_SECTION_AREA
+# define CLCV_SECTION_DIAG
+# define CLCV_SECTION_MORPH_3X3
+# define CLCV_SECTION_RANK
+# define CLCV_SECTION_LUT
+# define CLCV_SECTION_SKELETON
+# define CLCV_SECTION_GRAY_RECONSTRUCT
+# define CLCV_SECTION_WATERSHED
+#endif
+#ifdef CLCV_SECTION_SKELETON
+# define CLCV_SECTION_MORPH_3X3
+#endif
+#if defined(CLCV_SECTION_DIAG) || defined(CLCV_SECTION_MORPH_3X3) || defined(CLCV_SECTION_RANK)
+# define CLCV_SECTION_SHIFT
+#endif
+#if defined(CLCV_SECTION_RUNS_FUSED) || defined(CLCV_SECTION_HITORMISS)
+# define CLCV_SECTION_RUNS
+#endif
+#if defined(CLCV_SECTION_RUNS_FUSED) || defined(CLCV_SECTION_RECT_FUSED)
+# define CLCV_SECTION_RESIDUE
+#endif
+#if defined(CLCV_SECTION_GRAY) || defined(CLCV_SECTION_GRAY_RECONSTRUCT)
+# define CLCV_SECTION_GRAY_OP
+#endif
+
+
 // Copy a sub image into a local memory buffer
 void naive_memcpy2d2local(local int * local_out, global const int * in,
                           const int in_nrows, const int in_ncols,
@@ -85,6 +131,7 @@ void naive_localimg_setup(global const int * in, global const int * se,
   barrier(CLK_LOCAL_MEM_FENCE);
 }
 
+#ifdef CLCV_SECTION_BINARIZE
 // Simple binarize/threshold operator. Global to global memory
 kernel void binarize(global const int * in, global int * out,
                      const int nrows, const int ncols,
@@ -95,7 +142,9 @@ kernel void binarize(global const int * in, global int * out,
   const int idx = mad24(y, ncols, x);
   out[idx] = select(min_val, max_val, in[idx] >= threshold);  
 }
+#endif
 
+#ifdef CLCV_SECTION_NAIVE
 // Naive mathematical morpholgy operator.
 // Just iterate through the structuring element for each pixel
 kernel void naive_morph(global const int * in, global int * out,
@@ -143,7 +192,51 @@ kernel void naive_morph(global const int * in, global int * out,
   }
   out[idx] = select(0, 1, acc >= se_targetsum);
 }
+#endif
+
+#ifdef CLCV_SECTION_NAIVE_JIT
+// naive_morph with the SE compiled in. The host defines the radii
+// (CLCV_SE_ROWRAD, CLCV_SE_COLRAD), the work-group size (CLCV_LXSIZE,
+// CLCV_LYSIZE) and CLCV_SE_POINTS, the list of the
+// CLCV_SE_POINT(row, col, weight) of the SE: the loop is unrolled, with
+// constant offsets in local_img.
+#define CLCV_PADDED_NROWS (CLCV_LYSIZE + CLCV_SE_ROWRAD * 2)
+#define CLCV_PADDED_NCOLS (CLCV_LXSIZE + CLCV_SE_COLRAD * 2)
+#define CLCV_SE_POINT(r, c, w) \
+  acc = mad24(local_img[lidx + (r) * CLCV_PADDED_NCOLS + (c)], (w), acc);
+
+kernel __attribute__((reqd_work_group_size(CLCV_LXSIZE, CLCV_LYSIZE, 1)))
+void naive_morph_jit(global const int * in, global int * out,
+                     const int nrows, const int ncols,
+                     const int se_targetsum)
+{
+  local int local_img[CLCV_PADDED_NROWS * CLCV_PADDED_NCOLS];
+
+  const int x = get_global_id(0);
+  const int y = get_global_id(1);
+  const int lx = get_local_id(0);
+  const int ly = get_local_id(1);
+  const int corner_x = get_group_id(0) * CLCV_LXSIZE;
+  const int corner_y = get_group_id(1) * CLCV_LYSIZE;
+
+  const int thread_idx = mad24(ly, CLCV_LXSIZE, lx);
+
+  const int lidx = mad24(CLCV_PADDED_NCOLS, ly + CLCV_SE_ROWRAD, lx + CLCV_SE_COLRAD);
+  const int idx = mad24(y, ncols, x);
+
+  naive_memcpy2d2local(local_img, in, nrows, ncols,
+                       CLCV_PADDED_NROWS, CLCV_PADDED_NCOLS,
+                       corner_y - CLCV_SE_ROWRAD, corner_x - CLCV_SE_COLRAD,
+                       thread_idx, CLCV_LXSIZE * CLCV_LYSIZE);
+  barrier(CLK_LOCAL_MEM_FENCE);
+
+  int acc = 0;
+  CLCV_SE_POINTS
+  out[idx] = select(0, 1, acc >= se_targetsum);
+}
+#endif
 
+#ifdef CLCV_SECTION_BITMAP
 // Bitmapped operators
 
 // This binarize version compacts the binarized image to a 1bit per pixel format
@@ -321,6 +414,9 @@ kernel void unbitmap(global const int * in, global int * out, local int * local_
   }
 
 }
+#endif
+
+#ifdef CLCV_SECTION_RECT
 // MM bimapped operators optimized for radius <= 32
 // Don't call it with radius > 32 along the x axis!
 
@@ -607,3 +703,2713 @@ kernel void bitmapped_erosion_v(global const int * in, global int * out,
     out[idx] = acc;    
   }
 }
+#endif
+
+#ifdef CLCV_SECTION_VHGW
+// MM bitmapped operators for large radii (van Herk/Gil-Werman)
+// The line is split into blocks of k = 2*rad+1 elements. For each block we
+// compute the prefix (g) and suffix (h) OR/AND, and the result for the window
+// [i-rad, i+rad] is then h[i-rad] op g[i+rad]. The cost per word is therefore
+// the same whatever the radius.
+
+// Pixels located i columns to the left of the pixels of w[0] (1 <= i < 64)
+uint bitmapped_pull_left(local const uint * w, const int i)
+{
+  if (i < 32)
+    return (w[0] >> i) | (w[-1] << (32-i));
+  if (i == 32)
+    return w[-1];
+  return (w[-1] >> (i-32)) | (w[-2] << (64-i));
+}
+
+// Pixels located i columns to the right of the pixels of w[0] (1 <= i < 64)
+uint bitmapped_pull_right(local const uint * w, const int i)
+{
+  if (i < 32)
+    return (w[0] << i) | (w[1] >> (32-i));
+  if (i == 32)
+    return w[1];
+  return (w[1] << (i-32)) | (w[2] >> (64-i));
+}
+
+// Horizontal van Herk/Gil-Werman. The radius is decomposed as
+// se_colrad = 32 * se_wordrad + se_bitrad with 16 <= se_bitrad < 48, i.e.
+// [-se_colrad, se_colrad] = 32.[-se_wordrad, se_wordrad] + [-se_bitrad, se_bitrad]
+// The word part uses the prefix/suffix scheme, the remaining bit part is
+// bounded and handled with shifts.
+// local_img, local_g and local_h are lysize * (lxsize + 2*se_wordrad + 4)
+void bitmapped_vhgw_h(global const int * in, global int * out,
+                      const int nrows, const int ncols,
+                      const int se_wordrad, const int se_bitrad,
+                      local uint * local_img, local uint * local_g, local uint * local_h,
+                      const int erosion)
+{
+  const int x = get_global_id(0);
+  const int y = get_global_id(1);
+  const int lx = get_local_id(0);
+  const int ly = get_local_id(1);
+  const int lxsize = get_local_size(0);
+  const int lysize = get_local_size(1);
+  const int b_ncols = ncols >> 5;
+
+  const int corner_x = get_group_id(0) * lxsize;
+  const int corner_y = get_group_id(1) * lysize;
+
+  const int thread_idx = mad24(ly, lxsize, lx);
+  const int nb_threads = lxsize * lysize;
+
+  const int k = se_wordrad * 2 + 1;
+  const int padded_nrows = lysize;
+  const int padded_ncols = lxsize + se_wordrad * 2 + 4;
+  const int nb_blocks = (padded_ncols - 1) / k + 1;
+
+  const int idx = mad24(y, b_ncols, x);
+
+  const int size = padded_nrows * padded_ncols;
+
+  // Copy subimage to local memory
+  for (int i = thread_idx; i < size; i += nb_threads)
+  {
+    const int div = i / padded_ncols;
+    const int rect_row = div + corner_y;
+    const int rect_col = i - div * padded_ncols + corner_x - se_wordrad - 2;
+
+    if (rect_row < 0 || rect_row >= nrows || rect_col < 0 || rect_col >= b_ncols)
+    {
+      local_img[i] = 0;
+    }
+    else
+    {
+      const int pidx = mad24(rect_row, b_ncols, rect_col);
+      local_img[i] = in[pidx];
+    }
+  }
+  barrier(CLK_LOCAL_MEM_FENCE);
+
+  // Prefix/suffix scans, one block per thread
+  for (int i = thread_idx; i < padded_nrows * nb_blocks; i += nb_threads)
+  {
+    const int div = i / nb_blocks;
+    const int start = mad24(div, padded_ncols, (i - div * nb_blocks) * k);
+    const int end = mad24(div, padded_ncols, min(padded_ncols, (i - div * nb_blocks + 1) * k));
+
+    uint acc = local_img[start];
+    local_g[start] = acc;
+    for (int j = start + 1; j < end; ++j)
+    {
+      acc = erosion ? acc & local_img[j] : acc | local_img[j];
+      local_g[j] = acc;
+    }
+    acc = local_img[end - 1];
+    local_h[end - 1] = acc;
+    for (int j = end - 2; j >= start; --j)
+    {
+      acc = erosion ? acc & local_img[j] : acc | local_img[j];
+      local_h[j] = acc;
+    }
+  }
+  barrier(CLK_LOCAL_MEM_FENCE);
+
+  // Merge the word windows. local_img now holds the word level result for
+  // the words [corner_x - 2, corner_x + lxsize + 2[
+  for (int i = thread_idx; i < padded_nrows * (lxsize + 4); i += nb_threads)
+  {
+    const int div = i / (lxsize + 4);
+    const int lidx = mad24(div, padded_ncols, i - div * (lxsize + 4));
+    const uint h = local_h[lidx];
+    const uint g = local_g[lidx + se_wordrad * 2];
+    local_img[lidx] = erosion ? h & g : h | g;
+  }
+  barrier(CLK_LOCAL_MEM_FENCE);
+
+  // Bail out if we are outside the image
+  if (x >= b_ncols || y >= nrows)
+    return;
+
+  // Remaining bit level window
+  {
+    local const uint * w = local_img + mad24(ly, padded_ncols, lx + 2);
+    uint acc = w[0];
+    for (int i = 1; i <= se_bitrad; ++i)
+    {
+      if (erosion)
+        acc &= bitmapped_pull_left(w, i) & bitmapped_pull_right(w, i);
+      else
+        acc |= bitmapped_pull_left(w, i) | bitmapped_pull_right(w, i);
+    }
+    out[idx] = acc;
+  }
+}
+
+kernel void bitmapped_vhgw_dilation_h(global const int * in, global int * out,
+                                      const int nrows, const int ncols,
+                                      const int se_wordrad, const int se_bitrad,
+                                      local uint * local_img,
+                                      local uint * local_g, local uint * local_h)
+{
+  bitmapped_vhgw_h(in, out, nrows, ncols, se_wordrad, se_bitrad,
+                   local_img, local_g, local_h, 0);
+}
+
+kernel void bitmapped_vhgw_erosion_h(global const int * in, global int * out,
+                                     const int nrows, const int ncols,
+                                     const int se_wordrad, const int se_bitrad,
+                                     local uint * local_img,
+                                     local uint * local_g, local uint * local_h)
+{
+  bitmapped_vhgw_h(in, out, nrows, ncols, se_wordrad, se_bitrad,
+                   local_img, local_g, local_h, 1);
+}
+
+// Vertical van Herk/Gil-Werman, first pass.
+// One thread per word column and per block of k = 2*se_rowrad+1 rows.
+// The apron would be too large for the local memory, so g and h go to
+// global memory.
+void bitmapped_vhgw_scan_v(global const int * in, global int * g, global int * h,
+                           const int nrows, const int ncols,
+                           const int se_rowrad, const int erosion)
+{
+  const int x = get_global_id(0);
+  const int y = get_global_id(1);
+  const int b_ncols = ncols >> 5;
+  const int k = se_rowrad * 2 + 1;
+
+  if (x >= b_ncols || y * k >= nrows)
+    return;
+
+  const int start = mad24(y * k, b_ncols, x);
+  const int end = mad24(min(nrows, (y + 1) * k), b_ncols, x);
+
+  int acc = in[start];
+  g[start] = acc;
+  for (int i = start + b_ncols; i < end; i += b_ncols)
+  {
+    acc = erosion ? acc & in[i] : acc | in[i];
+    g[i] = acc;
+  }
+  acc = in[end - b_ncols];
+  h[end - b_ncols] = acc;
+  for (int i = end - 2 * b_ncols; i >= start; i -= b_ncols)
+  {
+    acc = erosion ? acc & in[i] : acc | in[i];
+    h[i] = acc;
+  }
+}
+
+kernel void bitmapped_vhgw_dilation_scan_v(global const int * in,
+                                           global int * g, global int * h,
+                                           const int nrows, const int ncols,
+                                           const int se_rowrad)
+{
+  bitmapped_vhgw_scan_v(in, g, h, nrows, ncols, se_rowrad, 0);
+}
+
+kernel void bitmapped_vhgw_erosion_scan_v(global const int * in,
+                                          global int * g, global int * h,
+                                          const int nrows, const int ncols,
+                                          const int se_rowrad)
+{
+  bitmapped_vhgw_scan_v(in, g, h, nrows, ncols, se_rowrad, 1);
+}
+
+// Vertical van Herk/Gil-Werman, second pass. Out of the image is 0, as in
+// bitmapped_dilation_v/bitmapped_erosion_v.
+kernel void bitmapped_vhgw_dilation_v(global const int * g, global const int * h,
+                                      global int * out,
+                                      const int nrows, const int ncols,
+                                      const int se_rowrad)
+{
+  const int x = get_global_id(0);
+  const int y = get_global_id(1);
+  const int b_ncols = ncols >> 5;
+  const int k = se_rowrad * 2 + 1;
+
+  if (x >= b_ncols || y >= nrows)
+    return;
+
+  const int top = y - se_rowrad;
+  const int bottom = y + se_rowrad;
+  int acc = top < 0 ? 0 : h[mad24(top, b_ncols, x)];
+  if (bottom < nrows)
+    acc |= g[mad24(bottom, b_ncols, x)];
+  else if ((bottom / k) * k < nrows) // the last block is truncated
+    acc |= g[mad24(nrows - 1, b_ncols, x)];
+  out[mad24(y, b_ncols, x)] = acc;
+}
+
+kernel void bitmapped_vhgw_erosion_v(global const int * g, global const int * h,
+                                     global int * out,
+                                     const int nrows, const int ncols,
+                                     const int se_rowrad)
+{
+  const int x = get_global_id(0);
+  const int y = get_global_id(1);
+  const int b_ncols = ncols >> 5;
+
+  if (x >= b_ncols || y >= nrows)
+    return;
+
+  const int top = y - se_rowrad;
+  const int bottom = y + se_rowrad;
+  out[mad24(y, b_ncols, x)] = top < 0 || bottom >= nrows ? 0 :
+    h[mad24(top, b_ncols, x)] & g[mad24(bottom, b_ncols, x)];
+}
+#endif
+
+#ifdef CLCV_SECTION_BITMAP
+// Pixelwise logical operators on bitmaps (see clcv_logic_op)
+kernel void bitmapped_logic(global const int * a, global const int * b,
+                            global int * out, const int op)
+{
+  const int idx = get_global_id(0);
+  const int va = a[idx];
+  const int vb = b[idx];
+  switch (op)
+  {
+    case 0: out[idx] = va & vb; break;
+    case 1: out[idx] = va | vb; break;
+    case 2: out[idx] = va & ~vb; break;
+    default: out[idx] = va ^ vb; break;
+  }
+}
+#endif
+
+#ifdef CLCV_SECTION_RUNS
+// MM bitmapped operator for arbitrary flat SEs
+// The SE is encoded as horizontal runs (row, first col, last col). For each
+// run, the 32 pixels of a word are computed at once by OR'ing (AND'ing) the
+// shifted words of the corresponding row. Shifts are done on a 64bit window,
+// one window per group of 32 columns, and a run of length L costs log2(L)
+// shifts per window.
+
+// OR (erosion: AND) of v << c, for 0 <= c < len
+ulong bitmapped_smear(ulong v, const int len, const int erosion)
+{
+  int done = 1;
+  while (done * 2 <= len)
+  {
+    v = erosion ? v & (v << done) : v | (v << done);
+    done *= 2;
+  }
+  if (done < len)
+    v = erosion ? v & (v << (len - done)) : v | (v << (len - done));
+  return v;
+}
+
+// OR (erosion: AND) of the pixels located c0..c1 columns away from the
+// pixels of w[0] (c0 and c1 can be negative)
+uint bitmapped_run(local const uint * w, const int c0, const int c1, const int erosion)
+{
+  uint acc = erosion ? 0xFFFFFFFF : 0;
+  int c = c0;
+  while (c <= c1)
+  {
+    const int m = c >> 5; // floor(c / 32)
+    const int first = c - (m << 5);
+    const int last = min(c1 - (m << 5), 31);
+    const ulong window = ((ulong)w[m] << 32) | w[m + 1];
+    const uint v = (uint)((bitmapped_smear(window, last - first + 1, erosion) << first) >> 32);
+    acc = erosion ? acc & v : acc | v;
+    c = (m + 1) << 5;
+  }
+  return acc;
+}
+
+// local_runs is 3 * se_nruns, local_img is
+// (lysize + 2 * se_rowrad) * (lxsize + 2 * (se_colrad / 32 + 1))
+void bitmapped_morph(global const int * in, global int * out,
+                     const int nrows, const int ncols,
+                     global const int * se_runs, const int se_nruns,
+                     const int se_rowrad, const int se_colrad,
+                     local int * local_runs, local uint * local_img,
+                     const int erosion)
+{
+  const int x = get_global_id(0);
+  const int y = get_global_id(1);
+  const int lx = get_local_id(0);
+  const int ly = get_local_id(1);
+  const int lxsize = get_local_size(0);
+  const int lysize = get_local_size(1);
+  const int b_ncols = ncols >> 5;
+
+  const int corner_x = get_group_id(0) * lxsize;
+  const int corner_y = get_group_id(1) * lysize;
+
+  const int thread_idx = mad24(ly, lxsize, lx);
+  const int nb_threads = lxsize * lysize;
+
+  const int se_wordrad = (se_colrad >> 5) + 1;
+  const int padded_nrows = lysize + se_rowrad * 2;
+  const int padded_ncols = lxsize + se_wordrad * 2;
+
+  const int lidx = mad24(padded_ncols, ly + se_rowrad, lx + se_wordrad);
+  const int idx = mad24(y, b_ncols, x);
+
+  const int size = padded_nrows * padded_ncols;
+
+  memcpy2local(local_runs, se_runs, se_nruns * 3, thread_idx, nb_threads);
+  // Copy subimage to local memory
+  for (int i = thread_idx; i < size; i += nb_threads)
+  {
+    const int div = i / padded_ncols;
+    const int rect_row = div + corner_y - se_rowrad;
+    const int rect_col = i - div * padded_ncols + corner_x - se_wordrad;
+
+    if (rect_row < 0 || rect_row >= nrows || rect_col < 0 || rect_col >= b_ncols)
+    {
+      local_img[i] = 0;
+    }
+    else
+    {
+      const int pidx = mad24(rect_row, b_ncols, rect_col);
+      local_img[i] = in[pidx];
+    }
+  }
+  barrier(CLK_LOCAL_MEM_FENCE);
+
+  // Bail out if we are outside the image
+  if (x >= b_ncols || y >= nrows)
+    return;
+
+  uint acc = erosion ? 0xFFFFFFFF : 0;
+  for (int i = 0; i < se_nruns * 3; i += 3)
+  {
+    local const uint * w = local_img + mad24(padded_ncols, local_runs[i], lidx);
+    const uint v = bitmapped_run(w, local_runs[i+1], local_runs[i+2], erosion);
+    acc = erosion ? acc & v : acc | v;
+  }
+  out[idx] = acc;
+}
+
+kernel void bitmapped_dilation(global const int * in, global int * out,
+                               const int nrows, const int ncols,
+                               global const int * se_runs, const int se_nruns,
+                               const int se_rowrad, const int se_colrad,
+                               local int * local_runs, local uint * local_img)
+{
+  bitmapped_morph(in, out, nrows, ncols, se_runs, se_nruns, se_rowrad, se_colrad,
+                  local_runs, local_img, 0);
+}
+
+kernel void bitmapped_erosion(global const int * in, global int * out,
+                              const int nrows, const int ncols,
+                              global const int * se_runs, const int se_nruns,
+                              const int se_rowrad, const int se_colrad,
+                              local int * local_runs, local uint * local_img)
+{
+  bitmapped_morph(in, out, nrows, ncols, se_runs, se_nruns, se_rowrad, se_colrad,
+                  local_runs, local_img, 1);
+}
+#endif
+
+#ifdef CLCV_SECTION_RECT_FUSED
+// Fused openings/closings
+// The tile is loaded once with an apron twice as large as a single operator
+// needs. The first operator runs over the tile minus one apron, the second
+// one over the work group, and the result is written once. Pixels of the
+// intermediate image lying outside the image are reset to 0, as the
+// unfused operators would read them.
+
+// Rectangle, horizontal step (se_colrad <= 32)
+uint bitmapped_rect_h(const uint wl, const uint w, const uint wr,
+                      const int se_colrad, const int erosion)
+{
+  uint acc = w;
+  for (int i = 1; i <= se_colrad; ++i)
+  {
+    const uint l = (w >> i) | (wl << (32-i));
+    const uint r = (w << i) | (wr >> (32-i));
+    acc = erosion ? acc & l & r : acc | l | r;
+  }
+  return acc;
+}
+
+// Rectangle, vertical step
+uint bitmapped_rect_v(local const uint * w, const int padded_ncols,
+                      const int se_rowrad, const int erosion)
+{
+  uint acc = w[0];
+  for (int r = 1; r <= se_rowrad; ++r)
+  {
+    const uint u = w[-r * padded_ncols];
+    const uint d = w[r * padded_ncols];
+    acc = erosion ? acc & u & d : acc | u | d;
+  }
+  return acc;
+}
+#endif
+
+#ifdef CLCV_SECTION_RESIDUE
+// Residues (top-hats) of the fused operators: what the opening removed, or
+// what the closing added
+uint bitmapped_residue(const uint in, const uint res, const int closing)
+{
+  return closing ? res & ~in : in & ~res;
+}
+#endif
+
+#ifdef CLCV_SECTION_RECT_FUSED
+// local_img and local_tmp are
+// (lysize + 4 * se_rowrad) * (lxsize + 4) each
+void bitmapped_rect_fused(global const int * in, global int * out,
+                          const int nrows, const int ncols,
+                          const int se_rowrad, const int se_colrad,
+                          local uint * local_img, local uint * local_tmp,
+                          const int closing, const int residue)
+{
+  const int x = get_global_id(0);
+  const int y = get_global_id(1);
+  const int lx = get_local_id(0);
+  const int ly = get_local_id(1);
+  const int lxsize = get_local_size(0);
+  const int lysize = get_local_size(1);
+  const int b_ncols = ncols >> 5;
+
+  const int corner_x = get_group_id(0) * lxsize - 2;
+  const int corner_y = get_group_id(1) * lysize - se_rowrad * 2;
+
+  const int thread_idx = mad24(ly, lxsize, lx);
+  const int nb_threads = lxsize * lysize;
+
+  const int padded_nrows = lysize + se_rowrad * 4;
+  const int padded_ncols = lxsize + 4;
+
+  const int size = padded_nrows * padded_ncols;
+
+  // Copy subimage to local memory
+  for (int i = thread_idx; i < size; i += nb_threads)
+  {
+    const int div = i / padded_ncols;
+    const int rect_row = div + corner_y;
+    const int rect_col = i - div * padded_ncols + corner_x;
+
+    if (rect_row < 0 || rect_row >= nrows || rect_col < 0 || rect_col >= b_ncols)
+    {
+      local_img[i] = 0;
+    }
+    else
+    {
+      const int pidx = mad24(rect_row, b_ncols, rect_col);
+      local_img[i] = in[pidx];
+    }
+  }
+  barrier(CLK_LOCAL_MEM_FENCE);
+
+  // First operator, horizontal step: all the rows, all but the outer columns
+  for (int i = thread_idx; i < size; i += nb_threads)
+  {
+    const int col = i - (i / padded_ncols) * padded_ncols;
+    if (col > 0 && col < padded_ncols - 1)
+      local_tmp[i] = bitmapped_rect_h(local_img[i-1], local_img[i], local_img[i+1],
+                                      se_colrad, !closing);
+  }
+  barrier(CLK_LOCAL_MEM_FENCE);
+
+  // First operator, vertical step: back into local_img, without the outer rows
+  for (int i = thread_idx; i < size; i += nb_threads)
+  {
+    const int div = i / padded_ncols;
+    const int col = i - div * padded_ncols;
+    if (div >= se_rowrad && div < padded_nrows - se_rowrad
+        && col > 0 && col < padded_ncols - 1)
+    {
+      const int rect_row = div + corner_y;
+      const int rect_col = col + corner_x;
+      if (rect_row < 0 || rect_row >= nrows || rect_col < 0 || rect_col >= b_ncols)
+        local_img[i] = 0;
+      else
+        local_img[i] = bitmapped_rect_v(local_tmp + i, padded_ncols, se_rowrad, !closing);
+    }
+  }
+  barrier(CLK_LOCAL_MEM_FENCE);
+
+  // Second operator, horizontal step
+  for (int i = thread_idx; i < size; i += nb_threads)
+  {
+    const int div = i / padded_ncols;
+    const int col = i - div * padded_ncols;
+    if (div >= se_rowrad && div < padded_nrows - se_rowrad
+        && col > 1 && col < padded_ncols - 2)
+      local_tmp[i] = bitmapped_rect_h(local_img[i-1], local_img[i], local_img[i+1],
+                                      se_colrad, closing);
+  }
+  barrier(CLK_LOCAL_MEM_FENCE);
+
+  // Bail out if we are outside the image
+  if (x >= b_ncols || y >= nrows)
+    return;
+
+  // Second operator, vertical step
+  {
+    const int lidx = mad24(padded_ncols, ly + se_rowrad * 2, lx + 2);
+    const int idx = mad24(y, b_ncols, x);
+    const uint res = bitmapped_rect_v(local_tmp + lidx, padded_ncols, se_rowrad, closing);
+    out[idx] = residue ? bitmapped_residue(in[idx], res, closing) : res;
+  }
+}
+
+kernel void bitmapped_opening_rect(global const int * in, global int * out,
+                                   const int nrows, const int ncols,
+                                   const int se_rowrad, const int se_colrad,
+                                   local uint * local_img, local uint * local_tmp)
+{
+  bitmapped_rect_fused(in, out, nrows, ncols, se_rowrad, se_colrad,
+                       local_img, local_tmp, 0, 0);
+}
+
+kernel void bitmapped_closing_rect(global const int * in, global int * out,
+                                   const int nrows, const int ncols,
+                                   const int se_rowrad, const int se_colrad,
+                                   local uint * local_img, local uint * local_tmp)
+{
+  bitmapped_rect_fused(in, out, nrows, ncols, se_rowrad, se_colrad,
+                       local_img, local_tmp, 1, 0);
+}
+
+kernel void bitmapped_tophat_rect(global const int * in, global int * out,
+                                  const int nrows, const int ncols,
+                                  const int se_rowrad, const int se_colrad,
+                                  local uint * local_img, local uint * local_tmp)
+{
+  bitmapped_rect_fused(in, out, nrows, ncols, se_rowrad, se_colrad,
+                       local_img, local_tmp, 0, 1);
+}
+
+kernel void bitmapped_blackhat_rect(global const int * in, global int * out,
+                                    const int nrows, const int ncols,
+                                    const int se_rowrad, const int se_colrad,
+                                    local uint * local_img, local uint * local_tmp)
+{
+  bitmapped_rect_fused(in, out, nrows, ncols, se_rowrad, se_colrad,
+                       local_img, local_tmp, 1, 1);
+}
+#endif
+
+#ifdef CLCV_SECTION_RUNS
+// Any flat SE, encoded as runs (see bitmapped_morph)
+uint bitmapped_runs(local const uint * w, const int padded_ncols,
+                    local const int * local_runs, const int se_nruns,
+                    const int erosion)
+{
+  uint acc = erosion ? 0xFFFFFFFF : 0;
+  for (int i = 0; i < se_nruns * 3; i += 3)
+  {
+    const uint v = bitmapped_run(w + local_runs[i] * padded_ncols,
+                                 local_runs[i+1], local_runs[i+2], erosion);
+    acc = erosion ? acc & v : acc | v;
+  }
+  return acc;
+}
+#endif
+
+#ifdef CLCV_SECTION_RUNS_FUSED
+// local_runs is 3 * se_nruns, local_img and local_tmp are
+// (lysize + 4 * se_rowrad) * (lxsize + 4 * (se_colrad / 32 + 1)) each
+void bitmapped_morph_fused(global const int * in, global int * out,
+                           const int nrows, const int ncols,
+                           global const int * se_runs, const int se_nruns,
+                           const int se_rowrad, const int se_colrad,
+                           local int * local_runs,
+                           local uint * local_img, local uint * local_tmp,
+                           const int closing, const int residue)
+{
+  const int x = get_global_id(0);
+  const int y = get_global_id(1);
+  const int lx = get_local_id(0);
+  const int ly = get_local_id(1);
+  const int lxsize = get_local_size(0);
+  const int lysize = get_local_size(1);
+  const int b_ncols = ncols >> 5;
+
+  const int se_wordrad = (se_colrad >> 5) + 1;
+  const int corner_x = get_group_id(0) * lxsize - se_wordrad * 2;
+  const int corner_y = get_group_id(1) * lysize - se_rowrad * 2;
+
+  const int thread_idx = mad24(ly, lxsize, lx);
+  const int nb_threads = lxsize * lysize;
+
+  const int padded_nrows = lysize + se_rowrad * 4;
+  const int padded_ncols = lxsize + se_wordrad * 4;
+
+  const int size = padded_nrows * padded_ncols;
+
+  memcpy2local(local_runs, se_runs, se_nruns * 3, thread_idx, nb_threads);
+  // Copy subimage to local memory
+  for (int i = thread_idx; i < size; i += nb_threads)
+  {
+    const int div = i / padded_ncols;
+    const int rect_row = div + corner_y;
+    const int rect_col = i - div * padded_ncols + corner_x;
+
+    if (rect_row < 0 || rect_row >= nrows || rect_col < 0 || rect_col >= b_ncols)
+    {
+      local_img[i] = 0;
+    }
+    else
+    {
+      const int pidx = mad24(rect_row, b_ncols, rect_col);
+      local_img[i] = in[pidx];
+    }
+  }
+  barrier(CLK_LOCAL_MEM_FENCE);
+
+  // First operator over the tile minus one apron
+  for (int i = thread_idx; i < size; i += nb_threads)
+  {
+    const int div = i / padded_ncols;
+    const int col = i - div * padded_ncols;
+    if (div >= se_rowrad && div < padded_nrows - se_rowrad
+        && col >= se_wordrad && col < padded_ncols - se_wordrad)
+    {
+      const int rect_row = div + corner_y;
+      const int rect_col = col + corner_x;
+      if (rect_row < 0 || rect_row >= nrows || rect_col < 0 || rect_col >= b_ncols)
+        local_tmp[i] = 0;
+      else
+        local_tmp[i] = bitmapped_runs(local_img + i, padded_ncols,
+                                      local_runs, se_nruns, !closing);
+    }
+  }
+  barrier(CLK_LOCAL_MEM_FENCE);
+
+  // Bail out if we are outside the image
+  if (x >= b_ncols || y >= nrows)
+    return;
+
+  // Second operator
+  {
+    const int lidx = mad24(padded_ncols, ly + se_rowrad * 2, lx + se_wordrad * 2);
+    const int idx = mad24(y, b_ncols, x);
+    const uint res = bitmapped_runs(local_tmp + lidx, padded_ncols,
+                                    local_runs, se_nruns, closing);
+    out[idx] = residue ? bitmapped_residue(in[idx], res, closing) : res;
+  }
+}
+
+kernel void bitmapped_opening(global const int * in, global int * out,
+                              const int nrows, const int ncols,
+                              global const int * se_runs, const int se_nruns,
+                              const int se_rowrad, const int se_colrad,
+                              local int * local_runs,
+                              local uint * local_img, local uint * local_tmp)
+{
+  bitmapped_morph_fused(in, out, nrows, ncols, se_runs, se_nruns, se_rowrad, se_colrad,
+                        local_runs, local_img, local_tmp, 0, 0);
+}
+
+kernel void bitmapped_closing(global const int * in, global int * out,
+                              const int nrows, const int ncols,
+                              global const int * se_runs, const int se_nruns,
+                              const int se_rowrad, const int se_colrad,
+                              local int * local_runs,
+                              local uint * local_img, local uint * local_tmp)
+{
+  bitmapped_morph_fused(in, out, nrows, ncols, se_runs, se_nruns, se_rowrad, se_colrad,
+                        local_runs, local_img, local_tmp, 1, 0);
+}
+
+kernel void bitmapped_tophat(global const int * in, global int * out,
+                             const int nrows, const int ncols,
+                             global const int * se_runs, const int se_nruns,
+                             const int se_rowrad, const int se_colrad,
+                             local int * local_runs,
+                             local uint * local_img, local uint * local_tmp)
+{
+  bitmapped_morph_fused(in, out, nrows, ncols, se_runs, se_nruns, se_rowrad, se_colrad,
+                        local_runs, local_img, local_tmp, 0, 1);
+}
+
+kernel void bitmapped_blackhat(global const int * in, global int * out,
+                               const int nrows, const int ncols,
+                               global const int * se_runs, const int se_nruns,
+                               const int se_rowrad, const int se_colrad,
+                               local int * local_runs,
+                               local uint * local_img, local uint * local_tmp)
+{
+  bitmapped_morph_fused(in, out, nrows, ncols, se_runs, se_nruns, se_rowrad, se_colrad,
+                        local_runs, local_img, local_tmp, 1, 1);
+}
+#endif
+
+#ifdef CLCV_SECTION_NAIVE
+// Two naive_morph in a row with the same SE (e.g. an erosion then a
+// dilation). residue 1 outputs the input minus the result (white top-hat),
+// residue 2 the result minus the input (black top-hat). The input is
+// binary (0/1) like for naive_morph. local_img and local_tmp are
+// (lysize + 4 * se_rowrad) * (lxsize + 4 * se_colrad) each
+kernel void naive_morph_fused(global const int * in, global int * out,
+                              const int nrows, const int ncols,
+                              global int * se, const int se_rowrad, const int se_colrad,
+                              const int se_count,
+                              const int se_targetsum1, const int se_targetsum2,
+                              const int residue,
+                              local int * local_se,
+                              local int * local_img, local int * local_tmp)
+{
+  const int x = get_global_id(0);
+  const int y = get_global_id(1);
+  const int lx = get_local_id(0);
+  const int ly = get_local_id(1);
+  const int lxsize = get_local_size(0);
+  const int lysize = get_local_size(1);
+  const int corner_x = get_group_id(0) * lxsize - se_colrad * 2;
+  const int corner_y = get_group_id(1) * lysize - se_rowrad * 2;
+
+  const int thread_idx = mad24(ly, lxsize, lx);
+  const int nb_threads = lxsize * lysize;
+
+  const int se_size = se_count * 2 + se_count;
+
+  const int padded_nrows = lysize + se_rowrad * 4;
+  const int padded_ncols = lxsize + se_colrad * 4;
+
+  const int size = padded_nrows * padded_ncols;
+
+  naive_localimg_setup(in, se, local_img, local_se,
+                       thread_idx, nb_threads,
+                       nrows, ncols, padded_nrows, padded_ncols,
+                       corner_y, corner_x,
+                       se_size);
+
+  // First operator over the tile minus one apron. The result is kept in the
+  // same (-1/1) format as the input tile.
+  for (int i = thread_idx; i < size; i += nb_threads)
+  {
+    const int div = i / padded_ncols;
+    const int col = i - div * padded_ncols;
+    if (div >= se_rowrad && div < padded_nrows - se_rowrad
+        && col >= se_colrad && col < padded_ncols - se_colrad)
+    {
+      const int rect_row = div + corner_y;
+      const int rect_col = col + corner_x;
+      int acc = 0;
+      for (int j = 0; j < se_size; j += 3)
+      {
+        const int ridx = mad24(padded_ncols, local_se[j], i + local_se[j+1]);
+        acc = mad24(local_img[ridx], local_se[j+2], acc);
+      }
+      local_tmp[i] = rect_row < 0 || rect_row >= nrows || rect_col < 0 || rect_col >= ncols
+        ? -1 : select(-1, 1, acc >= se_targetsum1);
+    }
+  }
+  barrier(CLK_LOCAL_MEM_FENCE);
+
+  // Second operator
+  {
+    const int lidx = mad24(padded_ncols, ly + se_rowrad * 2, lx + se_colrad * 2);
+    const int idx = mad24(y, ncols, x);
+    int acc = 0;
+    for (int j = 0; j < se_size; j += 3)
+    {
+      const int ridx = mad24(padded_ncols, local_se[j], lidx + local_se[j+1]);
+      acc = mad24(local_tmp[ridx], local_se[j+2], acc);
+    }
+    const int res = select(0, 1, acc >= se_targetsum2);
+    const int v = in[idx] != 0;
+    out[idx] = residue == 1 ? v & ~res : residue == 2 ? res & ~v : res;
+  }
+}
+#endif
+
+#ifdef CLCV_SECTION_RECT_FUSED
+// Morphological gradients: dilation minus erosion, from the same tile
+
+// local_img, local_dil and local_ero are
+// (lysize + 2 * se_rowrad) * (lxsize + 2) each (se_colrad <= 32)
+kernel void bitmapped_gradient_rect(global const int * in, global int * out,
+                                    const int nrows, const int ncols,
+                                    const int se_rowrad, const int se_colrad,
+                                    local uint * local_img,
+                                    local uint * local_dil, local uint * local_ero)
+{
+  const int x = get_global_id(0);
+  const int y = get_global_id(1);
+  const int lx = get_local_id(0);
+  const int ly = get_local_id(1);
+  const int lxsize = get_local_size(0);
+  const int lysize = get_local_size(1);
+  const int b_ncols = ncols >> 5;
+
+  const int corner_x = get_group_id(0) * lxsize - 1;
+  const int corner_y = get_group_id(1) * lysize - se_rowrad;
+
+  const int thread_idx = mad24(ly, lxsize, lx);
+  const int nb_threads = lxsize * lysize;
+
+  const int padded_nrows = lysize + se_rowrad * 2;
+  const int padded_ncols = lxsize + 2;
+
+  const int size = padded_nrows * padded_ncols;
+
+  // Copy subimage to local memory
+  for (int i = thread_idx; i < size; i += nb_threads)
+  {
+    const int div = i / padded_ncols;
+    const int rect_row = div + corner_y;
+    const int rect_col = i - div * padded_ncols + corner_x;
+
+    if (rect_row < 0 || rect_row >= nrows || rect_col < 0 || rect_col >= b_ncols)
+    {
+      local_img[i] = 0;
+    }
+    else
+    {
+      const int pidx = mad24(rect_row, b_ncols, rect_col);
+      local_img[i] = in[pidx];
+    }
+  }
+  barrier(CLK_LOCAL_MEM_FENCE);
+
+  // Horizontal steps
+  for (int i = thread_idx; i < size; i += nb_threads)
+  {
+    const int col = i - (i / padded_ncols) * padded_ncols;
+    if (col > 0 && col < padded_ncols - 1)
+    {
+      local_dil[i] = bitmapped_rect_h(local_img[i-1], local_img[i], local_img[i+1],
+                                      se_colrad, 0);
+      local_ero[i] = bitmapped_rect_h(local_img[i-1], local_img[i], local_img[i+1],
+                                      se_colrad, 1);
+    }
+  }
+  barrier(CLK_LOCAL_MEM_FENCE);
+
+  // Bail out if we are outside the image
+  if (x >= b_ncols || y >= nrows)
+    return;
+
+  // Vertical steps
+  {
+    const int lidx = mad24(padded_ncols, ly + se_rowrad, lx + 1);
+    const int idx = mad24(y, b_ncols, x);
+    out[idx] = bitmapped_rect_v(local_dil + lidx, padded_ncols, se_rowrad, 0)
+      & ~bitmapped_rect_v(local_ero + lidx, padded_ncols, se_rowrad, 1);
+  }
+}
+#endif
+
+#ifdef CLCV_SECTION_RUNS_FUSED
+// Same layout as bitmapped_morph
+kernel void bitmapped_gradient(global const int * in, global int * out,
+                               const int nrows, const int ncols,
+                               global const int * se_runs, const int se_nruns,
+                               const int se_rowrad, const int se_colrad,
+                               local int * local_runs, local uint * local_img)
+{
+  const int x = get_global_id(0);
+  const int y = get_global_id(1);
+  const int lx = get_local_id(0);
+  const int ly = get_local_id(1);
+  const int lxsize = get_local_size(0);
+  const int lysize = get_local_size(1);
+  const int b_ncols = ncols >> 5;
+
+  const int se_wordrad = (se_colrad >> 5) + 1;
+  const int corner_x = get_group_id(0) * lxsize - se_wordrad;
+  const int corner_y = get_group_id(1) * lysize - se_rowrad;
+
+  const int thread_idx = mad24(ly, lxsize, lx);
+  const int nb_threads = lxsize * lysize;
+
+  const int padded_nrows = lysize + se_rowrad * 2;
+  const int padded_ncols = lxsize + se_wordrad * 2;
+
+  const int size = padded_nrows * padded_ncols;
+
+  memcpy2local(local_runs, se_runs, se_nruns * 3, thread_idx, nb_threads);
+  // Copy subimage to local memory
+  for (int i = thread_idx; i < size; i += nb_threads)
+  {
+    const int div = i / padded_ncols;
+    const int rect_row = div + corner_y;
+    const int rect_col = i - div * padded_ncols + corner_x;
+
+    if (rect_row < 0 || rect_row >= nrows || rect_col < 0 || rect_col >= b_ncols)
+    {
+      local_img[i] = 0;
+    }
+    else
+    {
+      const int pidx = mad24(rect_row, b_ncols, rect_col);
+      local_img[i] = in[pidx];
+    }
+  }
+  barrier(CLK_LOCAL_MEM_FENCE);
+
+  // Bail out if we are outside the image
+  if (x >= b_ncols || y >= nrows)
+    return;
+
+  {
+    const int lidx = mad24(padded_ncols, ly + se_rowrad, lx + se_wordrad);
+    const int idx = mad24(y, b_ncols, x);
+    out[idx] = bitmapped_runs(local_img + lidx, padded_ncols, local_runs, se_nruns, 0)
+      & ~bitmapped_runs(local_img + lidx, padded_ncols, local_runs, se_nruns, 1);
+  }
+}
+#endif
+
+#ifdef CLCV_SECTION_NAIVE
+// The dilation and the erosion share the same accumulator
+kernel void naive_gradient(global const int * in, global int * out,
+                           const int nrows, const int ncols,
+                           global int * se, const int se_rowrad, const int se_colrad,
+                           const int se_count,
+                           const int se_targetsum_dil, const int se_targetsum_ero,
+                           local int * local_se,
+                           local int * local_img)
+{
+  const int x = get_global_id(0);
+  const int y = get_global_id(1);
+  const int lx = get_local_id(0);
+  const int ly = get_local_id(1);
+  const int lxsize = get_local_size(0);
+  const int lysize = get_local_size(1);
+  const int corner_x = get_group_id(0) * lxsize;
+  const int corner_y = get_group_id(1) * lysize;
+
+  const int thread_idx = mad24(ly, lxsize, lx);
+  const int nb_threads = lxsize * lysize;
+
+  const int se_size = se_count * 2 + se_count;
+
+  const int padded_nrows = lysize + se_rowrad * 2;
+  const int padded_ncols = lxsize + se_colrad * 2;
+
+  const int lidx = mad24(padded_ncols, ly + se_rowrad, lx + se_colrad);
+  const int idx = mad24(y, ncols, x);
+
+  naive_localimg_setup(in, se, local_img, local_se,
+                       thread_idx, nb_threads,
+                       nrows, ncols, padded_nrows, padded_ncols,
+                       corner_y - se_rowrad, corner_x - se_colrad,
+                       se_size);
+
+  int acc = 0;
+  for (int i = 0; i < se_size; i += 3)
+  {
+    const int ridx = mad24(padded_ncols, local_se[i], lidx + local_se[i+1]);
+    acc = mad24(local_img[ridx], local_se[i+2], acc);
+  }
+  out[idx] = select(0, 1, acc >= se_targetsum_dil && acc < se_targetsum_ero);
+}
+#endif
+
+#ifdef CLCV_SECTION_HITORMISS
+// Hit-or-miss transforms
+// Pixels outside the image are background: they never match the
+// foreground of the SE and always match its background.
+
+// se_runs holds the foreground runs, then the background ones. Erosion of
+// the complement by the background is the complement of the dilation.
+// Same layout as bitmapped_morph, local_runs is 3 * (se_nfgruns + se_nbgruns)
+kernel void bitmapped_hitormiss(global const int * in, global int * out,
+                                const int nrows, const int ncols,
+                                global const int * se_runs,
+                                const int se_nfgruns, const int se_nbgruns,
+                                const int se_rowrad, const int se_colrad,
+                                local int * local_runs, local uint * local_img)
+{
+  const int x = get_global_id(0);
+  const int y = get_global_id(1);
+  const int lx = get_local_id(0);
+  const int ly = get_local_id(1);
+  const int lxsize = get_local_size(0);
+  const int lysize = get_local_size(1);
+  const int b_ncols = ncols >> 5;
+
+  const int se_wordrad = (se_colrad >> 5) + 1;
+  const int corner_x = get_group_id(0) * lxsize - se_wordrad;
+  const int corner_y = get_group_id(1) * lysize - se_rowrad;
+
+  const int thread_idx = mad24(ly, lxsize, lx);
+  const int nb_threads = lxsize * lysize;
+
+  const int padded_nrows = lysize + se_rowrad * 2;
+  const int padded_ncols = lxsize + se_wordrad * 2;
+
+  const int size = padded_nrows * padded_ncols;
+
+  memcpy2local(local_runs, se_runs, (se_nfgruns + se_nbgruns) * 3, thread_idx, nb_threads);
+  // Copy subimage to local memory
+  for (int i = thread_idx; i < size; i += nb_threads)
+  {
+    const int div = i / padded_ncols;
+    const int rect_row = div + corner_y;
+    const int rect_col = i - div * padded_ncols + corner_x;
+
+    if (rect_row < 0 || rect_row >= nrows || rect_col < 0 || rect_col >= b_ncols)
+    {
+      local_img[i] = 0;
+    }
+    else
+    {
+      const int pidx = mad24(rect_row, b_ncols, rect_col);
+      local_img[i] = in[pidx];
+    }
+  }
+  barrier(CLK_LOCAL_MEM_FENCE);
+
+  // Bail out if we are outside the image
+  if (x >= b_ncols || y >= nrows)
+    return;
+
+  {
+    const int lidx = mad24(padded_ncols, ly + se_rowrad, lx + se_wordrad);
+    const int idx = mad24(y, b_ncols, x);
+    out[idx] = bitmapped_runs(local_img + lidx, padded_ncols, local_runs, se_nfgruns, 1)
+      & ~bitmapped_runs(local_img + lidx, padded_ncols, local_runs + se_nfgruns * 3,
+                        se_nbgruns, 0);
+  }
+}
+
+// 3x3 SEs given as two 9 bit masks, bit (row + 1) * 3 + (col + 1) for the
+// pixel at (row, col). w points to the center word of a tile row.
+uint bitmapped_hitormiss3x3_word(local const uint * w, const int padded_ncols,
+                                 const int fg, const int bg)
+{
+  uint acc = 0xFFFFFFFF;
+  for (int r = 0; r < 3; ++r)
+  {
+    local const uint * wr = w + (r - 1) * padded_ncols;
+    const uint n[3] = { (wr[0] >> 1) | (wr[-1] << 31),
+                        wr[0],
+                        (wr[0] << 1) | (wr[1] >> 31) };
+    for (int c = 0; c < 3; ++c)
+    {
+      const int bit = 1 << (r * 3 + c);
+      if (fg & bit)
+        acc &= n[c];
+      if (bg & bit)
+        acc &= ~n[c];
+    }
+  }
+  return acc;
+}
+
+// local_img is (lysize + 2) * (lxsize + 2)
+void bitmapped_hitormiss3x3_common(global const int * in, global int * out,
+                                   const int nrows, const int ncols,
+                                   const int fg, const int bg,
+                                   global int * changed, local uint * local_img)
+{
+  const int x = get_global_id(0);
+  const int y = get_global_id(1);
+  const int lx = get_local_id(0);
+  const int ly = get_local_id(1);
+  const int lxsize = get_local_size(0);
+  const int lysize = get_local_size(1);
+  const int b_ncols = ncols >> 5;
+
+  const int corner_x = get_group_id(0) * lxsize - 1;
+  const int corner_y = get_group_id(1) * lysize - 1;
+
+  const int thread_idx = mad24(ly, lxsize, lx);
+  const int nb_threads = lxsize * lysize;
+
+  const int padded_nrows = lysize + 2;
+  const int padded_ncols = lxsize + 2;
+
+  const int size = padded_nrows * padded_ncols;
+
+  // Copy subimage to local memory
+  for (int i = thread_idx; i < size; i += nb_threads)
+  {
+    const int div = i / padded_ncols;
+    const int rect_row = div + corner_y;
+    const int rect_col = i - div * padded_ncols + corner_x;
+
+    if (rect_row < 0 || rect_row >= nrows || rect_col < 0 || rect_col >= b_ncols)
+    {
+      local_img[i] = 0;
+    }
+    else
+    {
+      const int pidx = mad24(rect_row, b_ncols, rect_col);
+      local_img[i] = in[pidx];
+    }
+  }
+  barrier(CLK_LOCAL_MEM_FENCE);
+
+  // Bail out if we are outside the image
+  if (x >= b_ncols || y >= nrows)
+    return;
+
+  {
+    const int lidx = mad24(padded_ncols, ly + 1, lx + 1);
+    const int idx = mad24(y, b_ncols, x);
+    const uint hit = bitmapped_hitormiss3x3_word(local_img + lidx, padded_ncols, fg, bg);
+    if (changed)
+    {
+      // Thinning: remove the matching pixels. Every writer stores the same
+      // value, no need for an atomic operation.
+      out[idx] = local_img[lidx] & ~hit;
+      if (local_img[lidx] & hit)
+        *changed = 1;
+    }
+    else
+      out[idx] = hit;
+  }
+}
+
+kernel void bitmapped_hitormiss3x3(global const int * in, global int * out,
+                                   const int nrows, const int ncols,
+                                   const int fg, const int bg,
+                                   local uint * local_img)
+{
+  bitmapped_hitormiss3x3_common(in, out, nrows, ncols, fg, bg, 0, local_img);
+}
+
+kernel void bitmapped_thinning3x3(global const int * in, global int * out,
+                                  const int nrows, const int ncols,
+                                  const int fg, const int bg,
+                                  global int * changed, local uint * local_img)
+{
+  bitmapped_hitormiss3x3_common(in, out, nrows, ncols, fg, bg, changed, local_img);
+}
+#endif
+
+#ifdef CLCV_SECTION_RECONSTRUCT
+// Geodesic reconstruction by dilation
+
+// Pixels of mask connected to seed along the row, within a word
+// (Kogge-Stone occluded fill in both directions)
+uint bitmapped_fill_word(const uint seed, const uint mask)
+{
+  uint r = seed & mask;
+  uint l = r;
+  uint pr = mask;
+  uint pl = mask;
+  for (int s = 1; s < 32; s *= 2)
+  {
+    r |= pr & (r >> s);
+    pr &= pr >> s;
+    l |= pl & (l << s);
+    pl &= pl << s;
+  }
+  return r | l;
+}
+
+// One launch propagates the marker inside the work group tile until it is
+// stable, the apron being the marker from the previous launch. The marker
+// must be included in the mask (see push_bitmapped_reconstruct). changed is
+// set when a word differs from the input marker, the host relaunches until
+// it isn't. local_img is (lysize + 2) * (lxsize + 2), local_flag one int.
+kernel void bitmapped_reconstruct(global const int * marker, global int * out,
+                                  global const int * mask,
+                                  const int nrows, const int ncols,
+                                  global int * changed,
+                                  local uint * local_img, local int * local_flag)
+{
+  const int x = get_global_id(0);
+  const int y = get_global_id(1);
+  const int lx = get_local_id(0);
+  const int ly = get_local_id(1);
+  const int lxsize = get_local_size(0);
+  const int lysize = get_local_size(1);
+  const int b_ncols = ncols >> 5;
+
+  const int corner_x = get_group_id(0) * lxsize - 1;
+  const int corner_y = get_group_id(1) * lysize - 1;
+
+  const int thread_idx = mad24(ly, lxsize, lx);
+  const int nb_threads = lxsize * lysize;
+
+  const int padded_nrows = lysize + 2;
+  const int padded_ncols = lxsize + 2;
+
+  const int lidx = mad24(padded_ncols, ly + 1, lx + 1);
+  const int idx = mad24(y, b_ncols, x);
+
+  const int size = padded_nrows * padded_ncols;
+
+  // Copy subimage to local memory
+  for (int i = thread_idx; i < size; i += nb_threads)
+  {
+    const int div = i / padded_ncols;
+    const int rect_row = div + corner_y;
+    const int rect_col = i - div * padded_ncols + corner_x;
+
+    if (rect_row < 0 || rect_row >= nrows || rect_col < 0 || rect_col >= b_ncols)
+    {
+      local_img[i] = 0;
+    }
+    else
+    {
+      const int pidx = mad24(rect_row, b_ncols, rect_col);
+      local_img[i] = marker[pidx];
+    }
+  }
+  barrier(CLK_LOCAL_MEM_FENCE);
+
+  // Threads outside the image still take part in the barriers
+  const int inside = x < b_ncols && y < nrows;
+  const uint m = inside ? mask[idx] : 0;
+  const uint orig = local_img[lidx];
+
+  for (;;)
+  {
+    if (thread_idx == 0)
+      *local_flag = 0;
+
+    const uint v = local_img[lidx];
+    uint acc = v;
+    for (int r = -1; r <= 1; ++r)
+    {
+      local const uint * w = local_img + lidx + r * padded_ncols;
+      acc |= w[0] | (w[0] >> 1) | (w[-1] << 31) | (w[0] << 1) | (w[1] >> 31);
+    }
+    const uint nv = bitmapped_fill_word(acc, m);
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    if (nv != v)
+    {
+      local_img[lidx] = nv;
+      *local_flag = 1;
+    }
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    const int again = *local_flag;
+    barrier(CLK_LOCAL_MEM_FENCE);
+    if (!again)
+      break;
+  }
+
+  if (!inside)
+    return;
+  out[idx] = local_img[lidx];
+  // Every writer stores the same value, no need for an atomic operation
+  if (local_img[lidx] != orig)
+    *changed = 1;
+}
+#endif
+
+#ifdef CLCV_SECTION_BITMAP
+// Seeds for the border related reconstructions: mask is the image (its
+// complement with invert), marker the pixels of mask on the image border
+kernel void bitmapped_border_marker(global const int * in,
+                                    global int * marker, global int * mask,
+                                    const int nrows, const int ncols,
+                                    const int invert)
+{
+  const int x = get_global_id(0);
+  const int y = get_global_id(1);
+  const int b_ncols = ncols >> 5;
+
+  if (x >= b_ncols || y >= nrows)
+    return;
+
+  const int idx = mad24(y, b_ncols, x);
+  const uint m = invert ? ~in[idx] : in[idx];
+  uint border = y == 0 || y == nrows - 1 ? 0xFFFFFFFF : 0;
+  if (x == 0)
+    border |= 0x80000000;
+  if (x == b_ncols - 1)
+    border |= 1;
+  mask[idx] = m;
+  marker[idx] = m & border;
+}
+#endif
+
+#ifdef CLCV_SECTION_GRAY_OP
+// Grayscale (min/max) morphology with flat SEs
+// Pixels outside the image are ignored, i.e. they are +inf for the
+// erosions and -inf for the dilations.
+
+int gray_op(const int a, const int b, const int erosion)
+{
+  return erosion ? min(a, b) : max(a, b);
+}
+#endif
+
+#ifdef CLCV_SECTION_GRAY
+// van Herk/Gil-Werman, first pass: running min/max from the start (g) and
+// from the end (h) of each block of 2 * se_rad + 1 pixels of a line (a row,
+// or a column when vertical). One thread per block, the blocks are along the
+// first dimension for the rows and along the second one for the columns.
+kernel void gray_vhgw_scan(global const int * in, global int * g, global int * h,
+                           const int nrows, const int ncols,
+                           const int se_rad, const int vertical, const int erosion)
+{
+  const int block = get_global_id(vertical ? 1 : 0);
+  const int line = get_global_id(vertical ? 0 : 1);
+  const int len = vertical ? nrows : ncols;
+  const int nlines = vertical ? ncols : nrows;
+  const int k = se_rad * 2 + 1;
+
+  if (line >= nlines || block * k >= len)
+    return;
+
+  const int step = vertical ? ncols : 1;
+  const int first = block * k;
+  const int last = min(first + k, len) - 1;
+  int idx = vertical ? mad24(first, ncols, line) : mad24(line, ncols, first);
+  int acc = in[idx];
+  g[idx] = acc;
+  for (int i = first + 1; i <= last; ++i)
+  {
+    idx += step;
+    acc = gray_op(acc, in[idx], erosion);
+    g[idx] = acc;
+  }
+  acc = in[idx];
+  h[idx] = acc;
+  for (int i = last - 1; i >= first; --i)
+  {
+    idx -= step;
+    acc = gray_op(acc, in[idx], erosion);
+    h[idx] = acc;
+  }
+}
+
+// Second pass: one thread per pixel, the window [lo, hi] spans at most two
+// blocks
+kernel void gray_vhgw_merge(global const int * g, global const int * h, global int * out,
+                            const int nrows, const int ncols,
+                            const int se_rad, const int vertical, const int erosion)
+{
+  const int x = get_global_id(0);
+  const int y = get_global_id(1);
+
+  if (x >= ncols || y >= nrows)
+    return;
+
+  const int pos = vertical ? y : x;
+  const int len = vertical ? nrows : ncols;
+  const int k = se_rad * 2 + 1;
+  const int lo = max(pos - se_rad, 0);
+  const int hi = min(pos + se_rad, len - 1);
+  const int lo_idx = vertical ? mad24(lo, ncols, x) : mad24(y, ncols, lo);
+  const int hi_idx = vertical ? mad24(hi, ncols, x) : mad24(y, ncols, hi);
+  const int idx = mad24(y, ncols, x);
+
+  if (lo / k != hi / k)
+    out[idx] = gray_op(h[lo_idx], g[hi_idx], erosion);
+  else
+    out[idx] = lo % k == 0 ? g[hi_idx] : h[lo_idx];
+}
+
+// Any flat SE (the points of the SE, whatever their weights), same layout as
+// naive_morph
+kernel void gray_morph(global const int * in, global int * out,
+                       const int nrows, const int ncols,
+                       global int * se, const int se_rowrad, const int se_colrad,
+                       const int se_count, const int erosion,
+                       local int * local_se,
+                       local int * local_img)
+{
+  const int x = get_global_id(0);
+  const int y = get_global_id(1);
+  const int lx = get_local_id(0);
+  const int ly = get_local_id(1);
+  const int lxsize = get_local_size(0);
+  const int lysize = get_local_size(1);
+  const int corner_x = get_group_id(0) * lxsize - se_colrad;
+  const int corner_y = get_group_id(1) * lysize - se_rowrad;
+
+  const int thread_idx = mad24(ly, lxsize, lx);
+  const int nb_threads = lxsize * lysize;
+
+  const int se_size = se_count * 2 + se_count;
+
+  const int padded_nrows = lysize + se_rowrad * 2;
+  const int padded_ncols = lxsize + se_colrad * 2;
+
+  const int size = padded_nrows * padded_ncols;
+  const int outside = erosion ? INT_MAX : INT_MIN;
+
+  // Copy the SE and the sub image into the local memory
+  memcpy2local(local_se, se, se_size, thread_idx, nb_threads);
+  for (int i = thread_idx; i < size; i += nb_threads)
+  {
+    const int div = i / padded_ncols;
+    const int rect_row = div + corner_y;
+    const int rect_col = i - div * padded_ncols + corner_x;
+
+    if (rect_row < 0 || rect_row >= nrows || rect_col < 0 || rect_col >= ncols)
+      local_img[i] = outside;
+    else
+      local_img[i] = in[mad24(rect_row, ncols, rect_col)];
+  }
+  barrier(CLK_LOCAL_MEM_FENCE);
+
+  if (x >= ncols || y >= nrows)
+    return;
+
+  const int lidx = mad24(padded_ncols, ly + se_rowrad, lx + se_colrad);
+  int acc = outside;
+  for (int i = 0; i < se_size; i += 3)
+  {
+    const int ridx = mad24(padded_ncols, local_se[i], lidx + local_se[i+1]);
+    acc = gray_op(acc, local_img[ridx], erosion);
+  }
+  out[mad24(y, ncols, x)] = acc;
+}
+#endif
+
+// Connected component labeling of bitmaps (8-connexity)
+// The nodes of the union-find are the runs of set bits inside each word,
+// identified by the index of their first pixel. The roots are always the
+// smallest index, i.e. the first run of the component in raster order.
+
+// Only the sections using atomics require the extensions
+#if defined(CLCV_SECTION_LABEL) || defined(CLCV_SECTION_AREA) \
+  || defined(CLCV_SECTION_BITMAP) || defined(CLCV_SECTION_GRAY_RECONSTRUCT)
+# pragma OPENCL EXTENSION cl_khr_global_int32_base_atomics : enable
+# pragma OPENCL EXTENSION cl_khr_global_int32_extended_atomics : enable
+# pragma OPENCL EXTENSION cl_khr_local_int32_extended_atomics : enable
+#endif
+
+#ifdef CLCV_SECTION_LABEL
+// Starts of the runs of a word (pos 0 is the MSB). Two starts are at least
+// two positions apart, so pos / 2 numbers the runs of a word.
+uint bitmapped_starts(const uint w)
+{
+  return w & ~(w >> 1);
+}
+
+// Positions >= pos
+uint bitmapped_from(const int pos)
+{
+  return pos >= 32 ? 0 : 0xFFFFFFFF >> pos;
+}
+
+// First position of the run containing pos
+int bitmapped_run_begin(const uint w, const int pos)
+{
+  const uint zeros = ~w & ~bitmapped_from(pos);
+  return zeros ? clz(zeros & -zeros) + 1 : 0;
+}
+
+// Position following the run containing pos
+int bitmapped_run_end(const uint w, const int pos)
+{
+  const uint zeros = ~w & bitmapped_from(pos);
+  return zeros ? clz(zeros) : 32;
+}
+
+// Start of the run numbered j (see bitmapped_starts)
+int bitmapped_run_start(const uint w, const int j)
+{
+  return (bitmapped_starts(w) & (0x80000000 >> (j * 2))) ? j * 2 : j * 2 + 1;
+}
+
+// Pairs of 8-connected runs between a word and the word above it, as
+// (start in w) << 8 | (start in up). There are fewer than 32.
+int bitmapped_label_pairs(const uint w, const uint up, int * pairs)
+{
+  int n = 0;
+  uint starts = bitmapped_starts(w);
+  while (starts)
+  {
+    const int begin = clz(starts);
+    const int end = bitmapped_run_end(w, begin);
+    uint m = up & bitmapped_from(max(begin - 1, 0)) & ~bitmapped_from(min(end + 1, 32));
+    while (m)
+    {
+      const int q = clz(m);
+      pairs[n++] = (begin << 8) | bitmapped_run_begin(up, q);
+      m &= bitmapped_from(bitmapped_run_end(up, q));
+    }
+    starts &= bitmapped_from(end);
+  }
+  return n;
+}
+
+// The components of the 0 pixels when inverted
+uint bitmapped_label_word(global const int * in, const int idx, const int inverted)
+{
+  return inverted ? ~in[idx] : in[idx];
+}
+
+int bitmapped_label_find_local(volatile local int * parent, int x)
+{
+  int p = parent[x];
+  while (p != x)
+  {
+    x = p;
+    p = parent[x];
+  }
+  return x;
+}
+
+// Hook the larger root under the smaller one. When another thread hooked
+// it first, retry from where it was hooked.
+void bitmapped_label_union_local(volatile local int * parent, int a, int b)
+{
+  for (;;)
+  {
+    a = bitmapped_label_find_local(parent, a);
+    b = bitmapped_label_find_local(parent, b);
+    if (a == b)
+      return;
+    if (a > b)
+    {
+      const int t = a;
+      a = b;
+      b = t;
+    }
+    const int old = atomic_min(&parent[b], a);
+    if (old == b)
+      return;
+    b = old;
+  }
+}
+
+int bitmapped_label_find(volatile global int * parent, int x)
+{
+  int p = parent[x];
+  while (p != x)
+  {
+    x = p;
+    p = parent[x];
+  }
+  return x;
+}
+
+void bitmapped_label_union(volatile global int * parent, int a, int b)
+{
+  for (;;)
+  {
+    a = bitmapped_label_find(parent, a);
+    b = bitmapped_label_find(parent, b);
+    if (a == b)
+      return;
+    if (a > b)
+    {
+      const int t = a;
+      a = b;
+      b = t;
+    }
+    const int old = atomic_min(&parent[b], a);
+    if (old == b)
+      return;
+    b = old;
+  }
+}
+
+// First pass: one thread per word, merge the runs of the tile in local
+// memory (local_parent holds 16 nodes per word), then store the local roots
+// in the global parent array (one entry per pixel, only the run starts are
+// written).
+kernel void bitmapped_label_local(global const int * in, global int * parent,
+                                  const int nrows, const int ncols, const int inverted,
+                                  local int * local_img,
+                                  volatile local int * local_parent)
+{
+  const int x = get_global_id(0);
+  const int y = get_global_id(1);
+  const int lx = get_local_id(0);
+  const int ly = get_local_id(1);
+  const int lxsize = get_local_size(0);
+  const int b_ncols = ncols / 32;
+  const int lw = mad24(ly, lxsize, lx);
+
+  const uint w = x < b_ncols && y < nrows ? bitmapped_label_word(in, mad24(y, b_ncols, x), inverted) : 0;
+  local_img[lw] = w;
+  for (int j = 0; j < 16; ++j)
+    local_parent[lw * 16 + j] = lw * 16 + j;
+  barrier(CLK_LOCAL_MEM_FENCE);
+
+  if (lx > 0 && (w & 0x80000000) && (local_img[lw - 1] & 1))
+    bitmapped_label_union_local(local_parent, lw * 16,
+                                (lw - 1) * 16 + bitmapped_run_begin(local_img[lw - 1], 31) / 2);
+  if (ly > 0)
+  {
+    const int up = lw - lxsize;
+    int pairs[32];
+    const int n = bitmapped_label_pairs(w, local_img[up], pairs);
+    for (int i = 0; i < n; ++i)
+      bitmapped_label_union_local(local_parent, lw * 16 + (pairs[i] >> 8) / 2,
+                                  up * 16 + (pairs[i] & 0xFF) / 2);
+    if (lx > 0 && (w & 0x80000000) && (local_img[up - 1] & 1))
+      bitmapped_label_union_local(local_parent, lw * 16,
+                                  (up - 1) * 16 + bitmapped_run_begin(local_img[up - 1], 31) / 2);
+    if (lx < lxsize - 1 && (w & 1) && (local_img[up + 1] & 0x80000000))
+      bitmapped_label_union_local(local_parent, lw * 16 + bitmapped_run_begin(w, 31) / 2,
+                                  (up + 1) * 16);
+  }
+  barrier(CLK_LOCAL_MEM_FENCE);
+
+  if (x >= b_ncols || y >= nrows)
+    return;
+
+  const int corner_x = get_group_id(0) * lxsize;
+  const int corner_y = get_group_id(1) * get_local_size(1);
+  uint starts = bitmapped_starts(w);
+  while (starts)
+  {
+    const int begin = clz(starts);
+    starts &= ~(0x80000000 >> begin);
+    const int root = bitmapped_label_find_local(local_parent, lw * 16 + begin / 2);
+    const int rw = root / 16;
+    const int rdiv = rw / lxsize;
+    const int rx = corner_x + rw - rdiv * lxsize;
+    const int ry = corner_y + rdiv;
+    parent[mad24(y, ncols, x * 32 + begin)] =
+      mad24(ry, ncols, rx * 32 + bitmapped_run_start(local_img[rw], root % 16));
+  }
+}
+
+// Second pass: same geometry, merge the runs across the tile borders
+kernel void bitmapped_label_merge(global const int * in, volatile global int * parent,
+                                  const int nrows, const int ncols, const int inverted)
+{
+  const int x = get_global_id(0);
+  const int y = get_global_id(1);
+  const int lx = get_local_id(0);
+  const int ly = get_local_id(1);
+  const int lxsize = get_local_size(0);
+  const int b_ncols = ncols / 32;
+
+  if (x >= b_ncols || y >= nrows)
+    return;
+
+  const int idx = mad24(y, b_ncols, x);
+  const uint w = bitmapped_label_word(in, idx, inverted);
+  if (!w)
+    return;
+
+  const int base = mad24(y, ncols, x * 32);
+  if (lx == 0 && x > 0 && (w & 0x80000000))
+  {
+    const uint left = bitmapped_label_word(in, idx - 1, inverted);
+    if (left & 1)
+      bitmapped_label_union(parent, base, base - 32 + bitmapped_run_begin(left, 31));
+  }
+  if (y > 0)
+  {
+    const int up = idx - b_ncols;
+    const int up_base = base - ncols;
+    if (ly == 0)
+    {
+      int pairs[32];
+      const int n = bitmapped_label_pairs(w, bitmapped_label_word(in, up, inverted), pairs);
+      for (int i = 0; i < n; ++i)
+        bitmapped_label_union(parent, base + (pairs[i] >> 8), up_base + (pairs[i] & 0xFF));
+    }
+    if ((ly == 0 || lx == 0) && x > 0 && (w & 0x80000000))
+    {
+      const uint up_left = bitmapped_label_word(in, up - 1, inverted);
+      if (up_left & 1)
+        bitmapped_label_union(parent, base, up_base - 32 + bitmapped_run_begin(up_left, 31));
+    }
+    if ((ly == 0 || lx == lxsize - 1) && x < b_ncols - 1 && (w & 1))
+    {
+      const uint up_right = bitmapped_label_word(in, up + 1, inverted);
+      if (up_right & 0x80000000)
+        bitmapped_label_union(parent, base + bitmapped_run_begin(w, 31), up_base + 32);
+    }
+  }
+}
+
+// Last pass: one thread per pixel, the label is 1 + the index of the first
+// pixel of the component in raster order, 0 for the background
+kernel void bitmapped_label_final(global const int * in, volatile global int * parent,
+                                  global int * labels,
+                                  const int nrows, const int ncols, const int inverted)
+{
+  const int x = get_global_id(0);
+  const int y = get_global_id(1);
+
+  if (x >= ncols || y >= nrows)
+    return;
+
+  const int b_ncols = ncols / 32;
+  const uint w = bitmapped_label_word(in, mad24(y, b_ncols, x / 32), inverted);
+  const int pos = x & 31;
+  const int idx = mad24(y, ncols, x);
+
+  if (!(w & (0x80000000 >> pos)))
+    labels[idx] = 0;
+  else
+    labels[idx] = bitmapped_label_find(parent, idx - pos + bitmapped_run_begin(w, pos)) + 1;
+}
+#endif
+
+#ifdef CLCV_SECTION_EDT
+// Exact Euclidean distance transform (Meijster, Roerdink and Hesselink),
+// squared distances to the nearest target pixel: the 0 pixels, or the 1
+// pixels when inverted. Without any target the distances are at least
+// (nrows + ncols)^2.
+
+int edt_is_target(global const int * in, const int y, const int x, const int ncols,
+                  const int bitmapped, const int inverted)
+{
+  const int v = bitmapped ?
+    (in[mad24(y, ncols / 32, x / 32)] >> (31 - (x & 31))) & 1
+    : in[mad24(y, ncols, x)] != 0;
+  return v == inverted;
+}
+
+// First pass: one thread per column, distance to the nearest target of the
+// column
+kernel void edt_columns(global const int * in, global int * g,
+                        const int nrows, const int ncols,
+                        const int bitmapped, const int inverted)
+{
+  const int x = get_global_id(0);
+
+  if (x >= ncols)
+    return;
+
+  const int inf = nrows + ncols;
+  int d = inf;
+  for (int y = 0; y < nrows; ++y)
+  {
+    d = edt_is_target(in, y, x, ncols, bitmapped, inverted) ? 0 : min(d + 1, inf);
+    g[mad24(y, ncols, x)] = d;
+  }
+  for (int y = nrows - 2; y >= 0; --y)
+  {
+    const int idx = mad24(y, ncols, x);
+    d = min(d + 1, inf);
+    if (d < g[idx])
+      g[idx] = d;
+    else
+      d = g[idx];
+  }
+}
+
+// Second pass: one thread per row, lower envelope of the parabolas
+// (x - i)^2 + g(i)^2. The stack of parabolas (s) and of the positions where
+// they start to be the lowest one (t) are stored by column, so that the
+// threads access consecutive addresses.
+kernel void edt_rows(global const int * g, global int * out,
+                     global int * s, global int * t,
+                     const int nrows, const int ncols)
+{
+  const int y = get_global_id(0);
+
+  if (y >= nrows)
+    return;
+
+  global const int * gy = g + y * ncols;
+  int q = 0;
+  s[y] = 0;
+  t[y] = 0;
+  for (int u = 1; u < ncols; ++u)
+  {
+    const int gu = gy[u] * gy[u];
+    while (q >= 0)
+    {
+      const int sq = s[mad24(q, nrows, y)];
+      const int tq = t[mad24(q, nrows, y)];
+      if ((tq - sq) * (tq - sq) + gy[sq] * gy[sq] <= (tq - u) * (tq - u) + gu)
+        break;
+      --q;
+    }
+    if (q < 0)
+    {
+      q = 0;
+      s[y] = u;
+    }
+    else
+    {
+      const int sq = s[mad24(q, nrows, y)];
+      const int w = 1 + (u * u - sq * sq + gu - gy[sq] * gy[sq]) / (2 * (u - sq));
+      if (w < ncols)
+      {
+        ++q;
+        s[mad24(q, nrows, y)] = u;
+        t[mad24(q, nrows, y)] = w;
+      }
+    }
+  }
+  for (int u = ncols - 1; u >= 0; --u)
+  {
+    const int sq = s[mad24(q, nrows, y)];
+    out[mad24(y, ncols, u)] = (u - sq) * (u - sq) + gy[sq] * gy[sq];
+    if (u == t[mad24(q, nrows, y)])
+      --q;
+  }
+}
+
+// Disks of radius r from the squared distance maps: the dilation keeps the
+// pixels whose nearest 1 pixel is within r, the erosion those whose nearest
+// 0 pixel, inside or outside the image, is farther than r.
+int edt_disk(const int d, const int y, const int x, const int nrows, const int ncols,
+             const int sqrad, const int erosion)
+{
+  if (!erosion)
+    return d <= sqrad;
+  const int border = min(min(y, nrows - 1 - y), min(x, ncols - 1 - x)) + 1;
+  return d > sqrad && border * border > sqrad;
+}
+
+kernel void edt_threshold(global const int * in, global int * out,
+                          const int nrows, const int ncols,
+                          const int sqrad, const int erosion)
+{
+  const int x = get_global_id(0);
+  const int y = get_global_id(1);
+
+  if (x >= ncols || y >= nrows)
+    return;
+
+  const int idx = mad24(y, ncols, x);
+  out[idx] = edt_disk(in[idx], y, x, nrows, ncols, sqrad, erosion);
+}
+
+// Same thing, one thread per word of the output bitmap
+kernel void bitmapped_edt_threshold(global const int * in, global int * out,
+                                    const int nrows, const int ncols,
+                                    const int sqrad, const int erosion)
+{
+  const int x = get_global_id(0);
+  const int y = get_global_id(1);
+  const int b_ncols = ncols / 32;
+
+  if (x >= b_ncols || y >= nrows)
+    return;
+
+  global const int * d = in + mad24(y, ncols, x * 32);
+  uint w = 0;
+  for (int i = 0; i < 32; ++i)
+    w = (w << 1) | edt_disk(d[i], y, x * 32 + i, nrows, ncols, sqrad, erosion);
+  out[mad24(y, b_ncols, x)] = w;
+}
+#endif
+
+#ifdef CLCV_SECTION_AREA
+// Area opening: the areas (indexed by label - 1) are reset at the first
+// pixel of each component, then counted
+kernel void label_area_reset(global const int * labels, global int * areas,
+                             const int nrows, const int ncols)
+{
+  const int x = get_global_id(0);
+  const int y = get_global_id(1);
+
+  if (x >= ncols || y >= nrows)
+    return;
+
+  const int idx = mad24(y, ncols, x);
+  if (labels[idx] == idx + 1)
+    areas[idx] = 0;
+}
+
+kernel void label_area_count(global const int * labels, volatile global int * areas,
+                             const int nrows, const int ncols)
+{
+  const int x = get_global_id(0);
+  const int y = get_global_id(1);
+
+  if (x >= ncols || y >= nrows)
+    return;
+
+  const int label = labels[mad24(y, ncols, x)];
+  if (label)
+    atomic_inc(&areas[label - 1]);
+}
+
+// One thread per word, keep the pixels of the components of at least
+// min_area pixels. When the labels are those of the 0 pixels (inverted),
+// fill the smaller components instead.
+kernel void bitmapped_area_filter(global const int * labels, global const int * areas,
+                                  global int * out,
+                                  const int nrows, const int ncols,
+                                  const int min_area, const int inverted)
+{
+  const int x = get_global_id(0);
+  const int y = get_global_id(1);
+  const int b_ncols = ncols / 32;
+
+  if (x >= b_ncols || y >= nrows)
+    return;
+
+  global const int * l = labels + mad24(y, ncols, x * 32);
+  uint w = 0;
+  for (int i = 0; i < 32; ++i)
+    w = (w << 1) | (l[i] && areas[l[i] - 1] >= min_area);
+  out[mad24(y, b_ncols, x)] = inverted ? ~w : w;
+}
+#endif
+
+#ifdef CLCV_SECTION_BITMAP
+// Number of set bits (popcount is OpenCL 1.2)
+int bitcount(uint w)
+{
+  w = w - ((w >> 1) & 0x55555555);
+  w = (w & 0x33333333) + ((w >> 2) & 0x33333333);
+  w = (w + (w >> 4)) & 0x0F0F0F0F;
+  return (w * 0x01010101) >> 24;
+}
+
+// Add the number of set pixels of a bitmap of size words to counts[index].
+// Each thread sums a strided part of the bitmap, then each work-group
+// reduces in local memory (the local size must be a power of 2) and adds
+// its total with one atomic.
+kernel void bitmapped_count(global const int * in, volatile global int * counts,
+                            const int size, const int index,
+                            local int * local_sum)
+{
+  const int lid = get_local_id(0);
+  const int lsize = get_local_size(0);
+
+  int sum = 0;
+  for (int i = get_global_id(0); i < size; i += get_global_size(0))
+    sum += bitcount(in[i]);
+  local_sum[lid] = sum;
+  barrier(CLK_LOCAL_MEM_FENCE);
+
+  for (int s = lsize / 2; s > 0; s >>= 1)
+  {
+    if (lid < s)
+      local_sum[lid] += local_sum[lid + s];
+    barrier(CLK_LOCAL_MEM_FENCE);
+  }
+  if (lid == 0)
+    atomic_add(&counts[index], local_sum[0]);
+}
+#endif
+
+#ifdef CLCV_SECTION_SHIFT
+// Row words shifted by s pixels: pos p of the result is pos p + s of the
+// row (left, w, right), -32 <= s <= 32
+uint bitmapped_shift(const uint left, const uint w, const uint right, const int s)
+{
+  if (s == 0)
+    return w;
+  if (s >= 32)
+    return right;
+  if (s <= -32)
+    return left;
+  return s > 0 ? (w << s) | (right >> (32 - s)) : (w >> -s) | (left << (32 + s));
+}
+#endif
+
+#ifdef CLCV_SECTION_DIAG
+// Diagonal segments (se_rad <= 32): row y + k is shifted by k pixels along
+// (1, 1) (dir 1), or by -k pixels along (1, -1) (dir -1)
+void bitmapped_morph_diag(global const int * in, global int * out,
+                          const int nrows, const int ncols,
+                          const int se_rad, const int dir, const int erosion,
+                          local uint * local_img)
+{
+  const int x = get_global_id(0);
+  const int y = get_global_id(1);
+  const int lx = get_local_id(0);
+  const int ly = get_local_id(1);
+  const int lxsize = get_local_size(0);
+  const int lysize = get_local_size(1);
+  const int b_ncols = ncols >> 5;
+
+  const int corner_x = get_group_id(0) * lxsize - 1;
+  const int corner_y = get_group_id(1) * lysize - se_rad;
+
+  const int thread_idx = mad24(ly, lxsize, lx);
+  const int nb_threads = lxsize * lysize;
+
+  const int padded_nrows = lysize + se_rad * 2;
+  const int padded_ncols = lxsize + 2;
+
+  const int lidx = mad24(padded_ncols, ly + se_rad, lx + 1);
+  const int size = padded_nrows * padded_ncols;
+
+  for (int i = thread_idx; i < size; i += nb_threads)
+  {
+    const int div = i / padded_ncols;
+    const int rect_row = div + corner_y;
+    const int rect_col = i - div * padded_ncols + corner_x;
+
+    if (rect_row < 0 || rect_row >= nrows || rect_col < 0 || rect_col >= b_ncols)
+      local_img[i] = 0;
+    else
+      local_img[i] = in[mad24(rect_row, b_ncols, rect_col)];
+  }
+  barrier(CLK_LOCAL_MEM_FENCE);
+
+  if (x >= b_ncols || y >= nrows)
+    return;
+
+  uint acc = erosion ? 0xFFFFFFFF : 0;
+  for (int k = -se_rad; k <= se_rad; ++k)
+  {
+    const int l = mad24(k, padded_ncols, lidx);
+    const uint s = bitmapped_shift(local_img[l - 1], local_img[l], local_img[l + 1], k * dir);
+    acc = erosion ? acc & s : acc | s;
+  }
+  out[mad24(y, b_ncols, x)] = acc;
+}
+
+kernel void bitmapped_dilation_diag(global const int * in, global int * out,
+                                    const int nrows, const int ncols,
+                                    const int se_rad, const int dir,
+                                    local uint * local_img)
+{
+  bitmapped_morph_diag(in, out, nrows, ncols, se_rad, dir, 0, local_img);
+}
+
+kernel void bitmapped_erosion_diag(global const int * in, global int * out,
+                                   const int nrows, const int ncols,
+                                   const int se_rad, const int dir,
+                                   local uint * local_img)
+{
+  bitmapped_morph_diag(in, out, nrows, ncols, se_rad, dir, 1, local_img);
+}
+#endif
+
+#ifdef CLCV_SECTION_MORPH_3X3
+// 3x3 SEs: the 4-connexity cross, which fills the holes of the sums of
+// diagonal segments, or the 8-connexity square. w points to the center word
+// of a tile with a one word apron.
+uint bitmapped_morph_3x3_word(local const uint * w, const int padded_ncols,
+                              const int c8, const int erosion)
+{
+  uint acc = erosion ? 0xFFFFFFFF : 0;
+  for (int r = -1; r <= 1; ++r)
+  {
+    local const uint * wr = w + r * padded_ncols;
+    uint row = wr[0];
+    if (c8 || r == 0)
+    {
+      const uint left = bitmapped_shift(wr[-1], wr[0], wr[1], -1);
+      const uint right = bitmapped_shift(wr[-1], wr[0], wr[1], 1);
+      row = erosion ? left & row & right : left | row | right;
+    }
+    acc = erosion ? acc & row : acc | row;
+  }
+  return acc;
+}
+
+void bitmapped_morph_3x3(global const int * in, global int * out,
+                         const int nrows, const int ncols,
+                         const int c8, const int erosion,
+                         local uint * local_img)
+{
+  const int x = get_global_id(0);
+  const int y = get_global_id(1);
+  const int lx = get_local_id(0);
+  const int ly = get_local_id(1);
+  const int lxsize = get_local_size(0);
+  const int lysize = get_local_size(1);
+  const int b_ncols = ncols >> 5;
+
+  const int corner_x = get_group_id(0) * lxsize - 1;
+  const int corner_y = get_group_id(1) * lysize - 1;
+
+  const int thread_idx = mad24(ly, lxsize, lx);
+  const int nb_threads = lxsize * lysize;
+
+  const int padded_ncols = lxsize + 2;
+  const int lidx = mad24(padded_ncols, ly + 1, lx + 1);
+  const int size = (lysize + 2) * padded_ncols;
+
+  for (int i = thread_idx; i < size; i += nb_threads)
+  {
+    const int div = i / padded_ncols;
+    const int rect_row = div + corner_y;
+    const int rect_col = i - div * padded_ncols + corner_x;
+
+    if (rect_row < 0 || rect_row >= nrows || rect_col < 0 || rect_col >= b_ncols)
+      local_img[i] = 0;
+    else
+      local_img[i] = in[mad24(rect_row, b_ncols, rect_col)];
+  }
+  barrier(CLK_LOCAL_MEM_FENCE);
+
+  if (x >= b_ncols || y >= nrows)
+    return;
+
+  out[mad24(y, b_ncols, x)] = bitmapped_morph_3x3_word(local_img + lidx, padded_ncols,
+                                                       c8, erosion);
+}
+
+kernel void bitmapped_dilation_c4(global const int * in, global int * out,
+                                  const int nrows, const int ncols,
+                                  local uint * local_img)
+{
+  bitmapped_morph_3x3(in, out, nrows, ncols, 0, 0, local_img);
+}
+
+kernel void bitmapped_erosion_c4(global const int * in, global int * out,
+                                 const int nrows, const int ncols,
+                                 local uint * local_img)
+{
+  bitmapped_morph_3x3(in, out, nrows, ncols, 0, 1, local_img);
+}
+
+kernel void bitmapped_dilation_c8(global const int * in, global int * out,
+                                  const int nrows, const int ncols,
+                                  local uint * local_img)
+{
+  bitmapped_morph_3x3(in, out, nrows, ncols, 1, 0, local_img);
+}
+
+kernel void bitmapped_erosion_c8(global const int * in, global int * out,
+                                 const int nrows, const int ncols,
+                                 local uint * local_img)
+{
+  bitmapped_morph_3x3(in, out, nrows, ncols, 1, 1, local_img);
+}
+#endif
+
+#ifdef CLCV_SECTION_RANK
+// Rank filter on bitmaps: a pixel is set when at least rank points of the SE
+// (those of positive weight) hit set pixels. The hits of the 32 pixels of a
+// word are summed in bit sliced counters: slice j holds the bit j of the 32
+// counts, adding a word is a ripple of half adders. se_colrad <= 32, at most
+// 65535 points.
+kernel void bitmapped_rank(global const int * in, global int * out,
+                           const int nrows, const int ncols,
+                           global const int * se, const int se_rowrad,
+                           const int se_count, const int rank,
+                           local int * local_se,
+                           local uint * local_img)
+{
+  const int x = get_global_id(0);
+  const int y = get_global_id(1);
+  const int lx = get_local_id(0);
+  const int ly = get_local_id(1);
+  const int lxsize = get_local_size(0);
+  const int lysize = get_local_size(1);
+  const int b_ncols = ncols >> 5;
+
+  const int corner_x = get_group_id(0) * lxsize - 1;
+  const int corner_y = get_group_id(1) * lysize - se_rowrad;
+
+  const int thread_idx = mad24(ly, lxsize, lx);
+  const int nb_threads = lxsize * lysize;
+
+  const int se_size = se_count * 3;
+  const int padded_ncols = lxsize + 2;
+  const int lidx = mad24(padded_ncols, ly + se_rowrad, lx + 1);
+  const int size = (lysize + se_rowrad * 2) * padded_ncols;
+
+  memcpy2local(local_se, se, se_size, thread_idx, nb_threads);
+  for (int i = thread_idx; i < size; i += nb_threads)
+  {
+    const int div = i / padded_ncols;
+    const int rect_row = div + corner_y;
+    const int rect_col = i - div * padded_ncols + corner_x;
+
+    if (rect_row < 0 || rect_row >= nrows || rect_col < 0 || rect_col >= b_ncols)
+      local_img[i] = 0;
+    else
+      local_img[i] = in[mad24(rect_row, b_ncols, rect_col)];
+  }
+  barrier(CLK_LOCAL_MEM_FENCE);
+
+  if (x >= b_ncols || y >= nrows)
+    return;
+
+  int nslices = 0;
+  for (int n = se_count; n; n >>= 1)
+    ++nslices;
+
+  uint slices[16];
+  for (int j = 0; j < nslices; ++j)
+    slices[j] = 0;
+  int se_positive = 0;
+  for (int i = 0; i < se_size; i += 3)
+  {
+    if (local_se[i + 2] <= 0)
+      continue;
+    ++se_positive;
+    const int l = mad24(local_se[i], padded_ncols, lidx);
+    uint carry = bitmapped_shift(local_img[l - 1], local_img[l], local_img[l + 1], local_se[i + 1]);
+    for (int j = 0; j < nslices && carry; ++j)
+    {
+      const uint t = slices[j] & carry;
+      slices[j] ^= carry;
+      carry = t;
+    }
+  }
+
+  // counts >= rank, from the most significant slice
+  uint ge = 0;
+  uint eq = 0xFFFFFFFF;
+  for (int j = nslices - 1; j >= 0; --j)
+  {
+    if ((rank >> j) & 1)
+      eq &= slices[j];
+    else
+    {
+      ge |= eq & slices[j];
+      eq &= ~slices[j];
+    }
+  }
+  // The slices only hold the low bits of rank
+  out[mad24(y, b_ncols, x)] = rank > se_positive ? 0 : rank <= 0 ? 0xFFFFFFFF : ge | eq;
+}
+#endif
+
+#ifdef CLCV_SECTION_LUT
+// Any 3x3 neighborhood operator, given as a 512 bit lookup table (16 words,
+// entry k is bit k & 31 of lut[k >> 5]). Entry k is indexed by the 3 rows of
+// the neighborhood from top to bottom, each as 3 bits from left (MSB) to
+// right. Changes are flagged for the iterations.
+kernel void bitmapped_lut3x3(global const int * in, global int * out,
+                             const int nrows, const int ncols,
+                             global const int * lut, global int * changed,
+                             local int * local_lut,
+                             local uint * local_img)
+{
+  const int x = get_global_id(0);
+  const int y = get_global_id(1);
+  const int lx = get_local_id(0);
+  const int ly = get_local_id(1);
+  const int lxsize = get_local_size(0);
+  const int lysize = get_local_size(1);
+  const int b_ncols = ncols >> 5;
+
+  const int corner_x = get_group_id(0) * lxsize - 1;
+  const int corner_y = get_group_id(1) * lysize - 1;
+
+  const int thread_idx = mad24(ly, lxsize, lx);
+  const int nb_threads = lxsize * lysize;
+
+  const int padded_ncols = lxsize + 2;
+  const int lidx = mad24(padded_ncols, ly + 1, lx + 1);
+  const int size = (lysize + 2) * padded_ncols;
+
+  memcpy2local(local_lut, lut, 16, thread_idx, nb_threads);
+  for (int i = thread_idx; i < size; i += nb_threads)
+  {
+    const int div = i / padded_ncols;
+    const int rect_row = div + corner_y;
+    const int rect_col = i - div * padded_ncols + corner_x;
+
+    if (rect_row < 0 || rect_row >= nrows || rect_col < 0 || rect_col >= b_ncols)
+      local_img[i] = 0;
+    else
+      local_img[i] = in[mad24(rect_row, b_ncols, rect_col)];
+  }
+  barrier(CLK_LOCAL_MEM_FENCE);
+
+  if (x >= b_ncols || y >= nrows)
+    return;
+
+  // Each row as 34 bits: the last pixel of the left word, the word, the
+  // first pixel of the right word
+  ulong rows[3];
+  for (int r = 0; r < 3; ++r)
+  {
+    const int l = mad24(r - 1, padded_ncols, lidx);
+    rows[r] = ((ulong)(local_img[l - 1] & 1) << 33) | ((ulong)local_img[l] << 1)
+      | (local_img[l + 1] >> 31);
+  }
+  uint acc = 0;
+  for (int s = 31; s >= 0; --s)
+  {
+    const int k = (int)((rows[0] >> s) & 7) << 6 | (int)((rows[1] >> s) & 7) << 3
+      | (int)((rows[2] >> s) & 7);
+    acc = (acc << 1) | ((local_lut[k >> 5] >> (k & 31)) & 1);
+  }
+  out[mad24(y, b_ncols, x)] = acc;
+  // Every writer stores the same value, no need for an atomic operation
+  if (acc != local_img[lidx])
+    *changed = 1;
+}
+#endif
+
+#ifdef CLCV_SECTION_SKELETON
+// Lantuejoul skeleton, one level: eroded is the erosion of level by the 3x3
+// SE, the opening of level its dilation. What the opening misses of level
+// joins the skeleton, its pixels get level_index + 1 in the quench function
+// (when with_quench). Level 0 initializes the skeleton and the quench
+// function. changed is set while the erosions aren't empty.
+kernel void bitmapped_skeleton(global const int * level, global const int * eroded,
+                               global int * skel, global int * quench,
+                               const int nrows, const int ncols,
+                               const int c8, const int level_index,
+                               const int with_quench, global int * changed,
+                               local uint * local_img)
+{
+  const int x = get_global_id(0);
+  const int y = get_global_id(1);
+  const int lx = get_local_id(0);
+  const int ly = get_local_id(1);
+  const int lxsize = get_local_size(0);
+  const int lysize = get_local_size(1);
+  const int b_ncols = ncols >> 5;
+
+  const int corner_x = get_group_id(0) * lxsize - 1;
+  const int corner_y = get_group_id(1) * lysize - 1;
+
+  const int thread_idx = mad24(ly, lxsize, lx);
+  const int nb_threads = lxsize * lysize;
+
+  const int padded_ncols = lxsize + 2;
+  const int lidx = mad24(padded_ncols, ly + 1, lx + 1);
+  const int size = (lysize + 2) * padded_ncols;
+
+  for (int i = thread_idx; i < size; i += nb_threads)
+  {
+    const int div = i / padded_ncols;
+    const int rect_row = div + corner_y;
+    const int rect_col = i - div * padded_ncols + corner_x;
+
+    if (rect_row < 0 || rect_row >= nrows || rect_col < 0 || rect_col >= b_ncols)
+      local_img[i] = 0;
+    else
+      local_img[i] = eroded[mad24(rect_row, b_ncols, rect_col)];
+  }
+  barrier(CLK_LOCAL_MEM_FENCE);
+
+  if (x >= b_ncols || y >= nrows)
+    return;
+
+  const int idx = mad24(y, b_ncols, x);
+  const uint opened = bitmapped_morph_3x3_word(local_img + lidx, padded_ncols, c8, 0);
+  const uint residue = level[idx] & ~opened;
+  skel[idx] = level_index == 0 ? residue : skel[idx] | residue;
+  if (with_quench && (residue || level_index == 0))
+  {
+    global int * q = quench + mad24(y, ncols, x << 5);
+    for (int i = 0; i < 32; ++i)
+      if ((residue << i) & 0x80000000)
+        q[i] = level_index + 1;
+      else if (level_index == 0)
+        q[i] = 0;
+  }
+  // Every writer stores the same value, no need for an atomic operation
+  if (local_img[lidx])
+    *changed = 1;
+}
+#endif
+
+#ifdef CLCV_SECTION_GRAY_RECONSTRUCT
+// Grayscale geodesic reconstruction (8-connexity), by dilation of a marker
+// under a mask, or by erosion of a marker above it. Hybrid algorithm: a few
+// passes propagate inside local tiles, then a FIFO of the pixels which can
+// still improve a neighbor finishes the propagation.
+
+// The geodesic step: v propagated to a neighbor of mask value m
+int gray_geodesic(const int v, const int m, const int erosion)
+{
+  return erosion ? max(v, m) : min(v, m);
+}
+
+int gray_improves(const int v, const int old, const int erosion)
+{
+  return erosion ? v < old : v > old;
+}
+
+// Propagates until the tile is stable, the apron (the neighbor tiles as of
+// the launch) doesn't change. The marker is first clipped by the mask.
+kernel void gray_reconstruct_tile(global const int * marker, global int * out,
+                                  global const int * mask,
+                                  const int nrows, const int ncols,
+                                  const int erosion,
+                                  local int * local_img, local int * local_flag)
+{
+  const int x = get_global_id(0);
+  const int y = get_global_id(1);
+  const int lx = get_local_id(0);
+  const int ly = get_local_id(1);
+  const int lxsize = get_local_size(0);
+  const int lysize = get_local_size(1);
+
+  const int corner_x = get_group_id(0) * lxsize - 1;
+  const int corner_y = get_group_id(1) * lysize - 1;
+
+  const int thread_idx = mad24(ly, lxsize, lx);
+  const int nb_threads = lxsize * lysize;
+
+  const int padded_ncols = lxsize + 2;
+  const int lidx = mad24(padded_ncols, ly + 1, lx + 1);
+  const int size = (lysize + 2) * padded_ncols;
+  const int outside = erosion ? INT_MAX : INT_MIN;
+
+  for (int i = thread_idx; i < size; i += nb_threads)
+  {
+    const int div = i / padded_ncols;
+    const int rect_row = div + corner_y;
+    const int rect_col = i - div * padded_ncols + corner_x;
+
+    if (rect_row < 0 || rect_row >= nrows || rect_col < 0 || rect_col >= ncols)
+      local_img[i] = outside;
+    else
+    {
+      const int pidx = mad24(rect_row, ncols, rect_col);
+      local_img[i] = gray_geodesic(marker[pidx], mask[pidx], erosion);
+    }
+  }
+  barrier(CLK_LOCAL_MEM_FENCE);
+
+  // Threads outside the image still take part in the barriers
+  const int inside = x < ncols && y < nrows;
+  const int idx = mad24(y, ncols, x);
+  const int m = inside ? mask[idx] : outside;
+
+  for (;;)
+  {
+    if (thread_idx == 0)
+      *local_flag = 0;
+
+    const int v = local_img[lidx];
+    int acc = v;
+    for (int r = -1; r <= 1; ++r)
+    {
+      local const int * w = local_img + lidx + r * padded_ncols;
+      acc = gray_op(acc, gray_op(w[-1], gray_op(w[0], w[1], erosion), erosion), erosion);
+    }
+    const int nv = inside ? gray_geodesic(acc, m, erosion) : v;
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    if (nv != v)
+    {
+      local_img[lidx] = nv;
+      *local_flag = 1;
+    }
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    const int again = *local_flag;
+    barrier(CLK_LOCAL_MEM_FENCE);
+    if (!again)
+      break;
+  }
+
+  if (!inside)
+    return;
+
+  out[idx] = local_img[lidx];
+}
+
+// Whether the value v of the pixel (x, y) can improve one of its neighbors
+int gray_can_propagate(global const int * marker, global const int * mask,
+                       const int nrows, const int ncols,
+                       const int x, const int y, const int v, const int erosion)
+{
+  for (int r = max(y - 1, 0); r <= min(y + 1, nrows - 1); ++r)
+    for (int c = max(x - 1, 0); c <= min(x + 1, ncols - 1); ++c)
+    {
+      const int q = mad24(r, ncols, c);
+      if (gray_improves(gray_geodesic(v, mask[q], erosion), marker[q], erosion))
+        return 1;
+    }
+  return 0;
+}
+
+// Fills the FIFO with the pixels which can improve a neighbor, and resets
+// the stamps (the last round each pixel was queued in)
+kernel void gray_reconstruct_seed(global const int * marker, global const int * mask,
+                                  global int * queue, global int * counts,
+                                  global int * stamps,
+                                  const int nrows, const int ncols,
+                                  const int erosion)
+{
+  const int x = get_global_id(0);
+  const int y = get_global_id(1);
+
+  if (x >= ncols || y >= nrows)
+    return;
+
+  const int idx = mad24(y, ncols, x);
+  stamps[idx] = 0;
+  if (gray_can_propagate(marker, mask, nrows, ncols, x, y, marker[idx], erosion))
+    queue[atomic_inc(counts)] = idx;
+}
+
+// One round of the FIFO: the pixels of queue_in (counts[in_index] of them)
+// propagate to their neighbors, the improved ones are queued in queue_out
+// (once per round, thanks to the stamps). Any number of threads. The marker
+// only moves towards the result, the atomic updates keep the best value.
+kernel void gray_reconstruct_fifo(global int * marker, global const int * mask,
+                                  global const int * queue_in, global int * queue_out,
+                                  global int * counts, const int in_index,
+                                  global int * stamps,
+                                  const int nrows, const int ncols,
+                                  const int erosion, const int fifo_round)
+{
+  const int count = counts[in_index];
+  global int * out_count = counts + 1 - in_index;
+
+  for (int i = get_global_id(0); i < count; i += get_global_size(0))
+  {
+    const int p = queue_in[i];
+    const int y = p / ncols;
+    const int x = p - y * ncols;
+    const int v = marker[p];
+    for (int r = max(y - 1, 0); r <= min(y + 1, nrows - 1); ++r)
+      for (int c = max(x - 1, 0); c <= min(x + 1, ncols - 1); ++c)
+      {
+        const int q = mad24(r, ncols, c);
+        const int nv = gray_geodesic(v, mask[q], erosion);
+        if (!gray_improves(nv, marker[q], erosion))
+          continue;
+        const int old = erosion ? atomic_min(marker + q, nv) : atomic_max(marker + q, nv);
+        if (gray_improves(nv, old, erosion)
+            && atomic_xchg(stamps + q, fifo_round) != fifo_round)
+          queue_out[atomic_inc(out_count)] = q;
+      }
+  }
+}
+
+// Constant offset, saturated
+kernel void gray_add_const(global const int * in, global int * out, const int value)
+{
+  const int idx = get_global_id(0);
+  out[idx] = add_sat(in[idx], value);
+}
+
+kernel void gray_sub(global const int * a, global const int * b, global int * out)
+{
+  const int idx = get_global_id(0);
+  out[idx] = sub_sat(a[idx], b[idx]);
+}
+
+// Marker of the reconstructions from the border: the image on the border,
+// value elsewhere
+kernel void gray_border_marker(global const int * in, global int * out,
+                               const int nrows, const int ncols, const int value)
+{
+  const int x = get_global_id(0);
+  const int y = get_global_id(1);
+
+  if (x >= ncols || y >= nrows)
+    return;
+
+  const int idx = mad24(y, ncols, x);
+  const int border = x == 0 || y == 0 || x == ncols - 1 || y == nrows - 1;
+  out[idx] = border ? in[idx] : value;
+}
+#endif
+
+#ifdef CLCV_SECTION_WATERSHED
+// Marker-controlled watershed (8-connexity), as the image foresting
+// transform of the gradient with the max path cost: each pixel takes the
+// label of the marker it can be reached from with the lowest maximum
+// gradient along the path. On the plateaus the distance since the last
+// climb splits the ties, then the smallest label. Each pixel recomputes its
+// value from its neighbors only, so that the relaxation has a single fixed
+// point whatever the order of the updates (the labels of the ties included).
+
+// Offer of the neighbor (cost, dist, label) to a pixel of gradient g,
+// kept when better than (best_cost, best_dist, best_label)
+void watershed_offer(const int cost, const int dist, const int label, const int g,
+                     int * best_cost, int * best_dist, int * best_label)
+{
+  if (label == 0)
+    return;
+  const int c = max(cost, g);
+  const int d = g <= cost ? dist + 1 : 0;
+  if (c < *best_cost
+      || (c == *best_cost && (d < *best_dist || (d == *best_dist && label < *best_label))))
+  {
+    *best_cost = c;
+    *best_dist = d;
+    *best_label = label;
+  }
+}
+
+// The markers start at their gradient with a distance of -1, which nothing
+// else can beat. Everything else is unreached.
+kernel void watershed_init(global const int * gradient, global const int * labels,
+                           global int * cost, global int * dist,
+                           const int nrows, const int ncols)
+{
+  const int x = get_global_id(0);
+  const int y = get_global_id(1);
+
+  if (x >= ncols || y >= nrows)
+    return;
+
+  const int idx = mad24(y, ncols, x);
+  cost[idx] = labels[idx] ? gradient[idx] : INT_MAX;
+  dist[idx] = labels[idx] ? -1 : 0;
+}
+
+// Relaxes until the tile is stable, the apron (the neighbor tiles as of the
+// launch) doesn't change
+kernel void watershed(global const int * cost_in, global const int * dist_in,
+                      global const int * label_in, global const int * gradient,
+                      global int * cost_out, global int * dist_out, global int * label_out,
+                      const int nrows, const int ncols, global int * changed,
+                      local int * local_cost, local int * local_dist, local int * local_label,
+                      local int * local_flag)
+{
+  const int x = get_global_id(0);
+  const int y = get_global_id(1);
+  const int lx = get_local_id(0);
+  const int ly = get_local_id(1);
+  const int lxsize = get_local_size(0);
+  const int lysize = get_local_size(1);
+
+  const int corner_x = get_group_id(0) * lxsize - 1;
+  const int corner_y = get_group_id(1) * lysize - 1;
+
+  const int thread_idx = mad24(ly, lxsize, lx);
+  const int nb_threads = lxsize * lysize;
+
+  const int padded_ncols = lxsize + 2;
+  const int lidx = mad24(padded_ncols, ly + 1, lx + 1);
+  const int size = (lysize + 2) * padded_ncols;
+
+  for (int i = thread_idx; i < size; i += nb_threads)
+  {
+    const int div = i / padded_ncols;
+    const int rect_row = div + corner_y;
+    const int rect_col = i - div * padded_ncols + corner_x;
+
+    if (rect_row < 0 || rect_row >= nrows || rect_col < 0 || rect_col >= ncols)
+    {
+      local_cost[i] = INT_MAX;
+      local_dist[i] = 0;
+      local_label[i] = 0;
+    }
+    else
+    {
+      const int pidx = mad24(rect_row, ncols, rect_col);
+      local_cost[i] = cost_in[pidx];
+      local_dist[i] = dist_in[pidx];
+      local_label[i] = label_in[pidx];
+    }
+  }
+  barrier(CLK_LOCAL_MEM_FENCE);
+
+  // Threads outside the image still take part in the barriers
+  const int inside = x < ncols && y < nrows;
+  const int idx = mad24(y, ncols, x);
+  const int g = inside ? gradient[idx] : 0;
+  const int orig_cost = local_cost[lidx];
+  const int orig_dist = local_dist[lidx];
+  const int orig_label = local_label[lidx];
+  const int fixed = !inside || orig_dist < 0;
+
+  for (;;)
+  {
+    if (thread_idx == 0)
+      *local_flag = 0;
+
+    int c = INT_MAX;
+    int d = 0;
+    int l = 0;
+    if (!fixed)
+      for (int r = -1; r <= 1; ++r)
+        for (int k = -1; k <= 1; ++k)
+          if (r != 0 || k != 0)
+          {
+            const int n = mad24(r, padded_ncols, lidx + k);
+            watershed_offer(local_cost[n], local_dist[n], local_label[n], g, &c, &d, &l);
+          }
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    if (!fixed && (c != local_cost[lidx] || d != local_dist[lidx] || l != local_label[lidx]))
+    {
+      local_cost[lidx] = c;
+      local_dist[lidx] = d;
+      local_label[lidx] = l;
+      *local_flag = 1;
+    }
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    const int again = *local_flag;
+    barrier(CLK_LOCAL_MEM_FENCE);
+    if (!again)
+      break;
+  }
+
+  if (!inside)
+    return;
+
+  cost_out[idx] = local_cost[lidx];
+  dist_out[idx] = local_dist[lidx];
+  label_out[idx] = local_label[lidx];
+  // Every writer stores the same value, no need for an atomic operation
+  if (local_cost[lidx] != orig_cost || local_dist[lidx] != orig_dist
+      || local_label[lidx] != orig_label)
+    *changed = 1;
+}
+#endif
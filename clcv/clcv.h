@@ -17,15 +17,42 @@
 #define CLCV_CLCV_H__
 
 #include <map>
+#include <list>
+#include <string>
+#include <vector>
+#include <bitset>
 #define __CL_ENABLE_EXCEPTIONS
 #include <clcv/cl.hpp>
 #include <clcv/win2d.h>
 #include <clcv/image2d.h>
+#include <clcv/decompose.h>
+
+// Radii above which the bitmapped operators switch to the van Herk/Gil-Werman
+// implementations, whose cost per word doesn't depend on the radius
+#ifndef CLCV_VHGW_COLRAD
+# define CLCV_VHGW_COLRAD 32
+#endif
+#ifndef CLCV_VHGW_ROWRAD
+# define CLCV_VHGW_ROWRAD 16
+#endif
+// Passes in local tiles (at least 1) before the grayscale reconstructions
+// switch to the FIFO
+#ifndef CLCV_RECONSTRUCT_TILE_PASSES
+# define CLCV_RECONSTRUCT_TILE_PASSES 2
+#endif
+// Largest SE (number of points) the naive JIT mode unrolls
+#ifndef CLCV_NAIVE_JIT_MAX_COUNT
+# define CLCV_NAIVE_JIT_MAX_COUNT 1024
+#endif
 
 namespace clcv
 {
   typedef unsigned clcv_image_id;
   typedef unsigned clcv_se_id;
+  typedef unsigned clcv_plan_id;
+
+  // Pixelwise logical operators on bitmaps
+  enum clcv_logic_op { logic_and = 0, logic_or = 1, logic_andnot = 2, logic_xor = 3 };
 
   template<typename T>
   class CLCV
@@ -37,6 +64,7 @@ namespace clcv
     // General
     cl_device_id get_device_id() const;
     cl_device_type get_device_type() const;
+    cl_ulong get_local_mem_size() const;
     cl::Context & get_context();
     cl::CommandQueue & get_queue();
     void flush();
@@ -46,6 +74,14 @@ namespace clcv
     const cl::NDRange & get_global_work_size() const;
     const cl::NDRange & get_local_work_size() const;
 
+    // Programs
+    // The kernels are embedded in the library (see embed_cl.sh), and built
+    // per operator (see the sections of clcv.cl) when first used. warmup()
+    // builds the programs of the given kernels (all of them by default)
+    // ahead of time, in parallel.
+    void warmup();
+    void warmup(const std::vector<std::string> & kernel_names);
+
     // Image related
     clcv_image_id open(const image2d<T> & img);
     cl::Event fetch(const size_t size);
@@ -58,10 +94,35 @@ namespace clcv
     cl::Buffer & get_out_buffer();
     
     // SE related
+    // Flat SEs are decomposed (see win2d_decomposition) when loaded, and the
+    // naive erosion/dilation then run the cheapest equivalent chain
     clcv_se_id load_se(const win2d<T> & win);
+    // Hit-or-miss SEs can also be given as a signed win2d: weight 1 for the
+    // foreground, -1 for the background
+    clcv_se_id load_se(const win2d<T> & fg, const win2d<T> & bg);
     void unload_se(clcv_se_id se_id);
 
+    // Plan related
+    // A plan records the chain of operators pushed between begin_plan() and
+    // end_plan() on the current image, without running them: the kernels
+    // with their arguments, sizes and buffers. The events returned by the
+    // pushes made while recording are null. push_plan() then runs the
+    // chain on a new image of the same size with one upload and the
+    // recorded enqueues. The plan has no image of its own: it reuses the
+    // recorded one, which must stay open while the plan is used, and
+    // overwrites its content (host copy and buffers) at each run. The
+    // result is that image, made current (see fetch()). The previous run
+    // must be done. The iterative operators (they read from the device)
+    // can't be recorded, unless limited to a single pass.
+    clcv_plan_id begin_plan();
+    void end_plan();
+    cl::Event push_plan(clcv_plan_id plan_id, const image2d<T> & img);
+    void unload_plan(clcv_plan_id plan_id);
+
     // Kernel related
+    // The kernels are cached (see get_kernel()): the one returned by a
+    // create_* is shared with the next calls, its arguments should only be
+    // changed by creating it again.
 
     cl::Kernel create_unbitmap(const cl::Buffer & image_in, const cl::Buffer & image_out,
                                const cl_int nrows, const cl_int ncols);
@@ -83,6 +144,10 @@ namespace clcv
     // Naive morpho implementations:
     // - One pixel per T
     // - Iterate through the SE for each pixel
+    // In JIT mode, each SE gets its own naive_morph, compiled with the SE
+    // as constants (see naive_morph_jit), and shared by the identical SEs
+    void set_naive_jit(const bool enabled);
+    bool get_naive_jit() const;
     cl::Kernel create_naivemorph(const cl::Buffer & image_in, const cl::Buffer & image_out,
                                  const cl_int nrows, const cl_int ncols,
                                  const clcv_se_id se_id, const cl_int se_targetsum,
@@ -100,7 +165,303 @@ namespace clcv
     cl::Event push_naiveerosion(const clcv_se_id se_id);
     cl::Event push_naiveopening(const clcv_se_id se_id);
     cl::Event push_naiveclosing(const clcv_se_id se_id);
+    // Fused naive_morph pair (same SE), one launch and one write
+    cl::Kernel create_naivemorph_fused(const cl::Buffer & image_in, const cl::Buffer & image_out,
+                                       const cl_int nrows, const cl_int ncols,
+                                       const clcv_se_id se_id,
+                                       const cl_int se_targetsum1, const cl_int se_targetsum2,
+                                       const cl_int residue,
+                                       const cl::NDRange & local_work_size);
+    cl::Event push_naivemorph_fused(const clcv_se_id se_id,
+                                    const cl_int se_targetsum1, const cl_int se_targetsum2,
+                                    const cl_int residue = 0);
+    // Gradient (dilation minus erosion), white top-hat (image minus
+    // opening) and black top-hat (closing minus image). The original image
+    // stays on the device. Like the other naive operators the input must
+    // be binary (0/1, see push_binarize): the residues are bitwise.
+    cl::Kernel create_naivegradient(const cl::Buffer & image_in, const cl::Buffer & image_out,
+                                    const cl_int nrows, const cl_int ncols,
+                                    const clcv_se_id se_id,
+                                    const cl::NDRange & local_work_size);
+    cl::Event push_naivegradient(const clcv_se_id se_id);
+    cl::Event push_naivetophat(const clcv_se_id se_id);
+    cl::Event push_naiveblackhat(const clcv_se_id se_id);
+    // Decomposed SEs: separable bitmapped chain when the image allows it,
+    // otherwise a naive chain of the smaller SEs
+    cl::Event push_decomposedmorph_bitmapped(const clcv_se_id se_id, const bool erosion);
+    cl::Event push_decomposedmorph_naive(const clcv_se_id se_id, const bool erosion);
+    // Any other flat SE: binarize, bitmapped runs operator, unbitmap
+    cl::Event push_runsmorph(const clcv_se_id se_id, const bool erosion);
+    cl::Event push_runsmorph_fused(const clcv_se_id se_id, const bool closing,
+                                   const bool residue = false);
     
+    // Hit-or-miss transforms (see load_se for the SE)
+    cl::Event push_naivehitormiss(const clcv_se_id se_id);
+    cl::Kernel create_bitmappedhitormiss(const cl::Buffer & image_in,
+                                         const cl::Buffer & image_out,
+                                         const cl_int nrows, const cl_int ncols,
+                                         const clcv_se_id se_id,
+                                         const cl::NDRange & local_work_size);
+    cl::Event push_bitmappedhitormiss(const clcv_se_id se_id);
+    // 3x3 SEs as 9 bit masks, bit (row+1)*3 + (col+1)
+    cl::Kernel create_bitmappedhitormiss3x3(const cl::Buffer & image_in,
+                                            const cl::Buffer & image_out,
+                                            const cl_int nrows, const cl_int ncols,
+                                            const cl_int fg, const cl_int bg,
+                                            const cl::NDRange & local_work_size);
+    cl::Event push_bitmappedhitormiss3x3(const cl_int fg, const cl_int bg);
+    // Thinning with the 8 rotations of the Golay L masks, until stability
+    // (or max_iter passes when not 0). The device flags the changes, it is
+    // read back every batch passes.
+    cl::Kernel create_bitmappedthinning3x3(const cl::Buffer & image_in,
+                                           const cl::Buffer & image_out,
+                                           const cl_int nrows, const cl_int ncols,
+                                           const cl_int fg, const cl_int bg,
+                                           const cl::Buffer & changed,
+                                           const cl::NDRange & local_work_size);
+    cl::Event push_bitmappedthinning(const unsigned max_iter = 0, const unsigned batch = 4);
+    cl::Event push_naivethinning(const unsigned max_iter = 0, const unsigned batch = 4);
+    // Any 3x3 operator as a lookup table, entry i for the neighborhood with
+    // bit (row + 1) * 3 + (col + 1) set for each set pixel. Applied max_iter
+    // times, or until stability when 0 (read back every batch passes).
+    cl::Kernel create_bitmappedlut3x3(const cl::Buffer & image_in,
+                                      const cl::Buffer & image_out,
+                                      const cl_int nrows, const cl_int ncols,
+                                      const cl::Buffer & lut, const cl::Buffer & changed,
+                                      const cl::NDRange & local_work_size);
+    cl::Event push_bitmapped_lut3x3(const std::bitset<512> & lut, const unsigned max_iter = 1,
+                                    const unsigned batch = 4);
+
+    // Geodesic reconstruction by dilation (8-connexity) of a bitmapped
+    // marker under a bitmapped mask of the same size. The result replaces the
+    // marker, which becomes the current image. The device flags the changes,
+    // it is read back every batch launches.
+    cl::Kernel create_bitmapped_reconstruct(const cl::Buffer & marker_in,
+                                            const cl::Buffer & marker_out,
+                                            const cl::Buffer & mask,
+                                            const cl_int nrows, const cl_int ncols,
+                                            const cl::Buffer & changed,
+                                            const cl::NDRange & local_work_size);
+    cl::Event push_bitmapped_reconstruct(const clcv_image_id marker_id,
+                                         const clcv_image_id mask_id,
+                                         const unsigned batch = 4);
+    // Reconstructions from the image border, on the current bitmapped image
+    cl::Kernel create_bitmapped_bordermarker(const cl::Buffer & image_in,
+                                             const cl::Buffer & marker,
+                                             const cl::Buffer & mask,
+                                             const cl_int nrows, const cl_int ncols,
+                                             const bool invert);
+    cl::Event push_bitmapped_fillholes(const unsigned batch = 4);
+    cl::Event push_bitmapped_clearborder(const unsigned batch = 4);
+
+    // Connected component labeling (8-connexity) of the current bitmapped
+    // image, into the label buffer of the image (one cl_int per pixel). The
+    // background is 0, the components are labelled 1 + the index of their
+    // first pixel in raster order. The bitmap itself is left unchanged.
+    // inverted labels the components of the 0 pixels instead.
+    cl::Kernel create_bitmapped_label_local(const cl::Buffer & image_in,
+                                            const cl::Buffer & parent,
+                                            const cl_int nrows, const cl_int ncols,
+                                            const bool inverted,
+                                            const cl::NDRange & local_work_size);
+    cl::Kernel create_bitmapped_label_merge(const cl::Buffer & image_in,
+                                            const cl::Buffer & parent,
+                                            const cl_int nrows, const cl_int ncols,
+                                            const bool inverted);
+    cl::Kernel create_bitmapped_label_final(const cl::Buffer & image_in,
+                                            const cl::Buffer & parent,
+                                            const cl::Buffer & labels,
+                                            const cl_int nrows, const cl_int ncols,
+                                            const bool inverted);
+    cl::Event push_bitmapped_label(const bool inverted = false);
+    cl::Buffer & get_label_buffer();
+    cl::Event fetch_labels(cl_int * labels);
+
+    // Area opening (removes the components of less than min_area pixels)
+    // and closing (fills the components of 0 pixels of less than min_area
+    // pixels) of the current bitmapped image, labeling on the device
+    cl::Kernel create_label_area_reset(const cl::Buffer & labels, const cl::Buffer & areas,
+                                       const cl_int nrows, const cl_int ncols);
+    cl::Kernel create_label_area_count(const cl::Buffer & labels, const cl::Buffer & areas,
+                                       const cl_int nrows, const cl_int ncols);
+    cl::Kernel create_bitmapped_area_filter(const cl::Buffer & labels, const cl::Buffer & areas,
+                                            const cl::Buffer & image_out,
+                                            const cl_int nrows, const cl_int ncols,
+                                            const cl_int min_area, const bool inverted);
+    cl::Event push_bitmapped_area_opening(const cl_int min_area);
+    cl::Event push_bitmapped_area_closing(const cl_int min_area);
+    // Despeckle: area opening, then area closing of the result
+    cl::Event push_bitmapped_despeckle(const cl_int min_area, const cl_int min_hole_area);
+
+    // Exact Euclidean distance transform (Meijster). Squared distances to
+    // the nearest 0 pixel (1 pixel when inverted) of the current binary (0/1)
+    // or bitmapped image, which becomes the distance map (one cl_int per
+    // pixel).
+    cl::Kernel create_edt_columns(const cl::Buffer & image_in, const cl::Buffer & g,
+                                  const cl_int nrows, const cl_int ncols,
+                                  const bool bitmapped, const bool inverted);
+    cl::Kernel create_edt_rows(const cl::Buffer & g, const cl::Buffer & image_out,
+                               const cl::Buffer & s, const cl::Buffer & t,
+                               const cl_int nrows, const cl_int ncols);
+    cl::Event push_edt(const bool inverted = false);
+    cl::Event push_bitmapped_edt(const bool inverted = false);
+
+    // Binary dilation/erosion by the disk of the given radius, thresholding
+    // the distance transform: the cost doesn't depend on the radius. Same
+    // borders as the other binary operators (the outside is 0).
+    cl::Kernel create_edt_threshold(const cl::Buffer & image_in, const cl::Buffer & image_out,
+                                    const cl_int nrows, const cl_int ncols,
+                                    const cl_int radius, const bool erosion,
+                                    const bool bitmapped);
+    cl::Event push_disk_dilation(const cl_int radius);
+    cl::Event push_disk_erosion(const cl_int radius);
+    cl::Event push_bitmapped_disk_dilation(const cl_int radius);
+    cl::Event push_bitmapped_disk_erosion(const cl_int radius);
+
+    // Number of set pixels of a bitmap of size words, added to counts[index]
+    cl::Kernel create_bitmappedcount(const cl::Buffer & image_in, const cl::Buffer & counts,
+                                     const cl_int size, const cl_int index,
+                                     const cl::NDRange & local_work_size);
+    cl::Event push_bitmappedcount(const cl::Buffer & counts, const cl_int index);
+    // Granulometry by squares: areas[r] is the area of the opening of the
+    // current bitmapped image by the square of radius r (areas[0] is the area
+    // of the image), for r = 0..max_radius. The pattern spectrum is
+    // areas[r - 1] - areas[r]. Each erosion is computed from the previous
+    // one, the areas are summed on the device and read back once (wait for
+    // the returned event). The image is left unchanged.
+    cl::Event push_bitmapped_granulometry(const cl_int max_radius, cl_int * areas);
+
+    // Lantuejoul skeleton of the current bitmapped image with the 3x3 SE
+    // (4-connexity cross, or square when c8): the union over k of the
+    // k-th erosion minus its opening. It replaces the image. With quench,
+    // the quench buffer of the image (one cl_int per pixel) holds k + 1 for
+    // the skeleton pixels and 0 elsewhere: the union of their dilations by
+    // k SEs is the image. The device flags the non-empty erosions, it is
+    // read back every batch levels.
+    cl::Kernel create_bitmapped_skeleton(const cl::Buffer & level, const cl::Buffer & eroded,
+                                         const cl::Buffer & skel, const cl::Buffer & quench,
+                                         const cl_int nrows, const cl_int ncols,
+                                         const bool c8, const cl_int level_index,
+                                         const bool with_quench, const cl::Buffer & changed,
+                                         const cl::NDRange & local_work_size);
+    cl::Event push_bitmapped_skeleton(const bool c8 = true, const bool quench = false,
+                                      const unsigned batch = 4);
+    cl::Buffer & get_quench_buffer();
+    cl::Event fetch_quench(cl_int * quench);
+
+    // Grayscale (min/max) morphology with flat SEs, on the current image.
+    // Pixels outside the image are ignored. Rectangles run the separable
+    // van Herk/Gil-Werman passes (any radius), any other SE a tiled local
+    // memory min/max.
+    cl::Kernel create_graymorph(const cl::Buffer & image_in,
+                                const cl::Buffer & image_out,
+                                const cl_int nrows, const cl_int ncols,
+                                const clcv_se_id se_id, const bool erosion,
+                                const cl::NDRange & local_work_size);
+    cl::Event push_graymorph(const clcv_se_id se_id, const bool erosion);
+    cl::Kernel create_gray_vhgw_scan(const cl::Buffer & image_in,
+                                     const cl::Buffer & g, const cl::Buffer & h,
+                                     const cl_int nrows, const cl_int ncols,
+                                     const cl_int se_rad, const bool vertical,
+                                     const bool erosion);
+    cl::Kernel create_gray_vhgw_merge(const cl::Buffer & g, const cl::Buffer & h,
+                                      const cl::Buffer & image_out,
+                                      const cl_int nrows, const cl_int ncols,
+                                      const cl_int se_rad, const bool vertical,
+                                      const bool erosion);
+    cl::Event push_gray_vhgw(const cl_int se_rad, const bool vertical, const bool erosion);
+    cl::Event push_gray_morph(const cl_int se_rowrad, const cl_int se_colrad, const bool erosion);
+    cl::Event push_gray_morph(const clcv_se_id se_id, const bool erosion);
+    cl::Event push_gray_dilation(const clcv_se_id se_id);
+    cl::Event push_gray_erosion(const clcv_se_id se_id);
+    cl::Event push_gray_opening(const clcv_se_id se_id);
+    cl::Event push_gray_closing(const clcv_se_id se_id);
+    cl::Event push_gray_dilation(const cl_int se_rowrad, const cl_int se_colrad);
+    cl::Event push_gray_erosion(const cl_int se_rowrad, const cl_int se_colrad);
+    cl::Event push_gray_opening(const cl_int se_rowrad, const cl_int se_colrad);
+    cl::Event push_gray_closing(const cl_int se_rowrad, const cl_int se_colrad);
+
+    // Grayscale geodesic reconstruction (8-connexity) by dilation of a
+    // marker under a mask of the same size, or by erosion of a marker above
+    // it. The result replaces the marker, which becomes the current image.
+    // A few passes propagate inside local tiles, then the device processes
+    // a FIFO of the pixels which can still improve a neighbor, in rounds.
+    // Its size is read back every batch rounds.
+    cl::Kernel create_gray_reconstruct_tile(const cl::Buffer & marker_in,
+                                            const cl::Buffer & marker_out,
+                                            const cl::Buffer & mask,
+                                            const cl_int nrows, const cl_int ncols,
+                                            const bool erosion,
+                                            const cl::NDRange & local_work_size);
+    cl::Kernel create_gray_reconstruct_seed(const cl::Buffer & marker, const cl::Buffer & mask,
+                                            const cl::Buffer & queue, const cl::Buffer & counts,
+                                            const cl::Buffer & stamps,
+                                            const cl_int nrows, const cl_int ncols,
+                                            const bool erosion);
+    cl::Kernel create_gray_reconstruct_fifo(const cl::Buffer & marker, const cl::Buffer & mask,
+                                            const cl::Buffer & queue_in,
+                                            const cl::Buffer & queue_out,
+                                            const cl::Buffer & counts, const cl_int in_index,
+                                            const cl::Buffer & stamps,
+                                            const cl_int nrows, const cl_int ncols,
+                                            const bool erosion, const cl_int fifo_round);
+    cl::Event push_gray_reconstruct(const clcv_image_id marker_id, const clcv_image_id mask_id,
+                                    const bool erosion = false, const unsigned batch = 4);
+    // h-maxima transform: reconstruction of the image minus h under the
+    // image, the maxima of height up to h are leveled
+    cl::Event push_hmaxima(const cl_int h, const unsigned batch = 4);
+    // Regional maxima as a binary (0/1) image: the image minus the
+    // reconstruction of the image minus 1
+    cl::Event push_regional_maxima(const unsigned batch = 4);
+    // Fills the holes (the minima not connected to the border):
+    // reconstruction by erosion of the border of the image
+    cl::Event push_fill_holes_gray(const unsigned batch = 4);
+    // Saturated arithmetics on explicit buffers of the size of the current
+    // image
+    cl::Kernel create_gray_add_const(const cl::Buffer & image_in, const cl::Buffer & image_out,
+                                     const cl_int value);
+    cl::Event push_gray_add_const(const cl::Buffer & image_in, const cl::Buffer & image_out,
+                                  const cl_int value);
+    cl::Kernel create_gray_sub(const cl::Buffer & a, const cl::Buffer & b,
+                               const cl::Buffer & image_out);
+    cl::Event push_gray_sub(const cl::Buffer & a, const cl::Buffer & b,
+                            const cl::Buffer & image_out);
+    cl::Kernel create_gray_border_marker(const cl::Buffer & image_in, const cl::Buffer & marker,
+                                         const cl_int nrows, const cl_int ncols,
+                                         const cl_int value);
+
+    // Marker-controlled watershed (8-connexity) of a gradient image: the
+    // markers are the non zero labels of a marker image of the same size,
+    // each pixel gets the label of the marker it is reached from with the
+    // lowest maximum gradient (ties: shortest path on the plateau, then
+    // smallest label). The label image replaces the marker, which becomes
+    // the current image. The device flags the changes, it is read back every
+    // batch launches.
+    cl::Kernel create_watershed_init(const cl::Buffer & gradient, const cl::Buffer & labels,
+                                     const cl::Buffer & cost, const cl::Buffer & dist,
+                                     const cl_int nrows, const cl_int ncols);
+    cl::Kernel create_watershed(const cl::Buffer & cost_in, const cl::Buffer & dist_in,
+                                const cl::Buffer & label_in, const cl::Buffer & gradient,
+                                const cl::Buffer & cost_out, const cl::Buffer & dist_out,
+                                const cl::Buffer & label_out,
+                                const cl_int nrows, const cl_int ncols,
+                                const cl::Buffer & changed,
+                                const cl::NDRange & local_work_size);
+    cl::Event push_watershed(const clcv_image_id gradient_id, const clcv_image_id marker_id,
+                             const unsigned batch = 4);
+
+    // Bitmapped logical operators
+    cl::Kernel create_bitmappedlogic(const cl::Buffer & a, const cl::Buffer & b,
+                                     const cl::Buffer & image_out,
+                                     const clcv_logic_op op);
+    cl::Event push_bitmappedlogic(const cl::Buffer & a, const cl::Buffer & b,
+                                  const cl::Buffer & image_out,
+                                  const clcv_logic_op op);
+    // Same on binary (0/1) images
+    cl::Event push_naivelogic(const cl::Buffer & a, const cl::Buffer & b,
+                              const cl::Buffer & image_out,
+                              const clcv_logic_op op);
+
     // Bitmapped implementation
     cl::Kernel create_bitmappedmorph_dilation_h(const cl::Buffer & image_in,
                                                 const cl::Buffer & image_out,
@@ -137,17 +498,171 @@ namespace clcv
     cl::Event push_bitmappedmorph_opening(const cl_int se_rowrad, const cl_int se_colrad);
     cl::Event push_bitmappedmorph_closing(const cl_int se_rowrad, const cl_int se_colrad);
 
+    // Diagonal segments along (1, 1) (dir 1) or (1, -1) (dir -1), any radius
+    cl::Kernel create_bitmappedmorph_diag(const cl::Buffer & image_in,
+                                          const cl::Buffer & image_out,
+                                          const cl_int nrows, const cl_int ncols,
+                                          const cl_int se_rad, const cl_int dir,
+                                          const bool erosion,
+                                          const cl::NDRange & local_work_size);
+    cl::Event push_bitmappedmorph_diag(const cl_int se_rad, const cl_int dir, const bool erosion);
+    // 4-connexity cross (win_c4p), or 3x3 square (win_c8p) when c8
+    cl::Kernel create_bitmappedmorph_3x3(const cl::Buffer & image_in,
+                                         const cl::Buffer & image_out,
+                                         const cl_int nrows, const cl_int ncols,
+                                         const bool c8, const bool erosion,
+                                         const cl::NDRange & local_work_size);
+    cl::Event push_bitmappedmorph_3x3(const bool c8, const bool erosion);
+    // Approximate disks: the octagon is the sum of a square and of two
+    // diagonal segments (same extent along the axes and the diagonals), the
+    // diamond the sum of two diagonal segments and of crosses. Within radius
+    // pixels of the borders, the dilations see less than the whole SE.
+    cl::Event push_bitmappedmorph_octagon(const cl_int radius, const bool erosion);
+    cl::Event push_bitmappedmorph_diamond(const cl_int radius, const bool erosion);
+
+    // Fused opening/closing, one launch (se_colrad <= 32)
+    cl::Kernel create_bitmappedmorph_fused(const cl::Buffer & image_in,
+                                           const cl::Buffer & image_out,
+                                           const cl_int nrows, const cl_int ncols,
+                                           const cl_int se_rowrad, const cl_int se_colrad,
+                                           const bool closing, const bool residue,
+                                           const cl::NDRange & local_work_size);
+    cl::Event push_bitmappedmorph_fused(const cl_int se_rowrad, const cl_int se_colrad,
+                                        const bool closing, const bool residue = false);
+
+    // Gradient and top-hats, fused into one launch when possible
+    cl::Kernel create_bitmappedmorph_gradient(const cl::Buffer & image_in,
+                                              const cl::Buffer & image_out,
+                                              const cl_int nrows, const cl_int ncols,
+                                              const cl_int se_rowrad, const cl_int se_colrad,
+                                              const cl::NDRange & local_work_size);
+    cl::Event push_bitmappedmorph_gradient(const cl_int se_rowrad, const cl_int se_colrad);
+    cl::Event push_bitmappedmorph_tophat(const cl_int se_rowrad, const cl_int se_colrad);
+    cl::Event push_bitmappedmorph_blackhat(const cl_int se_rowrad, const cl_int se_colrad);
+
+    // Bitmapped implementation for any flat SE (encoded as horizontal runs)
+    cl::Kernel create_bitmappedmorph(const cl::Buffer & image_in,
+                                     const cl::Buffer & image_out,
+                                     const cl_int nrows, const cl_int ncols,
+                                     const clcv_se_id se_id, const bool erosion,
+                                     const cl::NDRange & local_work_size);
+    cl::Event push_bitmappedmorph(const clcv_se_id se_id, const bool erosion);
+    cl::Event push_bitmappedmorph_dilation(const clcv_se_id se_id);
+    cl::Event push_bitmappedmorph_erosion(const clcv_se_id se_id);
+    cl::Event push_bitmappedmorph_opening(const clcv_se_id se_id);
+    cl::Event push_bitmappedmorph_closing(const clcv_se_id se_id);
+    cl::Kernel create_bitmappedmorph_fused(const cl::Buffer & image_in,
+                                           const cl::Buffer & image_out,
+                                           const cl_int nrows, const cl_int ncols,
+                                           const clcv_se_id se_id,
+                                           const bool closing, const bool residue,
+                                           const cl::NDRange & local_work_size);
+    cl::Event push_bitmappedmorph_fused(const clcv_se_id se_id, const bool closing,
+                                        const bool residue = false);
+    cl::Kernel create_bitmappedmorph_gradient(const cl::Buffer & image_in,
+                                              const cl::Buffer & image_out,
+                                              const cl_int nrows, const cl_int ncols,
+                                              const clcv_se_id se_id,
+                                              const cl::NDRange & local_work_size);
+    cl::Event push_bitmappedmorph_gradient(const clcv_se_id se_id);
+    cl::Event push_bitmappedmorph_tophat(const clcv_se_id se_id);
+    cl::Event push_bitmappedmorph_blackhat(const clcv_se_id se_id);
+
+    // Rank filter (se_colrad <= 32): a pixel is set when at least rank
+    // points of the SE (those of positive weight) hit set pixels. 1 is the
+    // dilation, the number of such points the erosion, the median is
+    // halfway.
+    cl::Kernel create_bitmappedrank(const cl::Buffer & image_in,
+                                    const cl::Buffer & image_out,
+                                    const cl_int nrows, const cl_int ncols,
+                                    const clcv_se_id se_id, const cl_int rank,
+                                    const cl::NDRange & local_work_size);
+    cl::Event push_bitmappedrank(const clcv_se_id se_id, const cl_int rank);
+    cl::Event push_bitmappedmedian(const clcv_se_id se_id);
+
+    // Bitmapped van Herk/Gil-Werman implementation (any radius)
+    cl::Kernel create_bitmappedmorph_vhgw_h(const cl::Buffer & image_in,
+                                            const cl::Buffer & image_out,
+                                            const cl_int nrows, const cl_int ncols,
+                                            const cl_int se_colrad, const bool erosion,
+                                            const cl::NDRange & local_work_size);
+    cl::Event push_bitmappedmorph_vhgw_h(const cl_int se_colrad, const bool erosion);
+
+    cl::Kernel create_bitmappedmorph_vhgw_scan_v(const cl::Buffer & image_in,
+                                                 const cl::Buffer & g, const cl::Buffer & h,
+                                                 const cl_int nrows, const cl_int ncols,
+                                                 const cl_int se_rowrad, const bool erosion);
+    cl::Kernel create_bitmappedmorph_vhgw_v(const cl::Buffer & g, const cl::Buffer & h,
+                                            const cl::Buffer & image_out,
+                                            const cl_int nrows, const cl_int ncols,
+                                            const cl_int se_rowrad, const bool erosion);
+    cl::Event push_bitmappedmorph_vhgw_v(const cl_int se_rowrad, const bool erosion);
+
   private: struct clcv_image;
   private: struct clcv_se;
+  private: class clcv_kernel;
+  private: struct clcv_plan;
   protected:
+    // programs
+    static std::string get_section_options(const std::string & section);
+    static void * build_section(void * arg);
+    cl::Program & get_program(const std::string & kernel_name);
+    // kernels, cached per name, first two (pooled buffer) arguments and
+    // local size
+    cl_mem get_kernelkey_arg(const cl::Buffer & buffer);
+    clcv_kernel & get_kernel(const char * kernel_name,
+                             const cl::Buffer & arg0, const cl::Buffer & arg1,
+                             const cl::NDRange & local_work_size = cl::NullRange);
+    clcv_kernel & get_naivemorph_jit(const clcv_se_id se_id,
+                                     const cl::Buffer & image_in, const cl::Buffer & image_out,
+                                     const cl::NDRange & local_work_size);
     // image
     clcv_image & get_image(clcv_image_id image_id);
     clcv_image & get_image();
+    bool is_bitmappable();
+    unsigned get_bitmap_size();
     // se
     clcv_se & get_se(clcv_se_id se_id);
+    clcv_se_id load_se_nodecompose(const win2d<T> & win);
+    bool can_push_decomposedmorph_bitmapped(const clcv_se_id se_id);
+    bool can_push_decomposedmorph_naive(const clcv_se_id se_id, const bool erosion);
+    bool get_rect(const clcv_se_id se_id, cl_int & se_rowrad, cl_int & se_colrad);
+    bool get_bitmappedrect(const clcv_se_id se_id, cl_int & se_rowrad, cl_int & se_colrad);
+    // fused operators double the apron, check it still fits
+    cl_ulong get_fused_local_size(const unsigned se_rowrad, const unsigned se_colrad,
+                                  const unsigned se_size);
+    bool can_push_bitmappedmorph_fused(const cl_int se_rowrad, const cl_int se_colrad);
+    bool can_push_bitmappedmorph_fused(const clcv_se_id se_id);
+    bool can_push_naivemorph_fused(const clcv_se_id se_id);
+    // top-hats, closing selects the black one
+    cl::Event push_naivehat(const clcv_se_id se_id, const bool closing);
+    cl::Event push_bitmappedmorph_hat(const cl_int se_rowrad, const cl_int se_colrad,
+                                      const bool closing);
+    cl::Event push_bitmappedmorph_hat(const clcv_se_id se_id, const bool closing);
+    bool is_runsmorphable(const clcv_se_id se_id);
+    cl::Event push_edt_passes(const bool bitmapped, const bool inverted);
+    cl::Event push_disk_morph(const cl_int radius, const bool erosion, const bool bitmapped);
+    cl::Event push_bitmapped_area_filter(const cl_int min_area, const bool inverted);
+    // device side flag for the iterative operators
+    void reset_flag();
+    bool read_flag();
+    // queue, recorded by the plans
+    void enqueue_kernel(const cl::Kernel & kernel, const cl::NDRange & global_work_size,
+                        const cl::NDRange & local_work_size,
+                        const std::vector<cl::Event> * events = NULL, cl::Event * event = NULL);
+    void enqueue_copy(const cl::Buffer & src, const cl::Buffer & dst,
+                      size_t src_offset, size_t dst_offset, size_t size,
+                      const std::vector<cl::Event> * events = NULL, cl::Event * event = NULL);
+    clcv_plan & get_plan(clcv_plan_id plan_id);
     // buffers
     typedef std::pair<cl::Buffer, cl::Buffer> clcv_bufferpair;
+    // reconstruction, marker.first holds the result
+    cl::Event push_bitmapped_reconstruct(clcv_bufferpair & marker, const cl::Buffer & mask,
+                                         const unsigned batch);
+    cl::Event push_gray_reconstruct(clcv_bufferpair & marker, const cl::Buffer & mask,
+                                    const bool erosion, const unsigned batch);
     clcv_bufferpair get_bufferpair(unsigned size);
+    clcv_bufferpair get_scratchpair(unsigned size, unsigned slot = 0);
     void clear_bufferpairs();
     cl::Buffer & get_in_buffer(clcv_image_id image_id);
     cl::Buffer & get_out_buffer(clcv_image_id image_id);
@@ -164,15 +679,51 @@ namespace clcv
     CLCV & operator=(const CLCV &);
     
     cl_device_id m_device_id;
+    cl_device_type m_device_type;
+    cl_ulong m_local_mem_size;
     cl::Context m_context;
     cl::CommandQueue m_queue;
-    cl::Program m_program;
+    // kernel name -> section, and section -> program
+    std::map<std::string, std::string> m_kernel_sections;
+    typedef std::map<std::string, cl::Program> clcv_programmap;
+    clcv_programmap m_programs;
+    bool m_naive_jit;
+
+    // Keeps the last value of each argument, only the changed ones are set
+    class clcv_kernel : public cl::Kernel
+    {
+    public:
+      clcv_kernel(const cl::Kernel & kernel);
+      template<typename A>
+      cl_int setArg(cl_uint index, A value);
+      cl_int setArg(cl_uint index, const cl::Buffer & buffer);
+      cl_int setArg(cl_uint index, ::size_t size, void * arg_ptr);
+
+    private:
+      std::vector<std::string> m_args;
+      // the last buffer of each argument, kept alive so that its handle
+      // can't be reused (one per argument, the cache stays bounded)
+      std::vector<cl::Buffer> m_buffers;
+    };
+    struct clcv_kernelkey {
+      std::string name;
+      cl_mem arg0;
+      cl_mem arg1;
+      ::size_t lxsize;
+      ::size_t lysize;
+      bool operator<(const clcv_kernelkey & other) const;
+    };
+    typedef std::map<clcv_kernelkey, clcv_kernel> clcv_kernelmap;
+    clcv_kernelmap m_kernels;
+    cl::Buffer m_flag;
     
     cl::NDRange m_global_work_size;
     cl::NDRange m_local_work_size;    
 
-    typedef std::map<unsigned, clcv_bufferpair> clcv_bufferpairmap;
+    typedef std::multimap<unsigned, clcv_bufferpair> clcv_bufferpairmap;
     clcv_bufferpairmap m_bufferpairs;
+    typedef std::map<std::pair<unsigned, unsigned>, clcv_bufferpair> clcv_scratchpairmap;
+    clcv_scratchpairmap m_scratchpairs;
     
     struct clcv_image {
       T * data;
@@ -180,6 +731,10 @@ namespace clcv
       unsigned ncols;
       clcv_bufferpair buffers;
       cl::NDRange global_work_size;
+      // allocated by the first labeling
+      cl::Buffer labels;
+      // allocated by the first skeleton with a quench function
+      cl::Buffer quench;
     };
     
     struct clcv_se {
@@ -190,8 +745,28 @@ namespace clcv
       unsigned colrad;
       unsigned buffer_size;
       unsigned se_nonzero;
+      // points of positive weight, the ones the rank filter counts
+      unsigned se_positive;
+      win2d_decomposition<T> decomposition;
+      std::vector<std::vector<clcv_se_id> > chain_ids;
+      // horizontal runs (row, first col, last col), weights 1 then -1 (the
+      // hit-or-miss background). Flat SEs have no background runs.
+      cl::Buffer runs_clmem;
+      unsigned nruns;
+      unsigned nbgruns;
+      unsigned runs_rowrad;
+      unsigned runs_colrad;
+      // CLCV_SE_POINT(row, col, weight) of each point, for naive_morph_jit
+      std::string jit_points;
     };
     
+    struct clcv_build_task {
+      cl::Context context;
+      std::string section;
+      cl::Program program;
+      cl_int err;
+    };
+
     typedef std::map<clcv_image_id, clcv_image> clcv_image_map;
     clcv_image_map m_images;
     clcv_image_id m_next_image_id;
@@ -200,6 +775,34 @@ namespace clcv
     typedef std::map<clcv_se_id, clcv_se> clcv_se_map;
     clcv_se_map m_ses;
     clcv_se_id m_next_se_id;
+
+    // A kernel launch, or a copy when kernel is null
+    struct clcv_plan_step {
+      cl::Kernel kernel;
+      cl::NDRange global_work_size;
+      cl::NDRange local_work_size;
+      cl::Buffer src;
+      cl::Buffer dst;
+      size_t src_offset;
+      size_t dst_offset;
+      size_t size;
+    };
+
+    struct clcv_plan {
+      clcv_image_id image_id;
+      // the image buffers before and after the chain
+      clcv_bufferpair input_buffers;
+      clcv_bufferpair output_buffers;
+      // the recorded kernels aren't shared with the cache
+      std::list<clcv_kernel> kernels;
+      std::vector<clcv_plan_step> steps;
+    };
+
+    typedef std::map<clcv_plan_id, clcv_plan> clcv_plan_map;
+    clcv_plan_map m_plans;
+    clcv_plan_id m_next_plan_id;
+    // the plan being recorded, 0 when none
+    clcv_plan_id m_recording_plan_id;
   };
 }
 
@@ -17,8 +17,11 @@
 #define CLCV_CLCV_HXX__
 
 #include <vector>
+#include <sstream>
 #include <cstdlib>
+#include <pthread.h>
 #include <clcv/clinit.h>
+#include <clcv/clcv_cl.h>
 #include <clcv/clcv.h>
 
 using namespace std;
@@ -28,15 +31,32 @@ namespace clcv
   template<typename T>
   inline
   CLCV<T>::CLCV(cl_device_type device_type)
-  : m_device_id(0), m_context(), m_queue(), m_program(),
+  : m_device_id(0), m_device_type(0), m_local_mem_size(0), m_context(), m_queue(),
+  m_kernel_sections(), m_programs(), m_naive_jit(false), m_kernels(),
   m_global_work_size(cl::NullRange), m_local_work_size(cl::NullRange),
-  m_bufferpairs(),
-  m_images(), m_next_image_id(1), m_current_image_id(0), m_ses(), m_next_se_id(0)
+  m_bufferpairs(), m_scratchpairs(),
+  m_images(), m_next_image_id(1), m_current_image_id(0), m_ses(), m_next_se_id(0),
+  m_plans(), m_next_plan_id(1), m_recording_plan_id(0)
   {
     m_device_id = get_device_fallback(device_type);
     m_context = clcv::get_context(m_device_id);
     m_queue = get_command_queue(m_context);
-    m_program = load_program(m_context, "clcv/clcv.cl");
+    vector<cl::Device> devices = m_context.getInfo<CL_CONTEXT_DEVICES>();
+    assert(devices.size() == 1);
+    m_device_type = devices[0].getInfo<CL_DEVICE_TYPE>();
+    m_local_mem_size = devices[0].getInfo<CL_DEVICE_LOCAL_MEM_SIZE>();
+    // The kernels of a section are between its #ifdef and #endif
+    istringstream source(clcv_cl_source);
+    const string guard("#ifdef CLCV_SECTION_"), kernel("kernel void ");
+    string line, section;
+    while (getline(source, line))
+      if (line.compare(0, guard.size(), guard) == 0)
+        section = line.substr(guard.size());
+      else if (line.compare(0, 6, "#endif") == 0)
+        section.clear();
+      else if (line.compare(0, kernel.size(), kernel) == 0 && !section.empty())
+        m_kernel_sections[line.substr(kernel.size(), line.find('(') - kernel.size())] = section;
+    m_flag = cl::Buffer(m_context, CL_MEM_READ_WRITE, sizeof (cl_int));
   }
 
   template<typename T>
@@ -60,9 +80,14 @@ namespace clcv
   inline
   cl_device_type CLCV<T>::get_device_type() const
   {
-    vector<cl::Device> devices = m_context.getInfo<CL_CONTEXT_DEVICES>();
-    assert(devices.size() == 1);
-    return devices[0].getInfo<CL_DEVICE_TYPE>();
+    return m_device_type;
+  }
+
+  template<typename T>
+  inline
+  cl_ulong CLCV<T>::get_local_mem_size() const
+  {
+    return m_local_mem_size;
   }
 
   
@@ -122,28 +147,255 @@ namespace clcv
   {
     return m_local_work_size;
   }
+
+  template<typename T>
+  inline
+  void CLCV<T>::warmup()
+  {
+    vector<string> kernel_names;
+    for (map<string, string>::const_iterator it = m_kernel_sections.begin();
+         it != m_kernel_sections.end(); ++it)
+      kernel_names.push_back(it->first);
+    warmup(kernel_names);
+  }
+
+  // One thread per program not built yet. The programs are only added to
+  // m_programs once all the threads are done.
+  template<typename T>
+  inline
+  void CLCV<T>::warmup(const vector<string> & kernel_names)
+  {
+    vector<clcv_build_task> tasks;
+    for (unsigned i = 0; i < kernel_names.size(); ++i)
+    {
+      map<string, string>::const_iterator it = m_kernel_sections.find(kernel_names[i]);
+      assert(it != m_kernel_sections.end());
+      bool found = m_programs.count(it->second) != 0;
+      for (unsigned j = 0; !found && j < tasks.size(); ++j)
+        found = tasks[j].section == it->second;
+      if (!found)
+      {
+        clcv_build_task task;
+        task.context = m_context;
+        task.section = it->second;
+        task.err = CL_SUCCESS;
+        tasks.push_back(task);
+      }
+    }
+
+    vector<pthread_t> threads(tasks.size());
+    for (unsigned i = 0; i < tasks.size(); ++i)
+    {
+      const int err = pthread_create(&threads[i], NULL, build_section, &tasks[i]);
+      assert(err == 0);
+      (void)err;
+    }
+    for (unsigned i = 0; i < tasks.size(); ++i)
+      pthread_join(threads[i], NULL);
+
+    cl_int err = CL_SUCCESS;
+    for (unsigned i = 0; i < tasks.size(); ++i)
+      if (tasks[i].err == CL_SUCCESS)
+        m_programs[tasks[i].section] = tasks[i].program;
+      else
+        err = tasks[i].err;
+    if (err != CL_SUCCESS)
+      throw cl::Error(err, "clBuildProgram");
+  }
+
+  template<typename T>
+  inline
+  string CLCV<T>::get_section_options(const string & section)
+  {
+    return "-D CLCV_SECTIONS -D CLCV_SECTION_" + section;
+  }
+
+  template<typename T>
+  inline
+  void * CLCV<T>::build_section(void * arg)
+  {
+    clcv_build_task & task = *static_cast<clcv_build_task *>(arg);
+    try {
+      task.program = load_program_source(task.context, clcv_cl_source,
+                                         get_section_options(task.section).c_str());
+    } catch(cl::Error & err) {
+      task.err = err.err();
+    }
+    return NULL;
+  }
+
+  template<typename T>
+  inline
+  cl::Program & CLCV<T>::get_program(const string & kernel_name)
+  {
+    map<string, string>::const_iterator it = m_kernel_sections.find(kernel_name);
+    assert(it != m_kernel_sections.end());
+    typename clcv_programmap::iterator program = m_programs.find(it->second);
+    if (program == m_programs.end())
+      program = m_programs.insert(make_pair(it->second, load_program_source(
+        m_context, clcv_cl_source, get_section_options(it->second).c_str()))).first;
+    return program->second;
+  }
+
+  template<typename T>
+  inline
+  typename CLCV<T>::clcv_kernel & CLCV<T>::get_kernel(const char * kernel_name,
+                                                     const cl::Buffer & arg0,
+                                                     const cl::Buffer & arg1,
+                                                     const cl::NDRange & local_work_size)
+  {
+    const clcv_kernelkey key = { kernel_name, get_kernelkey_arg(arg0), get_kernelkey_arg(arg1),
+                                 local_work_size.dimensions() > 0 ? xdim(local_work_size) : 0,
+                                 local_work_size.dimensions() > 1 ? ydim(local_work_size) : 0 };
+    if (m_recording_plan_id != 0)
+    {
+      clcv_plan & plan = get_plan(m_recording_plan_id);
+      plan.kernels.push_back(clcv_kernel(cl::Kernel(get_program(kernel_name), kernel_name)));
+      return plan.kernels.back();
+    }
+    typename clcv_kernelmap::iterator it = m_kernels.find(key);
+    if (it == m_kernels.end())
+      it = m_kernels.insert(make_pair(key, clcv_kernel(cl::Kernel(get_program(kernel_name),
+                                                                  kernel_name)))).first;
+    return it->second;
+  }
+
+  // Only the pooled buffers (images and scratch pairs) tell the cached
+  // kernels apart, the transient ones (counts, labels...) would grow the
+  // cache with each allocation
+  template<typename T>
+  inline
+  cl_mem CLCV<T>::get_kernelkey_arg(const cl::Buffer & buffer)
+  {
+    for (typename clcv_bufferpairmap::const_iterator it = m_bufferpairs.begin();
+         it != m_bufferpairs.end(); ++it)
+      if (it->second.first() == buffer() || it->second.second() == buffer())
+        return buffer();
+    for (typename clcv_scratchpairmap::const_iterator it = m_scratchpairs.begin();
+         it != m_scratchpairs.end(); ++it)
+      if (it->second.first() == buffer() || it->second.second() == buffer())
+        return buffer();
+    return NULL;
+  }
+
+  template<typename T>
+  inline
+  CLCV<T>::clcv_kernel::clcv_kernel(const cl::Kernel & kernel)
+  : cl::Kernel(kernel), m_args(), m_buffers()
+  {
+  }
+
+  template<typename T>
+  template<typename A>
+  inline
+  cl_int CLCV<T>::clcv_kernel::setArg(cl_uint index, A value)
+  {
+    return setArg(index, cl::detail::KernelArgumentHandler<A>::size(value),
+                  cl::detail::KernelArgumentHandler<A>::ptr(value));
+  }
+
+  // The buffer is kept until replaced: a cl_mem equal to the last one set is
+  // then the same object (it can't have been released and its handle
+  // reused), and the set can be skipped
+  template<typename T>
+  inline
+  cl_int CLCV<T>::clcv_kernel::setArg(cl_uint index, const cl::Buffer & buffer)
+  {
+    if (index >= m_buffers.size())
+      m_buffers.resize(index + 1);
+    m_buffers[index] = buffer;
+    cl_mem mem = buffer();
+    return setArg(index, sizeof (cl_mem), &mem);
+  }
+
+  // Local memory arguments are only a size
+  template<typename T>
+  inline
+  cl_int CLCV<T>::clcv_kernel::setArg(cl_uint index, ::size_t size, void * arg_ptr)
+  {
+    string arg(1, arg_ptr == NULL ? 'l' : 'v');
+    if (arg_ptr == NULL)
+      arg.append((const char *)&size, sizeof (size));
+    else
+      arg.append((const char *)arg_ptr, size);
+    if (index < m_args.size() && m_args[index] == arg)
+      return CL_SUCCESS;
+    const cl_int err = cl::Kernel::setArg(index, size, arg_ptr);
+    if (index >= m_args.size())
+      m_args.resize(index + 1);
+    m_args[index] = arg;
+    return err;
+  }
+
+  template<typename T>
+  inline
+  bool CLCV<T>::clcv_kernelkey::operator<(const clcv_kernelkey & other) const
+  {
+    if (name != other.name)
+      return name < other.name;
+    if (arg0 != other.arg0)
+      return arg0 < other.arg0;
+    if (arg1 != other.arg1)
+      return arg1 < other.arg1;
+    if (lxsize != other.lxsize)
+      return lxsize < other.lxsize;
+    return lysize < other.lysize;
+  }
   
+  // Pairs are recycled once their image is closed, but two open images
+  // never share one (e.g. the marker and the mask of a reconstruction)
   template<typename T>
   inline
   typename CLCV<T>::clcv_bufferpair CLCV<T>::get_bufferpair(unsigned size)
   {
-    clcv_bufferpairmap::iterator it = m_bufferpairs.find(size);
-    if (it != m_bufferpairs.end())
+    std::pair<typename clcv_bufferpairmap::iterator, typename clcv_bufferpairmap::iterator>
+      range = m_bufferpairs.equal_range(size);
+    for (typename clcv_bufferpairmap::iterator it = range.first; it != range.second; ++it)
     {
-      return it->second;
+      bool used = false;
+      for (typename clcv_image_map::iterator img = m_images.begin();
+           !used && img != m_images.end(); ++img)
+        used = img->second.buffers.first() == it->second.first()
+          || img->second.buffers.first() == it->second.second();
+      if (!used)
+        return it->second;
     }
     cl::Buffer a_mem(get_context(), CL_MEM_READ_WRITE, size);
     cl::Buffer b_mem(get_context(), CL_MEM_READ_WRITE, size);
     clcv_bufferpair bufferpair(a_mem, b_mem);
-    m_bufferpairs[size] = bufferpair;
+    m_bufferpairs.insert(std::make_pair(size, bufferpair));
     return bufferpair;
   }
   
+  // Temporary buffers used by the multi-pass operators. They are never
+  // attached to an image. Operators calling each other use different slots:
+  // slot 0 is for the innermost operators (e.g. the vHGW g and h buffers),
+  // slot 1 for the operands saved by the composite ones, slot 2 for the
+  // originals kept by the residue operators (top-hats, gradients).
+  template<typename T>
+  inline
+  typename CLCV<T>::clcv_bufferpair CLCV<T>::get_scratchpair(unsigned size, unsigned slot)
+  {
+    const std::pair<unsigned, unsigned> key(size, slot);
+    typename clcv_scratchpairmap::iterator it = m_scratchpairs.find(key);
+    if (it != m_scratchpairs.end())
+    {
+      return it->second;
+    }
+    cl::Buffer a_mem(get_context(), CL_MEM_READ_WRITE, size);
+    cl::Buffer b_mem(get_context(), CL_MEM_READ_WRITE, size);
+    clcv_bufferpair bufferpair(a_mem, b_mem);
+    m_scratchpairs[key] = bufferpair;
+    return bufferpair;
+  }
+
   template<typename T>
   inline
   void CLCV<T>::clear_bufferpairs()
   {
     m_bufferpairs.clear();
+    m_scratchpairs.clear();
+    m_kernels.clear();
   }
   
   template<typename T>
@@ -162,7 +414,8 @@ namespace clcv
       {
         data, img.nrows(), img.ncols(),
         get_bufferpair(size),
-        cl::NDRange(img.ncols(), img.nrows())
+        cl::NDRange(img.ncols(), img.nrows()),
+        cl::Buffer(), cl::Buffer()
       };
     unsigned id = m_next_image_id++;
     m_images[id] = image;
@@ -246,22 +499,92 @@ namespace clcv
   template<typename T>
   inline
   clcv_se_id CLCV<T>::load_se(const win2d<T> & win)
+  {
+    clcv_se_id id = load_se_nodecompose(win);
+    clcv_se & se = get_se(id);
+    se.decomposition = win2d_decomposition<T>(win);
+    // Load the smaller SEs for the naive chains
+    const typename win2d_decomposition<T>::chains & chains = se.decomposition.get_chains();
+    se.chain_ids.resize(chains.size());
+    for (unsigned i = 0; i < chains.size(); ++i)
+      for (unsigned j = 0; j < chains[i].size(); ++j)
+        se.chain_ids[i].push_back(load_se_nodecompose(chains[i][j]));
+    // Horizontal runs for the bitmapped operators, the foreground first.
+    // win2d is sorted by row then col.
+    std::vector<T> runs;
+    se.nruns = 0;
+    se.nbgruns = 0;
+    se.runs_rowrad = 0;
+    se.runs_colrad = 0;
+    for (int weight = 1; weight >= -1; weight -= 2)
+      for (typename win2d<T>::const_iter it = win.begin(); it != win.end(); ++it)
+      {
+        if (it->second != 1 && it->second != -1)
+        {
+          se.nruns = se.nbgruns = 0;
+          return id;
+        }
+        if (it->second != weight)
+          continue;
+        const coord row = it->first.row();
+        const coord col = it->first.col();
+        if ((weight == 1 ? se.nruns : se.nbgruns) > 0 && runs[runs.size()-3] == row
+            && runs[runs.size()-1] == col - 1)
+          runs[runs.size()-1] = col;
+        else
+        {
+          runs.push_back(row);
+          runs.push_back(col);
+          runs.push_back(col);
+          ++(weight == 1 ? se.nruns : se.nbgruns);
+        }
+        se.runs_rowrad = std::max<unsigned>(se.runs_rowrad, std::abs(row));
+        se.runs_colrad = std::max<unsigned>(se.runs_colrad, std::abs(col));
+      }
+    if (!runs.empty())
+      se.runs_clmem = cl::Buffer(get_context(), CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR,
+                                 runs.size() * sizeof (T), &runs[0]);
+    return id;
+  }
+
+  template<typename T>
+  inline
+  clcv_se_id CLCV<T>::load_se(const win2d<T> & fg, const win2d<T> & bg)
+  {
+    win2d<T> win;
+    for (typename win2d<T>::const_iter it = fg.begin(); it != fg.end(); ++it)
+      win.add(it->first, 1);
+    for (typename win2d<T>::const_iter it = bg.begin(); it != bg.end(); ++it)
+      win.add(it->first, -1);
+    return load_se(win);
+  }
+
+  template<typename T>
+  inline
+  clcv_se_id CLCV<T>::load_se_nodecompose(const win2d<T> & win)
   {
     size_t size = win.count() * sizeof (T) * 3;
     T * buffer = new T[size];
     
     // convert the window to an array of coord
     unsigned i = 0;
+    unsigned se_positive = 0;
+    ostringstream jit_points;
     for (typename win2d<T>::const_iter it = win.begin(); it != win.end(); ++it)
     {
+      se_positive += it->second > 0;
       buffer[i++] = it->first.row();
       buffer[i++] = it->first.col();
       buffer[i++] = it->second;
+      jit_points << "  CLCV_SE_POINT(" << it->first.row() << ", " << it->first.col()
+                 << ", " << it->second << ") \\\n";
     }
     // And finally allocate the cl_mem
     cl::Buffer se_mem(get_context(), CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, size, buffer);
     // Save it
-    clcv_se se = { se_mem, win.nrows(), win.ncols(), win.maxrow(), win.maxcol(), size, win.count() };
+    clcv_se se = { se_mem, win.nrows(), win.ncols(), win.maxrow(), win.maxcol(), size, win.count(),
+                   se_positive, win2d_decomposition<T>(), std::vector<std::vector<clcv_se_id> >(),
+                   cl::Buffer(), 0, 0, 0, 0, jit_points.str() };
     // Clean it
     delete[] buffer;
     // and return it
@@ -276,7 +599,87 @@ namespace clcv
   {
     typename clcv_se_map::iterator it = m_ses.find(se_id);
     if (it != m_ses.end())
-      m_ses.erase(se_id);
+    {
+      for (unsigned i = 0; i < it->second.chain_ids.size(); ++i)
+        for (unsigned j = 0; j < it->second.chain_ids[i].size(); ++j)
+          m_ses.erase(it->second.chain_ids[i][j]);
+      m_ses.erase(it);
+    }
+  }
+
+  template<typename T>
+  inline
+  clcv_plan_id CLCV<T>::begin_plan()
+  {
+    assert(m_recording_plan_id == 0);
+    clcv_image & image = get_image();
+    clcv_plan plan;
+    plan.image_id = m_current_image_id;
+    plan.input_buffers = image.buffers;
+    m_recording_plan_id = m_next_plan_id++;
+    m_plans[m_recording_plan_id] = plan;
+    return m_recording_plan_id;
+  }
+
+  // Nothing ran, the image gets its buffers back
+  template<typename T>
+  inline
+  void CLCV<T>::end_plan()
+  {
+    clcv_plan & plan = get_plan(m_recording_plan_id);
+    clcv_image & image = get_image(plan.image_id);
+    plan.output_buffers = image.buffers;
+    image.buffers = plan.input_buffers;
+    m_recording_plan_id = 0;
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_plan(clcv_plan_id plan_id, const image2d<T> & img)
+  {
+    assert(m_recording_plan_id == 0);
+    clcv_plan & plan = get_plan(plan_id);
+    clcv_image & image = get_image(plan.image_id);
+    assert(img.nrows() == image.nrows && img.ncols() == image.ncols);
+    { // Copy the image
+      int i = 0;
+      for (unsigned r = 0; r < img.nrows(); ++r)
+        for (unsigned c = 0; c < img.ncols(); ++c)
+          image.data[i++] = img(r, c);
+    }
+    m_current_image_id = plan.image_id;
+    image.buffers = plan.output_buffers;
+
+    cl::Event event = write_mem(m_queue, plan.input_buffers.first, image.data,
+                                image.nrows * image.ncols * sizeof (T));
+    for (unsigned i = 0; i < plan.steps.size(); ++i)
+    {
+      const clcv_plan_step & step = plan.steps[i];
+      if (step.kernel() != NULL)
+        m_queue.enqueueNDRangeKernel(step.kernel, cl::NullRange, step.global_work_size,
+                                     step.local_work_size, NULL, &event);
+      else
+        m_queue.enqueueCopyBuffer(step.src, step.dst, step.src_offset, step.dst_offset,
+                                  step.size, NULL, &event);
+    }
+    return event;
+  }
+
+  template<typename T>
+  inline
+  void CLCV<T>::unload_plan(clcv_plan_id plan_id)
+  {
+    assert(plan_id != m_recording_plan_id);
+    m_plans.erase(plan_id);
+  }
+
+  template<typename T>
+  inline
+  typename CLCV<T>::clcv_plan & CLCV<T>::get_plan(clcv_plan_id plan_id)
+  {
+    typename clcv_plan_map::iterator it = m_plans.find(plan_id);
+    assert(it != m_plans.end());
+    return it->second;
   }
 
   template<typename T>
@@ -295,6 +698,92 @@ namespace clcv
     return get_image(m_current_image_id);
   }
   
+  // Whether the current image can go through the bitmapped operators
+  template<typename T>
+  inline
+  bool CLCV<T>::is_bitmappable()
+  {
+    const unsigned size = get_nrows() * get_ncols();
+    if (get_ncols() % 32 != 0)
+      return false;
+    return get_device_type() == CL_DEVICE_TYPE_CPU ? size % 32 == 0 : size % (32*64) == 0;
+  }
+
+  // Size in bytes of the bitmapped version of the current image
+  template<typename T>
+  inline
+  unsigned CLCV<T>::get_bitmap_size()
+  {
+    return get_nrows() * get_ncols() / 32 * sizeof (T);
+  }
+
+  // Flat SE the bitmapped runs operators can handle on the current image
+  template<typename T>
+  inline
+  bool CLCV<T>::is_runsmorphable(const clcv_se_id se_id)
+  {
+    clcv_se & se = get_se(se_id);
+    return se.nruns > 0 && se.nbgruns == 0 && is_bitmappable();
+  }
+
+  template<typename T>
+  inline
+  void CLCV<T>::reset_flag()
+  {
+    static const cl_int zero = 0;
+    m_queue.enqueueWriteBuffer(m_flag, CL_FALSE, 0, sizeof (cl_int), &zero);
+  }
+
+  // Blocking
+  template<typename T>
+  inline
+  bool CLCV<T>::read_flag()
+  {
+    assert(m_recording_plan_id == 0);
+    cl_int flag;
+    m_queue.enqueueReadBuffer(m_flag, CL_TRUE, 0, sizeof (cl_int), &flag);
+    return flag != 0;
+  }
+
+  template<typename T>
+  inline
+  void CLCV<T>::enqueue_kernel(const cl::Kernel & kernel, const cl::NDRange & global_work_size,
+                               const cl::NDRange & local_work_size,
+                               const std::vector<cl::Event> * events, cl::Event * event)
+  {
+    if (m_recording_plan_id == 0)
+    {
+      m_queue.enqueueNDRangeKernel(kernel, cl::NullRange, global_work_size, local_work_size,
+                                   events, event);
+      return;
+    }
+    // nothing ran, no event
+    if (event != NULL)
+      *event = cl::Event();
+    const clcv_plan_step step = { kernel, global_work_size, local_work_size,
+                                  cl::Buffer(), cl::Buffer(), 0, 0, 0 };
+    get_plan(m_recording_plan_id).steps.push_back(step);
+  }
+
+  template<typename T>
+  inline
+  void CLCV<T>::enqueue_copy(const cl::Buffer & src, const cl::Buffer & dst,
+                             size_t src_offset, size_t dst_offset, size_t size,
+                             const std::vector<cl::Event> * events, cl::Event * event)
+  {
+    if (m_recording_plan_id == 0)
+    {
+      m_queue.enqueueCopyBuffer(src, dst, src_offset, dst_offset, size, events, event);
+      return;
+    }
+    // nothing ran, no event
+    if (event != NULL)
+      *event = cl::Event();
+    const clcv_plan_step step = { cl::Kernel(), cl::NullRange, cl::NullRange,
+                                  src, dst, src_offset, dst_offset, size };
+    get_plan(m_recording_plan_id).steps.push_back(step);
+  }
+
   template<typename T>
   inline
   typename CLCV<T>::clcv_se & CLCV<T>::get_se(clcv_se_id se_id)
@@ -342,7 +831,7 @@ namespace clcv
     const int nb_threads = get_device_type() == CL_DEVICE_TYPE_CPU ? 1 : 64;
     assert((nrows*ncols) % (32*nb_threads) == 0);
 
-    cl::Kernel kernel(m_program, "unbitmap");
+    clcv_kernel & kernel = get_kernel("unbitmap", image_in, image_out);
     kernel.setArg(0, image_in);
     kernel.setArg(1, image_out);
     kernel.setArg(2, 32 * nb_threads * sizeof (cl_int), NULL);
@@ -370,7 +859,7 @@ namespace clcv
                                         get_nrows(), get_ncols());
     swap_buffers();
     cl::Event event;
-    m_queue.enqueueNDRangeKernel(kernel, cl::NullRange, g_size, l_size, NULL, &event);
+    enqueue_kernel(kernel, g_size, l_size, NULL, &event);
     return event;
   }
   
@@ -380,7 +869,7 @@ namespace clcv
                                       const cl_int nrows, const cl_int ncols,
                                       const cl_int threshold, const cl_int min, const cl_int max)
   {
-    cl::Kernel kernel(m_program, "binarize");
+    clcv_kernel & kernel = get_kernel("binarize", image_in, image_out);
     kernel.setArg(0, image_in);
     kernel.setArg(1, image_out);
     kernel.setArg(2, nrows);
@@ -405,7 +894,7 @@ namespace clcv
                                         threshold, min, max);
     swap_buffers();
     cl::Event event;
-    m_queue.enqueueNDRangeKernel(kernel, cl::NullRange, g_size, l_size, NULL, &event);
+    enqueue_kernel(kernel, g_size, l_size, NULL, &event);
     return event;
   }
 
@@ -418,7 +907,7 @@ namespace clcv
     const int nb_threads = get_device_type() == CL_DEVICE_TYPE_CPU ? 1 : 64;
     assert((nrows*ncols) % (32*nb_threads) == 0);
 
-    cl::Kernel kernel(m_program, "bitmapped_binarize");
+    clcv_kernel & kernel = get_kernel("bitmapped_binarize", image_in, image_out);
     kernel.setArg(0, image_in);
     kernel.setArg(1, image_out);
     kernel.setArg(2, threshold);
@@ -450,10 +939,63 @@ namespace clcv
                                                  threshold, inverted);
     swap_buffers();
     cl::Event event;
-    m_queue.enqueueNDRangeKernel(kernel, cl::NullRange, g_size, l_size, NULL, &event);
+    enqueue_kernel(kernel, g_size, l_size, NULL, &event);
     return event;
   }
   
+  template<typename T>
+  inline
+  void CLCV<T>::set_naive_jit(const bool enabled)
+  {
+    m_naive_jit = enabled;
+  }
+
+  template<typename T>
+  inline
+  bool CLCV<T>::get_naive_jit() const
+  {
+    return m_naive_jit;
+  }
+
+  // The programs are keyed by their defines, i.e. the SE and the work-group
+  // size, so that the SEs loaded several times are only built once
+  template<typename T>
+  inline
+  typename CLCV<T>::clcv_kernel & CLCV<T>::get_naivemorph_jit(const clcv_se_id se_id,
+                                                             const cl::Buffer & image_in,
+                                                             const cl::Buffer & image_out,
+                                                             const cl::NDRange & local_work_size)
+  {
+    clcv_se & se = get_se(se_id);
+    const clcv_kernelkey kernel_key = { "naive_morph_jit\n" + se.jit_points,
+                                        get_kernelkey_arg(image_in),
+                                        get_kernelkey_arg(image_out),
+                                        xdim(local_work_size), ydim(local_work_size) };
+    typename clcv_kernelmap::iterator it = m_kernels.find(kernel_key);
+    if (it != m_kernels.end() && m_recording_plan_id == 0)
+      return it->second;
+
+    ostringstream defines;
+    defines << "#define CLCV_SE_ROWRAD " << se.rowrad << "\n"
+            << "#define CLCV_SE_COLRAD " << se.colrad << "\n"
+            << "#define CLCV_LXSIZE " << xdim(local_work_size) << "\n"
+            << "#define CLCV_LYSIZE " << ydim(local_work_size) << "\n"
+            << "#define CLCV_SE_POINTS \\\n" << se.jit_points << "\n";
+    const string key = "NAIVE_JIT\n" + defines.str();
+    typename clcv_programmap::iterator program = m_programs.find(key);
+    if (program == m_programs.end())
+      program = m_programs.insert(make_pair(key, load_program_source(
+        m_context, defines.str() + clcv_cl_source, get_section_options("NAIVE_JIT").c_str()))).first;
+    cl::Kernel kernel(program->second, "naive_morph_jit");
+    if (m_recording_plan_id != 0)
+    {
+      clcv_plan & plan = get_plan(m_recording_plan_id);
+      plan.kernels.push_back(clcv_kernel(kernel));
+      return plan.kernels.back();
+    }
+    return m_kernels.insert(make_pair(kernel_key, clcv_kernel(kernel))).first->second;
+  }
+
   template<typename T>
   inline
   cl::Kernel CLCV<T>::create_naivemorph(const cl::Buffer & image_in,
@@ -463,8 +1005,19 @@ namespace clcv
                                         const cl::NDRange & local_work_size)
   {
     clcv_se & se = get_se(se_id);
+
+    if (m_naive_jit && se.se_nonzero <= CLCV_NAIVE_JIT_MAX_COUNT)
+    {
+      clcv_kernel & kernel = get_naivemorph_jit(se_id, image_in, image_out, local_work_size);
+      kernel.setArg(0, image_in);
+      kernel.setArg(1, image_out);
+      kernel.setArg(2, nrows);
+      kernel.setArg(3, ncols);
+      kernel.setArg(4, se_targetsum);
+      return kernel;
+    }
     
-    cl::Kernel kernel(m_program, "naive_morph");
+    clcv_kernel & kernel = get_kernel("naive_morph", image_in, image_out, local_work_size);
     kernel.setArg(0, image_in);
     kernel.setArg(1, image_out);
     kernel.setArg(2, nrows);
@@ -497,7 +1050,7 @@ namespace clcv
                                           l_size);
     swap_buffers();
     cl::Event event;
-    m_queue.enqueueNDRangeKernel(kernel, cl::NullRange, g_size, l_size, NULL, &event);
+    enqueue_kernel(kernel, g_size, l_size, NULL, &event);
     return event;    
   }
 
@@ -520,6 +1073,13 @@ namespace clcv
   inline
   cl::Event CLCV<T>::push_naivedilation(const clcv_se_id se_id)
   {
+    if (can_push_decomposedmorph_bitmapped(se_id))
+      return push_decomposedmorph_bitmapped(se_id, false);
+    if (is_runsmorphable(se_id))
+      return push_runsmorph(se_id, false);
+    if (can_push_decomposedmorph_naive(se_id, false))
+      return push_decomposedmorph_naive(se_id, false);
+
     clcv_se & se = get_se(se_id);
     cl_int se_nonzero = se.se_nonzero;
 
@@ -545,6 +1105,13 @@ namespace clcv
   inline
   cl::Event CLCV<T>::push_naiveerosion(const clcv_se_id se_id)
   {
+    if (can_push_decomposedmorph_bitmapped(se_id))
+      return push_decomposedmorph_bitmapped(se_id, true);
+    if (is_runsmorphable(se_id))
+      return push_runsmorph(se_id, true);
+    if (can_push_decomposedmorph_naive(se_id, true))
+      return push_decomposedmorph_naive(se_id, true);
+
     clcv_se & se = get_se(se_id);
     cl_int se_nonzero = se.se_nonzero;
     
@@ -555,6 +1122,28 @@ namespace clcv
   inline
   cl::Event CLCV<T>::push_naiveopening(const clcv_se_id se_id)
   {
+    clcv_se & se = get_se(se_id);
+    cl_int se_nonzero = se.se_nonzero;
+    cl_int se_rowrad, se_colrad;
+
+    // Fused versions of the paths push_naiveerosion/dilation would take
+    if (get_bitmappedrect(se_id, se_rowrad, se_colrad))
+    { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
+      push_bitmappedbinarize(1);
+      push_bitmappedmorph_opening(se_rowrad, se_colrad);
+      return push_unbitmap();
+    }
+    if (!can_push_decomposedmorph_bitmapped(se_id))
+    {
+      if (is_runsmorphable(se_id))
+      {
+        if (can_push_bitmappedmorph_fused(se_id))
+          return push_runsmorph_fused(se_id, false);
+      }
+      else if (!can_push_decomposedmorph_naive(se_id, true) && can_push_naivemorph_fused(se_id))
+        return push_naivemorph_fused(se_id, se_nonzero, -se_nonzero+1);
+    }
+
     push_naiveerosion(se_id);
     return push_naivedilation(se_id);
   }
@@ -563,216 +1152,2836 @@ namespace clcv
   inline
   cl::Event CLCV<T>::push_naiveclosing(const clcv_se_id se_id)
   {
+    clcv_se & se = get_se(se_id);
+    cl_int se_nonzero = se.se_nonzero;
+    cl_int se_rowrad, se_colrad;
+
+    // Fused versions of the paths push_naiveerosion/dilation would take
+    if (get_bitmappedrect(se_id, se_rowrad, se_colrad))
+    { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
+      push_bitmappedbinarize(1);
+      push_bitmappedmorph_closing(se_rowrad, se_colrad);
+      return push_unbitmap();
+    }
+    if (!can_push_decomposedmorph_bitmapped(se_id))
+    {
+      if (is_runsmorphable(se_id))
+      {
+        if (can_push_bitmappedmorph_fused(se_id))
+          return push_runsmorph_fused(se_id, true);
+      }
+      else if (!can_push_decomposedmorph_naive(se_id, false) && can_push_naivemorph_fused(se_id))
+        return push_naivemorph_fused(se_id, -se_nonzero+1, se_nonzero);
+    }
+
     push_naivedilation(se_id);
     return push_naiveerosion(se_id);
   }
 
   template<typename T>
   inline
-  cl::Kernel CLCV<T>::create_bitmappedmorph_dilation_h(const cl::Buffer & image_in,
-                                                       const cl::Buffer & image_out,
-                                                       const cl_int nrows, const cl_int ncols,
-                                                       const cl_int se_colrad,
-                                                       const cl::NDRange & local_work_size)
+  cl::Kernel CLCV<T>::create_naivegradient(const cl::Buffer & image_in,
+                                           const cl::Buffer & image_out,
+                                           const cl_int nrows, const cl_int ncols,
+                                           const clcv_se_id se_id,
+                                           const cl::NDRange & local_work_size)
   {
-    assert(se_colrad <= 32);
-    assert(ncols % 32 == 0);
+    clcv_se & se = get_se(se_id);
+    cl_int se_nonzero = se.se_nonzero;
 
-    cl::Kernel kernel(m_program, "bitmapped_dilation_h");
+    clcv_kernel & kernel = get_kernel("naive_gradient", image_in, image_out, local_work_size);
     kernel.setArg(0, image_in);
     kernel.setArg(1, image_out);
     kernel.setArg(2, nrows);
     kernel.setArg(3, ncols);
-    kernel.setArg(4, se_colrad);
-    cl_int local_size = (xdim(local_work_size) + 16*2)
-    * ydim(local_work_size) * sizeof (T);
-    kernel.setArg(5, local_size, NULL);
+    kernel.setArg(4, se.clmem);
+    kernel.setArg(5, se.rowrad);
+    kernel.setArg(6, se.colrad);
+    kernel.setArg(7, se.se_nonzero);
+    kernel.setArg(8, -se_nonzero+1);
+    kernel.setArg(9, se_nonzero);
+    kernel.setArg(10, se.buffer_size, NULL);
+    cl_int local_size = (xdim(local_work_size) + se.colrad*2)
+      * (ydim(local_work_size) + se.rowrad*2) * sizeof (T);
+    kernel.setArg(11, local_size, NULL);
+
     return kernel;
   }
 
   template<typename T>
   inline
-  cl::Event CLCV<T>::push_bitmappedmorph_dilation_h(const cl_int se_colrad)
+  cl::Event CLCV<T>::push_naivegradient(const clcv_se_id se_id)
   {
-    assert(get_image().ncols % 32 == 0);
-    const unsigned ncols_round = round(get_ncols()/32, 32);
-    const cl::NDRange b_size(ncols_round, get_nrows());
+    cl_int se_rowrad, se_colrad;
+
+    if (get_bitmappedrect(se_id, se_rowrad, se_colrad))
+    { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
+      push_bitmappedbinarize(1);
+      push_bitmappedmorph_gradient(se_rowrad, se_colrad);
+      return push_unbitmap();
+    }
+    if (is_runsmorphable(se_id))
+    { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
+      push_bitmappedbinarize(1);
+      push_bitmappedmorph_gradient(se_id);
+      return push_unbitmap();
+    }
 
     const cl::NDRange & l_size = get_local_work_size();
     const cl::NDRange & g_size = get_global_work_size().dimensions() == 0 ?
-    b_size : get_global_work_size();
+    get_image().global_work_size
+    : get_global_work_size();
+
+    cl::Kernel kernel = create_naivegradient(get_in_buffer(), get_out_buffer(),
+                                             get_nrows(), get_ncols(),
+                                             se_id, l_size);
+    swap_buffers();
+    cl::Event event;
+    enqueue_kernel(kernel, g_size, l_size, NULL, &event);
+    return event;
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_naivetophat(const clcv_se_id se_id)
+  {
+    return push_naivehat(se_id, false);
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_naiveblackhat(const clcv_se_id se_id)
+  {
+    return push_naivehat(se_id, true);
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_naivehat(const clcv_se_id se_id, const bool closing)
+  { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
+    clcv_se & se = get_se(se_id);
+    cl_int se_nonzero = se.se_nonzero;
+    cl_int se_rowrad, se_colrad;
+
+    if (get_bitmappedrect(se_id, se_rowrad, se_colrad))
+    {
+      push_bitmappedbinarize(1);
+      push_bitmappedmorph_hat(se_rowrad, se_colrad, closing);
+      return push_unbitmap();
+    }
+    if (!can_push_decomposedmorph_bitmapped(se_id))
+    {
+      if (is_runsmorphable(se_id))
+      {
+        push_bitmappedbinarize(1);
+        push_bitmappedmorph_hat(se_id, closing);
+        return push_unbitmap();
+      }
+      if (!can_push_decomposedmorph_naive(se_id, !closing) && can_push_naivemorph_fused(se_id))
+        return closing ? push_naivemorph_fused(se_id, -se_nonzero+1, se_nonzero, 2)
+          : push_naivemorph_fused(se_id, se_nonzero, -se_nonzero+1, 1);
+    }
+
+    // Keep the original image aside
+    const unsigned size = get_nrows() * get_ncols() * sizeof (T);
+    clcv_bufferpair saved = get_scratchpair(size, 2);
+    enqueue_copy(get_in_buffer(), saved.first, 0, 0, size);
+    closing ? push_naiveclosing(se_id) : push_naiveopening(se_id);
+    cl::Event event = closing ?
+      push_naivelogic(get_in_buffer(), saved.first, get_out_buffer(), logic_andnot)
+      : push_naivelogic(saved.first, get_in_buffer(), get_out_buffer(), logic_andnot);
+    swap_buffers();
+    return event;
+  }
+
+  template<typename T>
+  inline
+  cl::Kernel CLCV<T>::create_naivemorph_fused(const cl::Buffer & image_in,
+                                              const cl::Buffer & image_out,
+                                              const cl_int nrows, const cl_int ncols,
+                                              const clcv_se_id se_id,
+                                              const cl_int se_targetsum1,
+                                              const cl_int se_targetsum2,
+                                              const cl_int residue,
+                                              const cl::NDRange & local_work_size)
+  {
+    clcv_se & se = get_se(se_id);
+
+    clcv_kernel & kernel = get_kernel("naive_morph_fused", image_in, image_out, local_work_size);
+    kernel.setArg(0, image_in);
+    kernel.setArg(1, image_out);
+    kernel.setArg(2, nrows);
+    kernel.setArg(3, ncols);
+    kernel.setArg(4, se.clmem);
+    kernel.setArg(5, se.rowrad);
+    kernel.setArg(6, se.colrad);
+    kernel.setArg(7, se.se_nonzero);
+    kernel.setArg(8, se_targetsum1);
+    kernel.setArg(9, se_targetsum2);
+    kernel.setArg(10, residue);
+    kernel.setArg(11, se.buffer_size, NULL);
+    cl_int local_size = (xdim(local_work_size) + se.colrad*4)
+      * (ydim(local_work_size) + se.rowrad*4) * sizeof (T);
+    kernel.setArg(12, local_size, NULL);
+    kernel.setArg(13, local_size, NULL);
+
+    return kernel;
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_naivemorph_fused(const clcv_se_id se_id,
+                                           const cl_int se_targetsum1,
+                                           const cl_int se_targetsum2,
+                                           const cl_int residue)
+  {
+    const cl::NDRange & l_size = get_local_work_size();
+    const cl::NDRange & g_size = get_global_work_size().dimensions() == 0 ?
+    get_image().global_work_size
+    : get_global_work_size();
+
+    cl::Kernel kernel = create_naivemorph_fused(get_in_buffer(), get_out_buffer(),
+                                                get_nrows(), get_ncols(),
+                                                se_id, se_targetsum1, se_targetsum2,
+                                                residue, l_size);
+    swap_buffers();
+    cl::Event event;
+    enqueue_kernel(kernel, g_size, l_size, NULL, &event);
+    return event;
+  }
+
+  // Both tiles of a fused operator: the work group plus twice the apron
+  template<typename T>
+  inline
+  cl_ulong CLCV<T>::get_fused_local_size(const unsigned se_rowrad, const unsigned se_colrad,
+                                         const unsigned se_size)
+  {
+    const cl::NDRange & l_size = get_local_work_size();
+    return (xdim(l_size) + se_colrad*4) * (ydim(l_size) + se_rowrad*4) * sizeof (T) * 2
+      + se_size;
+  }
+
+  template<typename T>
+  inline
+  bool CLCV<T>::can_push_bitmappedmorph_fused(const cl_int se_rowrad, const cl_int se_colrad)
+  {
+    return se_colrad <= 32 && se_rowrad <= CLCV_VHGW_ROWRAD
+      && get_fused_local_size(se_rowrad, 1, 0) <= get_local_mem_size();
+  }
+
+  template<typename T>
+  inline
+  bool CLCV<T>::can_push_bitmappedmorph_fused(const clcv_se_id se_id)
+  {
+    clcv_se & se = get_se(se_id);
+    return se.nruns > 0 && se.nbgruns == 0
+      && get_fused_local_size(se.runs_rowrad, se.runs_colrad/32 + 1,
+                              se.nruns * 3 * sizeof (T)) <= get_local_mem_size();
+  }
+
+  template<typename T>
+  inline
+  bool CLCV<T>::can_push_naivemorph_fused(const clcv_se_id se_id)
+  {
+    clcv_se & se = get_se(se_id);
+    return get_fused_local_size(se.rowrad, se.colrad, se.buffer_size) <= get_local_mem_size();
+  }
+
+  // Only the chains made of centered horizontal/vertical segments can be
+  // bitmapped
+  template<typename T>
+  inline
+  bool CLCV<T>::can_push_decomposedmorph_bitmapped(const clcv_se_id se_id)
+  {
+    const typename win2d_decomposition<T>::chains & chains =
+      get_se(se_id).decomposition.get_chains();
+    if (chains.empty() || !is_bitmappable())
+      return false;
+    for (unsigned i = 0; i < chains.size(); ++i)
+      for (unsigned j = 0; j < chains[i].size(); ++j)
+      {
+        unsigned rad;
+        if (!win2d_decomposition<T>::is_hsegment(chains[i][j], rad)
+            && !win2d_decomposition<T>::is_vsegment(chains[i][j], rad))
+          return false;
+      }
+    return true;
+  }
+
+  // Single chains of centered horizontal/vertical segments are rectangles
+  template<typename T>
+  inline
+  bool CLCV<T>::get_rect(const clcv_se_id se_id, cl_int & se_rowrad, cl_int & se_colrad)
+  {
+    const typename win2d_decomposition<T>::chains & chains =
+      get_se(se_id).decomposition.get_chains();
+    if (chains.size() != 1)
+      return false;
+    se_rowrad = 0;
+    se_colrad = 0;
+    for (unsigned j = 0; j < chains[0].size(); ++j)
+    {
+      unsigned rad;
+      if (win2d_decomposition<T>::is_hsegment(chains[0][j], rad))
+        se_colrad += rad;
+      else if (win2d_decomposition<T>::is_vsegment(chains[0][j], rad))
+        se_rowrad += rad;
+      else
+        return false;
+    }
+    return true;
+  }
+
+  template<typename T>
+  inline
+  bool CLCV<T>::get_bitmappedrect(const clcv_se_id se_id, cl_int & se_rowrad, cl_int & se_colrad)
+  {
+    return is_bitmappable() && get_rect(se_id, se_rowrad, se_colrad);
+  }
+
+  // Unions would cost more than the original SE with the naive operator.
+  // Chained dilations must also match the original SE near the borders.
+  template<typename T>
+  inline
+  bool CLCV<T>::can_push_decomposedmorph_naive(const clcv_se_id se_id, const bool erosion)
+  {
+    clcv_se & se = get_se(se_id);
+    return se.decomposition.get_chains().size() == 1
+      && se.decomposition.cost() < se.se_nonzero
+      && (erosion || se.decomposition.exact_dilation());
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_decomposedmorph_bitmapped(const clcv_se_id se_id, const bool erosion)
+  { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
+    const typename win2d_decomposition<T>::chains & chains =
+      get_se(se_id).decomposition.get_chains();
+    const unsigned size = get_bitmap_size();
+    // saved.first holds the binarized image, saved.second the union
+    clcv_bufferpair saved = get_scratchpair(size, 1);
+
+    push_bitmappedbinarize(1);
+    if (chains.size() > 1)
+      enqueue_copy(get_in_buffer(), saved.first, 0, 0, size);
+    for (unsigned i = 0; i < chains.size(); ++i)
+    {
+      if (i > 0)
+        enqueue_copy(saved.first, get_in_buffer(), 0, 0, size);
+      for (unsigned j = 0; j < chains[i].size(); ++j)
+      {
+        unsigned rad;
+        if (win2d_decomposition<T>::is_hsegment(chains[i][j], rad))
+          erosion ? push_bitmappedmorph_erosion_h(rad) : push_bitmappedmorph_dilation_h(rad);
+        else if (win2d_decomposition<T>::is_vsegment(chains[i][j], rad))
+          erosion ? push_bitmappedmorph_erosion_v(rad) : push_bitmappedmorph_dilation_v(rad);
+      }
+      // Erosion by a union is the intersection of the erosions
+      const clcv_logic_op op = erosion ? logic_and : logic_or;
+      if (chains.size() > 1 && i == 0)
+        enqueue_copy(get_in_buffer(), saved.second, 0, 0, size);
+      else if (i + 1 < chains.size())
+        push_bitmappedlogic(get_in_buffer(), saved.second, saved.second, op);
+      else if (i > 0)
+      {
+        push_bitmappedlogic(get_in_buffer(), saved.second, get_out_buffer(), op);
+        swap_buffers();
+      }
+    }
+    return push_unbitmap();
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_decomposedmorph_naive(const clcv_se_id se_id, const bool erosion)
+  { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
+    const std::vector<clcv_se_id> & ids = get_se(se_id).chain_ids[0];
+    cl::Event event;
+    for (unsigned i = 0; i < ids.size(); ++i)
+    {
+      const cl_int se_nonzero = get_se(ids[i]).se_nonzero;
+      event = push_naivemorph(ids[i], erosion ? se_nonzero : -se_nonzero+1);
+    }
+    return event;
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_runsmorph(const clcv_se_id se_id, const bool erosion)
+  { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
+    push_bitmappedbinarize(1);
+    push_bitmappedmorph(se_id, erosion);
+    return push_unbitmap();
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_runsmorph_fused(const clcv_se_id se_id, const bool closing,
+                                          const bool residue)
+  { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
+    push_bitmappedbinarize(1);
+    push_bitmappedmorph_fused(se_id, closing, residue);
+    return push_unbitmap();
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_naivehitormiss(const clcv_se_id se_id)
+  {
+    clcv_se & se = get_se(se_id);
+    if (se.nruns + se.nbgruns > 0 && is_bitmappable())
+    { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
+      push_bitmappedbinarize(1);
+      push_bitmappedhitormiss(se_id);
+      return push_unbitmap();
+    }
+    // Both the foreground (in*2-1 == 1) and the background (in*2-1 == -1)
+    // pixels add 1 when they match
+    return push_naivemorph(se_id, se.se_nonzero);
+  }
+
+  template<typename T>
+  inline
+  cl::Kernel CLCV<T>::create_bitmappedhitormiss(const cl::Buffer & image_in,
+                                                const cl::Buffer & image_out,
+                                                const cl_int nrows, const cl_int ncols,
+                                                const clcv_se_id se_id,
+                                                const cl::NDRange & local_work_size)
+  {
+    assert(ncols % 32 == 0);
+    clcv_se & se = get_se(se_id);
+    assert(se.nruns + se.nbgruns > 0);
+
+    clcv_kernel & kernel = get_kernel("bitmapped_hitormiss", image_in, image_out, local_work_size);
+    kernel.setArg(0, image_in);
+    kernel.setArg(1, image_out);
+    kernel.setArg(2, nrows);
+    kernel.setArg(3, ncols);
+    kernel.setArg(4, se.runs_clmem);
+    kernel.setArg(5, (cl_int) se.nruns);
+    kernel.setArg(6, (cl_int) se.nbgruns);
+    kernel.setArg(7, (cl_int) se.runs_rowrad);
+    kernel.setArg(8, (cl_int) se.runs_colrad);
+    kernel.setArg(9, (se.nruns + se.nbgruns) * 3 * sizeof (T), NULL);
+    cl_int local_size = (xdim(local_work_size) + (se.runs_colrad/32 + 1)*2)
+    * (ydim(local_work_size) + se.runs_rowrad*2) * sizeof (T);
+    kernel.setArg(10, local_size, NULL);
+    return kernel;
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmappedhitormiss(const clcv_se_id se_id)
+  {
+    assert(get_image().ncols % 32 == 0);
+    const unsigned ncols_round = round(get_ncols()/32, 32);
+    const cl::NDRange b_size(ncols_round, get_nrows());
+
+    const cl::NDRange & l_size = get_local_work_size();
+    const cl::NDRange & g_size = get_global_work_size().dimensions() == 0 ?
+    b_size : get_global_work_size();
+
+    cl::Kernel kernel = create_bitmappedhitormiss(get_in_buffer(), get_out_buffer(),
+                                                  get_nrows(), get_ncols(),
+                                                  se_id, l_size);
+    swap_buffers();
+    cl::Event event;
+    enqueue_kernel(kernel, g_size, l_size, NULL, &event);
+    return event;
+  }
+
+  template<typename T>
+  inline
+  cl::Kernel CLCV<T>::create_bitmappedhitormiss3x3(const cl::Buffer & image_in,
+                                                   const cl::Buffer & image_out,
+                                                   const cl_int nrows, const cl_int ncols,
+                                                   const cl_int fg, const cl_int bg,
+                                                   const cl::NDRange & local_work_size)
+  {
+    assert(ncols % 32 == 0);
+
+    clcv_kernel & kernel = get_kernel("bitmapped_hitormiss3x3",
+                                      image_in, image_out, local_work_size);
+    kernel.setArg(0, image_in);
+    kernel.setArg(1, image_out);
+    kernel.setArg(2, nrows);
+    kernel.setArg(3, ncols);
+    kernel.setArg(4, fg);
+    kernel.setArg(5, bg);
+    cl_int local_size = (xdim(local_work_size) + 2)
+    * (ydim(local_work_size) + 2) * sizeof (T);
+    kernel.setArg(6, local_size, NULL);
+    return kernel;
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmappedhitormiss3x3(const cl_int fg, const cl_int bg)
+  {
+    assert(get_image().ncols % 32 == 0);
+    const unsigned ncols_round = round(get_ncols()/32, 32);
+    const cl::NDRange b_size(ncols_round, get_nrows());
+
+    const cl::NDRange & l_size = get_local_work_size();
+    const cl::NDRange & g_size = get_global_work_size().dimensions() == 0 ?
+    b_size : get_global_work_size();
+
+    cl::Kernel kernel = create_bitmappedhitormiss3x3(get_in_buffer(), get_out_buffer(),
+                                                     get_nrows(), get_ncols(),
+                                                     fg, bg, l_size);
+    swap_buffers();
+    cl::Event event;
+    enqueue_kernel(kernel, g_size, l_size, NULL, &event);
+    return event;
+  }
+
+  template<typename T>
+  inline
+  cl::Kernel CLCV<T>::create_bitmappedthinning3x3(const cl::Buffer & image_in,
+                                                  const cl::Buffer & image_out,
+                                                  const cl_int nrows, const cl_int ncols,
+                                                  const cl_int fg, const cl_int bg,
+                                                  const cl::Buffer & changed,
+                                                  const cl::NDRange & local_work_size)
+  {
+    assert(ncols % 32 == 0);
+
+    clcv_kernel & kernel = get_kernel("bitmapped_thinning3x3",
+                                      image_in, image_out, local_work_size);
+    kernel.setArg(0, image_in);
+    kernel.setArg(1, image_out);
+    kernel.setArg(2, nrows);
+    kernel.setArg(3, ncols);
+    kernel.setArg(4, fg);
+    kernel.setArg(5, bg);
+    kernel.setArg(6, changed);
+    cl_int local_size = (xdim(local_work_size) + 2)
+    * (ydim(local_work_size) + 2) * sizeof (T);
+    kernel.setArg(7, local_size, NULL);
+    return kernel;
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmappedthinning(const unsigned max_iter, const unsigned batch)
+  { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
+    assert(get_image().ncols % 32 == 0);
+    assert(batch > 0);
+    // Golay L masks (1 foreground, 0 background, . don't care) and their
+    // rotations by 90 degrees:
+    //   0 0 0    . 0 0
+    //   . 1 .    1 1 0
+    //   1 1 1    . 1 .
+    static const cl_int masks[8][2] = {
+      { 0x1d0, 0x007 }, { 0x098, 0x026 }, { 0x059, 0x124 }, { 0x01a, 0x1a0 },
+      { 0x017, 0x1c0 }, { 0x032, 0x0c8 }, { 0x134, 0x049 }, { 0x0b0, 0x00b }
+    };
+    const unsigned ncols_round = round(get_ncols()/32, 32);
+    const cl::NDRange b_size(ncols_round, get_nrows());
+
+    const cl::NDRange & l_size = get_local_work_size();
+    const cl::NDRange & g_size = get_global_work_size().dimensions() == 0 ?
+    b_size : get_global_work_size();
+
+    cl::Event event;
+    unsigned iter = 0;
+    bool changed = true;
+    while (changed && (max_iter == 0 || iter < max_iter))
+    {
+      reset_flag();
+      for (unsigned i = 0; i < batch && (max_iter == 0 || iter < max_iter); ++i, ++iter)
+        for (unsigned k = 0; k < 8; ++k)
+        {
+          cl::Kernel kernel = create_bitmappedthinning3x3(get_in_buffer(), get_out_buffer(),
+                                                          get_nrows(), get_ncols(),
+                                                          masks[k][0], masks[k][1],
+                                                          m_flag, l_size);
+          swap_buffers();
+          enqueue_kernel(kernel, g_size, l_size, NULL, &event);
+        }
+      changed = read_flag();
+    }
+    return event;
+  }
+
+  template<typename T>
+  inline
+  cl::Kernel CLCV<T>::create_bitmappedlut3x3(const cl::Buffer & image_in,
+                                             const cl::Buffer & image_out,
+                                             const cl_int nrows, const cl_int ncols,
+                                             const cl::Buffer & lut, const cl::Buffer & changed,
+                                             const cl::NDRange & local_work_size)
+  {
+    assert(ncols % 32 == 0);
+
+    clcv_kernel & kernel = get_kernel("bitmapped_lut3x3", image_in, image_out, local_work_size);
+    kernel.setArg(0, image_in);
+    kernel.setArg(1, image_out);
+    kernel.setArg(2, nrows);
+    kernel.setArg(3, ncols);
+    kernel.setArg(4, lut);
+    kernel.setArg(5, changed);
+    kernel.setArg(6, 16 * sizeof (cl_int), NULL);
+    cl_int local_size = (xdim(local_work_size) + 2)
+    * (ydim(local_work_size) + 2) * sizeof (T);
+    kernel.setArg(7, local_size, NULL);
+    return kernel;
+  }
+
+  // The kernel reads the neighborhood from the top left pixel down to the
+  // bottom right one, i.e. with the bits of the index reversed
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmapped_lut3x3(const std::bitset<512> & lut, const unsigned max_iter,
+                                           const unsigned batch)
+  { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
+    assert(get_image().ncols % 32 == 0);
+    assert(batch > 0);
+    const unsigned ncols_round = round(get_ncols()/32, 32);
+    const cl::NDRange b_size(ncols_round, get_nrows());
+
+    const cl::NDRange & l_size = get_local_work_size();
+    const cl::NDRange & g_size = get_global_work_size().dimensions() == 0 ?
+    b_size : get_global_work_size();
+
+    cl_uint words[16] = { 0 };
+    for (unsigned i = 0; i < 512; ++i)
+      if (lut[i])
+      {
+        unsigned k = 0;
+        for (unsigned b = 0; b < 9; ++b)
+          if (i & (1 << b))
+            k |= 1 << (8 - b);
+        words[k >> 5] |= 1u << (k & 31);
+      }
+    cl::Buffer lut_mem(get_context(), CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR,
+                       sizeof (words), words);
+
+    cl::Event event;
+    unsigned iter = 0;
+    bool changed = true;
+    while (changed && (max_iter == 0 || iter < max_iter))
+    {
+      reset_flag();
+      for (unsigned i = 0; i < batch && (max_iter == 0 || iter < max_iter); ++i, ++iter)
+      {
+        cl::Kernel kernel = create_bitmappedlut3x3(get_in_buffer(), get_out_buffer(),
+                                                   get_nrows(), get_ncols(),
+                                                   lut_mem, m_flag, l_size);
+        swap_buffers();
+        enqueue_kernel(kernel, g_size, l_size, NULL, &event);
+      }
+      // A single pass doesn't need to know
+      changed = (max_iter == 0 || iter < max_iter) && read_flag();
+    }
+    return event;
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_naivethinning(const unsigned max_iter, const unsigned batch)
+  { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
+    assert(is_bitmappable());
+    push_bitmappedbinarize(1);
+    push_bitmappedthinning(max_iter, batch);
+    return push_unbitmap();
+  }
+
+  template<typename T>
+  inline
+  cl::Kernel CLCV<T>::create_bitmapped_reconstruct(const cl::Buffer & marker_in,
+                                                   const cl::Buffer & marker_out,
+                                                   const cl::Buffer & mask,
+                                                   const cl_int nrows, const cl_int ncols,
+                                                   const cl::Buffer & changed,
+                                                   const cl::NDRange & local_work_size)
+  {
+    assert(ncols % 32 == 0);
+
+    clcv_kernel & kernel = get_kernel("bitmapped_reconstruct",
+                                      marker_in, marker_out, local_work_size);
+    kernel.setArg(0, marker_in);
+    kernel.setArg(1, marker_out);
+    kernel.setArg(2, mask);
+    kernel.setArg(3, nrows);
+    kernel.setArg(4, ncols);
+    kernel.setArg(5, changed);
+    cl_int local_size = (xdim(local_work_size) + 2)
+    * (ydim(local_work_size) + 2) * sizeof (T);
+    kernel.setArg(6, local_size, NULL);
+    kernel.setArg(7, sizeof (cl_int), NULL);
+    return kernel;
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmapped_reconstruct(const clcv_image_id marker_id,
+                                                const clcv_image_id mask_id,
+                                                const unsigned batch)
+  {
+    assert(get_image(marker_id).nrows == get_image(mask_id).nrows);
+    assert(get_image(marker_id).ncols == get_image(mask_id).ncols);
+    m_current_image_id = marker_id;
+    return push_bitmapped_reconstruct(get_image().buffers, get_in_buffer(mask_id), batch);
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmapped_reconstruct(clcv_bufferpair & marker, const cl::Buffer & mask,
+                                                const unsigned batch)
+  { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
+    assert(get_image().ncols % 32 == 0);
+    assert(batch > 0);
+    const unsigned ncols_round = round(get_ncols()/32, 32);
+    const cl::NDRange b_size(ncols_round, get_nrows());
+
+    const cl::NDRange & l_size = get_local_work_size();
+    const cl::NDRange & g_size = get_global_work_size().dimensions() == 0 ?
+    b_size : get_global_work_size();
+
+    // The kernel expects the marker under the mask
+    cl::Event event = push_bitmappedlogic(marker.first, mask, marker.first, logic_and);
+    bool changed = true;
+    while (changed)
+    {
+      reset_flag();
+      for (unsigned i = 0; i < batch; ++i)
+      {
+        cl::Kernel kernel = create_bitmapped_reconstruct(marker.first, marker.second, mask,
+                                                         get_nrows(), get_ncols(),
+                                                         m_flag, l_size);
+        std::swap(marker.first, marker.second);
+        enqueue_kernel(kernel, g_size, l_size, NULL, &event);
+      }
+      changed = read_flag();
+    }
+    return event;
+  }
+
+  template<typename T>
+  inline
+  cl::Kernel CLCV<T>::create_bitmapped_bordermarker(const cl::Buffer & image_in,
+                                                    const cl::Buffer & marker,
+                                                    const cl::Buffer & mask,
+                                                    const cl_int nrows, const cl_int ncols,
+                                                    const bool invert)
+  {
+    assert(ncols % 32 == 0);
+
+    clcv_kernel & kernel = get_kernel("bitmapped_border_marker", image_in, marker);
+    kernel.setArg(0, image_in);
+    kernel.setArg(1, marker);
+    kernel.setArg(2, mask);
+    kernel.setArg(3, nrows);
+    kernel.setArg(4, ncols);
+    kernel.setArg(5, (cl_int) invert);
+    return kernel;
+  }
+
+  // The holes are the background components which don't touch the border
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmapped_fillholes(const unsigned batch)
+  { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
+    assert(get_image().ncols % 32 == 0);
+    const unsigned ncols_round = round(get_ncols()/32, 32);
+    const cl::NDRange b_size(ncols_round, get_nrows());
+
+    const cl::NDRange & l_size = get_local_work_size();
+    const cl::NDRange & g_size = get_global_work_size().dimensions() == 0 ?
+    b_size : get_global_work_size();
+
+    const unsigned size = get_bitmap_size();
+    clcv_bufferpair marker = get_scratchpair(size, 1);
+    clcv_bufferpair saved = get_scratchpair(size, 2);
+
+    cl::Kernel kernel = create_bitmapped_bordermarker(get_in_buffer(), marker.first, saved.first,
+                                                      get_nrows(), get_ncols(), true);
+    enqueue_kernel(kernel, g_size, l_size, NULL, NULL);
+    push_bitmapped_reconstruct(marker, saved.first, batch);
+    push_bitmappedlogic(saved.first, marker.first, saved.second, logic_andnot);
+    cl::Event event = push_bitmappedlogic(get_in_buffer(), saved.second, get_out_buffer(),
+                                          logic_or);
+    swap_buffers();
+    return event;
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmapped_clearborder(const unsigned batch)
+  { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
+    assert(get_image().ncols % 32 == 0);
+    const unsigned ncols_round = round(get_ncols()/32, 32);
+    const cl::NDRange b_size(ncols_round, get_nrows());
+
+    const cl::NDRange & l_size = get_local_work_size();
+    const cl::NDRange & g_size = get_global_work_size().dimensions() == 0 ?
+    b_size : get_global_work_size();
+
+    const unsigned size = get_bitmap_size();
+    clcv_bufferpair marker = get_scratchpair(size, 1);
+    clcv_bufferpair saved = get_scratchpair(size, 2);
+
+    cl::Kernel kernel = create_bitmapped_bordermarker(get_in_buffer(), marker.first, saved.first,
+                                                      get_nrows(), get_ncols(), false);
+    enqueue_kernel(kernel, g_size, l_size, NULL, NULL);
+    push_bitmapped_reconstruct(marker, saved.first, batch);
+    cl::Event event = push_bitmappedlogic(get_in_buffer(), marker.first, get_out_buffer(),
+                                          logic_andnot);
+    swap_buffers();
+    return event;
+  }
+
+  template<typename T>
+  inline
+  cl::Kernel CLCV<T>::create_bitmapped_label_local(const cl::Buffer & image_in,
+                                                   const cl::Buffer & parent,
+                                                   const cl_int nrows, const cl_int ncols,
+                                                   const bool inverted,
+                                                   const cl::NDRange & local_work_size)
+  {
+    assert(ncols % 32 == 0);
+
+    clcv_kernel & kernel = get_kernel("bitmapped_label_local", image_in, parent, local_work_size);
+    kernel.setArg(0, image_in);
+    kernel.setArg(1, parent);
+    kernel.setArg(2, nrows);
+    kernel.setArg(3, ncols);
+    kernel.setArg(4, (cl_int)inverted);
+    cl_int local_size = xdim(local_work_size) * ydim(local_work_size) * sizeof (cl_int);
+    kernel.setArg(5, local_size, NULL);
+    // up to 16 runs per word
+    kernel.setArg(6, local_size * 16, NULL);
+    return kernel;
+  }
+
+  template<typename T>
+  inline
+  cl::Kernel CLCV<T>::create_bitmapped_label_merge(const cl::Buffer & image_in,
+                                                   const cl::Buffer & parent,
+                                                   const cl_int nrows, const cl_int ncols,
+                                                   const bool inverted)
+  {
+    assert(ncols % 32 == 0);
+
+    clcv_kernel & kernel = get_kernel("bitmapped_label_merge", image_in, parent);
+    kernel.setArg(0, image_in);
+    kernel.setArg(1, parent);
+    kernel.setArg(2, nrows);
+    kernel.setArg(3, ncols);
+    kernel.setArg(4, (cl_int)inverted);
+    return kernel;
+  }
+
+  template<typename T>
+  inline
+  cl::Kernel CLCV<T>::create_bitmapped_label_final(const cl::Buffer & image_in,
+                                                   const cl::Buffer & parent,
+                                                   const cl::Buffer & labels,
+                                                   const cl_int nrows, const cl_int ncols,
+                                                   const bool inverted)
+  {
+    assert(ncols % 32 == 0);
+
+    clcv_kernel & kernel = get_kernel("bitmapped_label_final", image_in, parent);
+    kernel.setArg(0, image_in);
+    kernel.setArg(1, parent);
+    kernel.setArg(2, labels);
+    kernel.setArg(3, nrows);
+    kernel.setArg(4, ncols);
+    kernel.setArg(5, (cl_int)inverted);
+    return kernel;
+  }
+
+  // Union-find over the runs of each word: merges inside the tiles in local
+  // memory, then across the tile borders in global memory (the merge pass
+  // must use the tiles of the first one), then one pass to resolve the
+  // labels of the pixels
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmapped_label(const bool inverted)
+  { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
+    assert(get_image().ncols % 32 == 0);
+    const unsigned ncols_round = round(get_ncols()/32, 32);
+    const cl::NDRange b_size(ncols_round, get_nrows());
+
+    const cl::NDRange & l_size = get_local_work_size();
+    const cl::NDRange & g_size = get_global_work_size().dimensions() == 0 ?
+    b_size : get_global_work_size();
+    assert(xdim(l_size) * ydim(l_size) * 17 * sizeof (cl_int) <= get_local_mem_size());
+
+    clcv_image & img = get_image();
+    const unsigned size = img.nrows * img.ncols * sizeof (cl_int);
+    if (img.labels() == NULL)
+      img.labels = cl::Buffer(get_context(), CL_MEM_READ_WRITE, size);
+    cl::Buffer parent = get_scratchpair(size).first;
+
+    cl::Kernel local_kernel = create_bitmapped_label_local(get_in_buffer(), parent,
+                                                           get_nrows(), get_ncols(),
+                                                           inverted, l_size);
+    cl::Kernel merge = create_bitmapped_label_merge(get_in_buffer(), parent,
+                                                    get_nrows(), get_ncols(), inverted);
+    cl::Kernel resolve = create_bitmapped_label_final(get_in_buffer(), parent, img.labels,
+                                                      get_nrows(), get_ncols(), inverted);
+    enqueue_kernel(local_kernel, g_size, l_size);
+    enqueue_kernel(merge, g_size, l_size);
+    cl::Event event;
+    enqueue_kernel(resolve, img.global_work_size, l_size, NULL, &event);
+    return event;
+  }
+
+  template<typename T>
+  inline
+  cl::Buffer & CLCV<T>::get_label_buffer()
+  {
+    return get_image().labels;
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::fetch_labels(cl_int * labels)
+  {
+    clcv_image & img = get_image();
+    assert(img.labels() != NULL);
+    return read_mem(m_queue, labels, img.labels,
+                    img.nrows * img.ncols * sizeof (cl_int));
+  }
+
+  template<typename T>
+  inline
+  cl::Kernel CLCV<T>::create_label_area_reset(const cl::Buffer & labels, const cl::Buffer & areas,
+                                              const cl_int nrows, const cl_int ncols)
+  {
+    clcv_kernel & kernel = get_kernel("label_area_reset", labels, areas);
+    kernel.setArg(0, labels);
+    kernel.setArg(1, areas);
+    kernel.setArg(2, nrows);
+    kernel.setArg(3, ncols);
+    return kernel;
+  }
+
+  template<typename T>
+  inline
+  cl::Kernel CLCV<T>::create_label_area_count(const cl::Buffer & labels, const cl::Buffer & areas,
+                                              const cl_int nrows, const cl_int ncols)
+  {
+    clcv_kernel & kernel = get_kernel("label_area_count", labels, areas);
+    kernel.setArg(0, labels);
+    kernel.setArg(1, areas);
+    kernel.setArg(2, nrows);
+    kernel.setArg(3, ncols);
+    return kernel;
+  }
+
+  template<typename T>
+  inline
+  cl::Kernel CLCV<T>::create_bitmapped_area_filter(const cl::Buffer & labels,
+                                                   const cl::Buffer & areas,
+                                                   const cl::Buffer & image_out,
+                                                   const cl_int nrows, const cl_int ncols,
+                                                   const cl_int min_area, const bool inverted)
+  {
+    assert(ncols % 32 == 0);
+
+    clcv_kernel & kernel = get_kernel("bitmapped_area_filter", labels, areas);
+    kernel.setArg(0, labels);
+    kernel.setArg(1, areas);
+    kernel.setArg(2, image_out);
+    kernel.setArg(3, nrows);
+    kernel.setArg(4, ncols);
+    kernel.setArg(5, min_area);
+    kernel.setArg(6, (cl_int)inverted);
+    return kernel;
+  }
+
+  // Label, count the areas with atomics (in the slot 1 scratch buffer, the
+  // labeling uses slot 0), then mask
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmapped_area_filter(const cl_int min_area, const bool inverted)
+  { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
+    assert(get_image().ncols % 32 == 0);
+    const unsigned ncols_round = round(get_ncols()/32, 32);
+    const cl::NDRange b_size(ncols_round, get_nrows());
+
+    const cl::NDRange & l_size = get_local_work_size();
+    const cl::NDRange & g_size = get_global_work_size().dimensions() == 0 ?
+    b_size : get_global_work_size();
+    const cl::NDRange & p_size = get_image().global_work_size;
+
+    push_bitmapped_label(inverted);
+    const cl::Buffer & labels = get_label_buffer();
+    cl::Buffer areas = get_scratchpair(get_nrows() * get_ncols() * sizeof (cl_int), 1).first;
+    cl::Kernel reset = create_label_area_reset(labels, areas, get_nrows(), get_ncols());
+    cl::Kernel count = create_label_area_count(labels, areas, get_nrows(), get_ncols());
+    cl::Kernel kernel = create_bitmapped_area_filter(labels, areas, get_out_buffer(),
+                                                     get_nrows(), get_ncols(),
+                                                     min_area, inverted);
+    swap_buffers();
+    enqueue_kernel(reset, p_size, l_size);
+    enqueue_kernel(count, p_size, l_size);
+    cl::Event event;
+    enqueue_kernel(kernel, g_size, l_size, NULL, &event);
+    return event;
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmapped_area_opening(const cl_int min_area)
+  {
+    return push_bitmapped_area_filter(min_area, false);
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmapped_area_closing(const cl_int min_area)
+  {
+    return push_bitmapped_area_filter(min_area, true);
+  }
+
+  // The specks are removed first, so that the holes containing some get
+  // filled too
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmapped_despeckle(const cl_int min_area, const cl_int min_hole_area)
+  { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
+    push_bitmapped_area_filter(min_area, false);
+    return push_bitmapped_area_filter(min_hole_area, true);
+  }
+
+  template<typename T>
+  inline
+  cl::Kernel CLCV<T>::create_bitmappedcount(const cl::Buffer & image_in,
+                                            const cl::Buffer & counts,
+                                            const cl_int size, const cl_int index,
+                                            const cl::NDRange & local_work_size)
+  {
+    clcv_kernel & kernel = get_kernel("bitmapped_count", image_in, counts, local_work_size);
+    kernel.setArg(0, image_in);
+    kernel.setArg(1, counts);
+    kernel.setArg(2, size);
+    kernel.setArg(3, index);
+    kernel.setArg(4, xdim(local_work_size) * sizeof (cl_int), NULL);
+    return kernel;
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmappedcount(const cl::Buffer & counts, const cl_int index)
+  {
+    const cl::NDRange unit_range(1);
+    const cl::NDRange parallel_range(64);
+    const bool cpu = get_device_type() == CL_DEVICE_TYPE_CPU;
+    const cl::NDRange & l_size = cpu ? unit_range : parallel_range;
+    const cl::NDRange g_size(cpu ? 64 : 64 * 64);
+
+    cl::Kernel kernel = create_bitmappedcount(get_in_buffer(), counts,
+                                              get_bitmap_size() / sizeof (cl_int), index,
+                                              l_size);
+    cl::Event event;
+    enqueue_kernel(kernel, g_size, l_size, NULL, &event);
+    return event;
+  }
+
+  // Chained erosions by the 3x3 square are exact (the outside is 0). The
+  // current erosion is kept in the slot 1 scratch buffer during the
+  // dilation, the original image in the slot 2 one.
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmapped_granulometry(const cl_int max_radius, cl_int * areas)
+  {
+    assert(get_image().ncols % 32 == 0);
+    assert(m_recording_plan_id == 0);
+    const unsigned size = get_bitmap_size();
+    clcv_bufferpair eroded = get_scratchpair(size, 1);
+    clcv_bufferpair saved = get_scratchpair(size, 2);
+
+    const std::vector<cl_int> zeros(max_radius + 1, 0);
+    const unsigned counts_size = zeros.size() * sizeof (cl_int);
+    cl::Buffer counts(get_context(), CL_MEM_READ_WRITE, counts_size);
+    write_mem(m_queue, counts, &zeros[0], counts_size, CL_TRUE);
+
+    enqueue_copy(get_in_buffer(), saved.first, 0, 0, size);
+    push_bitmappedcount(counts, 0);
+    for (cl_int r = 1; r <= max_radius; ++r)
+    {
+      push_bitmappedmorph_erosion(1, 1);
+      enqueue_copy(get_in_buffer(), eroded.first, 0, 0, size);
+      push_bitmappedmorph_dilation(r, r);
+      push_bitmappedcount(counts, r);
+      enqueue_copy(eroded.first, get_in_buffer(), 0, 0, size);
+    }
+    enqueue_copy(saved.first, get_in_buffer(), 0, 0, size);
+    return read_mem(m_queue, areas, counts, counts_size);
+  }
+
+  template<typename T>
+  inline
+  cl::Kernel CLCV<T>::create_bitmapped_skeleton(const cl::Buffer & level,
+                                                const cl::Buffer & eroded,
+                                                const cl::Buffer & skel,
+                                                const cl::Buffer & quench,
+                                                const cl_int nrows, const cl_int ncols,
+                                                const bool c8, const cl_int level_index,
+                                                const bool with_quench,
+                                                const cl::Buffer & changed,
+                                                const cl::NDRange & local_work_size)
+  {
+    assert(ncols % 32 == 0);
+
+    clcv_kernel & kernel = get_kernel("bitmapped_skeleton", level, eroded, local_work_size);
+    kernel.setArg(0, level);
+    kernel.setArg(1, eroded);
+    kernel.setArg(2, skel);
+    kernel.setArg(3, quench);
+    kernel.setArg(4, nrows);
+    kernel.setArg(5, ncols);
+    kernel.setArg(6, (cl_int)c8);
+    kernel.setArg(7, level_index);
+    kernel.setArg(8, (cl_int)with_quench);
+    kernel.setArg(9, changed);
+    cl_int local_size = (xdim(local_work_size) + 2)
+    * (ydim(local_work_size) + 2) * sizeof (T);
+    kernel.setArg(10, local_size, NULL);
+    return kernel;
+  }
+
+  // The levels (the successive erosions) alternate in the slot 1 scratch
+  // buffers, the skeleton is built in the output buffer. Each level needs
+  // the erosion anyway, the skeleton kernel dilates it on the fly.
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmapped_skeleton(const bool c8, const bool quench,
+                                             const unsigned batch)
+  { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
+    assert(get_image().ncols % 32 == 0);
+    assert(batch > 0);
+    const unsigned ncols_round = round(get_ncols()/32, 32);
+    const cl::NDRange b_size(ncols_round, get_nrows());
+
+    const cl::NDRange & l_size = get_local_work_size();
+    const cl::NDRange & g_size = get_global_work_size().dimensions() == 0 ?
+    b_size : get_global_work_size();
+
+    clcv_image & img = get_image();
+    if (quench && img.quench() == NULL)
+      img.quench = cl::Buffer(get_context(), CL_MEM_READ_WRITE,
+                              img.nrows * img.ncols * sizeof (cl_int));
+    // The kernel never touches the quench buffer without quench
+    const cl::Buffer & quench_mem = quench ? img.quench : m_flag;
+
+    const unsigned size = get_bitmap_size();
+    clcv_bufferpair levels = get_scratchpair(size, 1);
+    enqueue_copy(get_in_buffer(), levels.first, 0, 0, size);
+
+    cl::Event event;
+    cl_int level_index = 0;
+    bool changed = true;
+    while (changed)
+    {
+      reset_flag();
+      for (unsigned i = 0; i < batch; ++i, ++level_index)
+      {
+        cl::Kernel erosion = create_bitmappedmorph_3x3(levels.first, levels.second,
+                                                       get_nrows(), get_ncols(),
+                                                       c8, true, l_size);
+        cl::Kernel kernel = create_bitmapped_skeleton(levels.first, levels.second,
+                                                      get_out_buffer(), quench_mem,
+                                                      get_nrows(), get_ncols(),
+                                                      c8, level_index, quench,
+                                                      m_flag, l_size);
+        enqueue_kernel(erosion, g_size, l_size);
+        enqueue_kernel(kernel, g_size, l_size, NULL, &event);
+        std::swap(levels.first, levels.second);
+      }
+      changed = read_flag();
+    }
+    swap_buffers();
+    return event;
+  }
+
+  template<typename T>
+  inline
+  cl::Buffer & CLCV<T>::get_quench_buffer()
+  {
+    return get_image().quench;
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::fetch_quench(cl_int * quench)
+  {
+    clcv_image & img = get_image();
+    assert(img.quench() != NULL);
+    return read_mem(m_queue, quench, img.quench,
+                    img.nrows * img.ncols * sizeof (cl_int));
+  }
+
+  template<typename T>
+  inline
+  cl::Kernel CLCV<T>::create_edt_columns(const cl::Buffer & image_in, const cl::Buffer & g,
+                                         const cl_int nrows, const cl_int ncols,
+                                         const bool bitmapped, const bool inverted)
+  {
+    assert(!bitmapped || ncols % 32 == 0);
+
+    clcv_kernel & kernel = get_kernel("edt_columns", image_in, g);
+    kernel.setArg(0, image_in);
+    kernel.setArg(1, g);
+    kernel.setArg(2, nrows);
+    kernel.setArg(3, ncols);
+    kernel.setArg(4, (cl_int)bitmapped);
+    kernel.setArg(5, (cl_int)inverted);
+    return kernel;
+  }
+
+  template<typename T>
+  inline
+  cl::Kernel CLCV<T>::create_edt_rows(const cl::Buffer & g, const cl::Buffer & image_out,
+                                      const cl::Buffer & s, const cl::Buffer & t,
+                                      const cl_int nrows, const cl_int ncols)
+  {
+    clcv_kernel & kernel = get_kernel("edt_rows", g, image_out);
+    kernel.setArg(0, g);
+    kernel.setArg(1, image_out);
+    kernel.setArg(2, s);
+    kernel.setArg(3, t);
+    kernel.setArg(4, nrows);
+    kernel.setArg(5, ncols);
+    return kernel;
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_edt(const bool inverted)
+  {
+    return push_edt_passes(false, inverted);
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmapped_edt(const bool inverted)
+  {
+    return push_edt_passes(true, inverted);
+  }
+
+  // One thread per column, then one per row. The column distances go to the
+  // out buffer, then the envelopes (s and t) to the scratch buffers.
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_edt_passes(const bool bitmapped, const bool inverted)
+  { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
+    assert(sizeof (T) >= sizeof (cl_int));
+    clcv_bufferpair st = get_scratchpair(get_nrows() * get_ncols() * sizeof (cl_int));
+
+    cl::Kernel columns = create_edt_columns(get_in_buffer(), get_out_buffer(),
+                                            get_nrows(), get_ncols(),
+                                            bitmapped, inverted);
+    swap_buffers();
+    enqueue_kernel(columns, cl::NDRange(get_ncols()), cl::NullRange);
+    cl::Kernel rows = create_edt_rows(get_in_buffer(), get_out_buffer(), st.first, st.second,
+                                      get_nrows(), get_ncols());
+    swap_buffers();
+    cl::Event event;
+    enqueue_kernel(rows, cl::NDRange(get_nrows()), cl::NullRange, NULL, &event);
+    return event;
+  }
+
+  template<typename T>
+  inline
+  cl::Kernel CLCV<T>::create_edt_threshold(const cl::Buffer & image_in,
+                                           const cl::Buffer & image_out,
+                                           const cl_int nrows, const cl_int ncols,
+                                           const cl_int radius, const bool erosion,
+                                           const bool bitmapped)
+  {
+    assert(!bitmapped || ncols % 32 == 0);
+
+    clcv_kernel & kernel = get_kernel(bitmapped ? "bitmapped_edt_threshold" : "edt_threshold",
+                                      image_in, image_out);
+    kernel.setArg(0, image_in);
+    kernel.setArg(1, image_out);
+    kernel.setArg(2, nrows);
+    kernel.setArg(3, ncols);
+    // Without any target the distances are at least (nrows + ncols)^2, any
+    // larger radius is the same as nrows + ncols - 1 (the distances to an
+    // actual target are below its square)
+    const cl_int r = std::min(radius, nrows + ncols - 1);
+    kernel.setArg(4, r * r);
+    kernel.setArg(5, (cl_int)erosion);
+    return kernel;
+  }
+
+  // The dilation measures the distances to the 1 pixels, the erosion to the
+  // 0 ones
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_disk_morph(const cl_int radius, const bool erosion,
+                                     const bool bitmapped)
+  { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
+    const cl::NDRange & l_size = get_local_work_size();
+    cl::NDRange t_size = get_image().global_work_size;
+    if (bitmapped)
+      t_size = cl::NDRange(round(get_ncols()/32, 32), get_nrows());
+    const cl::NDRange & g_size = get_global_work_size().dimensions() == 0 ?
+    t_size : get_global_work_size();
+
+    push_edt_passes(bitmapped, !erosion);
+    cl::Kernel kernel = create_edt_threshold(get_in_buffer(), get_out_buffer(),
+                                             get_nrows(), get_ncols(),
+                                             radius, erosion, bitmapped);
+    swap_buffers();
+    cl::Event event;
+    enqueue_kernel(kernel, g_size, l_size, NULL, &event);
+    return event;
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_disk_dilation(const cl_int radius)
+  {
+    return push_disk_morph(radius, false, false);
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_disk_erosion(const cl_int radius)
+  {
+    return push_disk_morph(radius, true, false);
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmapped_disk_dilation(const cl_int radius)
+  {
+    return push_disk_morph(radius, false, true);
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmapped_disk_erosion(const cl_int radius)
+  {
+    return push_disk_morph(radius, true, true);
+  }
+
+  template<typename T>
+  inline
+  cl::Kernel CLCV<T>::create_graymorph(const cl::Buffer & image_in,
+                                       const cl::Buffer & image_out,
+                                       const cl_int nrows, const cl_int ncols,
+                                       const clcv_se_id se_id, const bool erosion,
+                                       const cl::NDRange & local_work_size)
+  {
+    clcv_se & se = get_se(se_id);
+
+    clcv_kernel & kernel = get_kernel("gray_morph", image_in, image_out, local_work_size);
+    kernel.setArg(0, image_in);
+    kernel.setArg(1, image_out);
+    kernel.setArg(2, nrows);
+    kernel.setArg(3, ncols);
+    kernel.setArg(4, se.clmem);
+    kernel.setArg(5, se.rowrad);
+    kernel.setArg(6, se.colrad);
+    kernel.setArg(7, se.se_nonzero);
+    kernel.setArg(8, (cl_int)erosion);
+    kernel.setArg(9, se.buffer_size, NULL);
+    cl_int local_size = (xdim(local_work_size) + se.colrad*2)
+      * (ydim(local_work_size) + se.rowrad*2) * sizeof (T);
+    kernel.setArg(10, local_size, NULL);
+
+    return kernel;
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_graymorph(const clcv_se_id se_id, const bool erosion)
+  {
+    const cl::NDRange & l_size = get_local_work_size();
+    const cl::NDRange & g_size = get_global_work_size().dimensions() == 0 ?
+    get_image().global_work_size
+    : get_global_work_size();
+
+    cl::Kernel kernel = create_graymorph(get_in_buffer(), get_out_buffer(),
+                                         get_nrows(), get_ncols(),
+                                         se_id, erosion, l_size);
+    swap_buffers();
+    cl::Event event;
+    enqueue_kernel(kernel, g_size, l_size, NULL, &event);
+    return event;
+  }
+
+  template<typename T>
+  inline
+  cl::Kernel CLCV<T>::create_gray_vhgw_scan(const cl::Buffer & image_in,
+                                            const cl::Buffer & g, const cl::Buffer & h,
+                                            const cl_int nrows, const cl_int ncols,
+                                            const cl_int se_rad, const bool vertical,
+                                            const bool erosion)
+  {
+    clcv_kernel & kernel = get_kernel("gray_vhgw_scan", image_in, g);
+    kernel.setArg(0, image_in);
+    kernel.setArg(1, g);
+    kernel.setArg(2, h);
+    kernel.setArg(3, nrows);
+    kernel.setArg(4, ncols);
+    kernel.setArg(5, se_rad);
+    kernel.setArg(6, (cl_int)vertical);
+    kernel.setArg(7, (cl_int)erosion);
+    return kernel;
+  }
+
+  template<typename T>
+  inline
+  cl::Kernel CLCV<T>::create_gray_vhgw_merge(const cl::Buffer & g, const cl::Buffer & h,
+                                             const cl::Buffer & image_out,
+                                             const cl_int nrows, const cl_int ncols,
+                                             const cl_int se_rad, const bool vertical,
+                                             const bool erosion)
+  {
+    clcv_kernel & kernel = get_kernel("gray_vhgw_merge", g, h);
+    kernel.setArg(0, g);
+    kernel.setArg(1, h);
+    kernel.setArg(2, image_out);
+    kernel.setArg(3, nrows);
+    kernel.setArg(4, ncols);
+    kernel.setArg(5, se_rad);
+    kernel.setArg(6, (cl_int)vertical);
+    kernel.setArg(7, (cl_int)erosion);
+    return kernel;
+  }
+
+  // One pass along the rows (or the columns when vertical): the scan runs
+  // one thread per block of 2 * se_rad + 1 pixels, the merge one per pixel
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_gray_vhgw(const cl_int se_rad, const bool vertical, const bool erosion)
+  {
+    const unsigned len = vertical ? get_nrows() : get_ncols();
+    const unsigned nblocks = (len - 1) / (se_rad*2 + 1) + 1;
+    const cl::NDRange s_size = vertical ?
+    cl::NDRange(get_ncols(), nblocks)
+    : cl::NDRange(nblocks, get_nrows());
+    const cl::NDRange & l_size = get_local_work_size();
+    const cl::NDRange & g_size = get_global_work_size().dimensions() == 0 ?
+    get_image().global_work_size
+    : get_global_work_size();
+
+    clcv_bufferpair gh = get_scratchpair(get_nrows() * get_ncols() * sizeof (T));
+    cl::Kernel scan = create_gray_vhgw_scan(get_in_buffer(), gh.first, gh.second,
+                                            get_nrows(), get_ncols(),
+                                            se_rad, vertical, erosion);
+    cl::Kernel kernel = create_gray_vhgw_merge(gh.first, gh.second, get_out_buffer(),
+                                               get_nrows(), get_ncols(),
+                                               se_rad, vertical, erosion);
+    swap_buffers();
+    enqueue_kernel(scan, s_size, cl::NullRange);
+    cl::Event event;
+    enqueue_kernel(kernel, g_size, l_size, NULL, &event);
+    return event;
+  }
+
+  // Rectangles are separable, even near the borders since the pixels outside
+  // the image are ignored
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_gray_morph(const cl_int se_rowrad, const cl_int se_colrad,
+                                     const bool erosion)
+  {
+    cl::Event event;
+    if (se_colrad > 0 || se_rowrad == 0)
+      event = push_gray_vhgw(se_colrad, false, erosion);
+    if (se_rowrad > 0)
+      event = push_gray_vhgw(se_rowrad, true, erosion);
+    return event;
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_gray_morph(const clcv_se_id se_id, const bool erosion)
+  {
+    cl_int se_rowrad, se_colrad;
+    if (get_rect(se_id, se_rowrad, se_colrad))
+      return push_gray_morph(se_rowrad, se_colrad, erosion);
+    return push_graymorph(se_id, erosion);
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_gray_dilation(const clcv_se_id se_id)
+  {
+    return push_gray_morph(se_id, false);
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_gray_erosion(const clcv_se_id se_id)
+  {
+    return push_gray_morph(se_id, true);
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_gray_opening(const clcv_se_id se_id)
+  { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
+    push_gray_morph(se_id, true);
+    return push_gray_morph(se_id, false);
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_gray_closing(const clcv_se_id se_id)
+  { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
+    push_gray_morph(se_id, false);
+    return push_gray_morph(se_id, true);
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_gray_dilation(const cl_int se_rowrad, const cl_int se_colrad)
+  {
+    return push_gray_morph(se_rowrad, se_colrad, false);
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_gray_erosion(const cl_int se_rowrad, const cl_int se_colrad)
+  {
+    return push_gray_morph(se_rowrad, se_colrad, true);
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_gray_opening(const cl_int se_rowrad, const cl_int se_colrad)
+  { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
+    push_gray_morph(se_rowrad, se_colrad, true);
+    return push_gray_morph(se_rowrad, se_colrad, false);
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_gray_closing(const cl_int se_rowrad, const cl_int se_colrad)
+  { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
+    push_gray_morph(se_rowrad, se_colrad, false);
+    return push_gray_morph(se_rowrad, se_colrad, true);
+  }
+
+  template<typename T>
+  inline
+  cl::Kernel CLCV<T>::create_gray_reconstruct_tile(const cl::Buffer & marker_in,
+                                                   const cl::Buffer & marker_out,
+                                                   const cl::Buffer & mask,
+                                                   const cl_int nrows, const cl_int ncols,
+                                                   const bool erosion,
+                                                   const cl::NDRange & local_work_size)
+  {
+    clcv_kernel & kernel = get_kernel("gray_reconstruct_tile",
+                                      marker_in, marker_out, local_work_size);
+    kernel.setArg(0, marker_in);
+    kernel.setArg(1, marker_out);
+    kernel.setArg(2, mask);
+    kernel.setArg(3, nrows);
+    kernel.setArg(4, ncols);
+    kernel.setArg(5, (cl_int)erosion);
+    cl_int local_size = (xdim(local_work_size) + 2)
+    * (ydim(local_work_size) + 2) * sizeof (T);
+    kernel.setArg(6, local_size, NULL);
+    kernel.setArg(7, sizeof (cl_int), NULL);
+    return kernel;
+  }
+
+  template<typename T>
+  inline
+  cl::Kernel CLCV<T>::create_gray_reconstruct_seed(const cl::Buffer & marker,
+                                                   const cl::Buffer & mask,
+                                                   const cl::Buffer & queue,
+                                                   const cl::Buffer & counts,
+                                                   const cl::Buffer & stamps,
+                                                   const cl_int nrows, const cl_int ncols,
+                                                   const bool erosion)
+  {
+    clcv_kernel & kernel = get_kernel("gray_reconstruct_seed", marker, mask);
+    kernel.setArg(0, marker);
+    kernel.setArg(1, mask);
+    kernel.setArg(2, queue);
+    kernel.setArg(3, counts);
+    kernel.setArg(4, stamps);
+    kernel.setArg(5, nrows);
+    kernel.setArg(6, ncols);
+    kernel.setArg(7, (cl_int)erosion);
+    return kernel;
+  }
+
+  template<typename T>
+  inline
+  cl::Kernel CLCV<T>::create_gray_reconstruct_fifo(const cl::Buffer & marker,
+                                                   const cl::Buffer & mask,
+                                                   const cl::Buffer & queue_in,
+                                                   const cl::Buffer & queue_out,
+                                                   const cl::Buffer & counts,
+                                                   const cl_int in_index,
+                                                   const cl::Buffer & stamps,
+                                                   const cl_int nrows, const cl_int ncols,
+                                                   const bool erosion, const cl_int fifo_round)
+  {
+    clcv_kernel & kernel = get_kernel("gray_reconstruct_fifo", marker, mask);
+    kernel.setArg(0, marker);
+    kernel.setArg(1, mask);
+    kernel.setArg(2, queue_in);
+    kernel.setArg(3, queue_out);
+    kernel.setArg(4, counts);
+    kernel.setArg(5, in_index);
+    kernel.setArg(6, stamps);
+    kernel.setArg(7, nrows);
+    kernel.setArg(8, ncols);
+    kernel.setArg(9, (cl_int)erosion);
+    kernel.setArg(10, fifo_round);
+    return kernel;
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_gray_reconstruct(const clcv_image_id marker_id,
+                                           const clcv_image_id mask_id,
+                                           const bool erosion, const unsigned batch)
+  {
+    assert(get_image(marker_id).nrows == get_image(mask_id).nrows);
+    assert(get_image(marker_id).ncols == get_image(mask_id).ncols);
+    m_current_image_id = marker_id;
+    return push_gray_reconstruct(get_image().buffers, get_in_buffer(mask_id), erosion, batch);
+  }
+
+  // The tile passes also clip the marker by the mask. The FIFO then works
+  // in place on marker.first: the queues are the slot 0 scratch buffers, the
+  // stamps (the last round each pixel was queued in) the slot 3 one. Each
+  // round has as many threads as the device can keep busy, whatever the
+  // size of the queue.
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_gray_reconstruct(clcv_bufferpair & marker, const cl::Buffer & mask,
+                                           const bool erosion, const unsigned batch)
+  { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
+    assert(batch > 0);
+    const cl::NDRange & l_size = get_local_work_size();
+    const cl::NDRange & g_size = get_global_work_size().dimensions() == 0 ?
+    get_image().global_work_size
+    : get_global_work_size();
+    const bool cpu = get_device_type() == CL_DEVICE_TYPE_CPU;
+    const cl::NDRange f_lsize = cpu ? cl::NDRange(1) : cl::NDRange(64);
+    const cl::NDRange f_gsize(cpu ? 64 : 64 * 256);
+
+    assert(CLCV_RECONSTRUCT_TILE_PASSES > 0);
+    for (unsigned i = 0; i < CLCV_RECONSTRUCT_TILE_PASSES; ++i)
+    {
+      cl::Kernel kernel = create_gray_reconstruct_tile(marker.first, marker.second, mask,
+                                                       get_nrows(), get_ncols(),
+                                                       erosion, l_size);
+      std::swap(marker.first, marker.second);
+      enqueue_kernel(kernel, g_size, l_size);
+    }
+
+    const unsigned size = get_nrows() * get_ncols() * sizeof (cl_int);
+    clcv_bufferpair queues = get_scratchpair(size);
+    cl::Buffer stamps = get_scratchpair(size, 3).first;
+    cl_int zeros[2] = { 0, 0 };
+    cl::Buffer counts(get_context(), CL_MEM_READ_WRITE | CL_MEM_COPY_HOST_PTR,
+                      sizeof (zeros), zeros);
+
+    cl::Kernel seed = create_gray_reconstruct_seed(marker.first, mask, queues.first, counts,
+                                                   stamps, get_nrows(), get_ncols(), erosion);
+    cl::Event event;
+    enqueue_kernel(seed, get_image().global_work_size, cl::NullRange, NULL, &event);
+    static const cl_int zero = 0;
+    cl_int in_index = 0;
+    cl_int fifo_round = 1;
+    cl_int count = 1;
+    while (count != 0)
+    {
+      for (unsigned i = 0; i < batch; ++i, ++fifo_round)
+      {
+        m_queue.enqueueWriteBuffer(counts, CL_FALSE, (1 - in_index) * sizeof (cl_int),
+                                   sizeof (cl_int), &zero);
+        cl::Kernel kernel = create_gray_reconstruct_fifo(marker.first, mask,
+                                                         queues.first, queues.second,
+                                                         counts, in_index, stamps,
+                                                         get_nrows(), get_ncols(),
+                                                         erosion, fifo_round);
+        std::swap(queues.first, queues.second);
+        in_index = 1 - in_index;
+        enqueue_kernel(kernel, f_gsize, f_lsize, NULL, &event);
+      }
+      assert(m_recording_plan_id == 0);
+      m_queue.enqueueReadBuffer(counts, CL_TRUE, in_index * sizeof (cl_int),
+                                sizeof (cl_int), &count);
+    }
+    return event;
+  }
+
+  // Leveling the maxima keeps the original image as the mask, in the slot 2
+  // scratch buffer
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_hmaxima(const cl_int h, const unsigned batch)
+  { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
+    assert(h >= 0);
+    clcv_bufferpair saved = get_scratchpair(get_nrows() * get_ncols() * sizeof (T), 2);
+    enqueue_copy(get_in_buffer(), saved.first, 0, 0, get_nrows() * get_ncols() * sizeof (T));
+    push_gray_add_const(get_in_buffer(), get_in_buffer(), -h);
+    return push_gray_reconstruct(get_image().buffers, saved.first, false, batch);
+  }
+
+  // The reconstruction of the image minus 1 is the image, minus 1 on the
+  // regional maxima
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_regional_maxima(const unsigned batch)
+  { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
+    push_hmaxima(1, batch);
+    const cl::Buffer saved = get_scratchpair(get_nrows() * get_ncols() * sizeof (T), 2).first;
+    cl::Event event = push_gray_sub(saved, get_in_buffer(), get_out_buffer());
+    swap_buffers();
+    return event;
+  }
+
+  // The marker (slot 1 scratch buffers) starts from the maximum value inside
+  // the image
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_fill_holes_gray(const unsigned batch)
+  { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
+    const unsigned size = get_nrows() * get_ncols() * sizeof (T);
+    clcv_bufferpair marker = get_scratchpair(size, 1);
+
+    cl::Kernel kernel = create_gray_border_marker(get_in_buffer(), marker.first,
+                                                  get_nrows(), get_ncols(), CL_INT_MAX);
+    enqueue_kernel(kernel, get_image().global_work_size, cl::NullRange);
+    push_gray_reconstruct(marker, get_in_buffer(), true, batch);
+    cl::Event event;
+    enqueue_copy(marker.first, get_out_buffer(), 0, 0, size, NULL, &event);
+    swap_buffers();
+    return event;
+  }
+
+  template<typename T>
+  inline
+  cl::Kernel CLCV<T>::create_gray_add_const(const cl::Buffer & image_in,
+                                            const cl::Buffer & image_out,
+                                            const cl_int value)
+  {
+    clcv_kernel & kernel = get_kernel("gray_add_const", image_in, image_out);
+    kernel.setArg(0, image_in);
+    kernel.setArg(1, image_out);
+    kernel.setArg(2, value);
+    return kernel;
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_gray_add_const(const cl::Buffer & image_in,
+                                         const cl::Buffer & image_out,
+                                         const cl_int value)
+  {
+    const cl::NDRange g_size(get_nrows() * get_ncols());
+
+    cl::Kernel kernel = create_gray_add_const(image_in, image_out, value);
+    cl::Event event;
+    enqueue_kernel(kernel, g_size, cl::NullRange, NULL, &event);
+    return event;
+  }
+
+  template<typename T>
+  inline
+  cl::Kernel CLCV<T>::create_gray_sub(const cl::Buffer & a, const cl::Buffer & b,
+                                      const cl::Buffer & image_out)
+  {
+    clcv_kernel & kernel = get_kernel("gray_sub", a, b);
+    kernel.setArg(0, a);
+    kernel.setArg(1, b);
+    kernel.setArg(2, image_out);
+    return kernel;
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_gray_sub(const cl::Buffer & a, const cl::Buffer & b,
+                                   const cl::Buffer & image_out)
+  {
+    const cl::NDRange g_size(get_nrows() * get_ncols());
+
+    cl::Kernel kernel = create_gray_sub(a, b, image_out);
+    cl::Event event;
+    enqueue_kernel(kernel, g_size, cl::NullRange, NULL, &event);
+    return event;
+  }
+
+  template<typename T>
+  inline
+  cl::Kernel CLCV<T>::create_gray_border_marker(const cl::Buffer & image_in,
+                                                const cl::Buffer & marker,
+                                                const cl_int nrows, const cl_int ncols,
+                                                const cl_int value)
+  {
+    clcv_kernel & kernel = get_kernel("gray_border_marker", image_in, marker);
+    kernel.setArg(0, image_in);
+    kernel.setArg(1, marker);
+    kernel.setArg(2, nrows);
+    kernel.setArg(3, ncols);
+    kernel.setArg(4, value);
+    return kernel;
+  }
+
+  template<typename T>
+  inline
+  cl::Kernel CLCV<T>::create_watershed_init(const cl::Buffer & gradient,
+                                            const cl::Buffer & labels,
+                                            const cl::Buffer & cost, const cl::Buffer & dist,
+                                            const cl_int nrows, const cl_int ncols)
+  {
+    clcv_kernel & kernel = get_kernel("watershed_init", gradient, labels);
+    kernel.setArg(0, gradient);
+    kernel.setArg(1, labels);
+    kernel.setArg(2, cost);
+    kernel.setArg(3, dist);
+    kernel.setArg(4, nrows);
+    kernel.setArg(5, ncols);
+    return kernel;
+  }
+
+  template<typename T>
+  inline
+  cl::Kernel CLCV<T>::create_watershed(const cl::Buffer & cost_in, const cl::Buffer & dist_in,
+                                       const cl::Buffer & label_in, const cl::Buffer & gradient,
+                                       const cl::Buffer & cost_out, const cl::Buffer & dist_out,
+                                       const cl::Buffer & label_out,
+                                       const cl_int nrows, const cl_int ncols,
+                                       const cl::Buffer & changed,
+                                       const cl::NDRange & local_work_size)
+  {
+    clcv_kernel & kernel = get_kernel("watershed", cost_in, dist_in, local_work_size);
+    kernel.setArg(0, cost_in);
+    kernel.setArg(1, dist_in);
+    kernel.setArg(2, label_in);
+    kernel.setArg(3, gradient);
+    kernel.setArg(4, cost_out);
+    kernel.setArg(5, dist_out);
+    kernel.setArg(6, label_out);
+    kernel.setArg(7, nrows);
+    kernel.setArg(8, ncols);
+    kernel.setArg(9, changed);
+    cl_int local_size = (xdim(local_work_size) + 2)
+    * (ydim(local_work_size) + 2) * sizeof (cl_int);
+    kernel.setArg(10, local_size, NULL);
+    kernel.setArg(11, local_size, NULL);
+    kernel.setArg(12, local_size, NULL);
+    kernel.setArg(13, sizeof (cl_int), NULL);
+    return kernel;
+  }
+
+  // The labels alternate in the buffers of the marker image, the path costs
+  // in the slot 1 scratch buffers and the plateau distances in the slot 2
+  // ones
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_watershed(const clcv_image_id gradient_id,
+                                    const clcv_image_id marker_id,
+                                    const unsigned batch)
+  { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
+    assert(get_image(marker_id).nrows == get_image(gradient_id).nrows);
+    assert(get_image(marker_id).ncols == get_image(gradient_id).ncols);
+    assert(batch > 0);
+    m_current_image_id = marker_id;
+    const cl::NDRange & l_size = get_local_work_size();
+    const cl::NDRange & g_size = get_global_work_size().dimensions() == 0 ?
+    get_image().global_work_size
+    : get_global_work_size();
+
+    const unsigned size = get_nrows() * get_ncols() * sizeof (cl_int);
+    clcv_bufferpair cost = get_scratchpair(size, 1);
+    clcv_bufferpair dist = get_scratchpair(size, 2);
+    const cl::Buffer & gradient = get_in_buffer(gradient_id);
+
+    cl::Kernel init = create_watershed_init(gradient, get_in_buffer(), cost.first, dist.first,
+                                            get_nrows(), get_ncols());
+    cl::Event event;
+    enqueue_kernel(init, get_image().global_work_size, cl::NullRange, NULL, &event);
+    bool changed = true;
+    while (changed)
+    {
+      reset_flag();
+      for (unsigned i = 0; i < batch; ++i)
+      {
+        cl::Kernel kernel = create_watershed(cost.first, dist.first, get_in_buffer(), gradient,
+                                             cost.second, dist.second, get_out_buffer(),
+                                             get_nrows(), get_ncols(), m_flag, l_size);
+        std::swap(cost.first, cost.second);
+        std::swap(dist.first, dist.second);
+        swap_buffers();
+        enqueue_kernel(kernel, g_size, l_size, NULL, &event);
+      }
+      changed = read_flag();
+    }
+    return event;
+  }
+
+  template<typename T>
+  inline
+  cl::Kernel CLCV<T>::create_bitmappedlogic(const cl::Buffer & a, const cl::Buffer & b,
+                                            const cl::Buffer & image_out,
+                                            const clcv_logic_op op)
+  {
+    clcv_kernel & kernel = get_kernel("bitmapped_logic", a, b);
+    kernel.setArg(0, a);
+    kernel.setArg(1, b);
+    kernel.setArg(2, image_out);
+    kernel.setArg(3, (cl_int)op);
+    return kernel;
+  }
+
+  // Unlike the other operators, works on explicit buffers of the size of the
+  // current bitmapped image, and doesn't swap anything
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmappedlogic(const cl::Buffer & a, const cl::Buffer & b,
+                                         const cl::Buffer & image_out,
+                                         const clcv_logic_op op)
+  {
+    assert(is_bitmappable());
+
+    const cl::NDRange unit_range(1);
+    const cl::NDRange parallel_range(64);
+    const cl::NDRange g_size(get_nrows() * get_ncols() / 32);
+
+    const cl::NDRange & l_size =
+    get_device_type() == CL_DEVICE_TYPE_CPU ? unit_range : parallel_range;
+
+    cl::Kernel kernel = create_bitmappedlogic(a, b, image_out, op);
+    cl::Event event;
+    enqueue_kernel(kernel, g_size, l_size, NULL, &event);
+    return event;
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_naivelogic(const cl::Buffer & a, const cl::Buffer & b,
+                                     const cl::Buffer & image_out,
+                                     const clcv_logic_op op)
+  {
+    const cl::NDRange g_size(get_nrows() * get_ncols());
+
+    cl::Kernel kernel = create_bitmappedlogic(a, b, image_out, op);
+    cl::Event event;
+    enqueue_kernel(kernel, g_size, cl::NullRange, NULL, &event);
+    return event;
+  }
+
+  template<typename T>
+  inline
+  cl::Kernel CLCV<T>::create_bitmappedmorph_dilation_h(const cl::Buffer & image_in,
+                                                       const cl::Buffer & image_out,
+                                                       const cl_int nrows, const cl_int ncols,
+                                                       const cl_int se_colrad,
+                                                       const cl::NDRange & local_work_size)
+  {
+    assert(se_colrad <= 32);
+    assert(ncols % 32 == 0);
+
+    clcv_kernel & kernel = get_kernel("bitmapped_dilation_h", image_in, image_out, local_work_size);
+    kernel.setArg(0, image_in);
+    kernel.setArg(1, image_out);
+    kernel.setArg(2, nrows);
+    kernel.setArg(3, ncols);
+    kernel.setArg(4, se_colrad);
+    cl_int local_size = (xdim(local_work_size) + 16*2)
+    * ydim(local_work_size) * sizeof (T);
+    kernel.setArg(5, local_size, NULL);
+    return kernel;
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmappedmorph_dilation_h(const cl_int se_colrad)
+  {
+    if (se_colrad > CLCV_VHGW_COLRAD)
+      return push_bitmappedmorph_vhgw_h(se_colrad, false);
+
+    assert(get_image().ncols % 32 == 0);
+    const unsigned ncols_round = round(get_ncols()/32, 32);
+    const cl::NDRange b_size(ncols_round, get_nrows());
+
+    const cl::NDRange & l_size = get_local_work_size();
+    const cl::NDRange & g_size = get_global_work_size().dimensions() == 0 ?
+    b_size : get_global_work_size();
 
     cl::Kernel kernel = create_bitmappedmorph_dilation_h(get_in_buffer(), get_out_buffer(),
                                                          get_nrows(), get_ncols(),
                                                          se_colrad, l_size);
     swap_buffers();
-    cl::Event event;    
-    m_queue.enqueueNDRangeKernel(kernel, cl::NullRange, g_size, l_size, NULL, &event);
-    return event;    
+    cl::Event event;    
+    enqueue_kernel(kernel, g_size, l_size, NULL, &event);
+    return event;    
+  }
+
+  template<typename T>
+  inline
+  cl::Kernel CLCV<T>::create_bitmappedmorph_dilation_v(const cl::Buffer & image_in,
+                                                       const cl::Buffer & image_out,
+                                                       const cl_int nrows, const cl_int ncols,
+                                                       const cl_int se_rowrad,
+                                                       const cl::NDRange & local_work_size)
+  {
+    assert(ncols % 32 == 0);
+    
+    clcv_kernel & kernel = get_kernel("bitmapped_dilation_v", image_in, image_out, local_work_size);
+    kernel.setArg(0, image_in);
+    kernel.setArg(1, image_out);
+    kernel.setArg(2, nrows);
+    kernel.setArg(3, ncols);
+    kernel.setArg(4, se_rowrad);
+    cl_int local_size = xdim(local_work_size)
+    * (ydim(local_work_size) + se_rowrad*2) * sizeof (T);
+    kernel.setArg(5, local_size, NULL);
+    return kernel;
+  }
+  
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmappedmorph_dilation_v(const cl_int se_rowrad)
+  {
+    if (se_rowrad > CLCV_VHGW_ROWRAD)
+      return push_bitmappedmorph_vhgw_v(se_rowrad, false);
+
+    assert(get_image().ncols % 32 == 0);
+    const unsigned ncols_round = round(get_ncols()/32, 32);
+    const cl::NDRange b_size(ncols_round, get_nrows());
+
+    const cl::NDRange & l_size = get_local_work_size();
+    const cl::NDRange & g_size = get_global_work_size().dimensions() == 0 ?
+    b_size : get_global_work_size();
+    
+    cl::Kernel kernel = create_bitmappedmorph_dilation_v(get_in_buffer(), get_out_buffer(),
+                                                           get_nrows(), get_ncols(),
+                                                           se_rowrad, l_size);
+    swap_buffers();
+    cl::Event event;
+    enqueue_kernel(kernel, g_size, l_size, NULL, &event);
+    return event;
+  }
+  
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmappedmorph_dilation(const cl_int se_rowrad, const cl_int se_colrad)
+  { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
+    push_bitmappedmorph_dilation_h(se_colrad);
+    return push_bitmappedmorph_dilation_v(se_rowrad);
+  }
+
+  template<typename T>
+  inline
+  cl::Kernel CLCV<T>::create_bitmappedmorph_erosion_h(const cl::Buffer & image_in,
+                                                      const cl::Buffer & image_out,
+                                                      const cl_int nrows, const cl_int ncols,
+                                                      const cl_int se_colrad,
+                                                      const cl::NDRange & local_work_size)
+  {
+    assert(se_colrad <= 32);
+    assert(ncols % 32 == 0);
+    
+    clcv_kernel & kernel = get_kernel("bitmapped_erosion_h", image_in, image_out, local_work_size);
+    kernel.setArg(0, image_in);
+    kernel.setArg(1, image_out);
+    kernel.setArg(2, nrows);
+    kernel.setArg(3, ncols);
+    kernel.setArg(4, se_colrad);
+    cl_int local_size = (xdim(local_work_size) + 16*2)
+    * ydim(local_work_size) * sizeof (T);
+    kernel.setArg(5, local_size, NULL);
+    return kernel;
+  }
+  
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmappedmorph_erosion_h(const cl_int se_colrad)
+  {
+    if (se_colrad > CLCV_VHGW_COLRAD)
+      return push_bitmappedmorph_vhgw_h(se_colrad, true);
+
+    assert(get_image().ncols % 32 == 0);
+    const unsigned ncols_round = round(get_ncols()/32, 32);
+    const cl::NDRange b_size(ncols_round, get_nrows());
+    
+    const cl::NDRange & l_size = get_local_work_size();
+    const cl::NDRange & g_size = get_global_work_size().dimensions() == 0 ?
+    b_size : get_global_work_size();
+    
+    cl::Kernel kernel = create_bitmappedmorph_erosion_h(get_in_buffer(), get_out_buffer(),
+                                                        get_nrows(), get_ncols(),
+                                                        se_colrad, l_size);
+    swap_buffers();
+    cl::Event event;    
+    enqueue_kernel(kernel, g_size, l_size, NULL, &event);
+    return event;    
+  }
+  
+  template<typename T>
+  inline
+  cl::Kernel CLCV<T>::create_bitmappedmorph_erosion_v(const cl::Buffer & image_in,
+                                                      const cl::Buffer & image_out,
+                                                      const cl_int nrows, const cl_int ncols,
+                                                      const cl_int se_rowrad,
+                                                      const cl::NDRange & local_work_size)
+  {
+    assert(ncols % 32 == 0);
+    
+    clcv_kernel & kernel = get_kernel("bitmapped_erosion_v", image_in, image_out, local_work_size);
+    kernel.setArg(0, image_in);
+    kernel.setArg(1, image_out);
+    kernel.setArg(2, nrows);
+    kernel.setArg(3, ncols);
+    kernel.setArg(4, se_rowrad);
+    cl_int local_size = xdim(local_work_size)
+    * (ydim(local_work_size) + se_rowrad*2) * sizeof (T);
+    kernel.setArg(5, local_size, NULL);
+    return kernel;
+  }
+  
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmappedmorph_erosion_v(const cl_int se_rowrad)
+  {
+    if (se_rowrad > CLCV_VHGW_ROWRAD)
+      return push_bitmappedmorph_vhgw_v(se_rowrad, true);
+
+    assert(get_image().ncols % 32 == 0);
+    const unsigned ncols_round = round(get_ncols()/32, 32);
+    const cl::NDRange b_size(ncols_round, get_nrows());
+    
+    const cl::NDRange & l_size = get_local_work_size();
+    const cl::NDRange & g_size = get_global_work_size().dimensions() == 0 ?
+    b_size : get_global_work_size();
+    
+    cl::Kernel kernel = create_bitmappedmorph_erosion_v(get_in_buffer(), get_out_buffer(),
+                                                        get_nrows(), get_ncols(),
+                                                        se_rowrad, l_size);
+    swap_buffers();
+    cl::Event event;
+    enqueue_kernel(kernel, g_size, l_size, NULL, &event);
+    return event;
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmappedmorph_erosion(const cl_int se_rowrad, const cl_int se_colrad)
+  { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
+    push_bitmappedmorph_erosion_h(se_colrad);
+    return push_bitmappedmorph_erosion_v(se_rowrad);
+  }  
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmappedmorph_opening(const cl_int se_rowrad, const cl_int se_colrad)
+  { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
+    if (can_push_bitmappedmorph_fused(se_rowrad, se_colrad))
+      return push_bitmappedmorph_fused(se_rowrad, se_colrad, false);
+    push_bitmappedmorph_erosion(se_rowrad, se_colrad);
+    return push_bitmappedmorph_dilation(se_rowrad, se_colrad);
+  }  
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmappedmorph_closing(const cl_int se_rowrad, const cl_int se_colrad)
+  { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
+    if (can_push_bitmappedmorph_fused(se_rowrad, se_colrad))
+      return push_bitmappedmorph_fused(se_rowrad, se_colrad, true);
+    push_bitmappedmorph_dilation(se_rowrad, se_colrad);
+    return push_bitmappedmorph_erosion(se_rowrad, se_colrad);
+  }  
+
+  template<typename T>
+  inline
+  cl::Kernel CLCV<T>::create_bitmappedrank(const cl::Buffer & image_in,
+                                           const cl::Buffer & image_out,
+                                           const cl_int nrows, const cl_int ncols,
+                                           const clcv_se_id se_id, const cl_int rank,
+                                           const cl::NDRange & local_work_size)
+  {
+    clcv_se & se = get_se(se_id);
+    assert(se.colrad <= 32);
+    assert(se.se_nonzero < 65536);
+    assert(rank >= 0 && (unsigned) rank <= se.se_positive);
+    assert(ncols % 32 == 0);
+
+    clcv_kernel & kernel = get_kernel("bitmapped_rank", image_in, image_out, local_work_size);
+    kernel.setArg(0, image_in);
+    kernel.setArg(1, image_out);
+    kernel.setArg(2, nrows);
+    kernel.setArg(3, ncols);
+    kernel.setArg(4, se.clmem);
+    kernel.setArg(5, se.rowrad);
+    kernel.setArg(6, se.se_nonzero);
+    kernel.setArg(7, rank);
+    kernel.setArg(8, se.buffer_size, NULL);
+    cl_int local_size = (xdim(local_work_size) + 2)
+    * (ydim(local_work_size) + se.rowrad*2) * sizeof (T);
+    kernel.setArg(9, local_size, NULL);
+    return kernel;
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmappedrank(const clcv_se_id se_id, const cl_int rank)
+  {
+    assert(get_image().ncols % 32 == 0);
+    const unsigned ncols_round = round(get_ncols()/32, 32);
+    const cl::NDRange b_size(ncols_round, get_nrows());
+
+    const cl::NDRange & l_size = get_local_work_size();
+    const cl::NDRange & g_size = get_global_work_size().dimensions() == 0 ?
+    b_size : get_global_work_size();
+
+    cl::Kernel kernel = create_bitmappedrank(get_in_buffer(), get_out_buffer(),
+                                             get_nrows(), get_ncols(), se_id, rank, l_size);
+    swap_buffers();
+    cl::Event event;
+    enqueue_kernel(kernel, g_size, l_size, NULL, &event);
+    return event;
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmappedmedian(const clcv_se_id se_id)
+  {
+    return push_bitmappedrank(se_id, get_se(se_id).se_positive / 2 + 1);
+  }
+
+  template<typename T>
+  inline
+  cl::Kernel CLCV<T>::create_bitmappedmorph_diag(const cl::Buffer & image_in,
+                                                 const cl::Buffer & image_out,
+                                                 const cl_int nrows, const cl_int ncols,
+                                                 const cl_int se_rad, const cl_int dir,
+                                                 const bool erosion,
+                                                 const cl::NDRange & local_work_size)
+  {
+    assert(se_rad <= 32);
+    assert(ncols % 32 == 0);
+
+    clcv_kernel & kernel = get_kernel(erosion ? "bitmapped_erosion_diag" : "bitmapped_dilation_diag",
+                                      image_in, image_out, local_work_size);
+    kernel.setArg(0, image_in);
+    kernel.setArg(1, image_out);
+    kernel.setArg(2, nrows);
+    kernel.setArg(3, ncols);
+    kernel.setArg(4, se_rad);
+    kernel.setArg(5, dir);
+    cl_int local_size = (xdim(local_work_size) + 2)
+    * (ydim(local_work_size) + se_rad*2) * sizeof (T);
+    kernel.setArg(6, local_size, NULL);
+    return kernel;
+  }
+
+  // The kernel shifts by one word at most, longer segments are sums of
+  // segments of radius <= 32
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmappedmorph_diag(const cl_int se_rad, const cl_int dir,
+                                              const bool erosion)
+  {
+    assert(get_image().ncols % 32 == 0);
+    const unsigned ncols_round = round(get_ncols()/32, 32);
+    const cl::NDRange b_size(ncols_round, get_nrows());
+
+    const cl::NDRange & l_size = get_local_work_size();
+    const cl::NDRange & g_size = get_global_work_size().dimensions() == 0 ?
+    b_size : get_global_work_size();
+
+    cl::Event event;
+    for (cl_int rad = se_rad; rad > 0; rad -= 32)
+    {
+      cl::Kernel kernel = create_bitmappedmorph_diag(get_in_buffer(), get_out_buffer(),
+                                                     get_nrows(), get_ncols(),
+                                                     std::min(rad, 32), dir, erosion, l_size);
+      swap_buffers();
+      enqueue_kernel(kernel, g_size, l_size, NULL, &event);
+    }
+    return event;
+  }
+
+  template<typename T>
+  inline
+  cl::Kernel CLCV<T>::create_bitmappedmorph_3x3(const cl::Buffer & image_in,
+                                                const cl::Buffer & image_out,
+                                                const cl_int nrows, const cl_int ncols,
+                                                const bool c8, const bool erosion,
+                                                const cl::NDRange & local_work_size)
+  {
+    assert(ncols % 32 == 0);
+
+    static const char * names[2][2] =
+      {
+        { "bitmapped_dilation_c4", "bitmapped_erosion_c4" },
+        { "bitmapped_dilation_c8", "bitmapped_erosion_c8" }
+      };
+    clcv_kernel & kernel = get_kernel(names[c8][erosion], image_in, image_out, local_work_size);
+    kernel.setArg(0, image_in);
+    kernel.setArg(1, image_out);
+    kernel.setArg(2, nrows);
+    kernel.setArg(3, ncols);
+    cl_int local_size = (xdim(local_work_size) + 2)
+    * (ydim(local_work_size) + 2) * sizeof (T);
+    kernel.setArg(4, local_size, NULL);
+    return kernel;
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmappedmorph_3x3(const bool c8, const bool erosion)
+  {
+    assert(get_image().ncols % 32 == 0);
+    const unsigned ncols_round = round(get_ncols()/32, 32);
+    const cl::NDRange b_size(ncols_round, get_nrows());
+
+    const cl::NDRange & l_size = get_local_work_size();
+    const cl::NDRange & g_size = get_global_work_size().dimensions() == 0 ?
+    b_size : get_global_work_size();
+
+    cl::Kernel kernel = create_bitmappedmorph_3x3(get_in_buffer(), get_out_buffer(),
+                                                  get_nrows(), get_ncols(), c8, erosion,
+                                                  l_size);
+    swap_buffers();
+    cl::Event event;
+    enqueue_kernel(kernel, g_size, l_size, NULL, &event);
+    return event;
+  }
+
+  // Square of radius a plus diagonal segments of radius b: a + 2b along the
+  // axes, (a + b) * sqrt(2) along the diagonals, hence b ~= r * (1 - 1/sqrt(2)).
+  // The diagonal sum has holes, which the square fills as long as a >= 1.
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmappedmorph_octagon(const cl_int radius, const bool erosion)
+  { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
+    assert(radius > 0);
+    const cl_int b = std::min((radius * 293 + 500) / 1000, (radius - 1) / 2);
+    const cl_int a = radius - 2 * b;
+
+    cl::Event event = erosion ? push_bitmappedmorph_erosion(a, a)
+      : push_bitmappedmorph_dilation(a, a);
+    if (b > 0)
+    {
+      push_bitmappedmorph_diag(b, 1, erosion);
+      event = push_bitmappedmorph_diag(b, -1, erosion);
+    }
+    return event;
+  }
+
+  // The diagonal segments of radius b sum to the pixels of the diamond of
+  // radius 2b with an even row + col, one cross fills it up to 2b + 1
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmappedmorph_diamond(const cl_int radius, const bool erosion)
+  { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
+    assert(radius > 0);
+    const cl_int b = (radius - 1) / 2;
+
+    if (b > 0)
+    {
+      push_bitmappedmorph_diag(b, 1, erosion);
+      push_bitmappedmorph_diag(b, -1, erosion);
+    }
+    cl::Event event;
+    for (cl_int i = 2 * b; i < radius; ++i)
+      event = push_bitmappedmorph_3x3(false, erosion);
+    return event;
+  }
+
+  template<typename T>
+  inline
+  cl::Kernel CLCV<T>::create_bitmappedmorph_fused(const cl::Buffer & image_in,
+                                                  const cl::Buffer & image_out,
+                                                  const cl_int nrows, const cl_int ncols,
+                                                  const cl_int se_rowrad, const cl_int se_colrad,
+                                                  const bool closing, const bool residue,
+                                                  const cl::NDRange & local_work_size)
+  {
+    assert(se_colrad <= 32);
+    assert(ncols % 32 == 0);
+
+    const char * name = residue ?
+      (closing ? "bitmapped_blackhat_rect" : "bitmapped_tophat_rect")
+      : (closing ? "bitmapped_closing_rect" : "bitmapped_opening_rect");
+    clcv_kernel & kernel = get_kernel(name, image_in, image_out, local_work_size);
+    kernel.setArg(0, image_in);
+    kernel.setArg(1, image_out);
+    kernel.setArg(2, nrows);
+    kernel.setArg(3, ncols);
+    kernel.setArg(4, se_rowrad);
+    kernel.setArg(5, se_colrad);
+    cl_int local_size = (xdim(local_work_size) + 4)
+    * (ydim(local_work_size) + se_rowrad*4) * sizeof (T);
+    kernel.setArg(6, local_size, NULL);
+    kernel.setArg(7, local_size, NULL);
+    return kernel;
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmappedmorph_fused(const cl_int se_rowrad, const cl_int se_colrad,
+                                               const bool closing, const bool residue)
+  {
+    assert(get_image().ncols % 32 == 0);
+    const unsigned ncols_round = round(get_ncols()/32, 32);
+    const cl::NDRange b_size(ncols_round, get_nrows());
+
+    const cl::NDRange & l_size = get_local_work_size();
+    const cl::NDRange & g_size = get_global_work_size().dimensions() == 0 ?
+    b_size : get_global_work_size();
+
+    cl::Kernel kernel = create_bitmappedmorph_fused(get_in_buffer(), get_out_buffer(),
+                                                    get_nrows(), get_ncols(),
+                                                    se_rowrad, se_colrad, closing, residue,
+                                                    l_size);
+    swap_buffers();
+    cl::Event event;
+    enqueue_kernel(kernel, g_size, l_size, NULL, &event);
+    return event;
   }
 
   template<typename T>
   inline
-  cl::Kernel CLCV<T>::create_bitmappedmorph_dilation_v(const cl::Buffer & image_in,
-                                                       const cl::Buffer & image_out,
-                                                       const cl_int nrows, const cl_int ncols,
-                                                       const cl_int se_rowrad,
-                                                       const cl::NDRange & local_work_size)
+  cl::Kernel CLCV<T>::create_bitmappedmorph_gradient(const cl::Buffer & image_in,
+                                                     const cl::Buffer & image_out,
+                                                     const cl_int nrows, const cl_int ncols,
+                                                     const cl_int se_rowrad, const cl_int se_colrad,
+                                                     const cl::NDRange & local_work_size)
   {
+    assert(se_colrad <= 32);
     assert(ncols % 32 == 0);
-    
-    cl::Kernel kernel(m_program, "bitmapped_dilation_v");
+
+    clcv_kernel & kernel = get_kernel("bitmapped_gradient_rect",
+                                      image_in, image_out, local_work_size);
     kernel.setArg(0, image_in);
     kernel.setArg(1, image_out);
     kernel.setArg(2, nrows);
     kernel.setArg(3, ncols);
     kernel.setArg(4, se_rowrad);
-    cl_int local_size = xdim(local_work_size)
+    kernel.setArg(5, se_colrad);
+    cl_int local_size = (xdim(local_work_size) + 2)
     * (ydim(local_work_size) + se_rowrad*2) * sizeof (T);
-    kernel.setArg(5, local_size, NULL);
+    kernel.setArg(6, local_size, NULL);
+    kernel.setArg(7, local_size, NULL);
+    kernel.setArg(8, local_size, NULL);
     return kernel;
   }
-  
+
   template<typename T>
   inline
-  cl::Event CLCV<T>::push_bitmappedmorph_dilation_v(const cl_int se_rowrad)
+  cl::Event CLCV<T>::push_bitmappedmorph_gradient(const cl_int se_rowrad, const cl_int se_colrad)
   {
     assert(get_image().ncols % 32 == 0);
+    if (se_colrad > 32 || se_rowrad > CLCV_VHGW_ROWRAD)
+    { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
+      const unsigned size = get_bitmap_size();
+      clcv_bufferpair saved = get_scratchpair(size, 2);
+      enqueue_copy(get_in_buffer(), saved.first, 0, 0, size);
+      push_bitmappedmorph_dilation(se_rowrad, se_colrad);
+      enqueue_copy(get_in_buffer(), saved.second, 0, 0, size);
+      enqueue_copy(saved.first, get_in_buffer(), 0, 0, size);
+      push_bitmappedmorph_erosion(se_rowrad, se_colrad);
+      cl::Event event = push_bitmappedlogic(saved.second, get_in_buffer(), get_out_buffer(),
+                                            logic_andnot);
+      swap_buffers();
+      return event;
+    }
+
     const unsigned ncols_round = round(get_ncols()/32, 32);
     const cl::NDRange b_size(ncols_round, get_nrows());
 
     const cl::NDRange & l_size = get_local_work_size();
     const cl::NDRange & g_size = get_global_work_size().dimensions() == 0 ?
     b_size : get_global_work_size();
-    
-    cl::Kernel kernel = create_bitmappedmorph_dilation_v(get_in_buffer(), get_out_buffer(),
-                                                           get_nrows(), get_ncols(),
-                                                           se_rowrad, l_size);
+
+    cl::Kernel kernel = create_bitmappedmorph_gradient(get_in_buffer(), get_out_buffer(),
+                                                       get_nrows(), get_ncols(),
+                                                       se_rowrad, se_colrad, l_size);
     swap_buffers();
     cl::Event event;
-    m_queue.enqueueNDRangeKernel(kernel, cl::NullRange, g_size, l_size, NULL, &event);
+    enqueue_kernel(kernel, g_size, l_size, NULL, &event);
+    return event;
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmappedmorph_tophat(const cl_int se_rowrad, const cl_int se_colrad)
+  {
+    return push_bitmappedmorph_hat(se_rowrad, se_colrad, false);
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmappedmorph_blackhat(const cl_int se_rowrad, const cl_int se_colrad)
+  {
+    return push_bitmappedmorph_hat(se_rowrad, se_colrad, true);
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmappedmorph_hat(const cl_int se_rowrad, const cl_int se_colrad,
+                                             const bool closing)
+  { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
+    if (can_push_bitmappedmorph_fused(se_rowrad, se_colrad))
+      return push_bitmappedmorph_fused(se_rowrad, se_colrad, closing, true);
+
+    const unsigned size = get_bitmap_size();
+    clcv_bufferpair saved = get_scratchpair(size, 2);
+    enqueue_copy(get_in_buffer(), saved.first, 0, 0, size);
+    closing ? push_bitmappedmorph_closing(se_rowrad, se_colrad)
+      : push_bitmappedmorph_opening(se_rowrad, se_colrad);
+    cl::Event event = closing ?
+      push_bitmappedlogic(get_in_buffer(), saved.first, get_out_buffer(), logic_andnot)
+      : push_bitmappedlogic(saved.first, get_in_buffer(), get_out_buffer(), logic_andnot);
+    swap_buffers();
     return event;
   }
   
   template<typename T>
   inline
-  cl::Event CLCV<T>::push_bitmappedmorph_dilation(const cl_int se_rowrad, const cl_int se_colrad)
+  cl::Kernel CLCV<T>::create_bitmappedmorph(const cl::Buffer & image_in,
+                                            const cl::Buffer & image_out,
+                                            const cl_int nrows, const cl_int ncols,
+                                            const clcv_se_id se_id, const bool erosion,
+                                            const cl::NDRange & local_work_size)
+  {
+    assert(ncols % 32 == 0);
+    clcv_se & se = get_se(se_id);
+    assert(se.nruns > 0 && se.nbgruns == 0);
+
+    clcv_kernel & kernel = get_kernel(erosion ? "bitmapped_erosion" : "bitmapped_dilation",
+                                      image_in, image_out, local_work_size);
+    kernel.setArg(0, image_in);
+    kernel.setArg(1, image_out);
+    kernel.setArg(2, nrows);
+    kernel.setArg(3, ncols);
+    kernel.setArg(4, se.runs_clmem);
+    kernel.setArg(5, (cl_int) se.nruns);
+    kernel.setArg(6, (cl_int) se.runs_rowrad);
+    kernel.setArg(7, (cl_int) se.runs_colrad);
+    kernel.setArg(8, se.nruns * 3 * sizeof (T), NULL);
+    cl_int local_size = (xdim(local_work_size) + (se.runs_colrad/32 + 1)*2)
+    * (ydim(local_work_size) + se.runs_rowrad*2) * sizeof (T);
+    kernel.setArg(9, local_size, NULL);
+    return kernel;
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmappedmorph(const clcv_se_id se_id, const bool erosion)
+  {
+    assert(get_image().ncols % 32 == 0);
+    const unsigned ncols_round = round(get_ncols()/32, 32);
+    const cl::NDRange b_size(ncols_round, get_nrows());
+
+    const cl::NDRange & l_size = get_local_work_size();
+    const cl::NDRange & g_size = get_global_work_size().dimensions() == 0 ?
+    b_size : get_global_work_size();
+
+    cl::Kernel kernel = create_bitmappedmorph(get_in_buffer(), get_out_buffer(),
+                                              get_nrows(), get_ncols(),
+                                              se_id, erosion, l_size);
+    swap_buffers();
+    cl::Event event;
+    enqueue_kernel(kernel, g_size, l_size, NULL, &event);
+    return event;
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmappedmorph_dilation(const clcv_se_id se_id)
+  {
+    return push_bitmappedmorph(se_id, false);
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmappedmorph_erosion(const clcv_se_id se_id)
+  {
+    return push_bitmappedmorph(se_id, true);
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmappedmorph_opening(const clcv_se_id se_id)
   { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
-    push_bitmappedmorph_dilation_h(se_colrad);
-    return push_bitmappedmorph_dilation_v(se_rowrad);
+    if (can_push_bitmappedmorph_fused(se_id))
+      return push_bitmappedmorph_fused(se_id, false);
+    push_bitmappedmorph(se_id, true);
+    return push_bitmappedmorph(se_id, false);
   }
 
   template<typename T>
   inline
-  cl::Kernel CLCV<T>::create_bitmappedmorph_erosion_h(const cl::Buffer & image_in,
-                                                      const cl::Buffer & image_out,
-                                                      const cl_int nrows, const cl_int ncols,
-                                                      const cl_int se_colrad,
-                                                      const cl::NDRange & local_work_size)
+  cl::Event CLCV<T>::push_bitmappedmorph_closing(const clcv_se_id se_id)
+  { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
+    if (can_push_bitmappedmorph_fused(se_id))
+      return push_bitmappedmorph_fused(se_id, true);
+    push_bitmappedmorph(se_id, false);
+    return push_bitmappedmorph(se_id, true);
+  }
+
+  template<typename T>
+  inline
+  cl::Kernel CLCV<T>::create_bitmappedmorph_fused(const cl::Buffer & image_in,
+                                                  const cl::Buffer & image_out,
+                                                  const cl_int nrows, const cl_int ncols,
+                                                  const clcv_se_id se_id,
+                                                  const bool closing, const bool residue,
+                                                  const cl::NDRange & local_work_size)
   {
-    assert(se_colrad <= 32);
     assert(ncols % 32 == 0);
-    
-    cl::Kernel kernel(m_program, "bitmapped_erosion_h");
+    clcv_se & se = get_se(se_id);
+    assert(se.nruns > 0 && se.nbgruns == 0);
+
+    const char * name = residue ?
+      (closing ? "bitmapped_blackhat" : "bitmapped_tophat")
+      : (closing ? "bitmapped_closing" : "bitmapped_opening");
+    clcv_kernel & kernel = get_kernel(name, image_in, image_out, local_work_size);
     kernel.setArg(0, image_in);
     kernel.setArg(1, image_out);
     kernel.setArg(2, nrows);
     kernel.setArg(3, ncols);
-    kernel.setArg(4, se_colrad);
-    cl_int local_size = (xdim(local_work_size) + 16*2)
-    * ydim(local_work_size) * sizeof (T);
-    kernel.setArg(5, local_size, NULL);
+    kernel.setArg(4, se.runs_clmem);
+    kernel.setArg(5, (cl_int) se.nruns);
+    kernel.setArg(6, (cl_int) se.runs_rowrad);
+    kernel.setArg(7, (cl_int) se.runs_colrad);
+    kernel.setArg(8, se.nruns * 3 * sizeof (T), NULL);
+    cl_int local_size = (xdim(local_work_size) + (se.runs_colrad/32 + 1)*4)
+    * (ydim(local_work_size) + se.runs_rowrad*4) * sizeof (T);
+    kernel.setArg(9, local_size, NULL);
+    kernel.setArg(10, local_size, NULL);
     return kernel;
   }
-  
+
   template<typename T>
   inline
-  cl::Event CLCV<T>::push_bitmappedmorph_erosion_h(const cl_int se_colrad)
+  cl::Event CLCV<T>::push_bitmappedmorph_fused(const clcv_se_id se_id, const bool closing,
+                                               const bool residue)
   {
     assert(get_image().ncols % 32 == 0);
     const unsigned ncols_round = round(get_ncols()/32, 32);
     const cl::NDRange b_size(ncols_round, get_nrows());
-    
+
     const cl::NDRange & l_size = get_local_work_size();
     const cl::NDRange & g_size = get_global_work_size().dimensions() == 0 ?
     b_size : get_global_work_size();
-    
-    cl::Kernel kernel = create_bitmappedmorph_erosion_h(get_in_buffer(), get_out_buffer(),
-                                                        get_nrows(), get_ncols(),
-                                                        se_colrad, l_size);
+
+    cl::Kernel kernel = create_bitmappedmorph_fused(get_in_buffer(), get_out_buffer(),
+                                                    get_nrows(), get_ncols(),
+                                                    se_id, closing, residue, l_size);
     swap_buffers();
-    cl::Event event;    
-    m_queue.enqueueNDRangeKernel(kernel, cl::NullRange, g_size, l_size, NULL, &event);
-    return event;    
+    cl::Event event;
+    enqueue_kernel(kernel, g_size, l_size, NULL, &event);
+    return event;
   }
-  
+
   template<typename T>
   inline
-  cl::Kernel CLCV<T>::create_bitmappedmorph_erosion_v(const cl::Buffer & image_in,
-                                                      const cl::Buffer & image_out,
-                                                      const cl_int nrows, const cl_int ncols,
-                                                      const cl_int se_rowrad,
-                                                      const cl::NDRange & local_work_size)
+  cl::Kernel CLCV<T>::create_bitmappedmorph_gradient(const cl::Buffer & image_in,
+                                                     const cl::Buffer & image_out,
+                                                     const cl_int nrows, const cl_int ncols,
+                                                     const clcv_se_id se_id,
+                                                     const cl::NDRange & local_work_size)
   {
     assert(ncols % 32 == 0);
-    
-    cl::Kernel kernel(m_program, "bitmapped_erosion_v");
+    clcv_se & se = get_se(se_id);
+    assert(se.nruns > 0 && se.nbgruns == 0);
+
+    clcv_kernel & kernel = get_kernel("bitmapped_gradient", image_in, image_out, local_work_size);
     kernel.setArg(0, image_in);
     kernel.setArg(1, image_out);
     kernel.setArg(2, nrows);
     kernel.setArg(3, ncols);
-    kernel.setArg(4, se_rowrad);
-    cl_int local_size = xdim(local_work_size)
-    * (ydim(local_work_size) + se_rowrad*2) * sizeof (T);
-    kernel.setArg(5, local_size, NULL);
+    kernel.setArg(4, se.runs_clmem);
+    kernel.setArg(5, (cl_int) se.nruns);
+    kernel.setArg(6, (cl_int) se.runs_rowrad);
+    kernel.setArg(7, (cl_int) se.runs_colrad);
+    kernel.setArg(8, se.nruns * 3 * sizeof (T), NULL);
+    cl_int local_size = (xdim(local_work_size) + (se.runs_colrad/32 + 1)*2)
+    * (ydim(local_work_size) + se.runs_rowrad*2) * sizeof (T);
+    kernel.setArg(9, local_size, NULL);
     return kernel;
   }
-  
+
   template<typename T>
   inline
-  cl::Event CLCV<T>::push_bitmappedmorph_erosion_v(const cl_int se_rowrad)
+  cl::Event CLCV<T>::push_bitmappedmorph_gradient(const clcv_se_id se_id)
   {
     assert(get_image().ncols % 32 == 0);
     const unsigned ncols_round = round(get_ncols()/32, 32);
     const cl::NDRange b_size(ncols_round, get_nrows());
-    
+
     const cl::NDRange & l_size = get_local_work_size();
     const cl::NDRange & g_size = get_global_work_size().dimensions() == 0 ?
     b_size : get_global_work_size();
-    
-    cl::Kernel kernel = create_bitmappedmorph_erosion_v(get_in_buffer(), get_out_buffer(),
-                                                        get_nrows(), get_ncols(),
-                                                        se_rowrad, l_size);
+
+    cl::Kernel kernel = create_bitmappedmorph_gradient(get_in_buffer(), get_out_buffer(),
+                                                       get_nrows(), get_ncols(),
+                                                       se_id, l_size);
     swap_buffers();
     cl::Event event;
-    m_queue.enqueueNDRangeKernel(kernel, cl::NullRange, g_size, l_size, NULL, &event);
+    enqueue_kernel(kernel, g_size, l_size, NULL, &event);
     return event;
   }
 
   template<typename T>
   inline
-  cl::Event CLCV<T>::push_bitmappedmorph_erosion(const cl_int se_rowrad, const cl_int se_colrad)
-  { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
-    push_bitmappedmorph_erosion_h(se_colrad);
-    return push_bitmappedmorph_erosion_v(se_rowrad);
-  }  
+  cl::Event CLCV<T>::push_bitmappedmorph_tophat(const clcv_se_id se_id)
+  {
+    return push_bitmappedmorph_hat(se_id, false);
+  }
 
   template<typename T>
   inline
-  cl::Event CLCV<T>::push_bitmappedmorph_opening(const cl_int se_rowrad, const cl_int se_colrad)
-  { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
-    push_bitmappedmorph_erosion(se_rowrad, se_colrad);
-    return push_bitmappedmorph_dilation(se_rowrad, se_colrad);
-  }  
+  cl::Event CLCV<T>::push_bitmappedmorph_blackhat(const clcv_se_id se_id)
+  {
+    return push_bitmappedmorph_hat(se_id, true);
+  }
 
   template<typename T>
   inline
-  cl::Event CLCV<T>::push_bitmappedmorph_closing(const cl_int se_rowrad, const cl_int se_colrad)
+  cl::Event CLCV<T>::push_bitmappedmorph_hat(const clcv_se_id se_id, const bool closing)
   { // FIXME : return an event for the whole operation, otherwise the timing won't make sense
-    push_bitmappedmorph_dilation(se_rowrad, se_colrad);
-    return push_bitmappedmorph_erosion(se_rowrad, se_colrad);
-  }  
-  
+    if (can_push_bitmappedmorph_fused(se_id))
+      return push_bitmappedmorph_fused(se_id, closing, true);
+
+    const unsigned size = get_bitmap_size();
+    clcv_bufferpair saved = get_scratchpair(size, 2);
+    enqueue_copy(get_in_buffer(), saved.first, 0, 0, size);
+    closing ? push_bitmappedmorph_closing(se_id) : push_bitmappedmorph_opening(se_id);
+    cl::Event event = closing ?
+      push_bitmappedlogic(get_in_buffer(), saved.first, get_out_buffer(), logic_andnot)
+      : push_bitmappedlogic(saved.first, get_in_buffer(), get_out_buffer(), logic_andnot);
+    swap_buffers();
+    return event;
+  }
+
+  template<typename T>
+  inline
+  cl::Kernel CLCV<T>::create_bitmappedmorph_vhgw_h(const cl::Buffer & image_in,
+                                                   const cl::Buffer & image_out,
+                                                   const cl_int nrows, const cl_int ncols,
+                                                   const cl_int se_colrad, const bool erosion,
+                                                   const cl::NDRange & local_work_size)
+  {
+    assert(ncols % 32 == 0);
+    // se_colrad = 32 * se_wordrad + se_bitrad, with 16 <= se_bitrad < 48
+    // so that the word windows overlap
+    const cl_int se_wordrad = se_colrad < 16 ? 0 : (se_colrad - 16) / 32;
+    const cl_int se_bitrad = se_colrad - 32 * se_wordrad;
+
+    clcv_kernel & kernel = get_kernel(erosion ? "bitmapped_vhgw_erosion_h" : "bitmapped_vhgw_dilation_h",
+                                      image_in, image_out, local_work_size);
+    kernel.setArg(0, image_in);
+    kernel.setArg(1, image_out);
+    kernel.setArg(2, nrows);
+    kernel.setArg(3, ncols);
+    kernel.setArg(4, se_wordrad);
+    kernel.setArg(5, se_bitrad);
+    cl_int local_size = (xdim(local_work_size) + se_wordrad*2 + 4)
+    * ydim(local_work_size) * sizeof (T);
+    kernel.setArg(6, local_size, NULL);
+    kernel.setArg(7, local_size, NULL);
+    kernel.setArg(8, local_size, NULL);
+    return kernel;
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmappedmorph_vhgw_h(const cl_int se_colrad, const bool erosion)
+  {
+    assert(get_image().ncols % 32 == 0);
+    const unsigned ncols_round = round(get_ncols()/32, 32);
+    const cl::NDRange b_size(ncols_round, get_nrows());
+
+    const cl::NDRange & l_size = get_local_work_size();
+    const cl::NDRange & g_size = get_global_work_size().dimensions() == 0 ?
+    b_size : get_global_work_size();
+
+    cl::Kernel kernel = create_bitmappedmorph_vhgw_h(get_in_buffer(), get_out_buffer(),
+                                                     get_nrows(), get_ncols(),
+                                                     se_colrad, erosion, l_size);
+    swap_buffers();
+    cl::Event event;
+    enqueue_kernel(kernel, g_size, l_size, NULL, &event);
+    return event;
+  }
+
+  template<typename T>
+  inline
+  cl::Kernel CLCV<T>::create_bitmappedmorph_vhgw_scan_v(const cl::Buffer & image_in,
+                                                        const cl::Buffer & g, const cl::Buffer & h,
+                                                        const cl_int nrows, const cl_int ncols,
+                                                        const cl_int se_rowrad, const bool erosion)
+  {
+    assert(ncols % 32 == 0);
+
+    clcv_kernel & kernel = get_kernel(erosion ? "bitmapped_vhgw_erosion_scan_v" : "bitmapped_vhgw_dilation_scan_v",
+                                      image_in, g);
+    kernel.setArg(0, image_in);
+    kernel.setArg(1, g);
+    kernel.setArg(2, h);
+    kernel.setArg(3, nrows);
+    kernel.setArg(4, ncols);
+    kernel.setArg(5, se_rowrad);
+    return kernel;
+  }
+
+  template<typename T>
+  inline
+  cl::Kernel CLCV<T>::create_bitmappedmorph_vhgw_v(const cl::Buffer & g, const cl::Buffer & h,
+                                                   const cl::Buffer & image_out,
+                                                   const cl_int nrows, const cl_int ncols,
+                                                   const cl_int se_rowrad, const bool erosion)
+  {
+    assert(ncols % 32 == 0);
+
+    clcv_kernel & kernel = get_kernel(erosion ? "bitmapped_vhgw_erosion_v" : "bitmapped_vhgw_dilation_v",
+                                      g, h);
+    kernel.setArg(0, g);
+    kernel.setArg(1, h);
+    kernel.setArg(2, image_out);
+    kernel.setArg(3, nrows);
+    kernel.setArg(4, ncols);
+    kernel.setArg(5, se_rowrad);
+    return kernel;
+  }
+
+  template<typename T>
+  inline
+  cl::Event CLCV<T>::push_bitmappedmorph_vhgw_v(const cl_int se_rowrad, const bool erosion)
+  {
+    assert(get_image().ncols % 32 == 0);
+    const unsigned ncols_round = round(get_ncols()/32, 32);
+    const unsigned nblocks = (get_nrows() - 1) / (se_rowrad*2 + 1) + 1;
+    const cl::NDRange & l_size = get_local_work_size();
+    const unsigned nblocks_round = l_size.dimensions() == 0 ? nblocks : round(nblocks, ydim(l_size));
+    const cl::NDRange s_size(ncols_round, nblocks_round);
+    const cl::NDRange b_size(ncols_round, get_nrows());
+    const cl::NDRange & g_size = get_global_work_size().dimensions() == 0 ?
+    b_size : get_global_work_size();
+
+    // g and h are bitmaps too
+    clcv_bufferpair gh = get_scratchpair(get_bitmap_size());
+    cl::Kernel scan = create_bitmappedmorph_vhgw_scan_v(get_in_buffer(), gh.first, gh.second,
+                                                        get_nrows(), get_ncols(),
+                                                        se_rowrad, erosion);
+    cl::Kernel kernel = create_bitmappedmorph_vhgw_v(gh.first, gh.second, get_out_buffer(),
+                                                     get_nrows(), get_ncols(),
+                                                     se_rowrad, erosion);
+    swap_buffers();
+    enqueue_kernel(scan, s_size, l_size);
+    cl::Event event;
+    enqueue_kernel(kernel, g_size, l_size, NULL, &event);
+    return event;
+  }
+
   template<typename T>
   inline
   int CLCV<T>::round(int v, int r)
@@ -0,0 +1,7558 @@
+// Generated from clcv.cl by embed_cl.sh, do not edit
+
+#ifndef CLCV_CLCV_CL_H__
+#define CLCV_CLCV_CL_H__
+
+namespace clcv
+{
+  static const char clcv_cl_source[] = {
+    47, 47, 32, 67, 111, 112, 121, 114, 105, 103, 104, 116, 32, 40, 99, 41,
+    32, 50, 48, 49, 48, 32, 105, 90, 115, 104, 32, 45, 32, 105, 122, 115,
+    104, 32, 97, 116, 32, 102, 97, 105, 108, 48, 118, 101, 114, 102, 108, 111,
+    119, 46, 99, 111, 109, 10, 47, 47, 10, 47, 47, 32, 84, 104, 105, 115,
+    32, 112, 114, 111, 103, 114, 97, 109, 32, 105, 115, 32, 102, 114, 101, 101,
+    32, 115, 111, 102, 116, 119, 97, 114, 101, 58, 32, 121, 111, 117, 32, 99,
+    97, 110, 32, 114, 101, 100, 105, 115, 116, 114, 105, 98, 117, 116, 101, 32,
+    105, 116, 32, 97, 110, 100, 47, 111, 114, 32, 109, 111, 100, 105, 102, 121,
+    10, 47, 47, 32, 105, 116, 32, 117, 110, 100, 101, 114, 32, 116, 104, 101,
+    32, 116, 101, 114, 109, 115, 32, 111, 102, 32, 116, 104, 101, 32, 71, 78,
+    85, 32, 71, 101, 110, 101, 114, 97, 108, 32, 80, 117, 98, 108, 105, 99,
+    32, 76, 105, 99, 101, 110, 115, 101, 32, 97, 115, 32, 112, 117, 98, 108,
+    105, 115, 104, 101, 100, 32, 98, 121, 10, 47, 47, 32, 116, 104, 101, 32,
+    70, 114, 101, 101, 32, 83, 111, 102, 116, 119, 97, 114, 101, 32, 70, 111,
+    117, 110, 100, 97, 116, 105, 111, 110, 44, 32, 101, 105, 116, 104, 101, 114,
+    32, 118, 101, 114, 115, 105, 111, 110, 32, 51, 32, 111, 102, 32, 116, 104,
+    101, 32, 76, 105, 99, 101, 110, 115, 101, 44, 32, 111, 114, 10, 47, 47,
+    32, 40, 97, 116, 32, 121, 111, 117, 114, 32, 111, 112, 116, 105, 111, 110,
+    41, 32, 97, 110, 121, 32, 108, 97, 116, 101, 114, 32, 118, 101, 114, 115,
+    105, 111, 110, 46, 10, 47, 47, 32, 10, 47, 47, 32, 84, 104, 105, 115,
+    32, 112, 114, 111, 103, 114, 97, 109, 32, 105, 115, 32, 100, 105, 115, 116,
+    114, 105, 98, 117, 116, 101, 100, 32, 105, 110, 32, 116, 104, 101, 32, 104,
+    111, 112, 101, 32, 116, 104, 97, 116, 32, 105, 116, 32, 119, 105, 108, 108,
+    32, 98, 101, 32, 117, 115, 101, 102, 117, 108, 44, 10, 47, 47, 32, 98,
+    117, 116, 32, 87, 73, 84, 72, 79, 85, 84, 32, 65, 78, 89, 32, 87,
+    65, 82, 82, 65, 78, 84, 89, 59, 32, 119, 105, 116, 104, 111, 117, 116,
+    32, 101, 118, 101, 110, 32, 116, 104, 101, 32, 105, 109, 112, 108, 105, 101,
+    100, 32, 119, 97, 114, 114, 97, 110, 116, 121, 32, 111, 102, 10, 47, 47,
+    32, 77, 69, 82, 67, 72, 65, 78, 84, 65, 66, 73, 76, 73, 84, 89,
+    32, 111, 114, 32, 70, 73, 84, 78, 69, 83, 83, 32, 70, 79, 82, 32,
+    65, 32, 80, 65, 82, 84, 73, 67, 85, 76, 65, 82, 32, 80, 85, 82,
+    80, 79, 83, 69, 46, 32, 32, 83, 101, 101, 32, 116, 104, 101, 10, 47,
+    47, 32, 71, 78, 85, 32, 71, 101, 110, 101, 114, 97, 108, 32, 80, 117,
+    98, 108, 105, 99, 32, 76, 105, 99, 101, 110, 115, 101, 32, 102, 111, 114,
+    32, 109, 111, 114, 101, 32, 100, 101, 116, 97, 105, 108, 115, 46, 10, 47,
+    47, 32, 10, 47, 47, 32, 89, 111, 117, 32, 115, 104, 111, 117, 108, 100,
+    32, 104, 97, 118, 101, 32, 114, 101, 99, 101, 105, 118, 101, 100, 32, 97,
+    32, 99, 111, 112, 121, 32, 111, 102, 32, 116, 104, 101, 32, 71, 78, 85,
+    32, 71, 101, 110, 101, 114, 97, 108, 32, 80, 117, 98, 108, 105, 99, 32,
+    76, 105, 99, 101, 110, 115, 101, 10, 47, 47, 32, 97, 108, 111, 110, 103,
+    32, 119, 105, 116, 104, 32, 116, 104, 105, 115, 32, 112, 114, 111, 103, 114,
+    97, 109, 46, 32, 32, 73, 102, 32, 110, 111, 116, 44, 32, 115, 101, 101,
+    32, 60, 104, 116, 116, 112, 58, 47, 47, 119, 119, 119, 46, 103, 110, 117,
+    46, 111, 114, 103, 47, 108, 105, 99, 101, 110, 115, 101, 115, 47, 62, 46,
+    10, 10, 47, 47, 32, 84, 79, 68, 79, 58, 32, 69, 120, 112, 101, 114,
+    105, 109, 101, 110, 116, 32, 119, 105, 116, 104, 32, 102, 108, 111, 97, 116,
+    115, 32, 97, 110, 100, 32, 100, 105, 102, 102, 101, 114, 101, 110, 116, 32,
+    71, 80, 85, 115, 10, 47, 47, 32, 79, 110, 32, 115, 111, 109, 101, 32,
+    100, 101, 118, 105, 99, 101, 115, 32, 40, 109, 111, 115, 116, 108, 121, 32,
+    111, 108, 100, 63, 41, 32, 102, 108, 111, 97, 116, 32, 109, 117, 108, 32,
+    97, 114, 101, 32, 102, 97, 115, 116, 101, 114, 32, 116, 104, 97, 110, 32,
+    105, 110, 116, 32, 109, 117, 108, 10, 47, 47, 32, 83, 111, 109, 101, 32,
+    101, 120, 112, 101, 114, 105, 109, 101, 110, 116, 115, 32, 115, 104, 111, 117,
+    108, 100, 32, 116, 104, 101, 114, 101, 102, 111, 114, 101, 32, 98, 101, 101,
+    110, 32, 109, 97, 100, 101, 32, 119, 105, 116, 104, 32, 117, 115, 105, 110,
+    103, 32, 102, 108, 111, 97, 116, 32, 105, 110, 115, 116, 101, 97, 100, 32,
+    111, 102, 32, 105, 110, 116, 115, 46, 10, 47, 47, 32, 101, 46, 103, 46,
+    32, 117, 115, 105, 110, 103, 32, 109, 97, 100, 32, 111, 110, 32, 102, 108,
+    111, 97, 116, 32, 115, 104, 111, 117, 108, 100, 32, 98, 101, 32, 99, 111,
+    110, 115, 105, 115, 116, 101, 110, 116, 108, 121, 32, 101, 102, 102, 105, 99,
+    105, 101, 110, 116, 44, 32, 119, 104, 101, 114, 101, 97, 115, 32, 119, 105,
+    116, 104, 32, 105, 110, 116, 115, 44, 10, 47, 47, 32, 121, 111, 117, 32,
+    104, 97, 118, 101, 32, 116, 111, 32, 101, 105, 116, 104, 101, 114, 32, 117,
+    115, 101, 32, 109, 97, 100, 50, 52, 32, 111, 114, 32, 114, 101, 103, 117,
+    108, 97, 114, 32, 109, 97, 100, 32, 116, 111, 32, 103, 101, 116, 32, 116,
+    104, 101, 32, 98, 101, 115, 116, 32, 112, 101, 114, 102, 111, 114, 109, 97,
+    110, 99, 101, 10, 47, 47, 32, 40, 100, 101, 112, 101, 110, 100, 105, 110,
+    103, 32, 111, 110, 32, 116, 104, 101, 32, 99, 104, 105, 112, 115, 101, 116,
+    41, 46, 10, 10, 10, 47, 47, 32, 80, 114, 111, 103, 114, 97, 109, 115,
+    10, 47, 47, 32, 84, 104, 101, 32, 108, 105, 98, 114, 97, 114, 121, 32,
+    98, 117, 105, 108, 100, 115, 32, 111, 110, 101, 32, 112, 114, 111, 103, 114,
+    97, 109, 32, 112, 101, 114, 32, 111, 112, 101, 114, 97, 116, 111, 114, 32,
+    40, 102, 97, 109, 105, 108, 121, 41, 44, 32, 119, 105, 116, 104, 10, 47,
+    47, 32, 45, 68, 32, 67, 76, 67, 86, 95, 83, 69, 67, 84, 73, 79,
+    78, 83, 32, 45, 68, 32, 67, 76, 67, 86, 95, 83, 69, 67, 84, 73,
+    79, 78, 95, 60, 110, 97, 109, 101, 62, 44, 32, 105, 110, 115, 116, 101,
+    97, 100, 32, 111, 102, 32, 116, 104, 101, 32, 119, 104, 111, 108, 101, 32,
+    102, 105, 108, 101, 46, 32, 69, 97, 99, 104, 10, 47, 47, 32, 115, 101,
+    99, 116, 105, 111, 110, 32, 98, 101, 108, 111, 119, 32, 105, 115, 32, 103,
+    117, 97, 114, 100, 101, 100, 32, 98, 121, 32, 105, 116, 115, 32, 110, 97,
+    109, 101, 44, 32, 116, 104, 101, 32, 115, 101, 99, 116, 105, 111, 110, 115,
+    32, 97, 110, 32, 111, 112, 101, 114, 97, 116, 111, 114, 32, 100, 101, 112,
+    101, 110, 100, 115, 32, 111, 110, 10, 47, 47, 32, 97, 114, 101, 32, 101,
+    110, 97, 98, 108, 101, 100, 32, 104, 101, 114, 101, 32, 40, 100, 101, 112,
+    101, 110, 100, 101, 110, 116, 115, 32, 102, 105, 114, 115, 116, 41, 46, 32,
+    87, 105, 116, 104, 111, 117, 116, 32, 67, 76, 67, 86, 95, 83, 69, 67,
+    84, 73, 79, 78, 83, 44, 32, 101, 118, 101, 114, 121, 116, 104, 105, 110,
+    103, 32, 105, 115, 10, 47, 47, 32, 98, 117, 105, 108, 116, 44, 32, 98,
+    117, 116, 32, 78, 65, 73, 86, 69, 95, 74, 73, 84, 32, 40, 115, 101,
+    101, 32, 110, 97, 105, 118, 101, 95, 109, 111, 114, 112, 104, 95, 106, 105,
+    116, 41, 46, 10, 35, 105, 102, 110, 100, 101, 102, 32, 67, 76, 67, 86,
+    95, 83, 69, 67, 84, 73, 79, 78, 83, 10, 35, 32, 100, 101, 102, 105,
+    110, 101, 32, 67, 76, 67, 86, 95, 83, 69, 67, 84, 73, 79, 78, 95,
+    66, 73, 78, 65, 82, 73, 90, 69, 10, 35, 32, 100, 101, 102, 105, 110,
+    101, 32, 67, 76, 67, 86, 95, 83, 69, 67, 84, 73, 79, 78, 95, 78,
+    65, 73, 86, 69, 10, 35, 32, 100, 101, 102, 105, 110, 101, 32, 67, 76,
+    67, 86, 95, 83, 69, 67, 84, 73, 79, 78, 95, 66, 73, 84, 77, 65,
+    80, 10, 35, 32, 100, 101, 102, 105, 110, 101, 32, 67, 76, 67, 86, 95,
+    83, 69, 67, 84, 73, 79, 78, 95, 82, 69, 67, 84, 10, 35, 32, 100,
+    101, 102, 105, 110, 101, 32, 67, 76, 67, 86, 95, 83, 69, 67, 84, 73,
+    79, 78, 95, 86, 72, 71, 87, 10, 35, 32, 100, 101, 102, 105, 110, 101,
+    32, 67, 76, 67, 86, 95, 83, 69, 67, 84, 73, 79, 78, 95, 82, 85,
+    78, 83, 10, 35, 32, 100, 101, 102, 105, 110, 101, 32, 67, 76, 67, 86,
+    95, 83, 69, 67, 84, 73, 79, 78, 95, 82, 69, 67, 84, 95, 70, 85,
+    83, 69, 68, 10, 35, 32, 100, 101, 102, 105, 110, 101, 32, 67, 76, 67,
+    86, 95, 83, 69, 67, 84, 73, 79, 78, 95, 82, 85, 78, 83, 95, 70,
+    85, 83, 69, 68, 10, 35, 32, 100, 101, 102, 105, 110, 101, 32, 67, 76,
+    67, 86, 95, 83, 69, 67, 84, 73, 79, 78, 95, 72, 73, 84, 79, 82,
+    77, 73, 83, 83, 10, 35, 32, 100, 101, 102, 105, 110, 101, 32, 67, 76,
+    67, 86, 95, 83, 69, 67, 84, 73, 79, 78, 95, 82, 69, 67, 79, 78,
+    83, 84, 82, 85, 67, 84, 10, 35, 32, 100, 101, 102, 105, 110, 101, 32,
+    67, 76, 67, 86, 95, 83, 69, 67, 84, 73, 79, 78, 95, 71, 82, 65,
+    89, 10, 35, 32, 100, 101, 102, 105, 110, 101, 32, 67, 76, 67, 86, 95,
+    83, 69, 67, 84, 73, 79, 78, 95, 76, 65, 66, 69, 76, 10, 35, 32,
+    100, 101, 102, 105, 110, 101, 32, 67, 76, 67, 86, 95, 83, 69, 67, 84,
+    73, 79, 78, 95, 69, 68, 84, 10, 35, 32, 100, 101, 102, 105, 110, 101,
+    32, 67, 76, 67, 86, 95, 83, 69, 67, 84, 73, 79, 78, 95, 65, 82,
+    69, 65, 10, 35, 32, 100, 101, 102, 105, 110, 101, 32, 67, 76, 67, 86,
+    95, 83, 69, 67, 84, 73, 79, 78, 95, 68, 73, 65, 71, 10, 35, 32,
+    100, 101, 102, 105, 110, 101, 32, 67, 76, 67, 86, 95, 83, 69, 67, 84,
+    73, 79, 78, 95, 77, 79, 82, 80, 72, 95, 51, 88, 51, 10, 35, 32,
+    100, 101, 102, 105, 110, 101, 32, 67, 76, 67, 86, 95, 83, 69, 67, 84,
+    73, 79, 78, 95, 82, 65, 78, 75, 10, 35, 32, 100, 101, 102, 105, 110,
+    101, 32, 67, 76, 67, 86, 95, 83, 69, 67, 84, 73, 79, 78, 95, 76,
+    85, 84, 10, 35, 32, 100, 101, 102, 105, 110, 101, 32, 67, 76, 67, 86,
+    95, 83, 69, 67, 84, 73, 79, 78, 95, 83, 75, 69, 76, 69, 84, 79,
+    78, 10, 35, 32, 100, 101, 102, 105, 110, 101, 32, 67, 76, 67, 86, 95,
+    83, 69, 67, 84, 73, 79, 78, 95, 71, 82, 65, 89, 95, 82, 69, 67,
+    79, 78, 83, 84, 82, 85, 67, 84, 10, 35, 32, 100, 101, 102, 105, 110,
+    101, 32, 67, 76, 67, 86, 95, 83, 69, 67, 84, 73, 79, 78, 95, 87,
+    65, 84, 69, 82, 83, 72, 69, 68, 10, 35, 101, 110, 100, 105, 102, 10,
+    35, 105, 102, 100, 101, 102, 32, 67, 76, 67, 86, 95, 83, 69, 67, 84,
+    73, 79, 78, 95, 83, 75, 69, 76, 69, 84, 79, 78, 10, 35, 32, 100,
+    101, 102, 105, 110, 101, 32, 67, 76, 67, 86, 95, 83, 69, 67, 84, 73,
+    79, 78, 95, 77, 79, 82, 80, 72, 95, 51, 88, 51, 10, 35, 101, 110,
+    100, 105, 102, 10, 35, 105, 102, 32, 100, 101, 102, 105, 110, 101, 100, 40,
+    67, 76, 67, 86, 95, 83, 69, 67, 84, 73, 79, 78, 95, 68, 73, 65,
+    71, 41, 32, 124, 124, 32, 100, 101, 102, 105, 110, 101, 100, 40, 67, 76,
+    67, 86, 95, 83, 69, 67, 84, 73, 79, 78, 95, 77, 79, 82, 80, 72,
+    95, 51, 88, 51, 41, 32, 124, 124, 32, 100, 101, 102, 105, 110, 101, 100,
+    40, 67, 76, 67, 86, 95, 83, 69, 67, 84, 73, 79, 78, 95, 82, 65,
+    78, 75, 41, 10, 35, 32, 100, 101, 102, 105, 110, 101, 32, 67, 76, 67,
+    86, 95, 83, 69, 67, 84, 73, 79, 78, 95, 83, 72, 73, 70, 84, 10,
+    35, 101, 110, 100, 105, 102, 10, 35, 105, 102, 32, 100, 101, 102, 105, 110,
+    101, 100, 40, 67, 76, 67, 86, 95, 83, 69, 67, 84, 73, 79, 78, 95,
+    82, 85, 78, 83, 95, 70, 85, 83, 69, 68, 41, 32, 124, 124, 32, 100,
+    101, 102, 105, 110, 101, 100, 40, 67, 76, 67, 86, 95, 83, 69, 67, 84,
+    73, 79, 78, 95, 72, 73, 84, 79, 82, 77, 73, 83, 83, 41, 10, 35,
+    32, 100, 101, 102, 105, 110, 101, 32, 67, 76, 67, 86, 95, 83, 69, 67,
+    84, 73, 79, 78, 95, 82, 85, 78, 83, 10, 35, 101, 110, 100, 105, 102,
+    10, 35, 105, 102, 32, 100, 101, 102, 105, 110, 101, 100, 40, 67, 76, 67,
+    86, 95, 83, 69, 67, 84, 73, 79, 78, 95, 82, 85, 78, 83, 95, 70,
+    85, 83, 69, 68, 41, 32, 124, 124, 32, 100, 101, 102, 105, 110, 101, 100,
+    40, 67, 76, 67, 86, 95, 83, 69, 67, 84, 73, 79, 78, 95, 82, 69,
+    67, 84, 95, 70, 85, 83, 69, 68, 41, 10, 35, 32, 100, 101, 102, 105,
+    110, 101, 32, 67, 76, 67, 86, 95, 83, 69, 67, 84, 73, 79, 78, 95,
+    82, 69, 83, 73, 68, 85, 69, 10, 35, 101, 110, 100, 105, 102, 10, 35,
+    105, 102, 32, 100, 101, 102, 105, 110, 101, 100, 40, 67, 76, 67, 86, 95,
+    83, 69, 67, 84, 73, 79, 78, 95, 71, 82, 65, 89, 41, 32, 124, 124,
+    32, 100, 101, 102, 105, 110, 101, 100, 40, 67, 76, 67, 86, 95, 83, 69,
+    67, 84, 73, 79, 78, 95, 71, 82, 65, 89, 95, 82, 69, 67, 79, 78,
+    83, 84, 82, 85, 67, 84, 41, 10, 35, 32, 100, 101, 102, 105, 110, 101,
+    32, 67, 76, 67, 86, 95, 83, 69, 67, 84, 73, 79, 78, 95, 71, 82,
+    65, 89, 95, 79, 80, 10, 35, 101, 110, 100, 105, 102, 10, 10, 10, 47,
+    47, 32, 67, 111, 112, 121, 32, 97, 32, 115, 117, 98, 32, 105, 109, 97,
+    103, 101, 32, 105, 110, 116, 111, 32, 97, 32, 108, 111, 99, 97, 108, 32,
+    109, 101, 109, 111, 114, 121, 32, 98, 117, 102, 102, 101, 114, 10, 118, 111,
+    105, 100, 32, 110, 97, 105, 118, 101, 95, 109, 101, 109, 99, 112, 121, 50,
+    100, 50, 108, 111, 99, 97, 108, 40, 108, 111, 99, 97, 108, 32, 105, 110,
+    116, 32, 42, 32, 108, 111, 99, 97, 108, 95, 111, 117, 116, 44, 32, 103,
+    108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    42, 32, 105, 110, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 105, 110, 95, 110, 114, 111,
+    119, 115, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 105, 110,
+    95, 110, 99, 111, 108, 115, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 114, 101, 99, 116,
+    95, 110, 114, 111, 119, 115, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 114, 101, 99, 116, 95, 110, 99, 111, 108, 115, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 111, 114, 105, 103, 95, 114, 44, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 111, 114, 105, 103, 95, 99, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 44, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115,
+    41, 10, 123, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    115, 105, 122, 101, 32, 61, 32, 114, 101, 99, 116, 95, 110, 114, 111, 119,
+    115, 32, 42, 32, 114, 101, 99, 116, 95, 110, 99, 111, 108, 115, 59, 10,
+    10, 32, 32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 105, 32, 61, 32,
+    116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 59, 32, 105, 32, 60, 32,
+    115, 105, 122, 101, 59, 32, 105, 32, 43, 61, 32, 110, 98, 95, 116, 104,
+    114, 101, 97, 100, 115, 41, 10, 32, 32, 123, 10, 32, 32, 32, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 100, 105, 118, 32, 61, 32, 105,
+    32, 47, 32, 114, 101, 99, 116, 95, 110, 99, 111, 108, 115, 59, 10, 32,
+    32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 114, 101, 99,
+    116, 95, 114, 111, 119, 32, 61, 32, 100, 105, 118, 32, 43, 32, 111, 114,
+    105, 103, 95, 114, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 114, 101, 99, 116, 95, 99, 111, 108, 32, 61, 32, 105,
+    32, 45, 32, 100, 105, 118, 32, 42, 32, 114, 101, 99, 116, 95, 110, 99,
+    111, 108, 115, 32, 43, 32, 111, 114, 105, 103, 95, 99, 59, 10, 10, 32,
+    32, 32, 32, 105, 102, 32, 40, 114, 101, 99, 116, 95, 114, 111, 119, 32,
+    60, 32, 48, 32, 124, 124, 32, 114, 101, 99, 116, 95, 114, 111, 119, 32,
+    62, 61, 32, 105, 110, 95, 110, 114, 111, 119, 115, 32, 124, 124, 32, 114,
+    101, 99, 116, 95, 99, 111, 108, 32, 60, 32, 48, 32, 124, 124, 32, 114,
+    101, 99, 116, 95, 99, 111, 108, 32, 62, 61, 32, 105, 110, 95, 110, 99,
+    111, 108, 115, 41, 10, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108,
+    95, 111, 117, 116, 91, 105, 93, 32, 61, 32, 45, 49, 59, 10, 32, 32,
+    32, 32, 101, 108, 115, 101, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32,
+    32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 112, 105, 100,
+    120, 32, 61, 32, 109, 97, 100, 50, 52, 40, 114, 101, 99, 116, 95, 114,
+    111, 119, 44, 32, 105, 110, 95, 110, 99, 111, 108, 115, 44, 32, 114, 101,
+    99, 116, 95, 99, 111, 108, 41, 59, 10, 32, 32, 32, 32, 32, 32, 108,
+    111, 99, 97, 108, 95, 111, 117, 116, 91, 105, 93, 32, 61, 32, 105, 110,
+    91, 112, 105, 100, 120, 93, 32, 42, 32, 50, 32, 45, 32, 49, 59, 10,
+    32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 125, 10, 10, 47, 47, 32,
+    67, 111, 112, 121, 32, 97, 32, 108, 105, 110, 101, 97, 114, 32, 97, 114,
+    114, 97, 121, 32, 105, 110, 116, 111, 32, 97, 32, 108, 111, 99, 97, 108,
+    32, 109, 101, 109, 111, 114, 121, 32, 98, 117, 102, 102, 101, 114, 10, 118,
+    111, 105, 100, 32, 109, 101, 109, 99, 112, 121, 50, 108, 111, 99, 97, 108,
+    40, 108, 111, 99, 97, 108, 32, 105, 110, 116, 32, 42, 32, 108, 111, 99,
+    97, 108, 95, 111, 117, 116, 44, 32, 103, 108, 111, 98, 97, 108, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32, 105, 110, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 105, 122, 101, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 116, 104, 114,
+    101, 97, 100, 95, 105, 100, 120, 44, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 41, 10, 123,
+    10, 32, 32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 105, 32, 61, 32,
+    116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 59, 32, 105, 32, 60, 32,
+    115, 105, 122, 101, 59, 32, 105, 32, 43, 61, 32, 110, 98, 95, 116, 104,
+    114, 101, 97, 100, 115, 41, 10, 32, 32, 32, 32, 108, 111, 99, 97, 108,
+    95, 111, 117, 116, 91, 105, 93, 32, 61, 32, 105, 110, 91, 105, 93, 59,
+    10, 125, 10, 10, 47, 47, 32, 109, 101, 109, 115, 101, 116, 32, 97, 32,
+    108, 111, 99, 97, 108, 32, 109, 101, 109, 111, 114, 121, 32, 98, 117, 102,
+    102, 101, 114, 10, 118, 111, 105, 100, 32, 109, 101, 109, 115, 101, 116, 50,
+    108, 111, 99, 97, 108, 40, 108, 111, 99, 97, 108, 32, 105, 110, 116, 32,
+    42, 32, 112, 116, 114, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 118, 97, 108, 117, 101, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 115, 105, 122, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 44, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 98, 95, 116, 104, 114,
+    101, 97, 100, 115, 41, 10, 123, 10, 32, 32, 102, 111, 114, 32, 40, 105,
+    110, 116, 32, 105, 32, 61, 32, 116, 104, 114, 101, 97, 100, 95, 105, 100,
+    120, 59, 32, 105, 32, 60, 32, 115, 105, 122, 101, 59, 32, 105, 32, 43,
+    61, 32, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 41, 10, 32, 32,
+    32, 32, 112, 116, 114, 91, 105, 93, 32, 61, 32, 118, 97, 108, 117, 101,
+    59, 10, 125, 10, 10, 47, 47, 32, 67, 111, 109, 109, 111, 110, 32, 105,
+    109, 97, 103, 101, 32, 115, 101, 116, 117, 112, 46, 32, 67, 111, 112, 121,
+    32, 116, 104, 101, 32, 115, 116, 114, 117, 99, 116, 117, 114, 105, 110, 103,
+    32, 101, 108, 101, 109, 101, 110, 116, 32, 97, 110, 100, 32, 116, 104, 101,
+    32, 119, 111, 114, 107, 103, 114, 111, 117, 112, 43, 97, 112, 114, 111, 110,
+    10, 47, 47, 32, 105, 110, 116, 111, 32, 116, 119, 111, 32, 108, 111, 99,
+    97, 108, 32, 109, 101, 109, 111, 114, 121, 32, 98, 117, 102, 102, 101, 114,
+    115, 10, 47, 47, 32, 84, 79, 68, 79, 58, 32, 65, 108, 105, 103, 110,
+    32, 114, 101, 97, 100, 32, 111, 112, 101, 114, 97, 116, 105, 111, 110, 115,
+    32, 102, 111, 114, 32, 99, 111, 97, 108, 101, 115, 99, 105, 110, 103, 32,
+    40, 116, 97, 107, 105, 110, 103, 32, 105, 110, 116, 111, 32, 97, 99, 99,
+    111, 117, 110, 116, 32, 116, 104, 101, 32, 97, 112, 114, 111, 110, 41, 10,
+    118, 111, 105, 100, 32, 110, 97, 105, 118, 101, 95, 108, 111, 99, 97, 108,
+    105, 109, 103, 95, 115, 101, 116, 117, 112, 40, 103, 108, 111, 98, 97, 108,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32, 105, 110, 44,
+    32, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 42, 32, 115, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 108, 111, 99, 97, 108, 32, 105, 110, 116, 32, 42, 32, 108, 111,
+    99, 97, 108, 95, 97, 44, 32, 108, 111, 99, 97, 108, 32, 105, 110, 116,
+    32, 42, 32, 108, 111, 99, 97, 108, 95, 115, 101, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 44, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 110, 98, 95, 116, 104, 114, 101, 97, 100,
+    115, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 110, 114, 111, 119, 115, 44, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 110, 99, 111, 108, 115, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 112, 97, 100, 100, 101, 100, 95, 110, 114, 111, 119, 115, 44,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 112, 97, 100, 100, 101,
+    100, 95, 110, 99, 111, 108, 115, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 114, 44, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 99, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 115, 101, 95, 115, 105, 122, 101, 41, 10, 123, 10, 32, 32, 47, 47,
+    32, 67, 111, 112, 121, 32, 116, 104, 101, 32, 83, 69, 32, 105, 110, 116,
+    111, 32, 116, 104, 101, 32, 108, 111, 99, 97, 108, 32, 109, 101, 109, 111,
+    114, 121, 10, 32, 32, 109, 101, 109, 99, 112, 121, 50, 108, 111, 99, 97,
+    108, 40, 108, 111, 99, 97, 108, 95, 115, 101, 44, 32, 115, 101, 44, 32,
+    115, 101, 95, 115, 105, 122, 101, 44, 32, 116, 104, 114, 101, 97, 100, 95,
+    105, 100, 120, 44, 32, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 41,
+    59, 10, 32, 32, 47, 47, 32, 67, 111, 112, 121, 32, 116, 104, 101, 32,
+    115, 117, 98, 32, 105, 109, 97, 103, 101, 32, 105, 110, 116, 111, 32, 116,
+    104, 101, 32, 108, 111, 99, 97, 108, 32, 109, 101, 109, 111, 114, 121, 32,
+    32, 10, 32, 32, 110, 97, 105, 118, 101, 95, 109, 101, 109, 99, 112, 121,
+    50, 100, 50, 108, 111, 99, 97, 108, 40, 108, 111, 99, 97, 108, 95, 97,
+    44, 32, 105, 110, 44, 32, 110, 114, 111, 119, 115, 44, 32, 110, 99, 111,
+    108, 115, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 112, 97, 100, 100, 101,
+    100, 95, 110, 114, 111, 119, 115, 44, 32, 112, 97, 100, 100, 101, 100, 95,
+    110, 99, 111, 108, 115, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 114, 44,
+    32, 99, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 116, 104, 114, 101, 97,
+    100, 95, 105, 100, 120, 44, 32, 110, 98, 95, 116, 104, 114, 101, 97, 100,
+    115, 41, 59, 10, 32, 32, 47, 47, 32, 83, 121, 110, 99, 104, 32, 97,
+    108, 108, 32, 116, 104, 114, 101, 97, 100, 115, 10, 32, 32, 98, 97, 114,
+    114, 105, 101, 114, 40, 67, 76, 75, 95, 76, 79, 67, 65, 76, 95, 77,
+    69, 77, 95, 70, 69, 78, 67, 69, 41, 59, 10, 125, 10, 10, 35, 105,
+    102, 100, 101, 102, 32, 67, 76, 67, 86, 95, 83, 69, 67, 84, 73, 79,
+    78, 95, 66, 73, 78, 65, 82, 73, 90, 69, 10, 47, 47, 32, 83, 105,
+    109, 112, 108, 101, 32, 98, 105, 110, 97, 114, 105, 122, 101, 47, 116, 104,
+    114, 101, 115, 104, 111, 108, 100, 32, 111, 112, 101, 114, 97, 116, 111, 114,
+    46, 32, 71, 108, 111, 98, 97, 108, 32, 116, 111, 32, 103, 108, 111, 98,
+    97, 108, 32, 109, 101, 109, 111, 114, 121, 10, 107, 101, 114, 110, 101, 108,
+    32, 118, 111, 105, 100, 32, 98, 105, 110, 97, 114, 105, 122, 101, 40, 103,
+    108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    42, 32, 105, 110, 44, 32, 103, 108, 111, 98, 97, 108, 32, 105, 110, 116,
+    32, 42, 32, 111, 117, 116, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 110, 114, 111, 119, 115, 44, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 110, 99, 111, 108, 115, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 116, 104,
+    114, 101, 115, 104, 111, 108, 100, 44, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 109, 105, 110, 95, 118, 97, 108, 44, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 109, 97, 120, 95, 118, 97, 108, 41, 10, 123,
+    32, 32, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 120,
+    32, 61, 32, 103, 101, 116, 95, 103, 108, 111, 98, 97, 108, 95, 105, 100,
+    40, 48, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 121, 32, 61, 32, 103, 101, 116, 95, 103, 108, 111, 98, 97, 108, 95,
+    105, 100, 40, 49, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40, 121,
+    44, 32, 110, 99, 111, 108, 115, 44, 32, 120, 41, 59, 10, 32, 32, 111,
+    117, 116, 91, 105, 100, 120, 93, 32, 61, 32, 115, 101, 108, 101, 99, 116,
+    40, 109, 105, 110, 95, 118, 97, 108, 44, 32, 109, 97, 120, 95, 118, 97,
+    108, 44, 32, 105, 110, 91, 105, 100, 120, 93, 32, 62, 61, 32, 116, 104,
+    114, 101, 115, 104, 111, 108, 100, 41, 59, 32, 32, 10, 125, 10, 35, 101,
+    110, 100, 105, 102, 10, 10, 35, 105, 102, 100, 101, 102, 32, 67, 76, 67,
+    86, 95, 83, 69, 67, 84, 73, 79, 78, 95, 78, 65, 73, 86, 69, 10,
+    47, 47, 32, 78, 97, 105, 118, 101, 32, 109, 97, 116, 104, 101, 109, 97,
+    116, 105, 99, 97, 108, 32, 109, 111, 114, 112, 104, 111, 108, 103, 121, 32,
+    111, 112, 101, 114, 97, 116, 111, 114, 46, 10, 47, 47, 32, 74, 117, 115,
+    116, 32, 105, 116, 101, 114, 97, 116, 101, 32, 116, 104, 114, 111, 117, 103,
+    104, 32, 116, 104, 101, 32, 115, 116, 114, 117, 99, 116, 117, 114, 105, 110,
+    103, 32, 101, 108, 101, 109, 101, 110, 116, 32, 102, 111, 114, 32, 101, 97,
+    99, 104, 32, 112, 105, 120, 101, 108, 10, 107, 101, 114, 110, 101, 108, 32,
+    118, 111, 105, 100, 32, 110, 97, 105, 118, 101, 95, 109, 111, 114, 112, 104,
+    40, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 42, 32, 105, 110, 44, 32, 103, 108, 111, 98, 97, 108, 32, 105,
+    110, 116, 32, 42, 32, 111, 117, 116, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 114, 111, 119,
+    115, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 99, 111,
+    108, 115, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 103, 108, 111, 98,
+    97, 108, 32, 105, 110, 116, 32, 42, 32, 115, 101, 44, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 115, 101, 95, 114, 111, 119, 114, 97, 100,
+    44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 101, 95, 99,
+    111, 108, 114, 97, 100, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 101, 95, 99, 111, 117, 110,
+    116, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 101, 95,
+    116, 97, 114, 103, 101, 116, 115, 117, 109, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 108, 111, 99, 97, 108, 32, 105, 110, 116, 32, 42, 32, 108,
+    111, 99, 97, 108, 95, 115, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 108, 111, 99, 97, 108, 32, 105, 110, 116, 32, 42, 32, 108, 111, 99,
+    97, 108, 95, 105, 109, 103, 41, 10, 123, 10, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 120, 32, 61, 32, 103, 101, 116, 95, 103, 108,
+    111, 98, 97, 108, 95, 105, 100, 40, 48, 41, 59, 10, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 121, 32, 61, 32, 103, 101, 116, 95,
+    103, 108, 111, 98, 97, 108, 95, 105, 100, 40, 49, 41, 59, 10, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 120, 32, 61, 32, 103,
+    101, 116, 95, 108, 111, 99, 97, 108, 95, 105, 100, 40, 48, 41, 59, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 121, 32, 61,
+    32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 105, 100, 40, 49, 41,
+    59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 120,
+    115, 105, 122, 101, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108,
+    95, 115, 105, 122, 101, 40, 48, 41, 59, 10, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 108, 121, 115, 105, 122, 101, 32, 61, 32, 103,
+    101, 116, 95, 108, 111, 99, 97, 108, 95, 115, 105, 122, 101, 40, 49, 41,
+    59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 99, 111,
+    114, 110, 101, 114, 95, 120, 32, 61, 32, 103, 101, 116, 95, 103, 114, 111,
+    117, 112, 95, 105, 100, 40, 48, 41, 32, 42, 32, 108, 120, 115, 105, 122,
+    101, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 99,
+    111, 114, 110, 101, 114, 95, 121, 32, 61, 32, 103, 101, 116, 95, 103, 114,
+    111, 117, 112, 95, 105, 100, 40, 49, 41, 32, 42, 32, 108, 121, 115, 105,
+    122, 101, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 32, 61, 32, 109, 97,
+    100, 50, 52, 40, 108, 121, 44, 32, 108, 120, 115, 105, 122, 101, 44, 32,
+    108, 120, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 32, 61, 32, 108, 120,
+    115, 105, 122, 101, 32, 42, 32, 108, 121, 115, 105, 122, 101, 59, 10, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 101, 95, 115,
+    105, 122, 101, 32, 61, 32, 115, 101, 95, 99, 111, 117, 110, 116, 32, 42,
+    32, 50, 32, 43, 32, 115, 101, 95, 99, 111, 117, 110, 116, 59, 10, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 112, 97, 100, 100,
+    101, 100, 95, 110, 114, 111, 119, 115, 32, 61, 32, 108, 121, 115, 105, 122,
+    101, 32, 43, 32, 115, 101, 95, 114, 111, 119, 114, 97, 100, 32, 42, 32,
+    50, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 112,
+    97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 32, 61, 32, 108, 120,
+    115, 105, 122, 101, 32, 43, 32, 115, 101, 95, 99, 111, 108, 114, 97, 100,
+    32, 42, 32, 50, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 108, 105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40,
+    112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 44, 32, 108, 121,
+    32, 43, 32, 115, 101, 95, 114, 111, 119, 114, 97, 100, 44, 32, 108, 120,
+    32, 43, 32, 115, 101, 95, 99, 111, 108, 114, 97, 100, 41, 59, 10, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 105, 100, 120, 32, 61,
+    32, 109, 97, 100, 50, 52, 40, 121, 44, 32, 110, 99, 111, 108, 115, 44,
+    32, 120, 41, 59, 10, 10, 32, 32, 110, 97, 105, 118, 101, 95, 108, 111,
+    99, 97, 108, 105, 109, 103, 95, 115, 101, 116, 117, 112, 40, 105, 110, 44,
+    32, 115, 101, 44, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 44, 32,
+    108, 111, 99, 97, 108, 95, 115, 101, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 44, 32, 110, 98, 95,
+    116, 104, 114, 101, 97, 100, 115, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    110, 114, 111, 119, 115, 44, 32, 110, 99, 111, 108, 115, 44, 32, 112, 97,
+    100, 100, 101, 100, 95, 110, 114, 111, 119, 115, 44, 32, 112, 97, 100, 100,
+    101, 100, 95, 110, 99, 111, 108, 115, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 99, 111, 114, 110, 101, 114, 95, 121, 32, 45, 32, 115, 101, 95, 114,
+    111, 119, 114, 97, 100, 44, 32, 99, 111, 114, 110, 101, 114, 95, 120, 32,
+    45, 32, 115, 101, 95, 99, 111, 108, 114, 97, 100, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 115, 101, 95, 115, 105, 122, 101, 41, 59, 10, 10, 32,
+    32, 105, 110, 116, 32, 97, 99, 99, 32, 61, 32, 48, 59, 10, 32, 32,
+    102, 111, 114, 32, 40, 105, 110, 116, 32, 105, 32, 61, 32, 48, 59, 32,
+    105, 32, 60, 32, 40, 115, 101, 95, 99, 111, 117, 110, 116, 42, 50, 43,
+    115, 101, 95, 99, 111, 117, 110, 116, 41, 59, 32, 105, 32, 43, 61, 32,
+    51, 41, 10, 32, 32, 123, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 114, 32, 61, 32, 108, 111, 99, 97, 108, 95, 115,
+    101, 91, 105, 93, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 99, 32, 61, 32, 108, 111, 99, 97, 108, 95, 115, 101,
+    91, 105, 43, 49, 93, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 119, 32, 61, 32, 108, 111, 99, 97, 108, 95, 115,
+    101, 91, 105, 43, 50, 93, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 114, 105, 100, 120, 32, 61, 32, 109, 97, 100,
+    50, 52, 40, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 44,
+    32, 114, 44, 32, 108, 105, 100, 120, 32, 43, 32, 99, 41, 59, 10, 32,
+    32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 118, 97, 108,
+    32, 61, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 114, 105, 100,
+    120, 93, 59, 10, 32, 32, 32, 32, 97, 99, 99, 32, 61, 32, 109, 97,
+    100, 50, 52, 40, 118, 97, 108, 44, 32, 119, 44, 32, 97, 99, 99, 41,
+    59, 10, 32, 32, 125, 10, 32, 32, 111, 117, 116, 91, 105, 100, 120, 93,
+    32, 61, 32, 115, 101, 108, 101, 99, 116, 40, 48, 44, 32, 49, 44, 32,
+    97, 99, 99, 32, 62, 61, 32, 115, 101, 95, 116, 97, 114, 103, 101, 116,
+    115, 117, 109, 41, 59, 10, 125, 10, 35, 101, 110, 100, 105, 102, 10, 10,
+    35, 105, 102, 100, 101, 102, 32, 67, 76, 67, 86, 95, 83, 69, 67, 84,
+    73, 79, 78, 95, 78, 65, 73, 86, 69, 95, 74, 73, 84, 10, 47, 47,
+    32, 110, 97, 105, 118, 101, 95, 109, 111, 114, 112, 104, 32, 119, 105, 116,
+    104, 32, 116, 104, 101, 32, 83, 69, 32, 99, 111, 109, 112, 105, 108, 101,
+    100, 32, 105, 110, 46, 32, 84, 104, 101, 32, 104, 111, 115, 116, 32, 100,
+    101, 102, 105, 110, 101, 115, 32, 116, 104, 101, 32, 114, 97, 100, 105, 105,
+    10, 47, 47, 32, 40, 67, 76, 67, 86, 95, 83, 69, 95, 82, 79, 87,
+    82, 65, 68, 44, 32, 67, 76, 67, 86, 95, 83, 69, 95, 67, 79, 76,
+    82, 65, 68, 41, 44, 32, 116, 104, 101, 32, 119, 111, 114, 107, 45, 103,
+    114, 111, 117, 112, 32, 115, 105, 122, 101, 32, 40, 67, 76, 67, 86, 95,
+    76, 88, 83, 73, 90, 69, 44, 10, 47, 47, 32, 67, 76, 67, 86, 95,
+    76, 89, 83, 73, 90, 69, 41, 32, 97, 110, 100, 32, 67, 76, 67, 86,
+    95, 83, 69, 95, 80, 79, 73, 78, 84, 83, 44, 32, 116, 104, 101, 32,
+    108, 105, 115, 116, 32, 111, 102, 32, 116, 104, 101, 10, 47, 47, 32, 67,
+    76, 67, 86, 95, 83, 69, 95, 80, 79, 73, 78, 84, 40, 114, 111, 119,
+    44, 32, 99, 111, 108, 44, 32, 119, 101, 105, 103, 104, 116, 41, 32, 111,
+    102, 32, 116, 104, 101, 32, 83, 69, 58, 32, 116, 104, 101, 32, 108, 111,
+    111, 112, 32, 105, 115, 32, 117, 110, 114, 111, 108, 108, 101, 100, 44, 32,
+    119, 105, 116, 104, 10, 47, 47, 32, 99, 111, 110, 115, 116, 97, 110, 116,
+    32, 111, 102, 102, 115, 101, 116, 115, 32, 105, 110, 32, 108, 111, 99, 97,
+    108, 95, 105, 109, 103, 46, 10, 35, 100, 101, 102, 105, 110, 101, 32, 67,
+    76, 67, 86, 95, 80, 65, 68, 68, 69, 68, 95, 78, 82, 79, 87, 83,
+    32, 40, 67, 76, 67, 86, 95, 76, 89, 83, 73, 90, 69, 32, 43, 32,
+    67, 76, 67, 86, 95, 83, 69, 95, 82, 79, 87, 82, 65, 68, 32, 42,
+    32, 50, 41, 10, 35, 100, 101, 102, 105, 110, 101, 32, 67, 76, 67, 86,
+    95, 80, 65, 68, 68, 69, 68, 95, 78, 67, 79, 76, 83, 32, 40, 67,
+    76, 67, 86, 95, 76, 88, 83, 73, 90, 69, 32, 43, 32, 67, 76, 67,
+    86, 95, 83, 69, 95, 67, 79, 76, 82, 65, 68, 32, 42, 32, 50, 41,
+    10, 35, 100, 101, 102, 105, 110, 101, 32, 67, 76, 67, 86, 95, 83, 69,
+    95, 80, 79, 73, 78, 84, 40, 114, 44, 32, 99, 44, 32, 119, 41, 32,
+    92, 10, 32, 32, 97, 99, 99, 32, 61, 32, 109, 97, 100, 50, 52, 40,
+    108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 108, 105, 100, 120, 32, 43,
+    32, 40, 114, 41, 32, 42, 32, 67, 76, 67, 86, 95, 80, 65, 68, 68,
+    69, 68, 95, 78, 67, 79, 76, 83, 32, 43, 32, 40, 99, 41, 93, 44,
+    32, 40, 119, 41, 44, 32, 97, 99, 99, 41, 59, 10, 10, 107, 101, 114,
+    110, 101, 108, 32, 95, 95, 97, 116, 116, 114, 105, 98, 117, 116, 101, 95,
+    95, 40, 40, 114, 101, 113, 100, 95, 119, 111, 114, 107, 95, 103, 114, 111,
+    117, 112, 95, 115, 105, 122, 101, 40, 67, 76, 67, 86, 95, 76, 88, 83,
+    73, 90, 69, 44, 32, 67, 76, 67, 86, 95, 76, 89, 83, 73, 90, 69,
+    44, 32, 49, 41, 41, 41, 10, 118, 111, 105, 100, 32, 110, 97, 105, 118,
+    101, 95, 109, 111, 114, 112, 104, 95, 106, 105, 116, 40, 103, 108, 111, 98,
+    97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32, 105,
+    110, 44, 32, 103, 108, 111, 98, 97, 108, 32, 105, 110, 116, 32, 42, 32,
+    111, 117, 116, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 110, 114, 111, 119, 115, 44, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 110, 99, 111, 108, 115, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 101, 95, 116, 97,
+    114, 103, 101, 116, 115, 117, 109, 41, 10, 123, 10, 32, 32, 108, 111, 99,
+    97, 108, 32, 105, 110, 116, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103,
+    91, 67, 76, 67, 86, 95, 80, 65, 68, 68, 69, 68, 95, 78, 82, 79,
+    87, 83, 32, 42, 32, 67, 76, 67, 86, 95, 80, 65, 68, 68, 69, 68,
+    95, 78, 67, 79, 76, 83, 93, 59, 10, 10, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 120, 32, 61, 32, 103, 101, 116, 95, 103, 108,
+    111, 98, 97, 108, 95, 105, 100, 40, 48, 41, 59, 10, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 121, 32, 61, 32, 103, 101, 116, 95,
+    103, 108, 111, 98, 97, 108, 95, 105, 100, 40, 49, 41, 59, 10, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 120, 32, 61, 32, 103,
+    101, 116, 95, 108, 111, 99, 97, 108, 95, 105, 100, 40, 48, 41, 59, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 121, 32, 61,
+    32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 105, 100, 40, 49, 41,
+    59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 99, 111,
+    114, 110, 101, 114, 95, 120, 32, 61, 32, 103, 101, 116, 95, 103, 114, 111,
+    117, 112, 95, 105, 100, 40, 48, 41, 32, 42, 32, 67, 76, 67, 86, 95,
+    76, 88, 83, 73, 90, 69, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 99, 111, 114, 110, 101, 114, 95, 121, 32, 61, 32, 103,
+    101, 116, 95, 103, 114, 111, 117, 112, 95, 105, 100, 40, 49, 41, 32, 42,
+    32, 67, 76, 67, 86, 95, 76, 89, 83, 73, 90, 69, 59, 10, 10, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 116, 104, 114, 101, 97,
+    100, 95, 105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40, 108, 121,
+    44, 32, 67, 76, 67, 86, 95, 76, 88, 83, 73, 90, 69, 44, 32, 108,
+    120, 41, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 108, 105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40, 67, 76,
+    67, 86, 95, 80, 65, 68, 68, 69, 68, 95, 78, 67, 79, 76, 83, 44,
+    32, 108, 121, 32, 43, 32, 67, 76, 67, 86, 95, 83, 69, 95, 82, 79,
+    87, 82, 65, 68, 44, 32, 108, 120, 32, 43, 32, 67, 76, 67, 86, 95,
+    83, 69, 95, 67, 79, 76, 82, 65, 68, 41, 59, 10, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 105, 100, 120, 32, 61, 32, 109, 97,
+    100, 50, 52, 40, 121, 44, 32, 110, 99, 111, 108, 115, 44, 32, 120, 41,
+    59, 10, 10, 32, 32, 110, 97, 105, 118, 101, 95, 109, 101, 109, 99, 112,
+    121, 50, 100, 50, 108, 111, 99, 97, 108, 40, 108, 111, 99, 97, 108, 95,
+    105, 109, 103, 44, 32, 105, 110, 44, 32, 110, 114, 111, 119, 115, 44, 32,
+    110, 99, 111, 108, 115, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 67, 76,
+    67, 86, 95, 80, 65, 68, 68, 69, 68, 95, 78, 82, 79, 87, 83, 44,
+    32, 67, 76, 67, 86, 95, 80, 65, 68, 68, 69, 68, 95, 78, 67, 79,
+    76, 83, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 114, 110, 101,
+    114, 95, 121, 32, 45, 32, 67, 76, 67, 86, 95, 83, 69, 95, 82, 79,
+    87, 82, 65, 68, 44, 32, 99, 111, 114, 110, 101, 114, 95, 120, 32, 45,
+    32, 67, 76, 67, 86, 95, 83, 69, 95, 67, 79, 76, 82, 65, 68, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 116, 104, 114, 101, 97, 100, 95, 105,
+    100, 120, 44, 32, 67, 76, 67, 86, 95, 76, 88, 83, 73, 90, 69, 32,
+    42, 32, 67, 76, 67, 86, 95, 76, 89, 83, 73, 90, 69, 41, 59, 10,
+    32, 32, 98, 97, 114, 114, 105, 101, 114, 40, 67, 76, 75, 95, 76, 79,
+    67, 65, 76, 95, 77, 69, 77, 95, 70, 69, 78, 67, 69, 41, 59, 10,
+    10, 32, 32, 105, 110, 116, 32, 97, 99, 99, 32, 61, 32, 48, 59, 10,
+    32, 32, 67, 76, 67, 86, 95, 83, 69, 95, 80, 79, 73, 78, 84, 83,
+    10, 32, 32, 111, 117, 116, 91, 105, 100, 120, 93, 32, 61, 32, 115, 101,
+    108, 101, 99, 116, 40, 48, 44, 32, 49, 44, 32, 97, 99, 99, 32, 62,
+    61, 32, 115, 101, 95, 116, 97, 114, 103, 101, 116, 115, 117, 109, 41, 59,
+    10, 125, 10, 35, 101, 110, 100, 105, 102, 10, 10, 35, 105, 102, 100, 101,
+    102, 32, 67, 76, 67, 86, 95, 83, 69, 67, 84, 73, 79, 78, 95, 66,
+    73, 84, 77, 65, 80, 10, 47, 47, 32, 66, 105, 116, 109, 97, 112, 112,
+    101, 100, 32, 111, 112, 101, 114, 97, 116, 111, 114, 115, 10, 10, 47, 47,
+    32, 84, 104, 105, 115, 32, 98, 105, 110, 97, 114, 105, 122, 101, 32, 118,
+    101, 114, 115, 105, 111, 110, 32, 99, 111, 109, 112, 97, 99, 116, 115, 32,
+    116, 104, 101, 32, 98, 105, 110, 97, 114, 105, 122, 101, 100, 32, 105, 109,
+    97, 103, 101, 32, 116, 111, 32, 97, 32, 49, 98, 105, 116, 32, 112, 101,
+    114, 32, 112, 105, 120, 101, 108, 32, 102, 111, 114, 109, 97, 116, 10, 47,
+    47, 32, 66, 101, 99, 97, 117, 115, 101, 32, 111, 102, 32, 99, 111, 97,
+    108, 101, 115, 99, 105, 110, 103, 44, 32, 97, 110, 100, 32, 116, 111, 32,
+    108, 101, 115, 115, 101, 110, 32, 116, 104, 101, 32, 99, 111, 110, 115, 116,
+    114, 97, 105, 110, 116, 115, 32, 111, 110, 32, 116, 104, 101, 32, 105, 109,
+    97, 103, 101, 32, 115, 105, 122, 101, 10, 47, 47, 32, 114, 111, 117, 110,
+    100, 105, 110, 103, 44, 32, 119, 101, 32, 105, 110, 116, 101, 114, 112, 114,
+    101, 116, 32, 116, 104, 101, 32, 105, 109, 97, 103, 101, 32, 97, 115, 32,
+    97, 32, 49, 68, 32, 100, 97, 116, 97, 32, 105, 110, 112, 117, 116, 46,
+    10, 47, 47, 32, 87, 101, 32, 100, 111, 110, 39, 116, 32, 117, 115, 101,
+    32, 114, 101, 100, 117, 99, 116, 105, 111, 110, 32, 104, 101, 114, 101, 32,
+    58, 32, 111, 110, 101, 32, 116, 104, 114, 101, 97, 100, 32, 105, 115, 32,
+    114, 101, 115, 112, 111, 110, 115, 105, 98, 108, 101, 32, 102, 111, 114, 32,
+    51, 50, 32, 99, 111, 110, 115, 101, 99, 117, 116, 105, 118, 101, 10, 47,
+    47, 32, 112, 105, 120, 101, 108, 115, 46, 32, 84, 104, 101, 114, 101, 102,
+    111, 114, 101, 32, 40, 110, 114, 111, 119, 115, 42, 110, 99, 111, 108, 115,
+    41, 32, 110, 101, 101, 100, 115, 32, 116, 111, 32, 98, 101, 32, 97, 32,
+    109, 117, 108, 116, 105, 112, 108, 101, 32, 111, 102, 32, 51, 50, 42, 54,
+    52, 61, 50, 48, 52, 56, 32, 102, 111, 114, 10, 47, 47, 32, 97, 32,
+    114, 101, 97, 115, 111, 110, 97, 98, 108, 101, 32, 111, 99, 99, 117, 112,
+    97, 110, 99, 121, 32, 97, 110, 100, 32, 116, 111, 32, 112, 114, 101, 118,
+    101, 110, 116, 32, 101, 120, 116, 114, 97, 32, 99, 104, 101, 99, 107, 115,
+    46, 10, 47, 47, 32, 66, 101, 32, 99, 97, 114, 101, 102, 117, 108, 32,
+    116, 104, 111, 117, 103, 104, 44, 32, 116, 104, 97, 116, 39, 115, 32, 97,
+    108, 114, 101, 97, 100, 121, 32, 56, 75, 66, 32, 111, 102, 32, 115, 104,
+    97, 114, 101, 100, 32, 109, 101, 109, 111, 114, 121, 32, 117, 115, 97, 103,
+    101, 46, 46, 46, 10, 47, 47, 32, 84, 79, 68, 79, 58, 32, 100, 111,
+    32, 114, 101, 97, 108, 32, 98, 101, 110, 99, 104, 109, 97, 114, 107, 105,
+    110, 103, 32, 97, 98, 111, 117, 116, 32, 111, 99, 99, 117, 112, 97, 110,
+    99, 121, 32, 118, 115, 46, 32, 109, 101, 109, 111, 114, 121, 32, 117, 115,
+    97, 103, 101, 32, 116, 114, 97, 100, 101, 111, 102, 102, 46, 10, 107, 101,
+    114, 110, 101, 108, 32, 118, 111, 105, 100, 32, 98, 105, 116, 109, 97, 112,
+    112, 101, 100, 95, 98, 105, 110, 97, 114, 105, 122, 101, 40, 103, 108, 111,
+    98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32,
+    105, 110, 44, 32, 103, 108, 111, 98, 97, 108, 32, 105, 110, 116, 32, 42,
+    32, 111, 117, 116, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 116,
+    104, 114, 101, 115, 104, 111, 108, 100, 44, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 109, 105, 110, 95, 118, 97, 108, 44, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 109, 97, 120, 95, 118, 97, 108, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 108,
+    111, 99, 97, 108, 32, 105, 110, 116, 32, 42, 32, 108, 111, 99, 97, 108,
+    95, 105, 109, 103, 41, 10, 123, 10, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 32, 61,
+    32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 105, 100, 40, 48, 41,
+    59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 98,
+    95, 116, 104, 114, 101, 97, 100, 115, 32, 61, 32, 103, 101, 116, 95, 108,
+    111, 99, 97, 108, 95, 115, 105, 122, 101, 40, 48, 41, 59, 10, 10, 32,
+    32, 47, 47, 32, 109, 101, 109, 99, 112, 121, 50, 108, 111, 99, 97, 108,
+    32, 98, 117, 116, 32, 117, 110, 114, 111, 108, 108, 101, 100, 46, 32, 50,
+    120, 32, 102, 97, 115, 116, 101, 114, 32, 111, 110, 32, 78, 118, 105, 100,
+    105, 97, 32, 57, 52, 48, 48, 77, 10, 32, 32, 123, 32, 47, 47, 32,
+    117, 110, 114, 111, 108, 108, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 103, 105, 100, 120, 32, 61, 32, 40, 103, 101, 116,
+    95, 103, 114, 111, 117, 112, 95, 105, 100, 40, 48, 41, 32, 60, 60, 32,
+    53, 41, 32, 42, 32, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 32,
+    43, 32, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 59, 10, 32, 32,
+    32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 116, 104, 114, 101,
+    97, 100, 95, 105, 100, 120, 32, 43, 32, 48, 42, 110, 98, 95, 116, 104,
+    114, 101, 97, 100, 115, 93, 32, 61, 32, 105, 110, 91, 103, 105, 100, 120,
+    32, 43, 32, 48, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93,
+    59, 10, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91,
+    116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 32, 43, 32, 49, 42, 110,
+    98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 32, 61, 32, 105, 110, 91,
+    103, 105, 100, 120, 32, 43, 32, 49, 42, 110, 98, 95, 116, 104, 114, 101,
+    97, 100, 115, 93, 59, 10, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95,
+    105, 109, 103, 91, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 32, 43,
+    32, 50, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 32, 61,
+    32, 105, 110, 91, 103, 105, 100, 120, 32, 43, 32, 50, 42, 110, 98, 95,
+    116, 104, 114, 101, 97, 100, 115, 93, 59, 10, 32, 32, 32, 32, 108, 111,
+    99, 97, 108, 95, 105, 109, 103, 91, 116, 104, 114, 101, 97, 100, 95, 105,
+    100, 120, 32, 43, 32, 51, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100,
+    115, 93, 32, 61, 32, 105, 110, 91, 103, 105, 100, 120, 32, 43, 32, 51,
+    42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 59, 10, 32, 32,
+    32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 116, 104, 114, 101,
+    97, 100, 95, 105, 100, 120, 32, 43, 32, 52, 42, 110, 98, 95, 116, 104,
+    114, 101, 97, 100, 115, 93, 32, 61, 32, 105, 110, 91, 103, 105, 100, 120,
+    32, 43, 32, 52, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93,
+    59, 10, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91,
+    116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 32, 43, 32, 53, 42, 110,
+    98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 32, 61, 32, 105, 110, 91,
+    103, 105, 100, 120, 32, 43, 32, 53, 42, 110, 98, 95, 116, 104, 114, 101,
+    97, 100, 115, 93, 59, 10, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95,
+    105, 109, 103, 91, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 32, 43,
+    32, 54, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 32, 61,
+    32, 105, 110, 91, 103, 105, 100, 120, 32, 43, 32, 54, 42, 110, 98, 95,
+    116, 104, 114, 101, 97, 100, 115, 93, 59, 10, 32, 32, 32, 32, 108, 111,
+    99, 97, 108, 95, 105, 109, 103, 91, 116, 104, 114, 101, 97, 100, 95, 105,
+    100, 120, 32, 43, 32, 55, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100,
+    115, 93, 32, 61, 32, 105, 110, 91, 103, 105, 100, 120, 32, 43, 32, 55,
+    42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 59, 10, 32, 32,
+    32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 116, 104, 114, 101,
+    97, 100, 95, 105, 100, 120, 32, 43, 32, 56, 42, 110, 98, 95, 116, 104,
+    114, 101, 97, 100, 115, 93, 32, 61, 32, 105, 110, 91, 103, 105, 100, 120,
+    32, 43, 32, 56, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93,
+    59, 10, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91,
+    116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 32, 43, 32, 57, 42, 110,
+    98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 32, 61, 32, 105, 110, 91,
+    103, 105, 100, 120, 32, 43, 32, 57, 42, 110, 98, 95, 116, 104, 114, 101,
+    97, 100, 115, 93, 59, 10, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95,
+    105, 109, 103, 91, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 32, 43,
+    32, 49, 48, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 32,
+    61, 32, 105, 110, 91, 103, 105, 100, 120, 32, 43, 32, 49, 48, 42, 110,
+    98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 59, 10, 32, 32, 32, 32,
+    108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 116, 104, 114, 101, 97, 100,
+    95, 105, 100, 120, 32, 43, 32, 49, 49, 42, 110, 98, 95, 116, 104, 114,
+    101, 97, 100, 115, 93, 32, 61, 32, 105, 110, 91, 103, 105, 100, 120, 32,
+    43, 32, 49, 49, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93,
+    59, 10, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91,
+    116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 32, 43, 32, 49, 50, 42,
+    110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 32, 61, 32, 105, 110,
+    91, 103, 105, 100, 120, 32, 43, 32, 49, 50, 42, 110, 98, 95, 116, 104,
+    114, 101, 97, 100, 115, 93, 59, 10, 32, 32, 32, 32, 108, 111, 99, 97,
+    108, 95, 105, 109, 103, 91, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120,
+    32, 43, 32, 49, 51, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115,
+    93, 32, 61, 32, 105, 110, 91, 103, 105, 100, 120, 32, 43, 32, 49, 51,
+    42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 59, 10, 32, 32,
+    32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 116, 104, 114, 101,
+    97, 100, 95, 105, 100, 120, 32, 43, 32, 49, 52, 42, 110, 98, 95, 116,
+    104, 114, 101, 97, 100, 115, 93, 32, 61, 32, 105, 110, 91, 103, 105, 100,
+    120, 32, 43, 32, 49, 52, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100,
+    115, 93, 59, 10, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109,
+    103, 91, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 32, 43, 32, 49,
+    53, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 32, 61, 32,
+    105, 110, 91, 103, 105, 100, 120, 32, 43, 32, 49, 53, 42, 110, 98, 95,
+    116, 104, 114, 101, 97, 100, 115, 93, 59, 10, 32, 32, 32, 32, 108, 111,
+    99, 97, 108, 95, 105, 109, 103, 91, 116, 104, 114, 101, 97, 100, 95, 105,
+    100, 120, 32, 43, 32, 49, 54, 42, 110, 98, 95, 116, 104, 114, 101, 97,
+    100, 115, 93, 32, 61, 32, 105, 110, 91, 103, 105, 100, 120, 32, 43, 32,
+    49, 54, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 59, 10,
+    32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 116, 104,
+    114, 101, 97, 100, 95, 105, 100, 120, 32, 43, 32, 49, 55, 42, 110, 98,
+    95, 116, 104, 114, 101, 97, 100, 115, 93, 32, 61, 32, 105, 110, 91, 103,
+    105, 100, 120, 32, 43, 32, 49, 55, 42, 110, 98, 95, 116, 104, 114, 101,
+    97, 100, 115, 93, 59, 10, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95,
+    105, 109, 103, 91, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 32, 43,
+    32, 49, 56, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 32,
+    61, 32, 105, 110, 91, 103, 105, 100, 120, 32, 43, 32, 49, 56, 42, 110,
+    98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 59, 10, 32, 32, 32, 32,
+    108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 116, 104, 114, 101, 97, 100,
+    95, 105, 100, 120, 32, 43, 32, 49, 57, 42, 110, 98, 95, 116, 104, 114,
+    101, 97, 100, 115, 93, 32, 61, 32, 105, 110, 91, 103, 105, 100, 120, 32,
+    43, 32, 49, 57, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93,
+    59, 10, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91,
+    116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 32, 43, 32, 50, 48, 42,
+    110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 32, 61, 32, 105, 110,
+    91, 103, 105, 100, 120, 32, 43, 32, 50, 48, 42, 110, 98, 95, 116, 104,
+    114, 101, 97, 100, 115, 93, 59, 10, 32, 32, 32, 32, 108, 111, 99, 97,
+    108, 95, 105, 109, 103, 91, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120,
+    32, 43, 32, 50, 49, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115,
+    93, 32, 61, 32, 105, 110, 91, 103, 105, 100, 120, 32, 43, 32, 50, 49,
+    42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 59, 10, 32, 32,
+    32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 116, 104, 114, 101,
+    97, 100, 95, 105, 100, 120, 32, 43, 32, 50, 50, 42, 110, 98, 95, 116,
+    104, 114, 101, 97, 100, 115, 93, 32, 61, 32, 105, 110, 91, 103, 105, 100,
+    120, 32, 43, 32, 50, 50, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100,
+    115, 93, 59, 10, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109,
+    103, 91, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 32, 43, 32, 50,
+    51, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 32, 61, 32,
+    105, 110, 91, 103, 105, 100, 120, 32, 43, 32, 50, 51, 42, 110, 98, 95,
+    116, 104, 114, 101, 97, 100, 115, 93, 59, 10, 32, 32, 32, 32, 108, 111,
+    99, 97, 108, 95, 105, 109, 103, 91, 116, 104, 114, 101, 97, 100, 95, 105,
+    100, 120, 32, 43, 32, 50, 52, 42, 110, 98, 95, 116, 104, 114, 101, 97,
+    100, 115, 93, 32, 61, 32, 105, 110, 91, 103, 105, 100, 120, 32, 43, 32,
+    50, 52, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 59, 10,
+    32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 116, 104,
+    114, 101, 97, 100, 95, 105, 100, 120, 32, 43, 32, 50, 53, 42, 110, 98,
+    95, 116, 104, 114, 101, 97, 100, 115, 93, 32, 61, 32, 105, 110, 91, 103,
+    105, 100, 120, 32, 43, 32, 50, 53, 42, 110, 98, 95, 116, 104, 114, 101,
+    97, 100, 115, 93, 59, 10, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95,
+    105, 109, 103, 91, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 32, 43,
+    32, 50, 54, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 32,
+    61, 32, 105, 110, 91, 103, 105, 100, 120, 32, 43, 32, 50, 54, 42, 110,
+    98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 59, 10, 32, 32, 32, 32,
+    108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 116, 104, 114, 101, 97, 100,
+    95, 105, 100, 120, 32, 43, 32, 50, 55, 42, 110, 98, 95, 116, 104, 114,
+    101, 97, 100, 115, 93, 32, 61, 32, 105, 110, 91, 103, 105, 100, 120, 32,
+    43, 32, 50, 55, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93,
+    59, 10, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91,
+    116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 32, 43, 32, 50, 56, 42,
+    110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 32, 61, 32, 105, 110,
+    91, 103, 105, 100, 120, 32, 43, 32, 50, 56, 42, 110, 98, 95, 116, 104,
+    114, 101, 97, 100, 115, 93, 59, 10, 32, 32, 32, 32, 108, 111, 99, 97,
+    108, 95, 105, 109, 103, 91, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120,
+    32, 43, 32, 50, 57, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115,
+    93, 32, 61, 32, 105, 110, 91, 103, 105, 100, 120, 32, 43, 32, 50, 57,
+    42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 59, 10, 32, 32,
+    32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 116, 104, 114, 101,
+    97, 100, 95, 105, 100, 120, 32, 43, 32, 51, 48, 42, 110, 98, 95, 116,
+    104, 114, 101, 97, 100, 115, 93, 32, 61, 32, 105, 110, 91, 103, 105, 100,
+    120, 32, 43, 32, 51, 48, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100,
+    115, 93, 59, 10, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109,
+    103, 91, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 32, 43, 32, 51,
+    49, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 32, 61, 32,
+    105, 110, 91, 103, 105, 100, 120, 32, 43, 32, 51, 49, 42, 110, 98, 95,
+    116, 104, 114, 101, 97, 100, 115, 93, 59, 10, 32, 32, 125, 10, 10, 32,
+    32, 47, 47, 32, 67, 111, 109, 112, 117, 116, 101, 32, 116, 104, 101, 32,
+    114, 101, 115, 117, 108, 116, 10, 32, 32, 123, 32, 47, 47, 32, 85, 110,
+    114, 111, 108, 108, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 105, 100, 120, 32, 61, 32, 103, 101, 116, 95, 103, 108, 111,
+    98, 97, 108, 95, 105, 100, 40, 48, 41, 59, 10, 32, 32, 32, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 105, 100, 120, 32, 61, 32,
+    116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 32, 60, 60, 32, 53, 59,
+    10, 32, 32, 32, 32, 111, 117, 116, 91, 105, 100, 120, 93, 32, 61, 10,
+    32, 32, 32, 32, 32, 32, 115, 101, 108, 101, 99, 116, 40, 109, 105, 110,
+    95, 118, 97, 108, 44, 32, 109, 97, 120, 95, 118, 97, 108, 44, 32, 108,
+    111, 99, 97, 108, 95, 105, 109, 103, 91, 108, 105, 100, 120, 32, 43, 32,
+    48, 93, 32, 62, 61, 32, 116, 104, 114, 101, 115, 104, 111, 108, 100, 41,
+    32, 60, 60, 32, 51, 49, 10, 32, 32, 32, 32, 32, 32, 124, 32, 115,
+    101, 108, 101, 99, 116, 40, 109, 105, 110, 95, 118, 97, 108, 44, 32, 109,
+    97, 120, 95, 118, 97, 108, 44, 32, 108, 111, 99, 97, 108, 95, 105, 109,
+    103, 91, 108, 105, 100, 120, 32, 43, 32, 49, 93, 32, 62, 61, 32, 116,
+    104, 114, 101, 115, 104, 111, 108, 100, 41, 32, 60, 60, 32, 51, 48, 10,
+    32, 32, 32, 32, 32, 32, 124, 32, 115, 101, 108, 101, 99, 116, 40, 109,
+    105, 110, 95, 118, 97, 108, 44, 32, 109, 97, 120, 95, 118, 97, 108, 44,
+    32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 108, 105, 100, 120, 32,
+    43, 32, 50, 93, 32, 62, 61, 32, 116, 104, 114, 101, 115, 104, 111, 108,
+    100, 41, 32, 60, 60, 32, 50, 57, 10, 32, 32, 32, 32, 32, 32, 124,
+    32, 115, 101, 108, 101, 99, 116, 40, 109, 105, 110, 95, 118, 97, 108, 44,
+    32, 109, 97, 120, 95, 118, 97, 108, 44, 32, 108, 111, 99, 97, 108, 95,
+    105, 109, 103, 91, 108, 105, 100, 120, 32, 43, 32, 51, 93, 32, 62, 61,
+    32, 116, 104, 114, 101, 115, 104, 111, 108, 100, 41, 32, 60, 60, 32, 50,
+    56, 10, 32, 32, 32, 32, 32, 32, 124, 32, 115, 101, 108, 101, 99, 116,
+    40, 109, 105, 110, 95, 118, 97, 108, 44, 32, 109, 97, 120, 95, 118, 97,
+    108, 44, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 108, 105, 100,
+    120, 32, 43, 32, 52, 93, 32, 62, 61, 32, 116, 104, 114, 101, 115, 104,
+    111, 108, 100, 41, 32, 60, 60, 32, 50, 55, 10, 32, 32, 32, 32, 32,
+    32, 124, 32, 115, 101, 108, 101, 99, 116, 40, 109, 105, 110, 95, 118, 97,
+    108, 44, 32, 109, 97, 120, 95, 118, 97, 108, 44, 32, 108, 111, 99, 97,
+    108, 95, 105, 109, 103, 91, 108, 105, 100, 120, 32, 43, 32, 53, 93, 32,
+    62, 61, 32, 116, 104, 114, 101, 115, 104, 111, 108, 100, 41, 32, 60, 60,
+    32, 50, 54, 10, 32, 32, 32, 32, 32, 32, 124, 32, 115, 101, 108, 101,
+    99, 116, 40, 109, 105, 110, 95, 118, 97, 108, 44, 32, 109, 97, 120, 95,
+    118, 97, 108, 44, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 108,
+    105, 100, 120, 32, 43, 32, 54, 93, 32, 62, 61, 32, 116, 104, 114, 101,
+    115, 104, 111, 108, 100, 41, 32, 60, 60, 32, 50, 53, 10, 32, 32, 32,
+    32, 32, 32, 124, 32, 115, 101, 108, 101, 99, 116, 40, 109, 105, 110, 95,
+    118, 97, 108, 44, 32, 109, 97, 120, 95, 118, 97, 108, 44, 32, 108, 111,
+    99, 97, 108, 95, 105, 109, 103, 91, 108, 105, 100, 120, 32, 43, 32, 55,
+    93, 32, 62, 61, 32, 116, 104, 114, 101, 115, 104, 111, 108, 100, 41, 32,
+    60, 60, 32, 50, 52, 10, 32, 32, 32, 32, 32, 32, 124, 32, 115, 101,
+    108, 101, 99, 116, 40, 109, 105, 110, 95, 118, 97, 108, 44, 32, 109, 97,
+    120, 95, 118, 97, 108, 44, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103,
+    91, 108, 105, 100, 120, 32, 43, 32, 56, 93, 32, 62, 61, 32, 116, 104,
+    114, 101, 115, 104, 111, 108, 100, 41, 32, 60, 60, 32, 50, 51, 10, 32,
+    32, 32, 32, 32, 32, 124, 32, 115, 101, 108, 101, 99, 116, 40, 109, 105,
+    110, 95, 118, 97, 108, 44, 32, 109, 97, 120, 95, 118, 97, 108, 44, 32,
+    108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 108, 105, 100, 120, 32, 43,
+    32, 57, 93, 32, 62, 61, 32, 116, 104, 114, 101, 115, 104, 111, 108, 100,
+    41, 32, 60, 60, 32, 50, 50, 10, 32, 32, 32, 32, 32, 32, 124, 32,
+    115, 101, 108, 101, 99, 116, 40, 109, 105, 110, 95, 118, 97, 108, 44, 32,
+    109, 97, 120, 95, 118, 97, 108, 44, 32, 108, 111, 99, 97, 108, 95, 105,
+    109, 103, 91, 108, 105, 100, 120, 32, 43, 32, 49, 48, 93, 32, 62, 61,
+    32, 116, 104, 114, 101, 115, 104, 111, 108, 100, 41, 32, 60, 60, 32, 50,
+    49, 10, 32, 32, 32, 32, 32, 32, 124, 32, 115, 101, 108, 101, 99, 116,
+    40, 109, 105, 110, 95, 118, 97, 108, 44, 32, 109, 97, 120, 95, 118, 97,
+    108, 44, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 108, 105, 100,
+    120, 32, 43, 32, 49, 49, 93, 32, 62, 61, 32, 116, 104, 114, 101, 115,
+    104, 111, 108, 100, 41, 32, 60, 60, 32, 50, 48, 10, 32, 32, 32, 32,
+    32, 32, 124, 32, 115, 101, 108, 101, 99, 116, 40, 109, 105, 110, 95, 118,
+    97, 108, 44, 32, 109, 97, 120, 95, 118, 97, 108, 44, 32, 108, 111, 99,
+    97, 108, 95, 105, 109, 103, 91, 108, 105, 100, 120, 32, 43, 32, 49, 50,
+    93, 32, 62, 61, 32, 116, 104, 114, 101, 115, 104, 111, 108, 100, 41, 32,
+    60, 60, 32, 49, 57, 10, 32, 32, 32, 32, 32, 32, 124, 32, 115, 101,
+    108, 101, 99, 116, 40, 109, 105, 110, 95, 118, 97, 108, 44, 32, 109, 97,
+    120, 95, 118, 97, 108, 44, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103,
+    91, 108, 105, 100, 120, 32, 43, 32, 49, 51, 93, 32, 62, 61, 32, 116,
+    104, 114, 101, 115, 104, 111, 108, 100, 41, 32, 60, 60, 32, 49, 56, 10,
+    32, 32, 32, 32, 32, 32, 124, 32, 115, 101, 108, 101, 99, 116, 40, 109,
+    105, 110, 95, 118, 97, 108, 44, 32, 109, 97, 120, 95, 118, 97, 108, 44,
+    32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 108, 105, 100, 120, 32,
+    43, 32, 49, 52, 93, 32, 62, 61, 32, 116, 104, 114, 101, 115, 104, 111,
+    108, 100, 41, 32, 60, 60, 32, 49, 55, 10, 32, 32, 32, 32, 32, 32,
+    124, 32, 115, 101, 108, 101, 99, 116, 40, 109, 105, 110, 95, 118, 97, 108,
+    44, 32, 109, 97, 120, 95, 118, 97, 108, 44, 32, 108, 111, 99, 97, 108,
+    95, 105, 109, 103, 91, 108, 105, 100, 120, 32, 43, 32, 49, 53, 93, 32,
+    62, 61, 32, 116, 104, 114, 101, 115, 104, 111, 108, 100, 41, 32, 60, 60,
+    32, 49, 54, 10, 32, 32, 32, 32, 32, 32, 124, 32, 115, 101, 108, 101,
+    99, 116, 40, 109, 105, 110, 95, 118, 97, 108, 44, 32, 109, 97, 120, 95,
+    118, 97, 108, 44, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 108,
+    105, 100, 120, 32, 43, 32, 49, 54, 93, 32, 62, 61, 32, 116, 104, 114,
+    101, 115, 104, 111, 108, 100, 41, 32, 60, 60, 32, 49, 53, 10, 32, 32,
+    32, 32, 32, 32, 124, 32, 115, 101, 108, 101, 99, 116, 40, 109, 105, 110,
+    95, 118, 97, 108, 44, 32, 109, 97, 120, 95, 118, 97, 108, 44, 32, 108,
+    111, 99, 97, 108, 95, 105, 109, 103, 91, 108, 105, 100, 120, 32, 43, 32,
+    49, 55, 93, 32, 62, 61, 32, 116, 104, 114, 101, 115, 104, 111, 108, 100,
+    41, 32, 60, 60, 32, 49, 52, 10, 32, 32, 32, 32, 32, 32, 124, 32,
+    115, 101, 108, 101, 99, 116, 40, 109, 105, 110, 95, 118, 97, 108, 44, 32,
+    109, 97, 120, 95, 118, 97, 108, 44, 32, 108, 111, 99, 97, 108, 95, 105,
+    109, 103, 91, 108, 105, 100, 120, 32, 43, 32, 49, 56, 93, 32, 62, 61,
+    32, 116, 104, 114, 101, 115, 104, 111, 108, 100, 41, 32, 60, 60, 32, 49,
+    51, 10, 32, 32, 32, 32, 32, 32, 124, 32, 115, 101, 108, 101, 99, 116,
+    40, 109, 105, 110, 95, 118, 97, 108, 44, 32, 109, 97, 120, 95, 118, 97,
+    108, 44, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 108, 105, 100,
+    120, 32, 43, 32, 49, 57, 93, 32, 62, 61, 32, 116, 104, 114, 101, 115,
+    104, 111, 108, 100, 41, 32, 60, 60, 32, 49, 50, 10, 32, 32, 32, 32,
+    32, 32, 124, 32, 115, 101, 108, 101, 99, 116, 40, 109, 105, 110, 95, 118,
+    97, 108, 44, 32, 109, 97, 120, 95, 118, 97, 108, 44, 32, 108, 111, 99,
+    97, 108, 95, 105, 109, 103, 91, 108, 105, 100, 120, 32, 43, 32, 50, 48,
+    93, 32, 62, 61, 32, 116, 104, 114, 101, 115, 104, 111, 108, 100, 41, 32,
+    60, 60, 32, 49, 49, 10, 32, 32, 32, 32, 32, 32, 124, 32, 115, 101,
+    108, 101, 99, 116, 40, 109, 105, 110, 95, 118, 97, 108, 44, 32, 109, 97,
+    120, 95, 118, 97, 108, 44, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103,
+    91, 108, 105, 100, 120, 32, 43, 32, 50, 49, 93, 32, 62, 61, 32, 116,
+    104, 114, 101, 115, 104, 111, 108, 100, 41, 32, 60, 60, 32, 49, 48, 10,
+    32, 32, 32, 32, 32, 32, 124, 32, 115, 101, 108, 101, 99, 116, 40, 109,
+    105, 110, 95, 118, 97, 108, 44, 32, 109, 97, 120, 95, 118, 97, 108, 44,
+    32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 108, 105, 100, 120, 32,
+    43, 32, 50, 50, 93, 32, 62, 61, 32, 116, 104, 114, 101, 115, 104, 111,
+    108, 100, 41, 32, 60, 60, 32, 57, 10, 32, 32, 32, 32, 32, 32, 124,
+    32, 115, 101, 108, 101, 99, 116, 40, 109, 105, 110, 95, 118, 97, 108, 44,
+    32, 109, 97, 120, 95, 118, 97, 108, 44, 32, 108, 111, 99, 97, 108, 95,
+    105, 109, 103, 91, 108, 105, 100, 120, 32, 43, 32, 50, 51, 93, 32, 62,
+    61, 32, 116, 104, 114, 101, 115, 104, 111, 108, 100, 41, 32, 60, 60, 32,
+    56, 10, 32, 32, 32, 32, 32, 32, 124, 32, 115, 101, 108, 101, 99, 116,
+    40, 109, 105, 110, 95, 118, 97, 108, 44, 32, 109, 97, 120, 95, 118, 97,
+    108, 44, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 108, 105, 100,
+    120, 32, 43, 32, 50, 52, 93, 32, 62, 61, 32, 116, 104, 114, 101, 115,
+    104, 111, 108, 100, 41, 32, 60, 60, 32, 55, 10, 32, 32, 32, 32, 32,
+    32, 124, 32, 115, 101, 108, 101, 99, 116, 40, 109, 105, 110, 95, 118, 97,
+    108, 44, 32, 109, 97, 120, 95, 118, 97, 108, 44, 32, 108, 111, 99, 97,
+    108, 95, 105, 109, 103, 91, 108, 105, 100, 120, 32, 43, 32, 50, 53, 93,
+    32, 62, 61, 32, 116, 104, 114, 101, 115, 104, 111, 108, 100, 41, 32, 60,
+    60, 32, 54, 10, 32, 32, 32, 32, 32, 32, 124, 32, 115, 101, 108, 101,
+    99, 116, 40, 109, 105, 110, 95, 118, 97, 108, 44, 32, 109, 97, 120, 95,
+    118, 97, 108, 44, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 108,
+    105, 100, 120, 32, 43, 32, 50, 54, 93, 32, 62, 61, 32, 116, 104, 114,
+    101, 115, 104, 111, 108, 100, 41, 32, 60, 60, 32, 53, 10, 32, 32, 32,
+    32, 32, 32, 124, 32, 115, 101, 108, 101, 99, 116, 40, 109, 105, 110, 95,
+    118, 97, 108, 44, 32, 109, 97, 120, 95, 118, 97, 108, 44, 32, 108, 111,
+    99, 97, 108, 95, 105, 109, 103, 91, 108, 105, 100, 120, 32, 43, 32, 50,
+    55, 93, 32, 62, 61, 32, 116, 104, 114, 101, 115, 104, 111, 108, 100, 41,
+    32, 60, 60, 32, 52, 10, 32, 32, 32, 32, 32, 32, 124, 32, 115, 101,
+    108, 101, 99, 116, 40, 109, 105, 110, 95, 118, 97, 108, 44, 32, 109, 97,
+    120, 95, 118, 97, 108, 44, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103,
+    91, 108, 105, 100, 120, 32, 43, 32, 50, 56, 93, 32, 62, 61, 32, 116,
+    104, 114, 101, 115, 104, 111, 108, 100, 41, 32, 60, 60, 32, 51, 10, 32,
+    32, 32, 32, 32, 32, 124, 32, 115, 101, 108, 101, 99, 116, 40, 109, 105,
+    110, 95, 118, 97, 108, 44, 32, 109, 97, 120, 95, 118, 97, 108, 44, 32,
+    108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 108, 105, 100, 120, 32, 43,
+    32, 50, 57, 93, 32, 62, 61, 32, 116, 104, 114, 101, 115, 104, 111, 108,
+    100, 41, 32, 60, 60, 32, 50, 10, 32, 32, 32, 32, 32, 32, 124, 32,
+    115, 101, 108, 101, 99, 116, 40, 109, 105, 110, 95, 118, 97, 108, 44, 32,
+    109, 97, 120, 95, 118, 97, 108, 44, 32, 108, 111, 99, 97, 108, 95, 105,
+    109, 103, 91, 108, 105, 100, 120, 32, 43, 32, 51, 48, 93, 32, 62, 61,
+    32, 116, 104, 114, 101, 115, 104, 111, 108, 100, 41, 32, 60, 60, 32, 49,
+    10, 32, 32, 32, 32, 32, 32, 124, 32, 115, 101, 108, 101, 99, 116, 40,
+    109, 105, 110, 95, 118, 97, 108, 44, 32, 109, 97, 120, 95, 118, 97, 108,
+    44, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 108, 105, 100, 120,
+    32, 43, 32, 51, 49, 93, 32, 62, 61, 32, 116, 104, 114, 101, 115, 104,
+    111, 108, 100, 41, 32, 60, 60, 32, 48, 59, 10, 32, 32, 125, 10, 125,
+    10, 10, 47, 47, 32, 67, 111, 110, 118, 101, 114, 116, 32, 97, 32, 98,
+    105, 116, 109, 97, 112, 32, 105, 109, 97, 103, 101, 32, 116, 111, 32, 105,
+    116, 115, 32, 117, 110, 98, 105, 116, 109, 97, 112, 32, 118, 101, 114, 115,
+    105, 111, 110, 32, 40, 111, 110, 101, 32, 112, 105, 120, 101, 108, 47, 51,
+    50, 98, 105, 116, 41, 10, 107, 101, 114, 110, 101, 108, 32, 118, 111, 105,
+    100, 32, 117, 110, 98, 105, 116, 109, 97, 112, 40, 103, 108, 111, 98, 97,
+    108, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32, 105, 110,
+    44, 32, 103, 108, 111, 98, 97, 108, 32, 105, 110, 116, 32, 42, 32, 111,
+    117, 116, 44, 32, 108, 111, 99, 97, 108, 32, 105, 110, 116, 32, 42, 32,
+    108, 111, 99, 97, 108, 95, 105, 109, 103, 41, 10, 123, 10, 32, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 116, 104, 114, 101, 97, 100, 95,
+    105, 100, 120, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95,
+    105, 100, 40, 48, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 32, 61, 32,
+    103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 115, 105, 122, 101, 40, 48,
+    41, 59, 10, 10, 32, 32, 47, 47, 32, 117, 110, 98, 105, 116, 109, 97,
+    112, 32, 116, 111, 32, 108, 111, 99, 97, 108, 32, 109, 101, 109, 111, 114,
+    121, 32, 98, 101, 99, 97, 117, 115, 101, 32, 111, 102, 32, 99, 111, 97,
+    108, 101, 115, 99, 105, 110, 103, 32, 119, 104, 101, 110, 32, 119, 114, 105,
+    116, 105, 110, 103, 10, 32, 32, 47, 47, 32, 116, 104, 101, 32, 114, 101,
+    115, 117, 108, 116, 32, 98, 97, 99, 107, 32, 116, 111, 32, 116, 104, 101,
+    32, 111, 117, 116, 112, 117, 116, 32, 109, 101, 109, 111, 114, 121, 46, 10,
+    32, 32, 123, 32, 47, 47, 32, 85, 110, 114, 111, 108, 108, 10, 32, 32,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 105, 100, 120, 32,
+    61, 32, 103, 101, 116, 95, 103, 108, 111, 98, 97, 108, 95, 105, 100, 40,
+    48, 41, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 111, 105, 100, 120, 32, 61, 32, 116, 104, 114, 101, 97, 100, 95,
+    105, 100, 120, 32, 60, 60, 32, 53, 59, 10, 32, 32, 32, 32, 108, 111,
+    99, 97, 108, 95, 105, 109, 103, 91, 111, 105, 100, 120, 32, 43, 32, 48,
+    93, 32, 61, 32, 40, 105, 110, 91, 105, 100, 120, 93, 32, 62, 62, 32,
+    51, 49, 41, 32, 38, 32, 49, 59, 10, 32, 32, 32, 32, 108, 111, 99,
+    97, 108, 95, 105, 109, 103, 91, 111, 105, 100, 120, 32, 43, 32, 49, 93,
+    32, 61, 32, 40, 105, 110, 91, 105, 100, 120, 93, 32, 62, 62, 32, 51,
+    48, 41, 32, 38, 32, 49, 59, 10, 32, 32, 32, 32, 108, 111, 99, 97,
+    108, 95, 105, 109, 103, 91, 111, 105, 100, 120, 32, 43, 32, 50, 93, 32,
+    61, 32, 40, 105, 110, 91, 105, 100, 120, 93, 32, 62, 62, 32, 50, 57,
+    41, 32, 38, 32, 49, 59, 10, 32, 32, 32, 32, 108, 111, 99, 97, 108,
+    95, 105, 109, 103, 91, 111, 105, 100, 120, 32, 43, 32, 51, 93, 32, 61,
+    32, 40, 105, 110, 91, 105, 100, 120, 93, 32, 62, 62, 32, 50, 56, 41,
+    32, 38, 32, 49, 59, 10, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95,
+    105, 109, 103, 91, 111, 105, 100, 120, 32, 43, 32, 52, 93, 32, 61, 32,
+    40, 105, 110, 91, 105, 100, 120, 93, 32, 62, 62, 32, 50, 55, 41, 32,
+    38, 32, 49, 59, 10, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105,
+    109, 103, 91, 111, 105, 100, 120, 32, 43, 32, 53, 93, 32, 61, 32, 40,
+    105, 110, 91, 105, 100, 120, 93, 32, 62, 62, 32, 50, 54, 41, 32, 38,
+    32, 49, 59, 10, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109,
+    103, 91, 111, 105, 100, 120, 32, 43, 32, 54, 93, 32, 61, 32, 40, 105,
+    110, 91, 105, 100, 120, 93, 32, 62, 62, 32, 50, 53, 41, 32, 38, 32,
+    49, 59, 10, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103,
+    91, 111, 105, 100, 120, 32, 43, 32, 55, 93, 32, 61, 32, 40, 105, 110,
+    91, 105, 100, 120, 93, 32, 62, 62, 32, 50, 52, 41, 32, 38, 32, 49,
+    59, 10, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91,
+    111, 105, 100, 120, 32, 43, 32, 56, 93, 32, 61, 32, 40, 105, 110, 91,
+    105, 100, 120, 93, 32, 62, 62, 32, 50, 51, 41, 32, 38, 32, 49, 59,
+    10, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 111,
+    105, 100, 120, 32, 43, 32, 57, 93, 32, 61, 32, 40, 105, 110, 91, 105,
+    100, 120, 93, 32, 62, 62, 32, 50, 50, 41, 32, 38, 32, 49, 59, 10,
+    32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 111, 105,
+    100, 120, 32, 43, 32, 49, 48, 93, 32, 61, 32, 40, 105, 110, 91, 105,
+    100, 120, 93, 32, 62, 62, 32, 50, 49, 41, 32, 38, 32, 49, 59, 10,
+    32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 111, 105,
+    100, 120, 32, 43, 32, 49, 49, 93, 32, 61, 32, 40, 105, 110, 91, 105,
+    100, 120, 93, 32, 62, 62, 32, 50, 48, 41, 32, 38, 32, 49, 59, 10,
+    32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 111, 105,
+    100, 120, 32, 43, 32, 49, 50, 93, 32, 61, 32, 40, 105, 110, 91, 105,
+    100, 120, 93, 32, 62, 62, 32, 49, 57, 41, 32, 38, 32, 49, 59, 10,
+    32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 111, 105,
+    100, 120, 32, 43, 32, 49, 51, 93, 32, 61, 32, 40, 105, 110, 91, 105,
+    100, 120, 93, 32, 62, 62, 32, 49, 56, 41, 32, 38, 32, 49, 59, 10,
+    32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 111, 105,
+    100, 120, 32, 43, 32, 49, 52, 93, 32, 61, 32, 40, 105, 110, 91, 105,
+    100, 120, 93, 32, 62, 62, 32, 49, 55, 41, 32, 38, 32, 49, 59, 10,
+    32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 111, 105,
+    100, 120, 32, 43, 32, 49, 53, 93, 32, 61, 32, 40, 105, 110, 91, 105,
+    100, 120, 93, 32, 62, 62, 32, 49, 54, 41, 32, 38, 32, 49, 59, 10,
+    32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 111, 105,
+    100, 120, 32, 43, 32, 49, 54, 93, 32, 61, 32, 40, 105, 110, 91, 105,
+    100, 120, 93, 32, 62, 62, 32, 49, 53, 41, 32, 38, 32, 49, 59, 10,
+    32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 111, 105,
+    100, 120, 32, 43, 32, 49, 55, 93, 32, 61, 32, 40, 105, 110, 91, 105,
+    100, 120, 93, 32, 62, 62, 32, 49, 52, 41, 32, 38, 32, 49, 59, 10,
+    32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 111, 105,
+    100, 120, 32, 43, 32, 49, 56, 93, 32, 61, 32, 40, 105, 110, 91, 105,
+    100, 120, 93, 32, 62, 62, 32, 49, 51, 41, 32, 38, 32, 49, 59, 10,
+    32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 111, 105,
+    100, 120, 32, 43, 32, 49, 57, 93, 32, 61, 32, 40, 105, 110, 91, 105,
+    100, 120, 93, 32, 62, 62, 32, 49, 50, 41, 32, 38, 32, 49, 59, 10,
+    32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 111, 105,
+    100, 120, 32, 43, 32, 50, 48, 93, 32, 61, 32, 40, 105, 110, 91, 105,
+    100, 120, 93, 32, 62, 62, 32, 49, 49, 41, 32, 38, 32, 49, 59, 10,
+    32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 111, 105,
+    100, 120, 32, 43, 32, 50, 49, 93, 32, 61, 32, 40, 105, 110, 91, 105,
+    100, 120, 93, 32, 62, 62, 32, 49, 48, 41, 32, 38, 32, 49, 59, 10,
+    32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 111, 105,
+    100, 120, 32, 43, 32, 50, 50, 93, 32, 61, 32, 40, 105, 110, 91, 105,
+    100, 120, 93, 32, 62, 62, 32, 57, 41, 32, 38, 32, 49, 59, 10, 32,
+    32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 111, 105, 100,
+    120, 32, 43, 32, 50, 51, 93, 32, 61, 32, 40, 105, 110, 91, 105, 100,
+    120, 93, 32, 62, 62, 32, 56, 41, 32, 38, 32, 49, 59, 10, 32, 32,
+    32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 111, 105, 100, 120,
+    32, 43, 32, 50, 52, 93, 32, 61, 32, 40, 105, 110, 91, 105, 100, 120,
+    93, 32, 62, 62, 32, 55, 41, 32, 38, 32, 49, 59, 10, 32, 32, 32,
+    32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 111, 105, 100, 120, 32,
+    43, 32, 50, 53, 93, 32, 61, 32, 40, 105, 110, 91, 105, 100, 120, 93,
+    32, 62, 62, 32, 54, 41, 32, 38, 32, 49, 59, 10, 32, 32, 32, 32,
+    108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 111, 105, 100, 120, 32, 43,
+    32, 50, 54, 93, 32, 61, 32, 40, 105, 110, 91, 105, 100, 120, 93, 32,
+    62, 62, 32, 53, 41, 32, 38, 32, 49, 59, 10, 32, 32, 32, 32, 108,
+    111, 99, 97, 108, 95, 105, 109, 103, 91, 111, 105, 100, 120, 32, 43, 32,
+    50, 55, 93, 32, 61, 32, 40, 105, 110, 91, 105, 100, 120, 93, 32, 62,
+    62, 32, 52, 41, 32, 38, 32, 49, 59, 10, 32, 32, 32, 32, 108, 111,
+    99, 97, 108, 95, 105, 109, 103, 91, 111, 105, 100, 120, 32, 43, 32, 50,
+    56, 93, 32, 61, 32, 40, 105, 110, 91, 105, 100, 120, 93, 32, 62, 62,
+    32, 51, 41, 32, 38, 32, 49, 59, 10, 32, 32, 32, 32, 108, 111, 99,
+    97, 108, 95, 105, 109, 103, 91, 111, 105, 100, 120, 32, 43, 32, 50, 57,
+    93, 32, 61, 32, 40, 105, 110, 91, 105, 100, 120, 93, 32, 62, 62, 32,
+    50, 41, 32, 38, 32, 49, 59, 10, 32, 32, 32, 32, 108, 111, 99, 97,
+    108, 95, 105, 109, 103, 91, 111, 105, 100, 120, 32, 43, 32, 51, 48, 93,
+    32, 61, 32, 40, 105, 110, 91, 105, 100, 120, 93, 32, 62, 62, 32, 49,
+    41, 32, 38, 32, 49, 59, 10, 32, 32, 32, 32, 108, 111, 99, 97, 108,
+    95, 105, 109, 103, 91, 111, 105, 100, 120, 32, 43, 32, 51, 49, 93, 32,
+    61, 32, 40, 105, 110, 91, 105, 100, 120, 93, 32, 62, 62, 32, 48, 41,
+    32, 38, 32, 49, 59, 10, 32, 32, 125, 10, 32, 32, 10, 32, 32, 47,
+    47, 32, 87, 114, 105, 116, 101, 32, 116, 104, 101, 32, 114, 101, 115, 117,
+    108, 116, 32, 98, 97, 99, 107, 10, 32, 32, 123, 32, 47, 47, 32, 117,
+    110, 114, 111, 108, 108, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 103, 105, 100, 120, 32, 61, 32, 40, 103, 101, 116, 95,
+    103, 114, 111, 117, 112, 95, 105, 100, 40, 48, 41, 32, 60, 60, 32, 53,
+    41, 32, 42, 32, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 32, 43,
+    32, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 59, 10, 32, 32, 32,
+    32, 111, 117, 116, 91, 103, 105, 100, 120, 32, 43, 32, 48, 42, 110, 98,
+    95, 116, 104, 114, 101, 97, 100, 115, 93, 32, 61, 32, 108, 111, 99, 97,
+    108, 95, 105, 109, 103, 91, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120,
+    32, 43, 32, 48, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93,
+    59, 10, 32, 32, 32, 32, 111, 117, 116, 91, 103, 105, 100, 120, 32, 43,
+    32, 49, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 32, 61,
+    32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 116, 104, 114, 101, 97,
+    100, 95, 105, 100, 120, 32, 43, 32, 49, 42, 110, 98, 95, 116, 104, 114,
+    101, 97, 100, 115, 93, 59, 10, 32, 32, 32, 32, 111, 117, 116, 91, 103,
+    105, 100, 120, 32, 43, 32, 50, 42, 110, 98, 95, 116, 104, 114, 101, 97,
+    100, 115, 93, 32, 61, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91,
+    116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 32, 43, 32, 50, 42, 110,
+    98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 59, 10, 32, 32, 32, 32,
+    111, 117, 116, 91, 103, 105, 100, 120, 32, 43, 32, 51, 42, 110, 98, 95,
+    116, 104, 114, 101, 97, 100, 115, 93, 32, 61, 32, 108, 111, 99, 97, 108,
+    95, 105, 109, 103, 91, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 32,
+    43, 32, 51, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 59,
+    10, 32, 32, 32, 32, 111, 117, 116, 91, 103, 105, 100, 120, 32, 43, 32,
+    52, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 32, 61, 32,
+    108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 116, 104, 114, 101, 97, 100,
+    95, 105, 100, 120, 32, 43, 32, 52, 42, 110, 98, 95, 116, 104, 114, 101,
+    97, 100, 115, 93, 59, 10, 32, 32, 32, 32, 111, 117, 116, 91, 103, 105,
+    100, 120, 32, 43, 32, 53, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100,
+    115, 93, 32, 61, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 116,
+    104, 114, 101, 97, 100, 95, 105, 100, 120, 32, 43, 32, 53, 42, 110, 98,
+    95, 116, 104, 114, 101, 97, 100, 115, 93, 59, 10, 32, 32, 32, 32, 111,
+    117, 116, 91, 103, 105, 100, 120, 32, 43, 32, 54, 42, 110, 98, 95, 116,
+    104, 114, 101, 97, 100, 115, 93, 32, 61, 32, 108, 111, 99, 97, 108, 95,
+    105, 109, 103, 91, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 32, 43,
+    32, 54, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 59, 10,
+    32, 32, 32, 32, 111, 117, 116, 91, 103, 105, 100, 120, 32, 43, 32, 55,
+    42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 32, 61, 32, 108,
+    111, 99, 97, 108, 95, 105, 109, 103, 91, 116, 104, 114, 101, 97, 100, 95,
+    105, 100, 120, 32, 43, 32, 55, 42, 110, 98, 95, 116, 104, 114, 101, 97,
+    100, 115, 93, 59, 10, 32, 32, 32, 32, 111, 117, 116, 91, 103, 105, 100,
+    120, 32, 43, 32, 56, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115,
+    93, 32, 61, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 116, 104,
+    114, 101, 97, 100, 95, 105, 100, 120, 32, 43, 32, 56, 42, 110, 98, 95,
+    116, 104, 114, 101, 97, 100, 115, 93, 59, 10, 32, 32, 32, 32, 111, 117,
+    116, 91, 103, 105, 100, 120, 32, 43, 32, 57, 42, 110, 98, 95, 116, 104,
+    114, 101, 97, 100, 115, 93, 32, 61, 32, 108, 111, 99, 97, 108, 95, 105,
+    109, 103, 91, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 32, 43, 32,
+    57, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 59, 10, 32,
+    32, 32, 32, 111, 117, 116, 91, 103, 105, 100, 120, 32, 43, 32, 49, 48,
+    42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 32, 61, 32, 108,
+    111, 99, 97, 108, 95, 105, 109, 103, 91, 116, 104, 114, 101, 97, 100, 95,
+    105, 100, 120, 32, 43, 32, 49, 48, 42, 110, 98, 95, 116, 104, 114, 101,
+    97, 100, 115, 93, 59, 10, 32, 32, 32, 32, 111, 117, 116, 91, 103, 105,
+    100, 120, 32, 43, 32, 49, 49, 42, 110, 98, 95, 116, 104, 114, 101, 97,
+    100, 115, 93, 32, 61, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91,
+    116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 32, 43, 32, 49, 49, 42,
+    110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 59, 10, 32, 32, 32,
+    32, 111, 117, 116, 91, 103, 105, 100, 120, 32, 43, 32, 49, 50, 42, 110,
+    98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 32, 61, 32, 108, 111, 99,
+    97, 108, 95, 105, 109, 103, 91, 116, 104, 114, 101, 97, 100, 95, 105, 100,
+    120, 32, 43, 32, 49, 50, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100,
+    115, 93, 59, 10, 32, 32, 32, 32, 111, 117, 116, 91, 103, 105, 100, 120,
+    32, 43, 32, 49, 51, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115,
+    93, 32, 61, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 116, 104,
+    114, 101, 97, 100, 95, 105, 100, 120, 32, 43, 32, 49, 51, 42, 110, 98,
+    95, 116, 104, 114, 101, 97, 100, 115, 93, 59, 10, 32, 32, 32, 32, 111,
+    117, 116, 91, 103, 105, 100, 120, 32, 43, 32, 49, 52, 42, 110, 98, 95,
+    116, 104, 114, 101, 97, 100, 115, 93, 32, 61, 32, 108, 111, 99, 97, 108,
+    95, 105, 109, 103, 91, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 32,
+    43, 32, 49, 52, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93,
+    59, 10, 32, 32, 32, 32, 111, 117, 116, 91, 103, 105, 100, 120, 32, 43,
+    32, 49, 53, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 32,
+    61, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 116, 104, 114, 101,
+    97, 100, 95, 105, 100, 120, 32, 43, 32, 49, 53, 42, 110, 98, 95, 116,
+    104, 114, 101, 97, 100, 115, 93, 59, 10, 32, 32, 32, 32, 111, 117, 116,
+    91, 103, 105, 100, 120, 32, 43, 32, 49, 54, 42, 110, 98, 95, 116, 104,
+    114, 101, 97, 100, 115, 93, 32, 61, 32, 108, 111, 99, 97, 108, 95, 105,
+    109, 103, 91, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 32, 43, 32,
+    49, 54, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 59, 10,
+    32, 32, 32, 32, 111, 117, 116, 91, 103, 105, 100, 120, 32, 43, 32, 49,
+    55, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 32, 61, 32,
+    108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 116, 104, 114, 101, 97, 100,
+    95, 105, 100, 120, 32, 43, 32, 49, 55, 42, 110, 98, 95, 116, 104, 114,
+    101, 97, 100, 115, 93, 59, 10, 32, 32, 32, 32, 111, 117, 116, 91, 103,
+    105, 100, 120, 32, 43, 32, 49, 56, 42, 110, 98, 95, 116, 104, 114, 101,
+    97, 100, 115, 93, 32, 61, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103,
+    91, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 32, 43, 32, 49, 56,
+    42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 59, 10, 32, 32,
+    32, 32, 111, 117, 116, 91, 103, 105, 100, 120, 32, 43, 32, 49, 57, 42,
+    110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 32, 61, 32, 108, 111,
+    99, 97, 108, 95, 105, 109, 103, 91, 116, 104, 114, 101, 97, 100, 95, 105,
+    100, 120, 32, 43, 32, 49, 57, 42, 110, 98, 95, 116, 104, 114, 101, 97,
+    100, 115, 93, 59, 10, 32, 32, 32, 32, 111, 117, 116, 91, 103, 105, 100,
+    120, 32, 43, 32, 50, 48, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100,
+    115, 93, 32, 61, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 116,
+    104, 114, 101, 97, 100, 95, 105, 100, 120, 32, 43, 32, 50, 48, 42, 110,
+    98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 59, 10, 32, 32, 32, 32,
+    111, 117, 116, 91, 103, 105, 100, 120, 32, 43, 32, 50, 49, 42, 110, 98,
+    95, 116, 104, 114, 101, 97, 100, 115, 93, 32, 61, 32, 108, 111, 99, 97,
+    108, 95, 105, 109, 103, 91, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120,
+    32, 43, 32, 50, 49, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115,
+    93, 59, 10, 32, 32, 32, 32, 111, 117, 116, 91, 103, 105, 100, 120, 32,
+    43, 32, 50, 50, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93,
+    32, 61, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 116, 104, 114,
+    101, 97, 100, 95, 105, 100, 120, 32, 43, 32, 50, 50, 42, 110, 98, 95,
+    116, 104, 114, 101, 97, 100, 115, 93, 59, 10, 32, 32, 32, 32, 111, 117,
+    116, 91, 103, 105, 100, 120, 32, 43, 32, 50, 51, 42, 110, 98, 95, 116,
+    104, 114, 101, 97, 100, 115, 93, 32, 61, 32, 108, 111, 99, 97, 108, 95,
+    105, 109, 103, 91, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 32, 43,
+    32, 50, 51, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 59,
+    10, 32, 32, 32, 32, 111, 117, 116, 91, 103, 105, 100, 120, 32, 43, 32,
+    50, 52, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 32, 61,
+    32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 116, 104, 114, 101, 97,
+    100, 95, 105, 100, 120, 32, 43, 32, 50, 52, 42, 110, 98, 95, 116, 104,
+    114, 101, 97, 100, 115, 93, 59, 10, 32, 32, 32, 32, 111, 117, 116, 91,
+    103, 105, 100, 120, 32, 43, 32, 50, 53, 42, 110, 98, 95, 116, 104, 114,
+    101, 97, 100, 115, 93, 32, 61, 32, 108, 111, 99, 97, 108, 95, 105, 109,
+    103, 91, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 32, 43, 32, 50,
+    53, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 59, 10, 32,
+    32, 32, 32, 111, 117, 116, 91, 103, 105, 100, 120, 32, 43, 32, 50, 54,
+    42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 32, 61, 32, 108,
+    111, 99, 97, 108, 95, 105, 109, 103, 91, 116, 104, 114, 101, 97, 100, 95,
+    105, 100, 120, 32, 43, 32, 50, 54, 42, 110, 98, 95, 116, 104, 114, 101,
+    97, 100, 115, 93, 59, 10, 32, 32, 32, 32, 111, 117, 116, 91, 103, 105,
+    100, 120, 32, 43, 32, 50, 55, 42, 110, 98, 95, 116, 104, 114, 101, 97,
+    100, 115, 93, 32, 61, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91,
+    116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 32, 43, 32, 50, 55, 42,
+    110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 59, 10, 32, 32, 32,
+    32, 111, 117, 116, 91, 103, 105, 100, 120, 32, 43, 32, 50, 56, 42, 110,
+    98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 32, 61, 32, 108, 111, 99,
+    97, 108, 95, 105, 109, 103, 91, 116, 104, 114, 101, 97, 100, 95, 105, 100,
+    120, 32, 43, 32, 50, 56, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100,
+    115, 93, 59, 10, 32, 32, 32, 32, 111, 117, 116, 91, 103, 105, 100, 120,
+    32, 43, 32, 50, 57, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115,
+    93, 32, 61, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 116, 104,
+    114, 101, 97, 100, 95, 105, 100, 120, 32, 43, 32, 50, 57, 42, 110, 98,
+    95, 116, 104, 114, 101, 97, 100, 115, 93, 59, 10, 32, 32, 32, 32, 111,
+    117, 116, 91, 103, 105, 100, 120, 32, 43, 32, 51, 48, 42, 110, 98, 95,
+    116, 104, 114, 101, 97, 100, 115, 93, 32, 61, 32, 108, 111, 99, 97, 108,
+    95, 105, 109, 103, 91, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 32,
+    43, 32, 51, 48, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93,
+    59, 10, 32, 32, 32, 32, 111, 117, 116, 91, 103, 105, 100, 120, 32, 43,
+    32, 51, 49, 42, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 93, 32,
+    61, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 116, 104, 114, 101,
+    97, 100, 95, 105, 100, 120, 32, 43, 32, 51, 49, 42, 110, 98, 95, 116,
+    104, 114, 101, 97, 100, 115, 93, 59, 10, 32, 32, 125, 10, 10, 125, 10,
+    35, 101, 110, 100, 105, 102, 10, 10, 35, 105, 102, 100, 101, 102, 32, 67,
+    76, 67, 86, 95, 83, 69, 67, 84, 73, 79, 78, 95, 82, 69, 67, 84,
+    10, 47, 47, 32, 77, 77, 32, 98, 105, 109, 97, 112, 112, 101, 100, 32,
+    111, 112, 101, 114, 97, 116, 111, 114, 115, 32, 111, 112, 116, 105, 109, 105,
+    122, 101, 100, 32, 102, 111, 114, 32, 114, 97, 100, 105, 117, 115, 32, 60,
+    61, 32, 51, 50, 10, 47, 47, 32, 68, 111, 110, 39, 116, 32, 99, 97,
+    108, 108, 32, 105, 116, 32, 119, 105, 116, 104, 32, 114, 97, 100, 105, 117,
+    115, 32, 62, 32, 51, 50, 32, 97, 108, 111, 110, 103, 32, 116, 104, 101,
+    32, 120, 32, 97, 120, 105, 115, 33, 10, 10, 118, 111, 105, 100, 32, 109,
+    101, 109, 99, 112, 121, 50, 100, 50, 108, 111, 99, 97, 108, 40, 108, 111,
+    99, 97, 108, 32, 105, 110, 116, 32, 42, 32, 108, 111, 99, 97, 108, 95,
+    111, 117, 116, 44, 32, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 42, 32, 105, 110, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 105, 110, 95, 110, 114, 111,
+    119, 115, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 105, 110,
+    95, 110, 99, 111, 108, 115, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 114, 101, 99, 116, 95, 110, 114, 111, 119, 115,
+    44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 114, 101, 99, 116,
+    95, 110, 99, 111, 108, 115, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 111, 114, 105, 103, 95, 114, 44, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 111, 114, 105, 103, 95, 99, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 116, 104,
+    114, 101, 97, 100, 95, 105, 100, 120, 44, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 41, 10,
+    123, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 105,
+    122, 101, 32, 61, 32, 114, 101, 99, 116, 95, 110, 114, 111, 119, 115, 32,
+    42, 32, 114, 101, 99, 116, 95, 110, 99, 111, 108, 115, 59, 10, 10, 32,
+    32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 105, 32, 61, 32, 116, 104,
+    114, 101, 97, 100, 95, 105, 100, 120, 59, 32, 105, 32, 60, 32, 115, 105,
+    122, 101, 59, 32, 105, 32, 43, 61, 32, 110, 98, 95, 116, 104, 114, 101,
+    97, 100, 115, 41, 10, 32, 32, 123, 10, 32, 32, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 100, 105, 118, 32, 61, 32, 105, 32, 47,
+    32, 114, 101, 99, 116, 95, 110, 99, 111, 108, 115, 59, 10, 32, 32, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 114, 101, 99, 116, 95,
+    114, 111, 119, 32, 61, 32, 100, 105, 118, 32, 43, 32, 111, 114, 105, 103,
+    95, 114, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 114, 101, 99, 116, 95, 99, 111, 108, 32, 61, 32, 105, 32, 45,
+    32, 100, 105, 118, 32, 42, 32, 114, 101, 99, 116, 95, 110, 99, 111, 108,
+    115, 32, 43, 32, 111, 114, 105, 103, 95, 99, 59, 10, 10, 32, 32, 32,
+    32, 105, 102, 32, 40, 114, 101, 99, 116, 95, 114, 111, 119, 32, 60, 32,
+    48, 32, 124, 124, 32, 114, 101, 99, 116, 95, 114, 111, 119, 32, 62, 61,
+    32, 105, 110, 95, 110, 114, 111, 119, 115, 32, 124, 124, 32, 114, 101, 99,
+    116, 95, 99, 111, 108, 32, 60, 32, 48, 32, 124, 124, 32, 114, 101, 99,
+    116, 95, 99, 111, 108, 32, 62, 61, 32, 105, 110, 95, 110, 99, 111, 108,
+    115, 41, 10, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 111,
+    117, 116, 91, 105, 93, 32, 61, 32, 48, 59, 10, 32, 32, 32, 32, 101,
+    108, 115, 101, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 112, 105, 100, 120, 32, 61,
+    32, 109, 97, 100, 50, 52, 40, 114, 101, 99, 116, 95, 114, 111, 119, 44,
+    32, 105, 110, 95, 110, 99, 111, 108, 115, 44, 32, 114, 101, 99, 116, 95,
+    99, 111, 108, 41, 59, 10, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97,
+    108, 95, 111, 117, 116, 91, 105, 93, 32, 61, 32, 105, 110, 91, 112, 105,
+    100, 120, 93, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 125,
+    10, 10, 107, 101, 114, 110, 101, 108, 32, 118, 111, 105, 100, 32, 98, 105,
+    116, 109, 97, 112, 112, 101, 100, 95, 100, 105, 108, 97, 116, 105, 111, 110,
+    95, 104, 40, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 42, 32, 105, 110, 44, 32, 103, 108, 111, 98, 97, 108,
+    32, 105, 110, 116, 32, 42, 32, 111, 117, 116, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 110, 114, 111, 119, 115, 44, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 110, 99, 111, 108, 115, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 101, 95, 99, 111, 108,
+    114, 97, 100, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 32, 117, 105, 110, 116,
+    32, 42, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 41, 10, 123, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 120, 32, 61, 32,
+    103, 101, 116, 95, 103, 108, 111, 98, 97, 108, 95, 105, 100, 40, 48, 41,
+    59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 121, 32,
+    61, 32, 103, 101, 116, 95, 103, 108, 111, 98, 97, 108, 95, 105, 100, 40,
+    49, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    108, 120, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 105,
+    100, 40, 48, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 108, 121, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108,
+    95, 105, 100, 40, 49, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 108, 120, 115, 105, 122, 101, 32, 61, 32, 103, 101, 116,
+    95, 108, 111, 99, 97, 108, 95, 115, 105, 122, 101, 40, 48, 41, 59, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 121, 115, 105,
+    122, 101, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 115,
+    105, 122, 101, 40, 49, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 98, 95, 110, 99, 111, 108, 115, 32, 61, 32, 110, 99,
+    111, 108, 115, 32, 62, 62, 32, 53, 59, 10, 10, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 99, 111, 114, 110, 101, 114, 95, 120, 32,
+    61, 32, 103, 101, 116, 95, 103, 114, 111, 117, 112, 95, 105, 100, 40, 48,
+    41, 32, 42, 32, 108, 120, 115, 105, 122, 101, 59, 10, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 99, 111, 114, 110, 101, 114, 95, 121,
+    32, 61, 32, 103, 101, 116, 95, 103, 114, 111, 117, 112, 95, 105, 100, 40,
+    49, 41, 32, 42, 32, 108, 121, 115, 105, 122, 101, 59, 10, 10, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 116, 104, 114, 101, 97, 100,
+    95, 105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40, 108, 121, 44,
+    32, 108, 120, 115, 105, 122, 101, 44, 32, 108, 120, 41, 59, 10, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 98, 95, 116, 104, 114,
+    101, 97, 100, 115, 32, 61, 32, 108, 120, 115, 105, 122, 101, 32, 42, 32,
+    108, 121, 115, 105, 122, 101, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 112, 97, 100, 100, 101, 100, 95, 110, 114, 111, 119,
+    115, 32, 61, 32, 108, 121, 115, 105, 122, 101, 59, 10, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 112, 97, 100, 100, 101, 100, 95, 110,
+    99, 111, 108, 115, 32, 61, 32, 108, 120, 115, 105, 122, 101, 32, 43, 32,
+    50, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    108, 105, 100, 120, 32, 61, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99,
+    111, 108, 115, 32, 42, 32, 108, 121, 32, 43, 32, 108, 120, 32, 43, 32,
+    49, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 105,
+    100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40, 121, 44, 32, 98, 95,
+    110, 99, 111, 108, 115, 44, 32, 120, 41, 59, 10, 32, 32, 10, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 105, 122, 101, 32, 61,
+    32, 112, 97, 100, 100, 101, 100, 95, 110, 114, 111, 119, 115, 32, 42, 32,
+    112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 59, 10, 32, 32,
+    10, 32, 32, 10, 32, 32, 47, 47, 32, 67, 111, 112, 121, 32, 115, 117,
+    98, 105, 109, 97, 103, 101, 32, 116, 111, 32, 108, 111, 99, 97, 108, 32,
+    109, 101, 109, 111, 114, 121, 10, 32, 32, 102, 111, 114, 32, 40, 105, 110,
+    116, 32, 105, 32, 61, 32, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120,
+    59, 32, 105, 32, 60, 32, 115, 105, 122, 101, 59, 32, 105, 32, 43, 61,
+    32, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 41, 10, 32, 32, 123,
+    10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 100,
+    105, 118, 32, 61, 32, 105, 32, 47, 32, 112, 97, 100, 100, 101, 100, 95,
+    110, 99, 111, 108, 115, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 114, 101, 99, 116, 95, 114, 111, 119, 32, 61, 32,
+    100, 105, 118, 32, 43, 32, 99, 111, 114, 110, 101, 114, 95, 121, 59, 10,
+    32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 114, 101,
+    99, 116, 95, 99, 111, 108, 32, 61, 32, 105, 32, 45, 32, 100, 105, 118,
+    32, 42, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 32,
+    43, 32, 99, 111, 114, 110, 101, 114, 95, 120, 32, 45, 32, 49, 59, 10,
+    10, 32, 32, 32, 32, 105, 102, 32, 40, 114, 101, 99, 116, 95, 114, 111,
+    119, 32, 60, 32, 48, 32, 124, 124, 32, 114, 101, 99, 116, 95, 114, 111,
+    119, 32, 62, 61, 32, 110, 114, 111, 119, 115, 32, 124, 124, 32, 114, 101,
+    99, 116, 95, 99, 111, 108, 32, 60, 32, 48, 32, 124, 124, 32, 114, 101,
+    99, 116, 95, 99, 111, 108, 32, 62, 61, 32, 98, 95, 110, 99, 111, 108,
+    115, 41, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 108,
+    111, 99, 97, 108, 95, 105, 109, 103, 91, 105, 93, 32, 61, 32, 48, 59,
+    10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 101, 108, 115, 101, 10,
+    32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 112, 105, 100, 120, 32, 61, 32, 109, 97, 100,
+    50, 52, 40, 114, 101, 99, 116, 95, 114, 111, 119, 44, 32, 98, 95, 110,
+    99, 111, 108, 115, 44, 32, 114, 101, 99, 116, 95, 99, 111, 108, 41, 59,
+    10, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103,
+    91, 105, 93, 32, 61, 32, 105, 110, 91, 112, 105, 100, 120, 93, 59, 10,
+    32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 32, 32, 98, 97, 114, 114,
+    105, 101, 114, 40, 67, 76, 75, 95, 76, 79, 67, 65, 76, 95, 77, 69,
+    77, 95, 70, 69, 78, 67, 69, 41, 59, 10, 32, 32, 10, 32, 32, 47,
+    47, 32, 66, 97, 105, 108, 32, 111, 117, 116, 32, 105, 102, 32, 119, 101,
+    32, 97, 114, 101, 32, 111, 117, 116, 115, 105, 100, 101, 32, 116, 104, 101,
+    32, 105, 109, 97, 103, 101, 10, 32, 32, 47, 47, 32, 84, 104, 105, 115,
+    32, 105, 115, 32, 117, 115, 101, 102, 117, 108, 32, 105, 102, 32, 119, 101,
+    32, 100, 111, 110, 39, 116, 32, 104, 97, 118, 101, 32, 97, 110, 32, 105,
+    109, 97, 103, 101, 32, 119, 105, 116, 104, 32, 112, 114, 111, 112, 101, 114,
+    32, 100, 105, 109, 101, 110, 115, 105, 111, 110, 115, 32, 97, 110, 100, 32,
+    119, 101, 10, 32, 32, 47, 47, 32, 100, 111, 110, 39, 116, 32, 119, 97,
+    110, 116, 32, 116, 111, 32, 114, 111, 117, 110, 100, 32, 116, 104, 101, 109,
+    32, 102, 111, 114, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101,
+    32, 114, 101, 97, 115, 111, 110, 115, 10, 32, 32, 105, 102, 32, 40, 120,
+    32, 62, 61, 32, 98, 95, 110, 99, 111, 108, 115, 32, 124, 124, 32, 121,
+    32, 62, 61, 32, 110, 114, 111, 119, 115, 41, 10, 32, 32, 32, 32, 114,
+    101, 116, 117, 114, 110, 59, 10, 10, 32, 32, 47, 47, 32, 67, 111, 109,
+    112, 117, 116, 101, 32, 116, 104, 101, 32, 100, 105, 108, 97, 116, 105, 111,
+    110, 10, 32, 32, 123, 10, 32, 32, 32, 32, 105, 110, 116, 32, 97, 99,
+    99, 32, 61, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 108, 105,
+    100, 120, 93, 59, 10, 32, 32, 32, 32, 102, 111, 114, 32, 40, 105, 110,
+    116, 32, 105, 32, 61, 32, 49, 59, 32, 105, 32, 60, 61, 32, 115, 101,
+    95, 99, 111, 108, 114, 97, 100, 59, 32, 43, 43, 105, 41, 10, 32, 32,
+    32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 97, 99, 99, 32, 124, 61,
+    32, 40, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 108, 105, 100, 120,
+    93, 32, 62, 62, 32, 105, 41, 32, 124, 32, 40, 108, 111, 99, 97, 108,
+    95, 105, 109, 103, 91, 108, 105, 100, 120, 32, 45, 32, 49, 93, 32, 60,
+    60, 32, 40, 51, 50, 45, 105, 41, 41, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 124, 32, 32, 40, 108, 111, 99, 97, 108, 95, 105, 109,
+    103, 91, 108, 105, 100, 120, 93, 32, 60, 60, 32, 105, 41, 32, 124, 32,
+    40, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 108, 105, 100, 120, 32,
+    43, 32, 49, 93, 32, 62, 62, 32, 40, 51, 50, 45, 105, 41, 41, 59,
+    10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 111, 117, 116, 91, 105,
+    100, 120, 93, 32, 61, 32, 97, 99, 99, 59, 10, 32, 32, 125, 10, 125,
+    10, 10, 107, 101, 114, 110, 101, 108, 32, 118, 111, 105, 100, 32, 98, 105,
+    116, 109, 97, 112, 112, 101, 100, 95, 100, 105, 108, 97, 116, 105, 111, 110,
+    95, 118, 40, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 42, 32, 105, 110, 44, 32, 103, 108, 111, 98, 97, 108,
+    32, 105, 110, 116, 32, 42, 32, 111, 117, 116, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 110, 114, 111, 119, 115, 44, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 110, 99, 111, 108, 115, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 101, 95, 114, 111, 119,
+    114, 97, 100, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 32, 117, 105, 110, 116,
+    32, 42, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 41, 10, 123, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 120, 32, 61, 32,
+    103, 101, 116, 95, 103, 108, 111, 98, 97, 108, 95, 105, 100, 40, 48, 41,
+    59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 121, 32,
+    61, 32, 103, 101, 116, 95, 103, 108, 111, 98, 97, 108, 95, 105, 100, 40,
+    49, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    108, 120, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 105,
+    100, 40, 48, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 108, 121, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108,
+    95, 105, 100, 40, 49, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 108, 120, 115, 105, 122, 101, 32, 61, 32, 103, 101, 116,
+    95, 108, 111, 99, 97, 108, 95, 115, 105, 122, 101, 40, 48, 41, 59, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 121, 115, 105,
+    122, 101, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 115,
+    105, 122, 101, 40, 49, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 98, 95, 110, 99, 111, 108, 115, 32, 61, 32, 110, 99,
+    111, 108, 115, 32, 62, 62, 32, 53, 59, 10, 10, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 99, 111, 114, 110, 101, 114, 95, 120, 32,
+    61, 32, 103, 101, 116, 95, 103, 114, 111, 117, 112, 95, 105, 100, 40, 48,
+    41, 32, 42, 32, 108, 120, 115, 105, 122, 101, 59, 10, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 99, 111, 114, 110, 101, 114, 95, 121,
+    32, 61, 32, 103, 101, 116, 95, 103, 114, 111, 117, 112, 95, 105, 100, 40,
+    49, 41, 32, 42, 32, 108, 121, 115, 105, 122, 101, 59, 10, 10, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 116, 104, 114, 101, 97, 100,
+    95, 105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40, 108, 121, 44,
+    32, 108, 120, 115, 105, 122, 101, 44, 32, 108, 120, 41, 59, 10, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 98, 95, 116, 104, 114,
+    101, 97, 100, 115, 32, 61, 32, 108, 120, 115, 105, 122, 101, 32, 42, 32,
+    108, 121, 115, 105, 122, 101, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 112, 97, 100, 100, 101, 100, 95, 110, 114, 111, 119,
+    115, 32, 61, 32, 108, 121, 115, 105, 122, 101, 32, 43, 32, 115, 101, 95,
+    114, 111, 119, 114, 97, 100, 32, 42, 32, 50, 59, 10, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 112, 97, 100, 100, 101, 100, 95, 110,
+    99, 111, 108, 115, 32, 61, 32, 108, 120, 115, 105, 122, 101, 59, 10, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 105, 100, 120,
+    32, 61, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 32,
+    42, 32, 40, 108, 121, 32, 43, 32, 115, 101, 95, 114, 111, 119, 114, 97,
+    100, 41, 32, 43, 32, 108, 120, 59, 10, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52,
+    40, 121, 44, 32, 98, 95, 110, 99, 111, 108, 115, 44, 32, 120, 41, 59,
+    10, 32, 32, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    115, 105, 122, 101, 32, 61, 32, 112, 97, 100, 100, 101, 100, 95, 110, 114,
+    111, 119, 115, 32, 42, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111,
+    108, 115, 59, 10, 32, 32, 47, 47, 32, 67, 111, 112, 121, 32, 115, 117,
+    98, 105, 109, 97, 103, 101, 32, 116, 111, 32, 108, 111, 99, 97, 108, 32,
+    109, 101, 109, 111, 114, 121, 10, 32, 32, 102, 111, 114, 32, 40, 105, 110,
+    116, 32, 105, 32, 61, 32, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120,
+    59, 32, 105, 32, 60, 32, 115, 105, 122, 101, 59, 32, 105, 32, 43, 61,
+    32, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 41, 10, 32, 32, 123,
+    10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 100,
+    105, 118, 32, 61, 32, 105, 32, 47, 32, 112, 97, 100, 100, 101, 100, 95,
+    110, 99, 111, 108, 115, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 114, 101, 99, 116, 95, 114, 111, 119, 32, 61, 32,
+    100, 105, 118, 32, 43, 32, 99, 111, 114, 110, 101, 114, 95, 121, 32, 45,
+    32, 115, 101, 95, 114, 111, 119, 114, 97, 100, 59, 10, 32, 32, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 114, 101, 99, 116, 95, 99,
+    111, 108, 32, 61, 32, 105, 32, 45, 32, 100, 105, 118, 32, 42, 32, 112,
+    97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 32, 43, 32, 99, 111,
+    114, 110, 101, 114, 95, 120, 59, 10, 10, 32, 32, 32, 32, 105, 102, 32,
+    40, 114, 101, 99, 116, 95, 114, 111, 119, 32, 60, 32, 48, 32, 124, 124,
+    32, 114, 101, 99, 116, 95, 114, 111, 119, 32, 62, 61, 32, 110, 114, 111,
+    119, 115, 32, 124, 124, 32, 114, 101, 99, 116, 95, 99, 111, 108, 32, 60,
+    32, 48, 32, 124, 124, 32, 114, 101, 99, 116, 95, 99, 111, 108, 32, 62,
+    61, 32, 98, 95, 110, 99, 111, 108, 115, 41, 10, 32, 32, 32, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103,
+    91, 105, 93, 32, 61, 32, 48, 59, 10, 32, 32, 32, 32, 125, 10, 32,
+    32, 32, 32, 101, 108, 115, 101, 10, 32, 32, 32, 32, 123, 10, 32, 32,
+    32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 112, 105,
+    100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40, 114, 101, 99, 116, 95,
+    114, 111, 119, 44, 32, 98, 95, 110, 99, 111, 108, 115, 44, 32, 114, 101,
+    99, 116, 95, 99, 111, 108, 41, 59, 10, 32, 32, 32, 32, 32, 32, 108,
+    111, 99, 97, 108, 95, 105, 109, 103, 91, 105, 93, 32, 61, 32, 105, 110,
+    91, 112, 105, 100, 120, 93, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32,
+    125, 10, 32, 32, 98, 97, 114, 114, 105, 101, 114, 40, 67, 76, 75, 95,
+    76, 79, 67, 65, 76, 95, 77, 69, 77, 95, 70, 69, 78, 67, 69, 41,
+    59, 10, 32, 32, 10, 32, 32, 47, 47, 32, 66, 97, 105, 108, 32, 111,
+    117, 116, 32, 105, 102, 32, 119, 101, 32, 97, 114, 101, 32, 111, 117, 116,
+    115, 105, 100, 101, 32, 116, 104, 101, 32, 105, 109, 97, 103, 101, 10, 32,
+    32, 47, 47, 32, 84, 104, 105, 115, 32, 105, 115, 32, 117, 115, 101, 102,
+    117, 108, 32, 105, 102, 32, 119, 101, 32, 100, 111, 110, 39, 116, 32, 104,
+    97, 118, 101, 32, 97, 110, 32, 105, 109, 97, 103, 101, 32, 119, 105, 116,
+    104, 32, 112, 114, 111, 112, 101, 114, 32, 100, 105, 109, 101, 110, 115, 105,
+    111, 110, 115, 32, 97, 110, 100, 32, 119, 101, 10, 32, 32, 47, 47, 32,
+    100, 111, 110, 39, 116, 32, 119, 97, 110, 116, 32, 116, 111, 32, 114, 111,
+    117, 110, 100, 32, 116, 104, 101, 109, 32, 102, 111, 114, 32, 112, 101, 114,
+    102, 111, 114, 109, 97, 110, 99, 101, 32, 114, 101, 97, 115, 111, 110, 115,
+    10, 32, 32, 105, 102, 32, 40, 120, 32, 62, 61, 32, 98, 95, 110, 99,
+    111, 108, 115, 32, 124, 124, 32, 121, 32, 62, 61, 32, 110, 114, 111, 119,
+    115, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 59, 10, 10,
+    32, 32, 47, 47, 32, 67, 111, 109, 112, 117, 116, 101, 32, 116, 104, 101,
+    32, 100, 105, 108, 97, 116, 105, 111, 110, 10, 32, 32, 123, 10, 32, 32,
+    32, 32, 105, 110, 116, 32, 115, 108, 105, 100, 120, 32, 61, 32, 109, 97,
+    100, 50, 52, 40, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115,
+    44, 32, 45, 115, 101, 95, 114, 111, 119, 114, 97, 100, 44, 32, 108, 105,
+    100, 120, 41, 59, 10, 32, 32, 32, 32, 105, 110, 116, 32, 97, 99, 99,
+    32, 61, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 108, 105, 100,
+    120, 93, 59, 10, 32, 32, 32, 32, 102, 111, 114, 32, 40, 105, 110, 116,
+    32, 114, 32, 61, 32, 45, 115, 101, 95, 114, 111, 119, 114, 97, 100, 59,
+    32, 114, 32, 60, 61, 32, 115, 101, 95, 114, 111, 119, 114, 97, 100, 59,
+    32, 43, 43, 114, 41, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 97, 99, 99, 32, 124, 61, 32, 108, 111, 99, 97, 108, 95, 105,
+    109, 103, 91, 115, 108, 105, 100, 120, 93, 59, 10, 32, 32, 32, 32, 32,
+    32, 115, 108, 105, 100, 120, 32, 43, 61, 32, 112, 97, 100, 100, 101, 100,
+    95, 110, 99, 111, 108, 115, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32,
+    32, 32, 47, 47, 32, 83, 97, 118, 101, 32, 116, 104, 101, 32, 114, 101,
+    115, 117, 108, 116, 115, 10, 32, 32, 32, 32, 111, 117, 116, 91, 105, 100,
+    120, 93, 32, 61, 32, 97, 99, 99, 59, 32, 32, 32, 32, 10, 32, 32,
+    125, 10, 125, 10, 10, 107, 101, 114, 110, 101, 108, 32, 118, 111, 105, 100,
+    32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 101, 114, 111, 115, 105,
+    111, 110, 95, 104, 40, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 42, 32, 105, 110, 44, 32, 103, 108, 111, 98,
+    97, 108, 32, 105, 110, 116, 32, 42, 32, 111, 117, 116, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 110, 114, 111, 119, 115, 44, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 99, 111, 108, 115, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 101, 95, 99, 111, 108,
+    114, 97, 100, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 32, 117, 105, 110, 116, 32,
+    42, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 41, 10, 123, 10, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 120, 32, 61, 32, 103,
+    101, 116, 95, 103, 108, 111, 98, 97, 108, 95, 105, 100, 40, 48, 41, 59,
+    10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 121, 32, 61,
+    32, 103, 101, 116, 95, 103, 108, 111, 98, 97, 108, 95, 105, 100, 40, 49,
+    41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108,
+    120, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 105, 100,
+    40, 48, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 108, 121, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95,
+    105, 100, 40, 49, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 108, 120, 115, 105, 122, 101, 32, 61, 32, 103, 101, 116, 95,
+    108, 111, 99, 97, 108, 95, 115, 105, 122, 101, 40, 48, 41, 59, 10, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 121, 115, 105, 122,
+    101, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 115, 105,
+    122, 101, 40, 49, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 98, 95, 110, 99, 111, 108, 115, 32, 61, 32, 110, 99, 111,
+    108, 115, 32, 62, 62, 32, 53, 59, 10, 10, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 99, 111, 114, 110, 101, 114, 95, 120, 32, 61,
+    32, 103, 101, 116, 95, 103, 114, 111, 117, 112, 95, 105, 100, 40, 48, 41,
+    32, 42, 32, 108, 120, 115, 105, 122, 101, 59, 10, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 99, 111, 114, 110, 101, 114, 95, 121, 32,
+    61, 32, 103, 101, 116, 95, 103, 114, 111, 117, 112, 95, 105, 100, 40, 49,
+    41, 32, 42, 32, 108, 121, 115, 105, 122, 101, 59, 10, 10, 32, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 116, 104, 114, 101, 97, 100, 95,
+    105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40, 108, 121, 44, 32,
+    108, 120, 115, 105, 122, 101, 44, 32, 108, 120, 41, 59, 10, 32, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 98, 95, 116, 104, 114, 101,
+    97, 100, 115, 32, 61, 32, 108, 120, 115, 105, 122, 101, 32, 42, 32, 108,
+    121, 115, 105, 122, 101, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 112, 97, 100, 100, 101, 100, 95, 110, 114, 111, 119, 115,
+    32, 61, 32, 108, 121, 115, 105, 122, 101, 59, 10, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99,
+    111, 108, 115, 32, 61, 32, 108, 120, 115, 105, 122, 101, 32, 43, 32, 50,
+    59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108,
+    105, 100, 120, 32, 61, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111,
+    108, 115, 32, 42, 32, 108, 121, 32, 43, 32, 108, 120, 32, 43, 32, 49,
+    59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 105, 100,
+    120, 32, 61, 32, 109, 97, 100, 50, 52, 40, 121, 44, 32, 98, 95, 110,
+    99, 111, 108, 115, 44, 32, 120, 41, 59, 10, 32, 32, 10, 32, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 105, 122, 101, 32, 61, 32,
+    112, 97, 100, 100, 101, 100, 95, 110, 114, 111, 119, 115, 32, 42, 32, 112,
+    97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 59, 10, 32, 32, 10,
+    32, 32, 10, 32, 32, 47, 47, 32, 67, 111, 112, 121, 32, 115, 117, 98,
+    105, 109, 97, 103, 101, 32, 116, 111, 32, 108, 111, 99, 97, 108, 32, 109,
+    101, 109, 111, 114, 121, 10, 32, 32, 102, 111, 114, 32, 40, 105, 110, 116,
+    32, 105, 32, 61, 32, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 59,
+    32, 105, 32, 60, 32, 115, 105, 122, 101, 59, 32, 105, 32, 43, 61, 32,
+    110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 41, 10, 32, 32, 123, 10,
+    32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 100, 105,
+    118, 32, 61, 32, 105, 32, 47, 32, 112, 97, 100, 100, 101, 100, 95, 110,
+    99, 111, 108, 115, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 114, 101, 99, 116, 95, 114, 111, 119, 32, 61, 32, 100,
+    105, 118, 32, 43, 32, 99, 111, 114, 110, 101, 114, 95, 121, 59, 10, 32,
+    32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 114, 101, 99,
+    116, 95, 99, 111, 108, 32, 61, 32, 105, 32, 45, 32, 100, 105, 118, 32,
+    42, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 32, 43,
+    32, 99, 111, 114, 110, 101, 114, 95, 120, 32, 45, 32, 49, 59, 10, 10,
+    32, 32, 32, 32, 105, 102, 32, 40, 114, 101, 99, 116, 95, 114, 111, 119,
+    32, 60, 32, 48, 32, 124, 124, 32, 114, 101, 99, 116, 95, 114, 111, 119,
+    32, 62, 61, 32, 110, 114, 111, 119, 115, 32, 124, 124, 32, 114, 101, 99,
+    116, 95, 99, 111, 108, 32, 60, 32, 48, 32, 124, 124, 32, 114, 101, 99,
+    116, 95, 99, 111, 108, 32, 62, 61, 32, 98, 95, 110, 99, 111, 108, 115,
+    41, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 108, 111,
+    99, 97, 108, 95, 105, 109, 103, 91, 105, 93, 32, 61, 32, 48, 59, 10,
+    32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 101, 108, 115, 101, 10, 32,
+    32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 112, 105, 100, 120, 32, 61, 32, 109, 97, 100, 50,
+    52, 40, 114, 101, 99, 116, 95, 114, 111, 119, 44, 32, 98, 95, 110, 99,
+    111, 108, 115, 44, 32, 114, 101, 99, 116, 95, 99, 111, 108, 41, 59, 10,
+    32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91,
+    105, 93, 32, 61, 32, 105, 110, 91, 112, 105, 100, 120, 93, 59, 10, 32,
+    32, 32, 32, 125, 10, 32, 32, 125, 10, 32, 32, 98, 97, 114, 114, 105,
+    101, 114, 40, 67, 76, 75, 95, 76, 79, 67, 65, 76, 95, 77, 69, 77,
+    95, 70, 69, 78, 67, 69, 41, 59, 10, 32, 32, 10, 32, 32, 47, 47,
+    32, 66, 97, 105, 108, 32, 111, 117, 116, 32, 105, 102, 32, 119, 101, 32,
+    97, 114, 101, 32, 111, 117, 116, 115, 105, 100, 101, 32, 116, 104, 101, 32,
+    105, 109, 97, 103, 101, 10, 32, 32, 47, 47, 32, 84, 104, 105, 115, 32,
+    105, 115, 32, 117, 115, 101, 102, 117, 108, 32, 105, 102, 32, 119, 101, 32,
+    100, 111, 110, 39, 116, 32, 104, 97, 118, 101, 32, 97, 110, 32, 105, 109,
+    97, 103, 101, 32, 119, 105, 116, 104, 32, 112, 114, 111, 112, 101, 114, 32,
+    100, 105, 109, 101, 110, 115, 105, 111, 110, 115, 32, 97, 110, 100, 32, 119,
+    101, 10, 32, 32, 47, 47, 32, 100, 111, 110, 39, 116, 32, 119, 97, 110,
+    116, 32, 116, 111, 32, 114, 111, 117, 110, 100, 32, 116, 104, 101, 109, 32,
+    102, 111, 114, 32, 112, 101, 114, 102, 111, 114, 109, 97, 110, 99, 101, 32,
+    114, 101, 97, 115, 111, 110, 115, 10, 32, 32, 105, 102, 32, 40, 120, 32,
+    62, 61, 32, 98, 95, 110, 99, 111, 108, 115, 32, 124, 124, 32, 121, 32,
+    62, 61, 32, 110, 114, 111, 119, 115, 41, 10, 32, 32, 32, 32, 114, 101,
+    116, 117, 114, 110, 59, 10, 10, 32, 32, 47, 47, 32, 67, 111, 109, 112,
+    117, 116, 101, 32, 116, 104, 101, 32, 101, 114, 111, 115, 105, 111, 110, 10,
+    32, 32, 123, 10, 32, 32, 32, 32, 105, 110, 116, 32, 97, 99, 99, 32,
+    61, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 108, 105, 100, 120,
+    93, 59, 10, 32, 32, 32, 32, 102, 111, 114, 32, 40, 105, 110, 116, 32,
+    105, 32, 61, 32, 49, 59, 32, 105, 32, 60, 61, 32, 115, 101, 95, 99,
+    111, 108, 114, 97, 100, 59, 32, 43, 43, 105, 41, 10, 32, 32, 32, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 97, 99, 99, 32, 38, 61, 32, 40,
+    40, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 108, 105, 100, 120, 93,
+    32, 62, 62, 32, 105, 41, 32, 124, 32, 40, 108, 111, 99, 97, 108, 95,
+    105, 109, 103, 91, 108, 105, 100, 120, 32, 45, 32, 49, 93, 32, 60, 60,
+    32, 40, 51, 50, 45, 105, 41, 41, 41, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 38, 32, 32, 40, 40, 108, 111, 99, 97, 108, 95, 105,
+    109, 103, 91, 108, 105, 100, 120, 93, 32, 60, 60, 32, 105, 41, 32, 124,
+    32, 40, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 108, 105, 100, 120,
+    32, 43, 32, 49, 93, 32, 62, 62, 32, 40, 51, 50, 45, 105, 41, 41,
+    41, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 111, 117, 116,
+    91, 105, 100, 120, 93, 32, 61, 32, 97, 99, 99, 59, 10, 32, 32, 125,
+    10, 125, 10, 10, 107, 101, 114, 110, 101, 108, 32, 118, 111, 105, 100, 32,
+    98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 101, 114, 111, 115, 105, 111,
+    110, 95, 118, 40, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 42, 32, 105, 110, 44, 32, 103, 108, 111, 98, 97,
+    108, 32, 105, 110, 116, 32, 42, 32, 111, 117, 116, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 110, 114, 111, 119, 115, 44, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 110, 99, 111, 108, 115, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 101, 95, 114, 111, 119, 114,
+    97, 100, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 108, 111, 99, 97, 108, 32, 117, 105, 110, 116, 32, 42,
+    32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 41, 10, 123, 10, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 120, 32, 61, 32, 103, 101,
+    116, 95, 103, 108, 111, 98, 97, 108, 95, 105, 100, 40, 48, 41, 59, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 121, 32, 61, 32,
+    103, 101, 116, 95, 103, 108, 111, 98, 97, 108, 95, 105, 100, 40, 49, 41,
+    59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 120,
+    32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 105, 100, 40,
+    48, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    108, 121, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 105,
+    100, 40, 49, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 108, 120, 115, 105, 122, 101, 32, 61, 32, 103, 101, 116, 95, 108,
+    111, 99, 97, 108, 95, 115, 105, 122, 101, 40, 48, 41, 59, 10, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 121, 115, 105, 122, 101,
+    32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 115, 105, 122,
+    101, 40, 49, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 98, 95, 110, 99, 111, 108, 115, 32, 61, 32, 110, 99, 111, 108,
+    115, 32, 62, 62, 32, 53, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 99, 111, 114, 110, 101, 114, 95, 120, 32, 61, 32,
+    103, 101, 116, 95, 103, 114, 111, 117, 112, 95, 105, 100, 40, 48, 41, 32,
+    42, 32, 108, 120, 115, 105, 122, 101, 59, 10, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 99, 111, 114, 110, 101, 114, 95, 121, 32, 61,
+    32, 103, 101, 116, 95, 103, 114, 111, 117, 112, 95, 105, 100, 40, 49, 41,
+    32, 42, 32, 108, 121, 115, 105, 122, 101, 59, 10, 10, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 116, 104, 114, 101, 97, 100, 95, 105,
+    100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40, 108, 121, 44, 32, 108,
+    120, 115, 105, 122, 101, 44, 32, 108, 120, 41, 59, 10, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 110, 98, 95, 116, 104, 114, 101, 97,
+    100, 115, 32, 61, 32, 108, 120, 115, 105, 122, 101, 32, 42, 32, 108, 121,
+    115, 105, 122, 101, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 112, 97, 100, 100, 101, 100, 95, 110, 114, 111, 119, 115, 32,
+    61, 32, 108, 121, 115, 105, 122, 101, 32, 43, 32, 115, 101, 95, 114, 111,
+    119, 114, 97, 100, 32, 42, 32, 50, 59, 10, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111,
+    108, 115, 32, 61, 32, 108, 120, 115, 105, 122, 101, 59, 10, 10, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 105, 100, 120, 32, 61,
+    32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 32, 42, 32,
+    40, 108, 121, 32, 43, 32, 115, 101, 95, 114, 111, 119, 114, 97, 100, 41,
+    32, 43, 32, 108, 120, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40, 121,
+    44, 32, 98, 95, 110, 99, 111, 108, 115, 44, 32, 120, 41, 59, 10, 32,
+    32, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 105,
+    122, 101, 32, 61, 32, 112, 97, 100, 100, 101, 100, 95, 110, 114, 111, 119,
+    115, 32, 42, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115,
+    59, 10, 32, 32, 47, 47, 32, 67, 111, 112, 121, 32, 115, 117, 98, 105,
+    109, 97, 103, 101, 32, 116, 111, 32, 108, 111, 99, 97, 108, 32, 109, 101,
+    109, 111, 114, 121, 10, 32, 32, 102, 111, 114, 32, 40, 105, 110, 116, 32,
+    105, 32, 61, 32, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 59, 32,
+    105, 32, 60, 32, 115, 105, 122, 101, 59, 32, 105, 32, 43, 61, 32, 110,
+    98, 95, 116, 104, 114, 101, 97, 100, 115, 41, 10, 32, 32, 123, 10, 32,
+    32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 100, 105, 118,
+    32, 61, 32, 105, 32, 47, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99,
+    111, 108, 115, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 114, 101, 99, 116, 95, 114, 111, 119, 32, 61, 32, 100, 105,
+    118, 32, 43, 32, 99, 111, 114, 110, 101, 114, 95, 121, 32, 45, 32, 115,
+    101, 95, 114, 111, 119, 114, 97, 100, 59, 10, 32, 32, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 114, 101, 99, 116, 95, 99, 111, 108,
+    32, 61, 32, 105, 32, 45, 32, 100, 105, 118, 32, 42, 32, 112, 97, 100,
+    100, 101, 100, 95, 110, 99, 111, 108, 115, 32, 43, 32, 99, 111, 114, 110,
+    101, 114, 95, 120, 59, 10, 10, 32, 32, 32, 32, 105, 102, 32, 40, 114,
+    101, 99, 116, 95, 114, 111, 119, 32, 60, 32, 48, 32, 124, 124, 32, 114,
+    101, 99, 116, 95, 114, 111, 119, 32, 62, 61, 32, 110, 114, 111, 119, 115,
+    32, 124, 124, 32, 114, 101, 99, 116, 95, 99, 111, 108, 32, 60, 32, 48,
+    32, 124, 124, 32, 114, 101, 99, 116, 95, 99, 111, 108, 32, 62, 61, 32,
+    98, 95, 110, 99, 111, 108, 115, 41, 10, 32, 32, 32, 32, 123, 10, 32,
+    32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 105,
+    93, 32, 61, 32, 48, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32,
+    32, 101, 108, 115, 101, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 112, 105, 100, 120,
+    32, 61, 32, 109, 97, 100, 50, 52, 40, 114, 101, 99, 116, 95, 114, 111,
+    119, 44, 32, 98, 95, 110, 99, 111, 108, 115, 44, 32, 114, 101, 99, 116,
+    95, 99, 111, 108, 41, 59, 10, 32, 32, 32, 32, 32, 32, 108, 111, 99,
+    97, 108, 95, 105, 109, 103, 91, 105, 93, 32, 61, 32, 105, 110, 91, 112,
+    105, 100, 120, 93, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10,
+    32, 32, 98, 97, 114, 114, 105, 101, 114, 40, 67, 76, 75, 95, 76, 79,
+    67, 65, 76, 95, 77, 69, 77, 95, 70, 69, 78, 67, 69, 41, 59, 10,
+    32, 32, 10, 32, 32, 47, 47, 32, 66, 97, 105, 108, 32, 111, 117, 116,
+    32, 105, 102, 32, 119, 101, 32, 97, 114, 101, 32, 111, 117, 116, 115, 105,
+    100, 101, 32, 116, 104, 101, 32, 105, 109, 97, 103, 101, 10, 32, 32, 47,
+    47, 32, 84, 104, 105, 115, 32, 105, 115, 32, 117, 115, 101, 102, 117, 108,
+    32, 105, 102, 32, 119, 101, 32, 100, 111, 110, 39, 116, 32, 104, 97, 118,
+    101, 32, 97, 110, 32, 105, 109, 97, 103, 101, 32, 119, 105, 116, 104, 32,
+    112, 114, 111, 112, 101, 114, 32, 100, 105, 109, 101, 110, 115, 105, 111, 110,
+    115, 32, 97, 110, 100, 32, 119, 101, 10, 32, 32, 47, 47, 32, 100, 111,
+    110, 39, 116, 32, 119, 97, 110, 116, 32, 116, 111, 32, 114, 111, 117, 110,
+    100, 32, 116, 104, 101, 109, 32, 102, 111, 114, 32, 112, 101, 114, 102, 111,
+    114, 109, 97, 110, 99, 101, 32, 114, 101, 97, 115, 111, 110, 115, 10, 32,
+    32, 105, 102, 32, 40, 120, 32, 62, 61, 32, 98, 95, 110, 99, 111, 108,
+    115, 32, 124, 124, 32, 121, 32, 62, 61, 32, 110, 114, 111, 119, 115, 41,
+    10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 59, 10, 10, 32, 32,
+    47, 47, 32, 67, 111, 109, 112, 117, 116, 101, 32, 116, 104, 101, 32, 101,
+    114, 111, 115, 105, 111, 110, 10, 32, 32, 123, 10, 32, 32, 32, 32, 105,
+    110, 116, 32, 115, 108, 105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52,
+    40, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 44, 32, 45,
+    115, 101, 95, 114, 111, 119, 114, 97, 100, 44, 32, 108, 105, 100, 120, 41,
+    59, 10, 32, 32, 32, 32, 105, 110, 116, 32, 97, 99, 99, 32, 61, 32,
+    108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 108, 105, 100, 120, 93, 59,
+    10, 32, 32, 32, 32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 114, 32,
+    61, 32, 45, 115, 101, 95, 114, 111, 119, 114, 97, 100, 59, 32, 114, 32,
+    60, 61, 32, 115, 101, 95, 114, 111, 119, 114, 97, 100, 59, 32, 43, 43,
+    114, 41, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 97,
+    99, 99, 32, 38, 61, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91,
+    115, 108, 105, 100, 120, 93, 59, 10, 32, 32, 32, 32, 32, 32, 115, 108,
+    105, 100, 120, 32, 43, 61, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99,
+    111, 108, 115, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 47,
+    47, 32, 83, 97, 118, 101, 32, 116, 104, 101, 32, 114, 101, 115, 117, 108,
+    116, 115, 10, 32, 32, 32, 32, 111, 117, 116, 91, 105, 100, 120, 93, 32,
+    61, 32, 97, 99, 99, 59, 32, 32, 32, 32, 10, 32, 32, 125, 10, 125,
+    10, 35, 101, 110, 100, 105, 102, 10, 10, 35, 105, 102, 100, 101, 102, 32,
+    67, 76, 67, 86, 95, 83, 69, 67, 84, 73, 79, 78, 95, 86, 72, 71,
+    87, 10, 47, 47, 32, 77, 77, 32, 98, 105, 116, 109, 97, 112, 112, 101,
+    100, 32, 111, 112, 101, 114, 97, 116, 111, 114, 115, 32, 102, 111, 114, 32,
+    108, 97, 114, 103, 101, 32, 114, 97, 100, 105, 105, 32, 40, 118, 97, 110,
+    32, 72, 101, 114, 107, 47, 71, 105, 108, 45, 87, 101, 114, 109, 97, 110,
+    41, 10, 47, 47, 32, 84, 104, 101, 32, 108, 105, 110, 101, 32, 105, 115,
+    32, 115, 112, 108, 105, 116, 32, 105, 110, 116, 111, 32, 98, 108, 111, 99,
+    107, 115, 32, 111, 102, 32, 107, 32, 61, 32, 50, 42, 114, 97, 100, 43,
+    49, 32, 101, 108, 101, 109, 101, 110, 116, 115, 46, 32, 70, 111, 114, 32,
+    101, 97, 99, 104, 32, 98, 108, 111, 99, 107, 32, 119, 101, 10, 47, 47,
+    32, 99, 111, 109, 112, 117, 116, 101, 32, 116, 104, 101, 32, 112, 114, 101,
+    102, 105, 120, 32, 40, 103, 41, 32, 97, 110, 100, 32, 115, 117, 102, 102,
+    105, 120, 32, 40, 104, 41, 32, 79, 82, 47, 65, 78, 68, 44, 32, 97,
+    110, 100, 32, 116, 104, 101, 32, 114, 101, 115, 117, 108, 116, 32, 102, 111,
+    114, 32, 116, 104, 101, 32, 119, 105, 110, 100, 111, 119, 10, 47, 47, 32,
+    91, 105, 45, 114, 97, 100, 44, 32, 105, 43, 114, 97, 100, 93, 32, 105,
+    115, 32, 116, 104, 101, 110, 32, 104, 91, 105, 45, 114, 97, 100, 93, 32,
+    111, 112, 32, 103, 91, 105, 43, 114, 97, 100, 93, 46, 32, 84, 104, 101,
+    32, 99, 111, 115, 116, 32, 112, 101, 114, 32, 119, 111, 114, 100, 32, 105,
+    115, 32, 116, 104, 101, 114, 101, 102, 111, 114, 101, 10, 47, 47, 32, 116,
+    104, 101, 32, 115, 97, 109, 101, 32, 119, 104, 97, 116, 101, 118, 101, 114,
+    32, 116, 104, 101, 32, 114, 97, 100, 105, 117, 115, 46, 10, 10, 47, 47,
+    32, 80, 105, 120, 101, 108, 115, 32, 108, 111, 99, 97, 116, 101, 100, 32,
+    105, 32, 99, 111, 108, 117, 109, 110, 115, 32, 116, 111, 32, 116, 104, 101,
+    32, 108, 101, 102, 116, 32, 111, 102, 32, 116, 104, 101, 32, 112, 105, 120,
+    101, 108, 115, 32, 111, 102, 32, 119, 91, 48, 93, 32, 40, 49, 32, 60,
+    61, 32, 105, 32, 60, 32, 54, 52, 41, 10, 117, 105, 110, 116, 32, 98,
+    105, 116, 109, 97, 112, 112, 101, 100, 95, 112, 117, 108, 108, 95, 108, 101,
+    102, 116, 40, 108, 111, 99, 97, 108, 32, 99, 111, 110, 115, 116, 32, 117,
+    105, 110, 116, 32, 42, 32, 119, 44, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 105, 41, 10, 123, 10, 32, 32, 105, 102, 32, 40, 105, 32,
+    60, 32, 51, 50, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110,
+    32, 40, 119, 91, 48, 93, 32, 62, 62, 32, 105, 41, 32, 124, 32, 40,
+    119, 91, 45, 49, 93, 32, 60, 60, 32, 40, 51, 50, 45, 105, 41, 41,
+    59, 10, 32, 32, 105, 102, 32, 40, 105, 32, 61, 61, 32, 51, 50, 41,
+    10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 119, 91, 45, 49,
+    93, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 40, 119, 91, 45,
+    49, 93, 32, 62, 62, 32, 40, 105, 45, 51, 50, 41, 41, 32, 124, 32,
+    40, 119, 91, 45, 50, 93, 32, 60, 60, 32, 40, 54, 52, 45, 105, 41,
+    41, 59, 10, 125, 10, 10, 47, 47, 32, 80, 105, 120, 101, 108, 115, 32,
+    108, 111, 99, 97, 116, 101, 100, 32, 105, 32, 99, 111, 108, 117, 109, 110,
+    115, 32, 116, 111, 32, 116, 104, 101, 32, 114, 105, 103, 104, 116, 32, 111,
+    102, 32, 116, 104, 101, 32, 112, 105, 120, 101, 108, 115, 32, 111, 102, 32,
+    119, 91, 48, 93, 32, 40, 49, 32, 60, 61, 32, 105, 32, 60, 32, 54,
+    52, 41, 10, 117, 105, 110, 116, 32, 98, 105, 116, 109, 97, 112, 112, 101,
+    100, 95, 112, 117, 108, 108, 95, 114, 105, 103, 104, 116, 40, 108, 111, 99,
+    97, 108, 32, 99, 111, 110, 115, 116, 32, 117, 105, 110, 116, 32, 42, 32,
+    119, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 105, 41, 10,
+    123, 10, 32, 32, 105, 102, 32, 40, 105, 32, 60, 32, 51, 50, 41, 10,
+    32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 40, 119, 91, 48, 93,
+    32, 60, 60, 32, 105, 41, 32, 124, 32, 40, 119, 91, 49, 93, 32, 62,
+    62, 32, 40, 51, 50, 45, 105, 41, 41, 59, 10, 32, 32, 105, 102, 32,
+    40, 105, 32, 61, 61, 32, 51, 50, 41, 10, 32, 32, 32, 32, 114, 101,
+    116, 117, 114, 110, 32, 119, 91, 49, 93, 59, 10, 32, 32, 114, 101, 116,
+    117, 114, 110, 32, 40, 119, 91, 49, 93, 32, 60, 60, 32, 40, 105, 45,
+    51, 50, 41, 41, 32, 124, 32, 40, 119, 91, 50, 93, 32, 62, 62, 32,
+    40, 54, 52, 45, 105, 41, 41, 59, 10, 125, 10, 10, 47, 47, 32, 72,
+    111, 114, 105, 122, 111, 110, 116, 97, 108, 32, 118, 97, 110, 32, 72, 101,
+    114, 107, 47, 71, 105, 108, 45, 87, 101, 114, 109, 97, 110, 46, 32, 84,
+    104, 101, 32, 114, 97, 100, 105, 117, 115, 32, 105, 115, 32, 100, 101, 99,
+    111, 109, 112, 111, 115, 101, 100, 32, 97, 115, 10, 47, 47, 32, 115, 101,
+    95, 99, 111, 108, 114, 97, 100, 32, 61, 32, 51, 50, 32, 42, 32, 115,
+    101, 95, 119, 111, 114, 100, 114, 97, 100, 32, 43, 32, 115, 101, 95, 98,
+    105, 116, 114, 97, 100, 32, 119, 105, 116, 104, 32, 49, 54, 32, 60, 61,
+    32, 115, 101, 95, 98, 105, 116, 114, 97, 100, 32, 60, 32, 52, 56, 44,
+    32, 105, 46, 101, 46, 10, 47, 47, 32, 91, 45, 115, 101, 95, 99, 111,
+    108, 114, 97, 100, 44, 32, 115, 101, 95, 99, 111, 108, 114, 97, 100, 93,
+    32, 61, 32, 51, 50, 46, 91, 45, 115, 101, 95, 119, 111, 114, 100, 114,
+    97, 100, 44, 32, 115, 101, 95, 119, 111, 114, 100, 114, 97, 100, 93, 32,
+    43, 32, 91, 45, 115, 101, 95, 98, 105, 116, 114, 97, 100, 44, 32, 115,
+    101, 95, 98, 105, 116, 114, 97, 100, 93, 10, 47, 47, 32, 84, 104, 101,
+    32, 119, 111, 114, 100, 32, 112, 97, 114, 116, 32, 117, 115, 101, 115, 32,
+    116, 104, 101, 32, 112, 114, 101, 102, 105, 120, 47, 115, 117, 102, 102, 105,
+    120, 32, 115, 99, 104, 101, 109, 101, 44, 32, 116, 104, 101, 32, 114, 101,
+    109, 97, 105, 110, 105, 110, 103, 32, 98, 105, 116, 32, 112, 97, 114, 116,
+    32, 105, 115, 10, 47, 47, 32, 98, 111, 117, 110, 100, 101, 100, 32, 97,
+    110, 100, 32, 104, 97, 110, 100, 108, 101, 100, 32, 119, 105, 116, 104, 32,
+    115, 104, 105, 102, 116, 115, 46, 10, 47, 47, 32, 108, 111, 99, 97, 108,
+    95, 105, 109, 103, 44, 32, 108, 111, 99, 97, 108, 95, 103, 32, 97, 110,
+    100, 32, 108, 111, 99, 97, 108, 95, 104, 32, 97, 114, 101, 32, 108, 121,
+    115, 105, 122, 101, 32, 42, 32, 40, 108, 120, 115, 105, 122, 101, 32, 43,
+    32, 50, 42, 115, 101, 95, 119, 111, 114, 100, 114, 97, 100, 32, 43, 32,
+    52, 41, 10, 118, 111, 105, 100, 32, 98, 105, 116, 109, 97, 112, 112, 101,
+    100, 95, 118, 104, 103, 119, 95, 104, 40, 103, 108, 111, 98, 97, 108, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32, 105, 110, 44, 32,
+    103, 108, 111, 98, 97, 108, 32, 105, 110, 116, 32, 42, 32, 111, 117, 116,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 110, 114, 111, 119, 115, 44, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 110, 99, 111, 108, 115, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 101, 95, 119, 111, 114,
+    100, 114, 97, 100, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    115, 101, 95, 98, 105, 116, 114, 97, 100, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 108, 111, 99, 97, 108, 32, 117, 105, 110, 116, 32, 42, 32, 108, 111,
+    99, 97, 108, 95, 105, 109, 103, 44, 32, 108, 111, 99, 97, 108, 32, 117,
+    105, 110, 116, 32, 42, 32, 108, 111, 99, 97, 108, 95, 103, 44, 32, 108,
+    111, 99, 97, 108, 32, 117, 105, 110, 116, 32, 42, 32, 108, 111, 99, 97,
+    108, 95, 104, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 101, 114, 111, 115, 105, 111, 110, 41, 10, 123, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 120, 32, 61, 32,
+    103, 101, 116, 95, 103, 108, 111, 98, 97, 108, 95, 105, 100, 40, 48, 41,
+    59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 121, 32,
+    61, 32, 103, 101, 116, 95, 103, 108, 111, 98, 97, 108, 95, 105, 100, 40,
+    49, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    108, 120, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 105,
+    100, 40, 48, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 108, 121, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108,
+    95, 105, 100, 40, 49, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 108, 120, 115, 105, 122, 101, 32, 61, 32, 103, 101, 116,
+    95, 108, 111, 99, 97, 108, 95, 115, 105, 122, 101, 40, 48, 41, 59, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 121, 115, 105,
+    122, 101, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 115,
+    105, 122, 101, 40, 49, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 98, 95, 110, 99, 111, 108, 115, 32, 61, 32, 110, 99,
+    111, 108, 115, 32, 62, 62, 32, 53, 59, 10, 10, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 99, 111, 114, 110, 101, 114, 95, 120, 32,
+    61, 32, 103, 101, 116, 95, 103, 114, 111, 117, 112, 95, 105, 100, 40, 48,
+    41, 32, 42, 32, 108, 120, 115, 105, 122, 101, 59, 10, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 99, 111, 114, 110, 101, 114, 95, 121,
+    32, 61, 32, 103, 101, 116, 95, 103, 114, 111, 117, 112, 95, 105, 100, 40,
+    49, 41, 32, 42, 32, 108, 121, 115, 105, 122, 101, 59, 10, 10, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 116, 104, 114, 101, 97, 100,
+    95, 105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40, 108, 121, 44,
+    32, 108, 120, 115, 105, 122, 101, 44, 32, 108, 120, 41, 59, 10, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 98, 95, 116, 104, 114,
+    101, 97, 100, 115, 32, 61, 32, 108, 120, 115, 105, 122, 101, 32, 42, 32,
+    108, 121, 115, 105, 122, 101, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 107, 32, 61, 32, 115, 101, 95, 119, 111, 114, 100,
+    114, 97, 100, 32, 42, 32, 50, 32, 43, 32, 49, 59, 10, 32, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 112, 97, 100, 100, 101, 100, 95,
+    110, 114, 111, 119, 115, 32, 61, 32, 108, 121, 115, 105, 122, 101, 59, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 112, 97, 100, 100,
+    101, 100, 95, 110, 99, 111, 108, 115, 32, 61, 32, 108, 120, 115, 105, 122,
+    101, 32, 43, 32, 115, 101, 95, 119, 111, 114, 100, 114, 97, 100, 32, 42,
+    32, 50, 32, 43, 32, 52, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 110, 98, 95, 98, 108, 111, 99, 107, 115, 32, 61, 32,
+    40, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 32, 45, 32,
+    49, 41, 32, 47, 32, 107, 32, 43, 32, 49, 59, 10, 10, 32, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 105, 100, 120, 32, 61, 32, 109,
+    97, 100, 50, 52, 40, 121, 44, 32, 98, 95, 110, 99, 111, 108, 115, 44,
+    32, 120, 41, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 115, 105, 122, 101, 32, 61, 32, 112, 97, 100, 100, 101, 100, 95,
+    110, 114, 111, 119, 115, 32, 42, 32, 112, 97, 100, 100, 101, 100, 95, 110,
+    99, 111, 108, 115, 59, 10, 10, 32, 32, 47, 47, 32, 67, 111, 112, 121,
+    32, 115, 117, 98, 105, 109, 97, 103, 101, 32, 116, 111, 32, 108, 111, 99,
+    97, 108, 32, 109, 101, 109, 111, 114, 121, 10, 32, 32, 102, 111, 114, 32,
+    40, 105, 110, 116, 32, 105, 32, 61, 32, 116, 104, 114, 101, 97, 100, 95,
+    105, 100, 120, 59, 32, 105, 32, 60, 32, 115, 105, 122, 101, 59, 32, 105,
+    32, 43, 61, 32, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 41, 10,
+    32, 32, 123, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 100, 105, 118, 32, 61, 32, 105, 32, 47, 32, 112, 97, 100, 100,
+    101, 100, 95, 110, 99, 111, 108, 115, 59, 10, 32, 32, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 114, 101, 99, 116, 95, 114, 111, 119,
+    32, 61, 32, 100, 105, 118, 32, 43, 32, 99, 111, 114, 110, 101, 114, 95,
+    121, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 114, 101, 99, 116, 95, 99, 111, 108, 32, 61, 32, 105, 32, 45, 32,
+    100, 105, 118, 32, 42, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111,
+    108, 115, 32, 43, 32, 99, 111, 114, 110, 101, 114, 95, 120, 32, 45, 32,
+    115, 101, 95, 119, 111, 114, 100, 114, 97, 100, 32, 45, 32, 50, 59, 10,
+    10, 32, 32, 32, 32, 105, 102, 32, 40, 114, 101, 99, 116, 95, 114, 111,
+    119, 32, 60, 32, 48, 32, 124, 124, 32, 114, 101, 99, 116, 95, 114, 111,
+    119, 32, 62, 61, 32, 110, 114, 111, 119, 115, 32, 124, 124, 32, 114, 101,
+    99, 116, 95, 99, 111, 108, 32, 60, 32, 48, 32, 124, 124, 32, 114, 101,
+    99, 116, 95, 99, 111, 108, 32, 62, 61, 32, 98, 95, 110, 99, 111, 108,
+    115, 41, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 108,
+    111, 99, 97, 108, 95, 105, 109, 103, 91, 105, 93, 32, 61, 32, 48, 59,
+    10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 101, 108, 115, 101, 10,
+    32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 112, 105, 100, 120, 32, 61, 32, 109, 97, 100,
+    50, 52, 40, 114, 101, 99, 116, 95, 114, 111, 119, 44, 32, 98, 95, 110,
+    99, 111, 108, 115, 44, 32, 114, 101, 99, 116, 95, 99, 111, 108, 41, 59,
+    10, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103,
+    91, 105, 93, 32, 61, 32, 105, 110, 91, 112, 105, 100, 120, 93, 59, 10,
+    32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 32, 32, 98, 97, 114, 114,
+    105, 101, 114, 40, 67, 76, 75, 95, 76, 79, 67, 65, 76, 95, 77, 69,
+    77, 95, 70, 69, 78, 67, 69, 41, 59, 10, 10, 32, 32, 47, 47, 32,
+    80, 114, 101, 102, 105, 120, 47, 115, 117, 102, 102, 105, 120, 32, 115, 99,
+    97, 110, 115, 44, 32, 111, 110, 101, 32, 98, 108, 111, 99, 107, 32, 112,
+    101, 114, 32, 116, 104, 114, 101, 97, 100, 10, 32, 32, 102, 111, 114, 32,
+    40, 105, 110, 116, 32, 105, 32, 61, 32, 116, 104, 114, 101, 97, 100, 95,
+    105, 100, 120, 59, 32, 105, 32, 60, 32, 112, 97, 100, 100, 101, 100, 95,
+    110, 114, 111, 119, 115, 32, 42, 32, 110, 98, 95, 98, 108, 111, 99, 107,
+    115, 59, 32, 105, 32, 43, 61, 32, 110, 98, 95, 116, 104, 114, 101, 97,
+    100, 115, 41, 10, 32, 32, 123, 10, 32, 32, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 100, 105, 118, 32, 61, 32, 105, 32, 47, 32,
+    110, 98, 95, 98, 108, 111, 99, 107, 115, 59, 10, 32, 32, 32, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 116, 97, 114, 116, 32, 61,
+    32, 109, 97, 100, 50, 52, 40, 100, 105, 118, 44, 32, 112, 97, 100, 100,
+    101, 100, 95, 110, 99, 111, 108, 115, 44, 32, 40, 105, 32, 45, 32, 100,
+    105, 118, 32, 42, 32, 110, 98, 95, 98, 108, 111, 99, 107, 115, 41, 32,
+    42, 32, 107, 41, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 101, 110, 100, 32, 61, 32, 109, 97, 100, 50, 52, 40,
+    100, 105, 118, 44, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108,
+    115, 44, 32, 109, 105, 110, 40, 112, 97, 100, 100, 101, 100, 95, 110, 99,
+    111, 108, 115, 44, 32, 40, 105, 32, 45, 32, 100, 105, 118, 32, 42, 32,
+    110, 98, 95, 98, 108, 111, 99, 107, 115, 32, 43, 32, 49, 41, 32, 42,
+    32, 107, 41, 41, 59, 10, 10, 32, 32, 32, 32, 117, 105, 110, 116, 32,
+    97, 99, 99, 32, 61, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91,
+    115, 116, 97, 114, 116, 93, 59, 10, 32, 32, 32, 32, 108, 111, 99, 97,
+    108, 95, 103, 91, 115, 116, 97, 114, 116, 93, 32, 61, 32, 97, 99, 99,
+    59, 10, 32, 32, 32, 32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 106,
+    32, 61, 32, 115, 116, 97, 114, 116, 32, 43, 32, 49, 59, 32, 106, 32,
+    60, 32, 101, 110, 100, 59, 32, 43, 43, 106, 41, 10, 32, 32, 32, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 97, 99, 99, 32, 61, 32, 101, 114,
+    111, 115, 105, 111, 110, 32, 63, 32, 97, 99, 99, 32, 38, 32, 108, 111,
+    99, 97, 108, 95, 105, 109, 103, 91, 106, 93, 32, 58, 32, 97, 99, 99,
+    32, 124, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 106, 93, 59,
+    10, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 103, 91, 106,
+    93, 32, 61, 32, 97, 99, 99, 59, 10, 32, 32, 32, 32, 125, 10, 32,
+    32, 32, 32, 97, 99, 99, 32, 61, 32, 108, 111, 99, 97, 108, 95, 105,
+    109, 103, 91, 101, 110, 100, 32, 45, 32, 49, 93, 59, 10, 32, 32, 32,
+    32, 108, 111, 99, 97, 108, 95, 104, 91, 101, 110, 100, 32, 45, 32, 49,
+    93, 32, 61, 32, 97, 99, 99, 59, 10, 32, 32, 32, 32, 102, 111, 114,
+    32, 40, 105, 110, 116, 32, 106, 32, 61, 32, 101, 110, 100, 32, 45, 32,
+    50, 59, 32, 106, 32, 62, 61, 32, 115, 116, 97, 114, 116, 59, 32, 45,
+    45, 106, 41, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32,
+    97, 99, 99, 32, 61, 32, 101, 114, 111, 115, 105, 111, 110, 32, 63, 32,
+    97, 99, 99, 32, 38, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91,
+    106, 93, 32, 58, 32, 97, 99, 99, 32, 124, 32, 108, 111, 99, 97, 108,
+    95, 105, 109, 103, 91, 106, 93, 59, 10, 32, 32, 32, 32, 32, 32, 108,
+    111, 99, 97, 108, 95, 104, 91, 106, 93, 32, 61, 32, 97, 99, 99, 59,
+    10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 32, 32, 98, 97, 114,
+    114, 105, 101, 114, 40, 67, 76, 75, 95, 76, 79, 67, 65, 76, 95, 77,
+    69, 77, 95, 70, 69, 78, 67, 69, 41, 59, 10, 10, 32, 32, 47, 47,
+    32, 77, 101, 114, 103, 101, 32, 116, 104, 101, 32, 119, 111, 114, 100, 32,
+    119, 105, 110, 100, 111, 119, 115, 46, 32, 108, 111, 99, 97, 108, 95, 105,
+    109, 103, 32, 110, 111, 119, 32, 104, 111, 108, 100, 115, 32, 116, 104, 101,
+    32, 119, 111, 114, 100, 32, 108, 101, 118, 101, 108, 32, 114, 101, 115, 117,
+    108, 116, 32, 102, 111, 114, 10, 32, 32, 47, 47, 32, 116, 104, 101, 32,
+    119, 111, 114, 100, 115, 32, 91, 99, 111, 114, 110, 101, 114, 95, 120, 32,
+    45, 32, 50, 44, 32, 99, 111, 114, 110, 101, 114, 95, 120, 32, 43, 32,
+    108, 120, 115, 105, 122, 101, 32, 43, 32, 50, 91, 10, 32, 32, 102, 111,
+    114, 32, 40, 105, 110, 116, 32, 105, 32, 61, 32, 116, 104, 114, 101, 97,
+    100, 95, 105, 100, 120, 59, 32, 105, 32, 60, 32, 112, 97, 100, 100, 101,
+    100, 95, 110, 114, 111, 119, 115, 32, 42, 32, 40, 108, 120, 115, 105, 122,
+    101, 32, 43, 32, 52, 41, 59, 32, 105, 32, 43, 61, 32, 110, 98, 95,
+    116, 104, 114, 101, 97, 100, 115, 41, 10, 32, 32, 123, 10, 32, 32, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 100, 105, 118, 32, 61,
+    32, 105, 32, 47, 32, 40, 108, 120, 115, 105, 122, 101, 32, 43, 32, 52,
+    41, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 108, 105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40, 100, 105,
+    118, 44, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 44,
+    32, 105, 32, 45, 32, 100, 105, 118, 32, 42, 32, 40, 108, 120, 115, 105,
+    122, 101, 32, 43, 32, 52, 41, 41, 59, 10, 32, 32, 32, 32, 99, 111,
+    110, 115, 116, 32, 117, 105, 110, 116, 32, 104, 32, 61, 32, 108, 111, 99,
+    97, 108, 95, 104, 91, 108, 105, 100, 120, 93, 59, 10, 32, 32, 32, 32,
+    99, 111, 110, 115, 116, 32, 117, 105, 110, 116, 32, 103, 32, 61, 32, 108,
+    111, 99, 97, 108, 95, 103, 91, 108, 105, 100, 120, 32, 43, 32, 115, 101,
+    95, 119, 111, 114, 100, 114, 97, 100, 32, 42, 32, 50, 93, 59, 10, 32,
+    32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 108, 105, 100,
+    120, 93, 32, 61, 32, 101, 114, 111, 115, 105, 111, 110, 32, 63, 32, 104,
+    32, 38, 32, 103, 32, 58, 32, 104, 32, 124, 32, 103, 59, 10, 32, 32,
+    125, 10, 32, 32, 98, 97, 114, 114, 105, 101, 114, 40, 67, 76, 75, 95,
+    76, 79, 67, 65, 76, 95, 77, 69, 77, 95, 70, 69, 78, 67, 69, 41,
+    59, 10, 10, 32, 32, 47, 47, 32, 66, 97, 105, 108, 32, 111, 117, 116,
+    32, 105, 102, 32, 119, 101, 32, 97, 114, 101, 32, 111, 117, 116, 115, 105,
+    100, 101, 32, 116, 104, 101, 32, 105, 109, 97, 103, 101, 10, 32, 32, 105,
+    102, 32, 40, 120, 32, 62, 61, 32, 98, 95, 110, 99, 111, 108, 115, 32,
+    124, 124, 32, 121, 32, 62, 61, 32, 110, 114, 111, 119, 115, 41, 10, 32,
+    32, 32, 32, 114, 101, 116, 117, 114, 110, 59, 10, 10, 32, 32, 47, 47,
+    32, 82, 101, 109, 97, 105, 110, 105, 110, 103, 32, 98, 105, 116, 32, 108,
+    101, 118, 101, 108, 32, 119, 105, 110, 100, 111, 119, 10, 32, 32, 123, 10,
+    32, 32, 32, 32, 108, 111, 99, 97, 108, 32, 99, 111, 110, 115, 116, 32,
+    117, 105, 110, 116, 32, 42, 32, 119, 32, 61, 32, 108, 111, 99, 97, 108,
+    95, 105, 109, 103, 32, 43, 32, 109, 97, 100, 50, 52, 40, 108, 121, 44,
+    32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 44, 32, 108,
+    120, 32, 43, 32, 50, 41, 59, 10, 32, 32, 32, 32, 117, 105, 110, 116,
+    32, 97, 99, 99, 32, 61, 32, 119, 91, 48, 93, 59, 10, 32, 32, 32,
+    32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 105, 32, 61, 32, 49, 59,
+    32, 105, 32, 60, 61, 32, 115, 101, 95, 98, 105, 116, 114, 97, 100, 59,
+    32, 43, 43, 105, 41, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 105, 102, 32, 40, 101, 114, 111, 115, 105, 111, 110, 41, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 97, 99, 99, 32, 38, 61, 32, 98, 105,
+    116, 109, 97, 112, 112, 101, 100, 95, 112, 117, 108, 108, 95, 108, 101, 102,
+    116, 40, 119, 44, 32, 105, 41, 32, 38, 32, 98, 105, 116, 109, 97, 112,
+    112, 101, 100, 95, 112, 117, 108, 108, 95, 114, 105, 103, 104, 116, 40, 119,
+    44, 32, 105, 41, 59, 10, 32, 32, 32, 32, 32, 32, 101, 108, 115, 101,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 97, 99, 99, 32, 124, 61, 32,
+    98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 112, 117, 108, 108, 95, 108,
+    101, 102, 116, 40, 119, 44, 32, 105, 41, 32, 124, 32, 98, 105, 116, 109,
+    97, 112, 112, 101, 100, 95, 112, 117, 108, 108, 95, 114, 105, 103, 104, 116,
+    40, 119, 44, 32, 105, 41, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32,
+    32, 32, 111, 117, 116, 91, 105, 100, 120, 93, 32, 61, 32, 97, 99, 99,
+    59, 10, 32, 32, 125, 10, 125, 10, 10, 107, 101, 114, 110, 101, 108, 32,
+    118, 111, 105, 100, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 118,
+    104, 103, 119, 95, 100, 105, 108, 97, 116, 105, 111, 110, 95, 104, 40, 103,
+    108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    42, 32, 105, 110, 44, 32, 103, 108, 111, 98, 97, 108, 32, 105, 110, 116,
+    32, 42, 32, 111, 117, 116, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 110, 114, 111, 119, 115, 44, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 99, 111, 108, 115, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    115, 101, 95, 119, 111, 114, 100, 114, 97, 100, 44, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 115, 101, 95, 98, 105, 116, 114, 97, 100, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 32, 117, 105, 110,
+    116, 32, 42, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 32, 117, 105, 110, 116, 32,
+    42, 32, 108, 111, 99, 97, 108, 95, 103, 44, 32, 108, 111, 99, 97, 108,
+    32, 117, 105, 110, 116, 32, 42, 32, 108, 111, 99, 97, 108, 95, 104, 41,
+    10, 123, 10, 32, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 118,
+    104, 103, 119, 95, 104, 40, 105, 110, 44, 32, 111, 117, 116, 44, 32, 110,
+    114, 111, 119, 115, 44, 32, 110, 99, 111, 108, 115, 44, 32, 115, 101, 95,
+    119, 111, 114, 100, 114, 97, 100, 44, 32, 115, 101, 95, 98, 105, 116, 114,
+    97, 100, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103,
+    44, 32, 108, 111, 99, 97, 108, 95, 103, 44, 32, 108, 111, 99, 97, 108,
+    95, 104, 44, 32, 48, 41, 59, 10, 125, 10, 10, 107, 101, 114, 110, 101,
+    108, 32, 118, 111, 105, 100, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100,
+    95, 118, 104, 103, 119, 95, 101, 114, 111, 115, 105, 111, 110, 95, 104, 40,
+    103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 42, 32, 105, 110, 44, 32, 103, 108, 111, 98, 97, 108, 32, 105, 110,
+    116, 32, 42, 32, 111, 117, 116, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 110, 114, 111, 119, 115, 44, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 99, 111, 108, 115, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115,
+    101, 95, 119, 111, 114, 100, 114, 97, 100, 44, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 115, 101, 95, 98, 105, 116, 114, 97, 100, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 32, 117, 105, 110, 116, 32,
+    42, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 108, 111, 99, 97, 108, 32, 117, 105, 110, 116, 32, 42, 32, 108,
+    111, 99, 97, 108, 95, 103, 44, 32, 108, 111, 99, 97, 108, 32, 117, 105,
+    110, 116, 32, 42, 32, 108, 111, 99, 97, 108, 95, 104, 41, 10, 123, 10,
+    32, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 118, 104, 103, 119,
+    95, 104, 40, 105, 110, 44, 32, 111, 117, 116, 44, 32, 110, 114, 111, 119,
+    115, 44, 32, 110, 99, 111, 108, 115, 44, 32, 115, 101, 95, 119, 111, 114,
+    100, 114, 97, 100, 44, 32, 115, 101, 95, 98, 105, 116, 114, 97, 100, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 44, 32, 108,
+    111, 99, 97, 108, 95, 103, 44, 32, 108, 111, 99, 97, 108, 95, 104, 44,
+    32, 49, 41, 59, 10, 125, 10, 10, 47, 47, 32, 86, 101, 114, 116, 105,
+    99, 97, 108, 32, 118, 97, 110, 32, 72, 101, 114, 107, 47, 71, 105, 108,
+    45, 87, 101, 114, 109, 97, 110, 44, 32, 102, 105, 114, 115, 116, 32, 112,
+    97, 115, 115, 46, 10, 47, 47, 32, 79, 110, 101, 32, 116, 104, 114, 101,
+    97, 100, 32, 112, 101, 114, 32, 119, 111, 114, 100, 32, 99, 111, 108, 117,
+    109, 110, 32, 97, 110, 100, 32, 112, 101, 114, 32, 98, 108, 111, 99, 107,
+    32, 111, 102, 32, 107, 32, 61, 32, 50, 42, 115, 101, 95, 114, 111, 119,
+    114, 97, 100, 43, 49, 32, 114, 111, 119, 115, 46, 10, 47, 47, 32, 84,
+    104, 101, 32, 97, 112, 114, 111, 110, 32, 119, 111, 117, 108, 100, 32, 98,
+    101, 32, 116, 111, 111, 32, 108, 97, 114, 103, 101, 32, 102, 111, 114, 32,
+    116, 104, 101, 32, 108, 111, 99, 97, 108, 32, 109, 101, 109, 111, 114, 121,
+    44, 32, 115, 111, 32, 103, 32, 97, 110, 100, 32, 104, 32, 103, 111, 32,
+    116, 111, 10, 47, 47, 32, 103, 108, 111, 98, 97, 108, 32, 109, 101, 109,
+    111, 114, 121, 46, 10, 118, 111, 105, 100, 32, 98, 105, 116, 109, 97, 112,
+    112, 101, 100, 95, 118, 104, 103, 119, 95, 115, 99, 97, 110, 95, 118, 40,
+    103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 42, 32, 105, 110, 44, 32, 103, 108, 111, 98, 97, 108, 32, 105, 110,
+    116, 32, 42, 32, 103, 44, 32, 103, 108, 111, 98, 97, 108, 32, 105, 110,
+    116, 32, 42, 32, 104, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 114, 111, 119,
+    115, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 99, 111,
+    108, 115, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 101, 95, 114, 111, 119, 114,
+    97, 100, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 101, 114,
+    111, 115, 105, 111, 110, 41, 10, 123, 10, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 120, 32, 61, 32, 103, 101, 116, 95, 103, 108, 111,
+    98, 97, 108, 95, 105, 100, 40, 48, 41, 59, 10, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 121, 32, 61, 32, 103, 101, 116, 95, 103,
+    108, 111, 98, 97, 108, 95, 105, 100, 40, 49, 41, 59, 10, 32, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 98, 95, 110, 99, 111, 108, 115,
+    32, 61, 32, 110, 99, 111, 108, 115, 32, 62, 62, 32, 53, 59, 10, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 107, 32, 61, 32, 115,
+    101, 95, 114, 111, 119, 114, 97, 100, 32, 42, 32, 50, 32, 43, 32, 49,
+    59, 10, 10, 32, 32, 105, 102, 32, 40, 120, 32, 62, 61, 32, 98, 95,
+    110, 99, 111, 108, 115, 32, 124, 124, 32, 121, 32, 42, 32, 107, 32, 62,
+    61, 32, 110, 114, 111, 119, 115, 41, 10, 32, 32, 32, 32, 114, 101, 116,
+    117, 114, 110, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 115, 116, 97, 114, 116, 32, 61, 32, 109, 97, 100, 50, 52, 40,
+    121, 32, 42, 32, 107, 44, 32, 98, 95, 110, 99, 111, 108, 115, 44, 32,
+    120, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    101, 110, 100, 32, 61, 32, 109, 97, 100, 50, 52, 40, 109, 105, 110, 40,
+    110, 114, 111, 119, 115, 44, 32, 40, 121, 32, 43, 32, 49, 41, 32, 42,
+    32, 107, 41, 44, 32, 98, 95, 110, 99, 111, 108, 115, 44, 32, 120, 41,
+    59, 10, 10, 32, 32, 105, 110, 116, 32, 97, 99, 99, 32, 61, 32, 105,
+    110, 91, 115, 116, 97, 114, 116, 93, 59, 10, 32, 32, 103, 91, 115, 116,
+    97, 114, 116, 93, 32, 61, 32, 97, 99, 99, 59, 10, 32, 32, 102, 111,
+    114, 32, 40, 105, 110, 116, 32, 105, 32, 61, 32, 115, 116, 97, 114, 116,
+    32, 43, 32, 98, 95, 110, 99, 111, 108, 115, 59, 32, 105, 32, 60, 32,
+    101, 110, 100, 59, 32, 105, 32, 43, 61, 32, 98, 95, 110, 99, 111, 108,
+    115, 41, 10, 32, 32, 123, 10, 32, 32, 32, 32, 97, 99, 99, 32, 61,
+    32, 101, 114, 111, 115, 105, 111, 110, 32, 63, 32, 97, 99, 99, 32, 38,
+    32, 105, 110, 91, 105, 93, 32, 58, 32, 97, 99, 99, 32, 124, 32, 105,
+    110, 91, 105, 93, 59, 10, 32, 32, 32, 32, 103, 91, 105, 93, 32, 61,
+    32, 97, 99, 99, 59, 10, 32, 32, 125, 10, 32, 32, 97, 99, 99, 32,
+    61, 32, 105, 110, 91, 101, 110, 100, 32, 45, 32, 98, 95, 110, 99, 111,
+    108, 115, 93, 59, 10, 32, 32, 104, 91, 101, 110, 100, 32, 45, 32, 98,
+    95, 110, 99, 111, 108, 115, 93, 32, 61, 32, 97, 99, 99, 59, 10, 32,
+    32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 105, 32, 61, 32, 101, 110,
+    100, 32, 45, 32, 50, 32, 42, 32, 98, 95, 110, 99, 111, 108, 115, 59,
+    32, 105, 32, 62, 61, 32, 115, 116, 97, 114, 116, 59, 32, 105, 32, 45,
+    61, 32, 98, 95, 110, 99, 111, 108, 115, 41, 10, 32, 32, 123, 10, 32,
+    32, 32, 32, 97, 99, 99, 32, 61, 32, 101, 114, 111, 115, 105, 111, 110,
+    32, 63, 32, 97, 99, 99, 32, 38, 32, 105, 110, 91, 105, 93, 32, 58,
+    32, 97, 99, 99, 32, 124, 32, 105, 110, 91, 105, 93, 59, 10, 32, 32,
+    32, 32, 104, 91, 105, 93, 32, 61, 32, 97, 99, 99, 59, 10, 32, 32,
+    125, 10, 125, 10, 10, 107, 101, 114, 110, 101, 108, 32, 118, 111, 105, 100,
+    32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 118, 104, 103, 119, 95,
+    100, 105, 108, 97, 116, 105, 111, 110, 95, 115, 99, 97, 110, 95, 118, 40,
+    103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 42, 32, 105, 110, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 103, 108, 111, 98, 97, 108, 32, 105, 110, 116, 32, 42, 32, 103,
+    44, 32, 103, 108, 111, 98, 97, 108, 32, 105, 110, 116, 32, 42, 32, 104,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 110, 114, 111, 119, 115, 44, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 110, 99, 111, 108, 115, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 115, 101, 95, 114, 111, 119, 114, 97, 100, 41, 10, 123,
+    10, 32, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 118, 104, 103,
+    119, 95, 115, 99, 97, 110, 95, 118, 40, 105, 110, 44, 32, 103, 44, 32,
+    104, 44, 32, 110, 114, 111, 119, 115, 44, 32, 110, 99, 111, 108, 115, 44,
+    32, 115, 101, 95, 114, 111, 119, 114, 97, 100, 44, 32, 48, 41, 59, 10,
+    125, 10, 10, 107, 101, 114, 110, 101, 108, 32, 118, 111, 105, 100, 32, 98,
+    105, 116, 109, 97, 112, 112, 101, 100, 95, 118, 104, 103, 119, 95, 101, 114,
+    111, 115, 105, 111, 110, 95, 115, 99, 97, 110, 95, 118, 40, 103, 108, 111,
+    98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32,
+    105, 110, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 103, 108,
+    111, 98, 97, 108, 32, 105, 110, 116, 32, 42, 32, 103, 44, 32, 103, 108,
+    111, 98, 97, 108, 32, 105, 110, 116, 32, 42, 32, 104, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 110, 114, 111, 119, 115, 44, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 110, 99, 111, 108, 115, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 101,
+    95, 114, 111, 119, 114, 97, 100, 41, 10, 123, 10, 32, 32, 98, 105, 116,
+    109, 97, 112, 112, 101, 100, 95, 118, 104, 103, 119, 95, 115, 99, 97, 110,
+    95, 118, 40, 105, 110, 44, 32, 103, 44, 32, 104, 44, 32, 110, 114, 111,
+    119, 115, 44, 32, 110, 99, 111, 108, 115, 44, 32, 115, 101, 95, 114, 111,
+    119, 114, 97, 100, 44, 32, 49, 41, 59, 10, 125, 10, 10, 47, 47, 32,
+    86, 101, 114, 116, 105, 99, 97, 108, 32, 118, 97, 110, 32, 72, 101, 114,
+    107, 47, 71, 105, 108, 45, 87, 101, 114, 109, 97, 110, 44, 32, 115, 101,
+    99, 111, 110, 100, 32, 112, 97, 115, 115, 46, 32, 79, 117, 116, 32, 111,
+    102, 32, 116, 104, 101, 32, 105, 109, 97, 103, 101, 32, 105, 115, 32, 48,
+    44, 32, 97, 115, 32, 105, 110, 10, 47, 47, 32, 98, 105, 116, 109, 97,
+    112, 112, 101, 100, 95, 100, 105, 108, 97, 116, 105, 111, 110, 95, 118, 47,
+    98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 101, 114, 111, 115, 105, 111,
+    110, 95, 118, 46, 10, 107, 101, 114, 110, 101, 108, 32, 118, 111, 105, 100,
+    32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 118, 104, 103, 119, 95,
+    100, 105, 108, 97, 116, 105, 111, 110, 95, 118, 40, 103, 108, 111, 98, 97,
+    108, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32, 103, 44,
+    32, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 42, 32, 104, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 103, 108, 111,
+    98, 97, 108, 32, 105, 110, 116, 32, 42, 32, 111, 117, 116, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110,
+    114, 111, 119, 115, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    110, 99, 111, 108, 115, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 115, 101, 95, 114, 111, 119, 114, 97, 100,
+    41, 10, 123, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    120, 32, 61, 32, 103, 101, 116, 95, 103, 108, 111, 98, 97, 108, 95, 105,
+    100, 40, 48, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 121, 32, 61, 32, 103, 101, 116, 95, 103, 108, 111, 98, 97, 108,
+    95, 105, 100, 40, 49, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 98, 95, 110, 99, 111, 108, 115, 32, 61, 32, 110, 99,
+    111, 108, 115, 32, 62, 62, 32, 53, 59, 10, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 107, 32, 61, 32, 115, 101, 95, 114, 111, 119,
+    114, 97, 100, 32, 42, 32, 50, 32, 43, 32, 49, 59, 10, 10, 32, 32,
+    105, 102, 32, 40, 120, 32, 62, 61, 32, 98, 95, 110, 99, 111, 108, 115,
+    32, 124, 124, 32, 121, 32, 62, 61, 32, 110, 114, 111, 119, 115, 41, 10,
+    32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 59, 10, 10, 32, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 116, 111, 112, 32, 61, 32, 121,
+    32, 45, 32, 115, 101, 95, 114, 111, 119, 114, 97, 100, 59, 10, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 98, 111, 116, 116, 111, 109,
+    32, 61, 32, 121, 32, 43, 32, 115, 101, 95, 114, 111, 119, 114, 97, 100,
+    59, 10, 32, 32, 105, 110, 116, 32, 97, 99, 99, 32, 61, 32, 116, 111,
+    112, 32, 60, 32, 48, 32, 63, 32, 48, 32, 58, 32, 104, 91, 109, 97,
+    100, 50, 52, 40, 116, 111, 112, 44, 32, 98, 95, 110, 99, 111, 108, 115,
+    44, 32, 120, 41, 93, 59, 10, 32, 32, 105, 102, 32, 40, 98, 111, 116,
+    116, 111, 109, 32, 60, 32, 110, 114, 111, 119, 115, 41, 10, 32, 32, 32,
+    32, 97, 99, 99, 32, 124, 61, 32, 103, 91, 109, 97, 100, 50, 52, 40,
+    98, 111, 116, 116, 111, 109, 44, 32, 98, 95, 110, 99, 111, 108, 115, 44,
+    32, 120, 41, 93, 59, 10, 32, 32, 101, 108, 115, 101, 32, 105, 102, 32,
+    40, 40, 98, 111, 116, 116, 111, 109, 32, 47, 32, 107, 41, 32, 42, 32,
+    107, 32, 60, 32, 110, 114, 111, 119, 115, 41, 32, 47, 47, 32, 116, 104,
+    101, 32, 108, 97, 115, 116, 32, 98, 108, 111, 99, 107, 32, 105, 115, 32,
+    116, 114, 117, 110, 99, 97, 116, 101, 100, 10, 32, 32, 32, 32, 97, 99,
+    99, 32, 124, 61, 32, 103, 91, 109, 97, 100, 50, 52, 40, 110, 114, 111,
+    119, 115, 32, 45, 32, 49, 44, 32, 98, 95, 110, 99, 111, 108, 115, 44,
+    32, 120, 41, 93, 59, 10, 32, 32, 111, 117, 116, 91, 109, 97, 100, 50,
+    52, 40, 121, 44, 32, 98, 95, 110, 99, 111, 108, 115, 44, 32, 120, 41,
+    93, 32, 61, 32, 97, 99, 99, 59, 10, 125, 10, 10, 107, 101, 114, 110,
+    101, 108, 32, 118, 111, 105, 100, 32, 98, 105, 116, 109, 97, 112, 112, 101,
+    100, 95, 118, 104, 103, 119, 95, 101, 114, 111, 115, 105, 111, 110, 95, 118,
+    40, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 42, 32, 103, 44, 32, 103, 108, 111, 98, 97, 108, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 42, 32, 104, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 103, 108, 111, 98, 97, 108, 32, 105, 110, 116, 32, 42, 32, 111,
+    117, 116, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 110, 114, 111, 119, 115, 44, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 110, 99, 111, 108, 115, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 101, 95, 114, 111, 119,
+    114, 97, 100, 41, 10, 123, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 120, 32, 61, 32, 103, 101, 116, 95, 103, 108, 111, 98, 97,
+    108, 95, 105, 100, 40, 48, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 121, 32, 61, 32, 103, 101, 116, 95, 103, 108, 111,
+    98, 97, 108, 95, 105, 100, 40, 49, 41, 59, 10, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 98, 95, 110, 99, 111, 108, 115, 32, 61,
+    32, 110, 99, 111, 108, 115, 32, 62, 62, 32, 53, 59, 10, 10, 32, 32,
+    105, 102, 32, 40, 120, 32, 62, 61, 32, 98, 95, 110, 99, 111, 108, 115,
+    32, 124, 124, 32, 121, 32, 62, 61, 32, 110, 114, 111, 119, 115, 41, 10,
+    32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 59, 10, 10, 32, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 116, 111, 112, 32, 61, 32, 121,
+    32, 45, 32, 115, 101, 95, 114, 111, 119, 114, 97, 100, 59, 10, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 98, 111, 116, 116, 111, 109,
+    32, 61, 32, 121, 32, 43, 32, 115, 101, 95, 114, 111, 119, 114, 97, 100,
+    59, 10, 32, 32, 111, 117, 116, 91, 109, 97, 100, 50, 52, 40, 121, 44,
+    32, 98, 95, 110, 99, 111, 108, 115, 44, 32, 120, 41, 93, 32, 61, 32,
+    116, 111, 112, 32, 60, 32, 48, 32, 124, 124, 32, 98, 111, 116, 116, 111,
+    109, 32, 62, 61, 32, 110, 114, 111, 119, 115, 32, 63, 32, 48, 32, 58,
+    10, 32, 32, 32, 32, 104, 91, 109, 97, 100, 50, 52, 40, 116, 111, 112,
+    44, 32, 98, 95, 110, 99, 111, 108, 115, 44, 32, 120, 41, 93, 32, 38,
+    32, 103, 91, 109, 97, 100, 50, 52, 40, 98, 111, 116, 116, 111, 109, 44,
+    32, 98, 95, 110, 99, 111, 108, 115, 44, 32, 120, 41, 93, 59, 10, 125,
+    10, 35, 101, 110, 100, 105, 102, 10, 10, 35, 105, 102, 100, 101, 102, 32,
+    67, 76, 67, 86, 95, 83, 69, 67, 84, 73, 79, 78, 95, 66, 73, 84,
+    77, 65, 80, 10, 47, 47, 32, 80, 105, 120, 101, 108, 119, 105, 115, 101,
+    32, 108, 111, 103, 105, 99, 97, 108, 32, 111, 112, 101, 114, 97, 116, 111,
+    114, 115, 32, 111, 110, 32, 98, 105, 116, 109, 97, 112, 115, 32, 40, 115,
+    101, 101, 32, 99, 108, 99, 118, 95, 108, 111, 103, 105, 99, 95, 111, 112,
+    41, 10, 107, 101, 114, 110, 101, 108, 32, 118, 111, 105, 100, 32, 98, 105,
+    116, 109, 97, 112, 112, 101, 100, 95, 108, 111, 103, 105, 99, 40, 103, 108,
+    111, 98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 42,
+    32, 97, 44, 32, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 42, 32, 98, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 103, 108, 111, 98, 97, 108, 32, 105, 110, 116,
+    32, 42, 32, 111, 117, 116, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 111, 112, 41, 10, 123, 10, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 105, 100, 120, 32, 61, 32, 103, 101, 116, 95, 103, 108,
+    111, 98, 97, 108, 95, 105, 100, 40, 48, 41, 59, 10, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 118, 97, 32, 61, 32, 97, 91, 105,
+    100, 120, 93, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 118, 98, 32, 61, 32, 98, 91, 105, 100, 120, 93, 59, 10, 32, 32,
+    115, 119, 105, 116, 99, 104, 32, 40, 111, 112, 41, 10, 32, 32, 123, 10,
+    32, 32, 32, 32, 99, 97, 115, 101, 32, 48, 58, 32, 111, 117, 116, 91,
+    105, 100, 120, 93, 32, 61, 32, 118, 97, 32, 38, 32, 118, 98, 59, 32,
+    98, 114, 101, 97, 107, 59, 10, 32, 32, 32, 32, 99, 97, 115, 101, 32,
+    49, 58, 32, 111, 117, 116, 91, 105, 100, 120, 93, 32, 61, 32, 118, 97,
+    32, 124, 32, 118, 98, 59, 32, 98, 114, 101, 97, 107, 59, 10, 32, 32,
+    32, 32, 99, 97, 115, 101, 32, 50, 58, 32, 111, 117, 116, 91, 105, 100,
+    120, 93, 32, 61, 32, 118, 97, 32, 38, 32, 126, 118, 98, 59, 32, 98,
+    114, 101, 97, 107, 59, 10, 32, 32, 32, 32, 100, 101, 102, 97, 117, 108,
+    116, 58, 32, 111, 117, 116, 91, 105, 100, 120, 93, 32, 61, 32, 118, 97,
+    32, 94, 32, 118, 98, 59, 32, 98, 114, 101, 97, 107, 59, 10, 32, 32,
+    125, 10, 125, 10, 35, 101, 110, 100, 105, 102, 10, 10, 35, 105, 102, 100,
+    101, 102, 32, 67, 76, 67, 86, 95, 83, 69, 67, 84, 73, 79, 78, 95,
+    82, 85, 78, 83, 10, 47, 47, 32, 77, 77, 32, 98, 105, 116, 109, 97,
+    112, 112, 101, 100, 32, 111, 112, 101, 114, 97, 116, 111, 114, 32, 102, 111,
+    114, 32, 97, 114, 98, 105, 116, 114, 97, 114, 121, 32, 102, 108, 97, 116,
+    32, 83, 69, 115, 10, 47, 47, 32, 84, 104, 101, 32, 83, 69, 32, 105,
+    115, 32, 101, 110, 99, 111, 100, 101, 100, 32, 97, 115, 32, 104, 111, 114,
+    105, 122, 111, 110, 116, 97, 108, 32, 114, 117, 110, 115, 32, 40, 114, 111,
+    119, 44, 32, 102, 105, 114, 115, 116, 32, 99, 111, 108, 44, 32, 108, 97,
+    115, 116, 32, 99, 111, 108, 41, 46, 32, 70, 111, 114, 32, 101, 97, 99,
+    104, 10, 47, 47, 32, 114, 117, 110, 44, 32, 116, 104, 101, 32, 51, 50,
+    32, 112, 105, 120, 101, 108, 115, 32, 111, 102, 32, 97, 32, 119, 111, 114,
+    100, 32, 97, 114, 101, 32, 99, 111, 109, 112, 117, 116, 101, 100, 32, 97,
+    116, 32, 111, 110, 99, 101, 32, 98, 121, 32, 79, 82, 39, 105, 110, 103,
+    32, 40, 65, 78, 68, 39, 105, 110, 103, 41, 32, 116, 104, 101, 10, 47,
+    47, 32, 115, 104, 105, 102, 116, 101, 100, 32, 119, 111, 114, 100, 115, 32,
+    111, 102, 32, 116, 104, 101, 32, 99, 111, 114, 114, 101, 115, 112, 111, 110,
+    100, 105, 110, 103, 32, 114, 111, 119, 46, 32, 83, 104, 105, 102, 116, 115,
+    32, 97, 114, 101, 32, 100, 111, 110, 101, 32, 111, 110, 32, 97, 32, 54,
+    52, 98, 105, 116, 32, 119, 105, 110, 100, 111, 119, 44, 10, 47, 47, 32,
+    111, 110, 101, 32, 119, 105, 110, 100, 111, 119, 32, 112, 101, 114, 32, 103,
+    114, 111, 117, 112, 32, 111, 102, 32, 51, 50, 32, 99, 111, 108, 117, 109,
+    110, 115, 44, 32, 97, 110, 100, 32, 97, 32, 114, 117, 110, 32, 111, 102,
+    32, 108, 101, 110, 103, 116, 104, 32, 76, 32, 99, 111, 115, 116, 115, 32,
+    108, 111, 103, 50, 40, 76, 41, 10, 47, 47, 32, 115, 104, 105, 102, 116,
+    115, 32, 112, 101, 114, 32, 119, 105, 110, 100, 111, 119, 46, 10, 10, 47,
+    47, 32, 79, 82, 32, 40, 101, 114, 111, 115, 105, 111, 110, 58, 32, 65,
+    78, 68, 41, 32, 111, 102, 32, 118, 32, 60, 60, 32, 99, 44, 32, 102,
+    111, 114, 32, 48, 32, 60, 61, 32, 99, 32, 60, 32, 108, 101, 110, 10,
+    117, 108, 111, 110, 103, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95,
+    115, 109, 101, 97, 114, 40, 117, 108, 111, 110, 103, 32, 118, 44, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 101, 110, 44, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 101, 114, 111, 115, 105, 111, 110, 41,
+    10, 123, 10, 32, 32, 105, 110, 116, 32, 100, 111, 110, 101, 32, 61, 32,
+    49, 59, 10, 32, 32, 119, 104, 105, 108, 101, 32, 40, 100, 111, 110, 101,
+    32, 42, 32, 50, 32, 60, 61, 32, 108, 101, 110, 41, 10, 32, 32, 123,
+    10, 32, 32, 32, 32, 118, 32, 61, 32, 101, 114, 111, 115, 105, 111, 110,
+    32, 63, 32, 118, 32, 38, 32, 40, 118, 32, 60, 60, 32, 100, 111, 110,
+    101, 41, 32, 58, 32, 118, 32, 124, 32, 40, 118, 32, 60, 60, 32, 100,
+    111, 110, 101, 41, 59, 10, 32, 32, 32, 32, 100, 111, 110, 101, 32, 42,
+    61, 32, 50, 59, 10, 32, 32, 125, 10, 32, 32, 105, 102, 32, 40, 100,
+    111, 110, 101, 32, 60, 32, 108, 101, 110, 41, 10, 32, 32, 32, 32, 118,
+    32, 61, 32, 101, 114, 111, 115, 105, 111, 110, 32, 63, 32, 118, 32, 38,
+    32, 40, 118, 32, 60, 60, 32, 40, 108, 101, 110, 32, 45, 32, 100, 111,
+    110, 101, 41, 41, 32, 58, 32, 118, 32, 124, 32, 40, 118, 32, 60, 60,
+    32, 40, 108, 101, 110, 32, 45, 32, 100, 111, 110, 101, 41, 41, 59, 10,
+    32, 32, 114, 101, 116, 117, 114, 110, 32, 118, 59, 10, 125, 10, 10, 47,
+    47, 32, 79, 82, 32, 40, 101, 114, 111, 115, 105, 111, 110, 58, 32, 65,
+    78, 68, 41, 32, 111, 102, 32, 116, 104, 101, 32, 112, 105, 120, 101, 108,
+    115, 32, 108, 111, 99, 97, 116, 101, 100, 32, 99, 48, 46, 46, 99, 49,
+    32, 99, 111, 108, 117, 109, 110, 115, 32, 97, 119, 97, 121, 32, 102, 114,
+    111, 109, 32, 116, 104, 101, 10, 47, 47, 32, 112, 105, 120, 101, 108, 115,
+    32, 111, 102, 32, 119, 91, 48, 93, 32, 40, 99, 48, 32, 97, 110, 100,
+    32, 99, 49, 32, 99, 97, 110, 32, 98, 101, 32, 110, 101, 103, 97, 116,
+    105, 118, 101, 41, 10, 117, 105, 110, 116, 32, 98, 105, 116, 109, 97, 112,
+    112, 101, 100, 95, 114, 117, 110, 40, 108, 111, 99, 97, 108, 32, 99, 111,
+    110, 115, 116, 32, 117, 105, 110, 116, 32, 42, 32, 119, 44, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 99, 48, 44, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 99, 49, 44, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 101, 114, 111, 115, 105, 111, 110, 41, 10, 123, 10, 32,
+    32, 117, 105, 110, 116, 32, 97, 99, 99, 32, 61, 32, 101, 114, 111, 115,
+    105, 111, 110, 32, 63, 32, 48, 120, 70, 70, 70, 70, 70, 70, 70, 70,
+    32, 58, 32, 48, 59, 10, 32, 32, 105, 110, 116, 32, 99, 32, 61, 32,
+    99, 48, 59, 10, 32, 32, 119, 104, 105, 108, 101, 32, 40, 99, 32, 60,
+    61, 32, 99, 49, 41, 10, 32, 32, 123, 10, 32, 32, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 109, 32, 61, 32, 99, 32, 62, 62,
+    32, 53, 59, 32, 47, 47, 32, 102, 108, 111, 111, 114, 40, 99, 32, 47,
+    32, 51, 50, 41, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 102, 105, 114, 115, 116, 32, 61, 32, 99, 32, 45, 32, 40,
+    109, 32, 60, 60, 32, 53, 41, 59, 10, 32, 32, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 108, 97, 115, 116, 32, 61, 32, 109, 105,
+    110, 40, 99, 49, 32, 45, 32, 40, 109, 32, 60, 60, 32, 53, 41, 44,
+    32, 51, 49, 41, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32,
+    117, 108, 111, 110, 103, 32, 119, 105, 110, 100, 111, 119, 32, 61, 32, 40,
+    40, 117, 108, 111, 110, 103, 41, 119, 91, 109, 93, 32, 60, 60, 32, 51,
+    50, 41, 32, 124, 32, 119, 91, 109, 32, 43, 32, 49, 93, 59, 10, 32,
+    32, 32, 32, 99, 111, 110, 115, 116, 32, 117, 105, 110, 116, 32, 118, 32,
+    61, 32, 40, 117, 105, 110, 116, 41, 40, 40, 98, 105, 116, 109, 97, 112,
+    112, 101, 100, 95, 115, 109, 101, 97, 114, 40, 119, 105, 110, 100, 111, 119,
+    44, 32, 108, 97, 115, 116, 32, 45, 32, 102, 105, 114, 115, 116, 32, 43,
+    32, 49, 44, 32, 101, 114, 111, 115, 105, 111, 110, 41, 32, 60, 60, 32,
+    102, 105, 114, 115, 116, 41, 32, 62, 62, 32, 51, 50, 41, 59, 10, 32,
+    32, 32, 32, 97, 99, 99, 32, 61, 32, 101, 114, 111, 115, 105, 111, 110,
+    32, 63, 32, 97, 99, 99, 32, 38, 32, 118, 32, 58, 32, 97, 99, 99,
+    32, 124, 32, 118, 59, 10, 32, 32, 32, 32, 99, 32, 61, 32, 40, 109,
+    32, 43, 32, 49, 41, 32, 60, 60, 32, 53, 59, 10, 32, 32, 125, 10,
+    32, 32, 114, 101, 116, 117, 114, 110, 32, 97, 99, 99, 59, 10, 125, 10,
+    10, 47, 47, 32, 108, 111, 99, 97, 108, 95, 114, 117, 110, 115, 32, 105,
+    115, 32, 51, 32, 42, 32, 115, 101, 95, 110, 114, 117, 110, 115, 44, 32,
+    108, 111, 99, 97, 108, 95, 105, 109, 103, 32, 105, 115, 10, 47, 47, 32,
+    40, 108, 121, 115, 105, 122, 101, 32, 43, 32, 50, 32, 42, 32, 115, 101,
+    95, 114, 111, 119, 114, 97, 100, 41, 32, 42, 32, 40, 108, 120, 115, 105,
+    122, 101, 32, 43, 32, 50, 32, 42, 32, 40, 115, 101, 95, 99, 111, 108,
+    114, 97, 100, 32, 47, 32, 51, 50, 32, 43, 32, 49, 41, 41, 10, 118,
+    111, 105, 100, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 109, 111,
+    114, 112, 104, 40, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 42, 32, 105, 110, 44, 32, 103, 108, 111, 98, 97,
+    108, 32, 105, 110, 116, 32, 42, 32, 111, 117, 116, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 114, 111, 119,
+    115, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 99, 111,
+    108, 115, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 103, 108, 111, 98, 97, 108, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32, 115, 101, 95, 114,
+    117, 110, 115, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115,
+    101, 95, 110, 114, 117, 110, 115, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 115, 101, 95, 114, 111, 119, 114, 97,
+    100, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 101, 95,
+    99, 111, 108, 114, 97, 100, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 108, 111, 99,
+    97, 108, 32, 105, 110, 116, 32, 42, 32, 108, 111, 99, 97, 108, 95, 114,
+    117, 110, 115, 44, 32, 108, 111, 99, 97, 108, 32, 117, 105, 110, 116, 32,
+    42, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 101, 114, 111, 115,
+    105, 111, 110, 41, 10, 123, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 120, 32, 61, 32, 103, 101, 116, 95, 103, 108, 111, 98, 97,
+    108, 95, 105, 100, 40, 48, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 121, 32, 61, 32, 103, 101, 116, 95, 103, 108, 111,
+    98, 97, 108, 95, 105, 100, 40, 49, 41, 59, 10, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 108, 120, 32, 61, 32, 103, 101, 116, 95,
+    108, 111, 99, 97, 108, 95, 105, 100, 40, 48, 41, 59, 10, 32, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 121, 32, 61, 32, 103, 101,
+    116, 95, 108, 111, 99, 97, 108, 95, 105, 100, 40, 49, 41, 59, 10, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 120, 115, 105, 122,
+    101, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 115, 105,
+    122, 101, 40, 48, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 108, 121, 115, 105, 122, 101, 32, 61, 32, 103, 101, 116, 95,
+    108, 111, 99, 97, 108, 95, 115, 105, 122, 101, 40, 49, 41, 59, 10, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 98, 95, 110, 99, 111,
+    108, 115, 32, 61, 32, 110, 99, 111, 108, 115, 32, 62, 62, 32, 53, 59,
+    10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 99, 111,
+    114, 110, 101, 114, 95, 120, 32, 61, 32, 103, 101, 116, 95, 103, 114, 111,
+    117, 112, 95, 105, 100, 40, 48, 41, 32, 42, 32, 108, 120, 115, 105, 122,
+    101, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 99,
+    111, 114, 110, 101, 114, 95, 121, 32, 61, 32, 103, 101, 116, 95, 103, 114,
+    111, 117, 112, 95, 105, 100, 40, 49, 41, 32, 42, 32, 108, 121, 115, 105,
+    122, 101, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 32, 61, 32, 109, 97,
+    100, 50, 52, 40, 108, 121, 44, 32, 108, 120, 115, 105, 122, 101, 44, 32,
+    108, 120, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 32, 61, 32, 108, 120,
+    115, 105, 122, 101, 32, 42, 32, 108, 121, 115, 105, 122, 101, 59, 10, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 101, 95, 119,
+    111, 114, 100, 114, 97, 100, 32, 61, 32, 40, 115, 101, 95, 99, 111, 108,
+    114, 97, 100, 32, 62, 62, 32, 53, 41, 32, 43, 32, 49, 59, 10, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 112, 97, 100, 100, 101,
+    100, 95, 110, 114, 111, 119, 115, 32, 61, 32, 108, 121, 115, 105, 122, 101,
+    32, 43, 32, 115, 101, 95, 114, 111, 119, 114, 97, 100, 32, 42, 32, 50,
+    59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 112, 97,
+    100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 32, 61, 32, 108, 120, 115,
+    105, 122, 101, 32, 43, 32, 115, 101, 95, 119, 111, 114, 100, 114, 97, 100,
+    32, 42, 32, 50, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 108, 105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40,
+    112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 44, 32, 108, 121,
+    32, 43, 32, 115, 101, 95, 114, 111, 119, 114, 97, 100, 44, 32, 108, 120,
+    32, 43, 32, 115, 101, 95, 119, 111, 114, 100, 114, 97, 100, 41, 59, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 105, 100, 120, 32,
+    61, 32, 109, 97, 100, 50, 52, 40, 121, 44, 32, 98, 95, 110, 99, 111,
+    108, 115, 44, 32, 120, 41, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 115, 105, 122, 101, 32, 61, 32, 112, 97, 100, 100,
+    101, 100, 95, 110, 114, 111, 119, 115, 32, 42, 32, 112, 97, 100, 100, 101,
+    100, 95, 110, 99, 111, 108, 115, 59, 10, 10, 32, 32, 109, 101, 109, 99,
+    112, 121, 50, 108, 111, 99, 97, 108, 40, 108, 111, 99, 97, 108, 95, 114,
+    117, 110, 115, 44, 32, 115, 101, 95, 114, 117, 110, 115, 44, 32, 115, 101,
+    95, 110, 114, 117, 110, 115, 32, 42, 32, 51, 44, 32, 116, 104, 114, 101,
+    97, 100, 95, 105, 100, 120, 44, 32, 110, 98, 95, 116, 104, 114, 101, 97,
+    100, 115, 41, 59, 10, 32, 32, 47, 47, 32, 67, 111, 112, 121, 32, 115,
+    117, 98, 105, 109, 97, 103, 101, 32, 116, 111, 32, 108, 111, 99, 97, 108,
+    32, 109, 101, 109, 111, 114, 121, 10, 32, 32, 102, 111, 114, 32, 40, 105,
+    110, 116, 32, 105, 32, 61, 32, 116, 104, 114, 101, 97, 100, 95, 105, 100,
+    120, 59, 32, 105, 32, 60, 32, 115, 105, 122, 101, 59, 32, 105, 32, 43,
+    61, 32, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 41, 10, 32, 32,
+    123, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    100, 105, 118, 32, 61, 32, 105, 32, 47, 32, 112, 97, 100, 100, 101, 100,
+    95, 110, 99, 111, 108, 115, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 114, 101, 99, 116, 95, 114, 111, 119, 32, 61,
+    32, 100, 105, 118, 32, 43, 32, 99, 111, 114, 110, 101, 114, 95, 121, 32,
+    45, 32, 115, 101, 95, 114, 111, 119, 114, 97, 100, 59, 10, 32, 32, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 114, 101, 99, 116, 95,
+    99, 111, 108, 32, 61, 32, 105, 32, 45, 32, 100, 105, 118, 32, 42, 32,
+    112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 32, 43, 32, 99,
+    111, 114, 110, 101, 114, 95, 120, 32, 45, 32, 115, 101, 95, 119, 111, 114,
+    100, 114, 97, 100, 59, 10, 10, 32, 32, 32, 32, 105, 102, 32, 40, 114,
+    101, 99, 116, 95, 114, 111, 119, 32, 60, 32, 48, 32, 124, 124, 32, 114,
+    101, 99, 116, 95, 114, 111, 119, 32, 62, 61, 32, 110, 114, 111, 119, 115,
+    32, 124, 124, 32, 114, 101, 99, 116, 95, 99, 111, 108, 32, 60, 32, 48,
+    32, 124, 124, 32, 114, 101, 99, 116, 95, 99, 111, 108, 32, 62, 61, 32,
+    98, 95, 110, 99, 111, 108, 115, 41, 10, 32, 32, 32, 32, 123, 10, 32,
+    32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 105,
+    93, 32, 61, 32, 48, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32,
+    32, 101, 108, 115, 101, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 112, 105, 100, 120,
+    32, 61, 32, 109, 97, 100, 50, 52, 40, 114, 101, 99, 116, 95, 114, 111,
+    119, 44, 32, 98, 95, 110, 99, 111, 108, 115, 44, 32, 114, 101, 99, 116,
+    95, 99, 111, 108, 41, 59, 10, 32, 32, 32, 32, 32, 32, 108, 111, 99,
+    97, 108, 95, 105, 109, 103, 91, 105, 93, 32, 61, 32, 105, 110, 91, 112,
+    105, 100, 120, 93, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10,
+    32, 32, 98, 97, 114, 114, 105, 101, 114, 40, 67, 76, 75, 95, 76, 79,
+    67, 65, 76, 95, 77, 69, 77, 95, 70, 69, 78, 67, 69, 41, 59, 10,
+    10, 32, 32, 47, 47, 32, 66, 97, 105, 108, 32, 111, 117, 116, 32, 105,
+    102, 32, 119, 101, 32, 97, 114, 101, 32, 111, 117, 116, 115, 105, 100, 101,
+    32, 116, 104, 101, 32, 105, 109, 97, 103, 101, 10, 32, 32, 105, 102, 32,
+    40, 120, 32, 62, 61, 32, 98, 95, 110, 99, 111, 108, 115, 32, 124, 124,
+    32, 121, 32, 62, 61, 32, 110, 114, 111, 119, 115, 41, 10, 32, 32, 32,
+    32, 114, 101, 116, 117, 114, 110, 59, 10, 10, 32, 32, 117, 105, 110, 116,
+    32, 97, 99, 99, 32, 61, 32, 101, 114, 111, 115, 105, 111, 110, 32, 63,
+    32, 48, 120, 70, 70, 70, 70, 70, 70, 70, 70, 32, 58, 32, 48, 59,
+    10, 32, 32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 105, 32, 61, 32,
+    48, 59, 32, 105, 32, 60, 32, 115, 101, 95, 110, 114, 117, 110, 115, 32,
+    42, 32, 51, 59, 32, 105, 32, 43, 61, 32, 51, 41, 10, 32, 32, 123,
+    10, 32, 32, 32, 32, 108, 111, 99, 97, 108, 32, 99, 111, 110, 115, 116,
+    32, 117, 105, 110, 116, 32, 42, 32, 119, 32, 61, 32, 108, 111, 99, 97,
+    108, 95, 105, 109, 103, 32, 43, 32, 109, 97, 100, 50, 52, 40, 112, 97,
+    100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 44, 32, 108, 111, 99, 97,
+    108, 95, 114, 117, 110, 115, 91, 105, 93, 44, 32, 108, 105, 100, 120, 41,
+    59, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 117, 105, 110, 116,
+    32, 118, 32, 61, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 114,
+    117, 110, 40, 119, 44, 32, 108, 111, 99, 97, 108, 95, 114, 117, 110, 115,
+    91, 105, 43, 49, 93, 44, 32, 108, 111, 99, 97, 108, 95, 114, 117, 110,
+    115, 91, 105, 43, 50, 93, 44, 32, 101, 114, 111, 115, 105, 111, 110, 41,
+    59, 10, 32, 32, 32, 32, 97, 99, 99, 32, 61, 32, 101, 114, 111, 115,
+    105, 111, 110, 32, 63, 32, 97, 99, 99, 32, 38, 32, 118, 32, 58, 32,
+    97, 99, 99, 32, 124, 32, 118, 59, 10, 32, 32, 125, 10, 32, 32, 111,
+    117, 116, 91, 105, 100, 120, 93, 32, 61, 32, 97, 99, 99, 59, 10, 125,
+    10, 10, 107, 101, 114, 110, 101, 108, 32, 118, 111, 105, 100, 32, 98, 105,
+    116, 109, 97, 112, 112, 101, 100, 95, 100, 105, 108, 97, 116, 105, 111, 110,
+    40, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 42, 32, 105, 110, 44, 32, 103, 108, 111, 98, 97, 108, 32, 105,
+    110, 116, 32, 42, 32, 111, 117, 116, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 110, 114, 111, 119, 115, 44, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 110, 99, 111, 108, 115, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 103, 108, 111, 98, 97, 108,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32, 115, 101, 95,
+    114, 117, 110, 115, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    115, 101, 95, 110, 114, 117, 110, 115, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 115, 101, 95, 114, 111, 119, 114, 97, 100, 44, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 115, 101, 95, 99, 111, 108, 114, 97,
+    100, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 108, 111, 99, 97, 108, 32, 105, 110, 116, 32, 42, 32, 108, 111,
+    99, 97, 108, 95, 114, 117, 110, 115, 44, 32, 108, 111, 99, 97, 108, 32,
+    117, 105, 110, 116, 32, 42, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103,
+    41, 10, 123, 10, 32, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95,
+    109, 111, 114, 112, 104, 40, 105, 110, 44, 32, 111, 117, 116, 44, 32, 110,
+    114, 111, 119, 115, 44, 32, 110, 99, 111, 108, 115, 44, 32, 115, 101, 95,
+    114, 117, 110, 115, 44, 32, 115, 101, 95, 110, 114, 117, 110, 115, 44, 32,
+    115, 101, 95, 114, 111, 119, 114, 97, 100, 44, 32, 115, 101, 95, 99, 111,
+    108, 114, 97, 100, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 114, 117,
+    110, 115, 44, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 44, 32, 48,
+    41, 59, 10, 125, 10, 10, 107, 101, 114, 110, 101, 108, 32, 118, 111, 105,
+    100, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 101, 114, 111, 115,
+    105, 111, 110, 40, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 42, 32, 105, 110, 44, 32, 103, 108, 111, 98, 97,
+    108, 32, 105, 110, 116, 32, 42, 32, 111, 117, 116, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 110, 114, 111, 119, 115, 44, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 110, 99, 111, 108, 115, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 103, 108, 111, 98, 97,
+    108, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32, 115, 101,
+    95, 114, 117, 110, 115, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 115, 101, 95, 110, 114, 117, 110, 115, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 115, 101, 95, 114, 111, 119, 114, 97, 100, 44, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 115, 101, 95, 99, 111, 108, 114, 97,
+    100, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 108, 111, 99, 97, 108, 32, 105, 110, 116, 32, 42, 32, 108, 111, 99,
+    97, 108, 95, 114, 117, 110, 115, 44, 32, 108, 111, 99, 97, 108, 32, 117,
+    105, 110, 116, 32, 42, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 41,
+    10, 123, 10, 32, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 109,
+    111, 114, 112, 104, 40, 105, 110, 44, 32, 111, 117, 116, 44, 32, 110, 114,
+    111, 119, 115, 44, 32, 110, 99, 111, 108, 115, 44, 32, 115, 101, 95, 114,
+    117, 110, 115, 44, 32, 115, 101, 95, 110, 114, 117, 110, 115, 44, 32, 115,
+    101, 95, 114, 111, 119, 114, 97, 100, 44, 32, 115, 101, 95, 99, 111, 108,
+    114, 97, 100, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 114, 117, 110,
+    115, 44, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 44, 32, 49, 41,
+    59, 10, 125, 10, 35, 101, 110, 100, 105, 102, 10, 10, 35, 105, 102, 100,
+    101, 102, 32, 67, 76, 67, 86, 95, 83, 69, 67, 84, 73, 79, 78, 95,
+    82, 69, 67, 84, 95, 70, 85, 83, 69, 68, 10, 47, 47, 32, 70, 117,
+    115, 101, 100, 32, 111, 112, 101, 110, 105, 110, 103, 115, 47, 99, 108, 111,
+    115, 105, 110, 103, 115, 10, 47, 47, 32, 84, 104, 101, 32, 116, 105, 108,
+    101, 32, 105, 115, 32, 108, 111, 97, 100, 101, 100, 32, 111, 110, 99, 101,
+    32, 119, 105, 116, 104, 32, 97, 110, 32, 97, 112, 114, 111, 110, 32, 116,
+    119, 105, 99, 101, 32, 97, 115, 32, 108, 97, 114, 103, 101, 32, 97, 115,
+    32, 97, 32, 115, 105, 110, 103, 108, 101, 32, 111, 112, 101, 114, 97, 116,
+    111, 114, 10, 47, 47, 32, 110, 101, 101, 100, 115, 46, 32, 84, 104, 101,
+    32, 102, 105, 114, 115, 116, 32, 111, 112, 101, 114, 97, 116, 111, 114, 32,
+    114, 117, 110, 115, 32, 111, 118, 101, 114, 32, 116, 104, 101, 32, 116, 105,
+    108, 101, 32, 109, 105, 110, 117, 115, 32, 111, 110, 101, 32, 97, 112, 114,
+    111, 110, 44, 32, 116, 104, 101, 32, 115, 101, 99, 111, 110, 100, 10, 47,
+    47, 32, 111, 110, 101, 32, 111, 118, 101, 114, 32, 116, 104, 101, 32, 119,
+    111, 114, 107, 32, 103, 114, 111, 117, 112, 44, 32, 97, 110, 100, 32, 116,
+    104, 101, 32, 114, 101, 115, 117, 108, 116, 32, 105, 115, 32, 119, 114, 105,
+    116, 116, 101, 110, 32, 111, 110, 99, 101, 46, 32, 80, 105, 120, 101, 108,
+    115, 32, 111, 102, 32, 116, 104, 101, 10, 47, 47, 32, 105, 110, 116, 101,
+    114, 109, 101, 100, 105, 97, 116, 101, 32, 105, 109, 97, 103, 101, 32, 108,
+    121, 105, 110, 103, 32, 111, 117, 116, 115, 105, 100, 101, 32, 116, 104, 101,
+    32, 105, 109, 97, 103, 101, 32, 97, 114, 101, 32, 114, 101, 115, 101, 116,
+    32, 116, 111, 32, 48, 44, 32, 97, 115, 32, 116, 104, 101, 10, 47, 47,
+    32, 117, 110, 102, 117, 115, 101, 100, 32, 111, 112, 101, 114, 97, 116, 111,
+    114, 115, 32, 119, 111, 117, 108, 100, 32, 114, 101, 97, 100, 32, 116, 104,
+    101, 109, 46, 10, 10, 47, 47, 32, 82, 101, 99, 116, 97, 110, 103, 108,
+    101, 44, 32, 104, 111, 114, 105, 122, 111, 110, 116, 97, 108, 32, 115, 116,
+    101, 112, 32, 40, 115, 101, 95, 99, 111, 108, 114, 97, 100, 32, 60, 61,
+    32, 51, 50, 41, 10, 117, 105, 110, 116, 32, 98, 105, 116, 109, 97, 112,
+    112, 101, 100, 95, 114, 101, 99, 116, 95, 104, 40, 99, 111, 110, 115, 116,
+    32, 117, 105, 110, 116, 32, 119, 108, 44, 32, 99, 111, 110, 115, 116, 32,
+    117, 105, 110, 116, 32, 119, 44, 32, 99, 111, 110, 115, 116, 32, 117, 105,
+    110, 116, 32, 119, 114, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 115, 101, 95, 99, 111, 108, 114, 97, 100,
+    44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 101, 114, 111, 115,
+    105, 111, 110, 41, 10, 123, 10, 32, 32, 117, 105, 110, 116, 32, 97, 99,
+    99, 32, 61, 32, 119, 59, 10, 32, 32, 102, 111, 114, 32, 40, 105, 110,
+    116, 32, 105, 32, 61, 32, 49, 59, 32, 105, 32, 60, 61, 32, 115, 101,
+    95, 99, 111, 108, 114, 97, 100, 59, 32, 43, 43, 105, 41, 10, 32, 32,
+    123, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 117, 105, 110, 116,
+    32, 108, 32, 61, 32, 40, 119, 32, 62, 62, 32, 105, 41, 32, 124, 32,
+    40, 119, 108, 32, 60, 60, 32, 40, 51, 50, 45, 105, 41, 41, 59, 10,
+    32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 117, 105, 110, 116, 32, 114,
+    32, 61, 32, 40, 119, 32, 60, 60, 32, 105, 41, 32, 124, 32, 40, 119,
+    114, 32, 62, 62, 32, 40, 51, 50, 45, 105, 41, 41, 59, 10, 32, 32,
+    32, 32, 97, 99, 99, 32, 61, 32, 101, 114, 111, 115, 105, 111, 110, 32,
+    63, 32, 97, 99, 99, 32, 38, 32, 108, 32, 38, 32, 114, 32, 58, 32,
+    97, 99, 99, 32, 124, 32, 108, 32, 124, 32, 114, 59, 10, 32, 32, 125,
+    10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 97, 99, 99, 59, 10, 125,
+    10, 10, 47, 47, 32, 82, 101, 99, 116, 97, 110, 103, 108, 101, 44, 32,
+    118, 101, 114, 116, 105, 99, 97, 108, 32, 115, 116, 101, 112, 10, 117, 105,
+    110, 116, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 114, 101, 99,
+    116, 95, 118, 40, 108, 111, 99, 97, 108, 32, 99, 111, 110, 115, 116, 32,
+    117, 105, 110, 116, 32, 42, 32, 119, 44, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 115, 101, 95, 114, 111, 119, 114, 97, 100, 44, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 101, 114, 111, 115, 105, 111, 110, 41, 10,
+    123, 10, 32, 32, 117, 105, 110, 116, 32, 97, 99, 99, 32, 61, 32, 119,
+    91, 48, 93, 59, 10, 32, 32, 102, 111, 114, 32, 40, 105, 110, 116, 32,
+    114, 32, 61, 32, 49, 59, 32, 114, 32, 60, 61, 32, 115, 101, 95, 114,
+    111, 119, 114, 97, 100, 59, 32, 43, 43, 114, 41, 10, 32, 32, 123, 10,
+    32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 117, 105, 110, 116, 32, 117,
+    32, 61, 32, 119, 91, 45, 114, 32, 42, 32, 112, 97, 100, 100, 101, 100,
+    95, 110, 99, 111, 108, 115, 93, 59, 10, 32, 32, 32, 32, 99, 111, 110,
+    115, 116, 32, 117, 105, 110, 116, 32, 100, 32, 61, 32, 119, 91, 114, 32,
+    42, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 93, 59,
+    10, 32, 32, 32, 32, 97, 99, 99, 32, 61, 32, 101, 114, 111, 115, 105,
+    111, 110, 32, 63, 32, 97, 99, 99, 32, 38, 32, 117, 32, 38, 32, 100,
+    32, 58, 32, 97, 99, 99, 32, 124, 32, 117, 32, 124, 32, 100, 59, 10,
+    32, 32, 125, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 97, 99, 99,
+    59, 10, 125, 10, 35, 101, 110, 100, 105, 102, 10, 10, 35, 105, 102, 100,
+    101, 102, 32, 67, 76, 67, 86, 95, 83, 69, 67, 84, 73, 79, 78, 95,
+    82, 69, 83, 73, 68, 85, 69, 10, 47, 47, 32, 82, 101, 115, 105, 100,
+    117, 101, 115, 32, 40, 116, 111, 112, 45, 104, 97, 116, 115, 41, 32, 111,
+    102, 32, 116, 104, 101, 32, 102, 117, 115, 101, 100, 32, 111, 112, 101, 114,
+    97, 116, 111, 114, 115, 58, 32, 119, 104, 97, 116, 32, 116, 104, 101, 32,
+    111, 112, 101, 110, 105, 110, 103, 32, 114, 101, 109, 111, 118, 101, 100, 44,
+    32, 111, 114, 10, 47, 47, 32, 119, 104, 97, 116, 32, 116, 104, 101, 32,
+    99, 108, 111, 115, 105, 110, 103, 32, 97, 100, 100, 101, 100, 10, 117, 105,
+    110, 116, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 114, 101, 115,
+    105, 100, 117, 101, 40, 99, 111, 110, 115, 116, 32, 117, 105, 110, 116, 32,
+    105, 110, 44, 32, 99, 111, 110, 115, 116, 32, 117, 105, 110, 116, 32, 114,
+    101, 115, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 99, 108,
+    111, 115, 105, 110, 103, 41, 10, 123, 10, 32, 32, 114, 101, 116, 117, 114,
+    110, 32, 99, 108, 111, 115, 105, 110, 103, 32, 63, 32, 114, 101, 115, 32,
+    38, 32, 126, 105, 110, 32, 58, 32, 105, 110, 32, 38, 32, 126, 114, 101,
+    115, 59, 10, 125, 10, 35, 101, 110, 100, 105, 102, 10, 10, 35, 105, 102,
+    100, 101, 102, 32, 67, 76, 67, 86, 95, 83, 69, 67, 84, 73, 79, 78,
+    95, 82, 69, 67, 84, 95, 70, 85, 83, 69, 68, 10, 47, 47, 32, 108,
+    111, 99, 97, 108, 95, 105, 109, 103, 32, 97, 110, 100, 32, 108, 111, 99,
+    97, 108, 95, 116, 109, 112, 32, 97, 114, 101, 10, 47, 47, 32, 40, 108,
+    121, 115, 105, 122, 101, 32, 43, 32, 52, 32, 42, 32, 115, 101, 95, 114,
+    111, 119, 114, 97, 100, 41, 32, 42, 32, 40, 108, 120, 115, 105, 122, 101,
+    32, 43, 32, 52, 41, 32, 101, 97, 99, 104, 10, 118, 111, 105, 100, 32,
+    98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 114, 101, 99, 116, 95, 102,
+    117, 115, 101, 100, 40, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 42, 32, 105, 110, 44, 32, 103, 108, 111, 98,
+    97, 108, 32, 105, 110, 116, 32, 42, 32, 111, 117, 116, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 110, 114, 111, 119, 115, 44, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 110, 99, 111, 108, 115, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 101,
+    95, 114, 111, 119, 114, 97, 100, 44, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 115, 101, 95, 99, 111, 108, 114, 97, 100, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 32, 117, 105,
+    110, 116, 32, 42, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 44, 32,
+    108, 111, 99, 97, 108, 32, 117, 105, 110, 116, 32, 42, 32, 108, 111, 99,
+    97, 108, 95, 116, 109, 112, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 99, 108, 111, 115,
+    105, 110, 103, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 114,
+    101, 115, 105, 100, 117, 101, 41, 10, 123, 10, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 120, 32, 61, 32, 103, 101, 116, 95, 103, 108,
+    111, 98, 97, 108, 95, 105, 100, 40, 48, 41, 59, 10, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 121, 32, 61, 32, 103, 101, 116, 95,
+    103, 108, 111, 98, 97, 108, 95, 105, 100, 40, 49, 41, 59, 10, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 120, 32, 61, 32, 103,
+    101, 116, 95, 108, 111, 99, 97, 108, 95, 105, 100, 40, 48, 41, 59, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 121, 32, 61,
+    32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 105, 100, 40, 49, 41,
+    59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 120,
+    115, 105, 122, 101, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108,
+    95, 115, 105, 122, 101, 40, 48, 41, 59, 10, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 108, 121, 115, 105, 122, 101, 32, 61, 32, 103,
+    101, 116, 95, 108, 111, 99, 97, 108, 95, 115, 105, 122, 101, 40, 49, 41,
+    59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 98, 95,
+    110, 99, 111, 108, 115, 32, 61, 32, 110, 99, 111, 108, 115, 32, 62, 62,
+    32, 53, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 99, 111, 114, 110, 101, 114, 95, 120, 32, 61, 32, 103, 101, 116, 95,
+    103, 114, 111, 117, 112, 95, 105, 100, 40, 48, 41, 32, 42, 32, 108, 120,
+    115, 105, 122, 101, 32, 45, 32, 50, 59, 10, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 99, 111, 114, 110, 101, 114, 95, 121, 32, 61,
+    32, 103, 101, 116, 95, 103, 114, 111, 117, 112, 95, 105, 100, 40, 49, 41,
+    32, 42, 32, 108, 121, 115, 105, 122, 101, 32, 45, 32, 115, 101, 95, 114,
+    111, 119, 114, 97, 100, 32, 42, 32, 50, 59, 10, 10, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 116, 104, 114, 101, 97, 100, 95, 105,
+    100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40, 108, 121, 44, 32, 108,
+    120, 115, 105, 122, 101, 44, 32, 108, 120, 41, 59, 10, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 110, 98, 95, 116, 104, 114, 101, 97,
+    100, 115, 32, 61, 32, 108, 120, 115, 105, 122, 101, 32, 42, 32, 108, 121,
+    115, 105, 122, 101, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 112, 97, 100, 100, 101, 100, 95, 110, 114, 111, 119, 115, 32,
+    61, 32, 108, 121, 115, 105, 122, 101, 32, 43, 32, 115, 101, 95, 114, 111,
+    119, 114, 97, 100, 32, 42, 32, 52, 59, 10, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111,
+    108, 115, 32, 61, 32, 108, 120, 115, 105, 122, 101, 32, 43, 32, 52, 59,
+    10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 105,
+    122, 101, 32, 61, 32, 112, 97, 100, 100, 101, 100, 95, 110, 114, 111, 119,
+    115, 32, 42, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115,
+    59, 10, 10, 32, 32, 47, 47, 32, 67, 111, 112, 121, 32, 115, 117, 98,
+    105, 109, 97, 103, 101, 32, 116, 111, 32, 108, 111, 99, 97, 108, 32, 109,
+    101, 109, 111, 114, 121, 10, 32, 32, 102, 111, 114, 32, 40, 105, 110, 116,
+    32, 105, 32, 61, 32, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 59,
+    32, 105, 32, 60, 32, 115, 105, 122, 101, 59, 32, 105, 32, 43, 61, 32,
+    110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 41, 10, 32, 32, 123, 10,
+    32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 100, 105,
+    118, 32, 61, 32, 105, 32, 47, 32, 112, 97, 100, 100, 101, 100, 95, 110,
+    99, 111, 108, 115, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 114, 101, 99, 116, 95, 114, 111, 119, 32, 61, 32, 100,
+    105, 118, 32, 43, 32, 99, 111, 114, 110, 101, 114, 95, 121, 59, 10, 32,
+    32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 114, 101, 99,
+    116, 95, 99, 111, 108, 32, 61, 32, 105, 32, 45, 32, 100, 105, 118, 32,
+    42, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 32, 43,
+    32, 99, 111, 114, 110, 101, 114, 95, 120, 59, 10, 10, 32, 32, 32, 32,
+    105, 102, 32, 40, 114, 101, 99, 116, 95, 114, 111, 119, 32, 60, 32, 48,
+    32, 124, 124, 32, 114, 101, 99, 116, 95, 114, 111, 119, 32, 62, 61, 32,
+    110, 114, 111, 119, 115, 32, 124, 124, 32, 114, 101, 99, 116, 95, 99, 111,
+    108, 32, 60, 32, 48, 32, 124, 124, 32, 114, 101, 99, 116, 95, 99, 111,
+    108, 32, 62, 61, 32, 98, 95, 110, 99, 111, 108, 115, 41, 10, 32, 32,
+    32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95,
+    105, 109, 103, 91, 105, 93, 32, 61, 32, 48, 59, 10, 32, 32, 32, 32,
+    125, 10, 32, 32, 32, 32, 101, 108, 115, 101, 10, 32, 32, 32, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 112, 105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40, 114, 101,
+    99, 116, 95, 114, 111, 119, 44, 32, 98, 95, 110, 99, 111, 108, 115, 44,
+    32, 114, 101, 99, 116, 95, 99, 111, 108, 41, 59, 10, 32, 32, 32, 32,
+    32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 105, 93, 32, 61,
+    32, 105, 110, 91, 112, 105, 100, 120, 93, 59, 10, 32, 32, 32, 32, 125,
+    10, 32, 32, 125, 10, 32, 32, 98, 97, 114, 114, 105, 101, 114, 40, 67,
+    76, 75, 95, 76, 79, 67, 65, 76, 95, 77, 69, 77, 95, 70, 69, 78,
+    67, 69, 41, 59, 10, 10, 32, 32, 47, 47, 32, 70, 105, 114, 115, 116,
+    32, 111, 112, 101, 114, 97, 116, 111, 114, 44, 32, 104, 111, 114, 105, 122,
+    111, 110, 116, 97, 108, 32, 115, 116, 101, 112, 58, 32, 97, 108, 108, 32,
+    116, 104, 101, 32, 114, 111, 119, 115, 44, 32, 97, 108, 108, 32, 98, 117,
+    116, 32, 116, 104, 101, 32, 111, 117, 116, 101, 114, 32, 99, 111, 108, 117,
+    109, 110, 115, 10, 32, 32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 105,
+    32, 61, 32, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 59, 32, 105,
+    32, 60, 32, 115, 105, 122, 101, 59, 32, 105, 32, 43, 61, 32, 110, 98,
+    95, 116, 104, 114, 101, 97, 100, 115, 41, 10, 32, 32, 123, 10, 32, 32,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 99, 111, 108, 32,
+    61, 32, 105, 32, 45, 32, 40, 105, 32, 47, 32, 112, 97, 100, 100, 101,
+    100, 95, 110, 99, 111, 108, 115, 41, 32, 42, 32, 112, 97, 100, 100, 101,
+    100, 95, 110, 99, 111, 108, 115, 59, 10, 32, 32, 32, 32, 105, 102, 32,
+    40, 99, 111, 108, 32, 62, 32, 48, 32, 38, 38, 32, 99, 111, 108, 32,
+    60, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 32, 45,
+    32, 49, 41, 10, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95,
+    116, 109, 112, 91, 105, 93, 32, 61, 32, 98, 105, 116, 109, 97, 112, 112,
+    101, 100, 95, 114, 101, 99, 116, 95, 104, 40, 108, 111, 99, 97, 108, 95,
+    105, 109, 103, 91, 105, 45, 49, 93, 44, 32, 108, 111, 99, 97, 108, 95,
+    105, 109, 103, 91, 105, 93, 44, 32, 108, 111, 99, 97, 108, 95, 105, 109,
+    103, 91, 105, 43, 49, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 115, 101,
+    95, 99, 111, 108, 114, 97, 100, 44, 32, 33, 99, 108, 111, 115, 105, 110,
+    103, 41, 59, 10, 32, 32, 125, 10, 32, 32, 98, 97, 114, 114, 105, 101,
+    114, 40, 67, 76, 75, 95, 76, 79, 67, 65, 76, 95, 77, 69, 77, 95,
+    70, 69, 78, 67, 69, 41, 59, 10, 10, 32, 32, 47, 47, 32, 70, 105,
+    114, 115, 116, 32, 111, 112, 101, 114, 97, 116, 111, 114, 44, 32, 118, 101,
+    114, 116, 105, 99, 97, 108, 32, 115, 116, 101, 112, 58, 32, 98, 97, 99,
+    107, 32, 105, 110, 116, 111, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103,
+    44, 32, 119, 105, 116, 104, 111, 117, 116, 32, 116, 104, 101, 32, 111, 117,
+    116, 101, 114, 32, 114, 111, 119, 115, 10, 32, 32, 102, 111, 114, 32, 40,
+    105, 110, 116, 32, 105, 32, 61, 32, 116, 104, 114, 101, 97, 100, 95, 105,
+    100, 120, 59, 32, 105, 32, 60, 32, 115, 105, 122, 101, 59, 32, 105, 32,
+    43, 61, 32, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 41, 10, 32,
+    32, 123, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 100, 105, 118, 32, 61, 32, 105, 32, 47, 32, 112, 97, 100, 100, 101,
+    100, 95, 110, 99, 111, 108, 115, 59, 10, 32, 32, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 99, 111, 108, 32, 61, 32, 105, 32, 45,
+    32, 100, 105, 118, 32, 42, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99,
+    111, 108, 115, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 100, 105, 118,
+    32, 62, 61, 32, 115, 101, 95, 114, 111, 119, 114, 97, 100, 32, 38, 38,
+    32, 100, 105, 118, 32, 60, 32, 112, 97, 100, 100, 101, 100, 95, 110, 114,
+    111, 119, 115, 32, 45, 32, 115, 101, 95, 114, 111, 119, 114, 97, 100, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 38, 38, 32, 99, 111, 108, 32, 62,
+    32, 48, 32, 38, 38, 32, 99, 111, 108, 32, 60, 32, 112, 97, 100, 100,
+    101, 100, 95, 110, 99, 111, 108, 115, 32, 45, 32, 49, 41, 10, 32, 32,
+    32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 114, 101, 99, 116, 95, 114, 111, 119, 32, 61, 32, 100,
+    105, 118, 32, 43, 32, 99, 111, 114, 110, 101, 114, 95, 121, 59, 10, 32,
+    32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 114,
+    101, 99, 116, 95, 99, 111, 108, 32, 61, 32, 99, 111, 108, 32, 43, 32,
+    99, 111, 114, 110, 101, 114, 95, 120, 59, 10, 32, 32, 32, 32, 32, 32,
+    105, 102, 32, 40, 114, 101, 99, 116, 95, 114, 111, 119, 32, 60, 32, 48,
+    32, 124, 124, 32, 114, 101, 99, 116, 95, 114, 111, 119, 32, 62, 61, 32,
+    110, 114, 111, 119, 115, 32, 124, 124, 32, 114, 101, 99, 116, 95, 99, 111,
+    108, 32, 60, 32, 48, 32, 124, 124, 32, 114, 101, 99, 116, 95, 99, 111,
+    108, 32, 62, 61, 32, 98, 95, 110, 99, 111, 108, 115, 41, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91,
+    105, 93, 32, 61, 32, 48, 59, 10, 32, 32, 32, 32, 32, 32, 101, 108,
+    115, 101, 10, 32, 32, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108,
+    95, 105, 109, 103, 91, 105, 93, 32, 61, 32, 98, 105, 116, 109, 97, 112,
+    112, 101, 100, 95, 114, 101, 99, 116, 95, 118, 40, 108, 111, 99, 97, 108,
+    95, 116, 109, 112, 32, 43, 32, 105, 44, 32, 112, 97, 100, 100, 101, 100,
+    95, 110, 99, 111, 108, 115, 44, 32, 115, 101, 95, 114, 111, 119, 114, 97,
+    100, 44, 32, 33, 99, 108, 111, 115, 105, 110, 103, 41, 59, 10, 32, 32,
+    32, 32, 125, 10, 32, 32, 125, 10, 32, 32, 98, 97, 114, 114, 105, 101,
+    114, 40, 67, 76, 75, 95, 76, 79, 67, 65, 76, 95, 77, 69, 77, 95,
+    70, 69, 78, 67, 69, 41, 59, 10, 10, 32, 32, 47, 47, 32, 83, 101,
+    99, 111, 110, 100, 32, 111, 112, 101, 114, 97, 116, 111, 114, 44, 32, 104,
+    111, 114, 105, 122, 111, 110, 116, 97, 108, 32, 115, 116, 101, 112, 10, 32,
+    32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 105, 32, 61, 32, 116, 104,
+    114, 101, 97, 100, 95, 105, 100, 120, 59, 32, 105, 32, 60, 32, 115, 105,
+    122, 101, 59, 32, 105, 32, 43, 61, 32, 110, 98, 95, 116, 104, 114, 101,
+    97, 100, 115, 41, 10, 32, 32, 123, 10, 32, 32, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 100, 105, 118, 32, 61, 32, 105, 32, 47,
+    32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 59, 10, 32,
+    32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 99, 111, 108,
+    32, 61, 32, 105, 32, 45, 32, 100, 105, 118, 32, 42, 32, 112, 97, 100,
+    100, 101, 100, 95, 110, 99, 111, 108, 115, 59, 10, 32, 32, 32, 32, 105,
+    102, 32, 40, 100, 105, 118, 32, 62, 61, 32, 115, 101, 95, 114, 111, 119,
+    114, 97, 100, 32, 38, 38, 32, 100, 105, 118, 32, 60, 32, 112, 97, 100,
+    100, 101, 100, 95, 110, 114, 111, 119, 115, 32, 45, 32, 115, 101, 95, 114,
+    111, 119, 114, 97, 100, 10, 32, 32, 32, 32, 32, 32, 32, 32, 38, 38,
+    32, 99, 111, 108, 32, 62, 32, 49, 32, 38, 38, 32, 99, 111, 108, 32,
+    60, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 32, 45,
+    32, 50, 41, 10, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95,
+    116, 109, 112, 91, 105, 93, 32, 61, 32, 98, 105, 116, 109, 97, 112, 112,
+    101, 100, 95, 114, 101, 99, 116, 95, 104, 40, 108, 111, 99, 97, 108, 95,
+    105, 109, 103, 91, 105, 45, 49, 93, 44, 32, 108, 111, 99, 97, 108, 95,
+    105, 109, 103, 91, 105, 93, 44, 32, 108, 111, 99, 97, 108, 95, 105, 109,
+    103, 91, 105, 43, 49, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 115, 101,
+    95, 99, 111, 108, 114, 97, 100, 44, 32, 99, 108, 111, 115, 105, 110, 103,
+    41, 59, 10, 32, 32, 125, 10, 32, 32, 98, 97, 114, 114, 105, 101, 114,
+    40, 67, 76, 75, 95, 76, 79, 67, 65, 76, 95, 77, 69, 77, 95, 70,
+    69, 78, 67, 69, 41, 59, 10, 10, 32, 32, 47, 47, 32, 66, 97, 105,
+    108, 32, 111, 117, 116, 32, 105, 102, 32, 119, 101, 32, 97, 114, 101, 32,
+    111, 117, 116, 115, 105, 100, 101, 32, 116, 104, 101, 32, 105, 109, 97, 103,
+    101, 10, 32, 32, 105, 102, 32, 40, 120, 32, 62, 61, 32, 98, 95, 110,
+    99, 111, 108, 115, 32, 124, 124, 32, 121, 32, 62, 61, 32, 110, 114, 111,
+    119, 115, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 59, 10,
+    10, 32, 32, 47, 47, 32, 83, 101, 99, 111, 110, 100, 32, 111, 112, 101,
+    114, 97, 116, 111, 114, 44, 32, 118, 101, 114, 116, 105, 99, 97, 108, 32,
+    115, 116, 101, 112, 10, 32, 32, 123, 10, 32, 32, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 108, 105, 100, 120, 32, 61, 32, 109, 97,
+    100, 50, 52, 40, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115,
+    44, 32, 108, 121, 32, 43, 32, 115, 101, 95, 114, 111, 119, 114, 97, 100,
+    32, 42, 32, 50, 44, 32, 108, 120, 32, 43, 32, 50, 41, 59, 10, 32,
+    32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 105, 100, 120,
+    32, 61, 32, 109, 97, 100, 50, 52, 40, 121, 44, 32, 98, 95, 110, 99,
+    111, 108, 115, 44, 32, 120, 41, 59, 10, 32, 32, 32, 32, 99, 111, 110,
+    115, 116, 32, 117, 105, 110, 116, 32, 114, 101, 115, 32, 61, 32, 98, 105,
+    116, 109, 97, 112, 112, 101, 100, 95, 114, 101, 99, 116, 95, 118, 40, 108,
+    111, 99, 97, 108, 95, 116, 109, 112, 32, 43, 32, 108, 105, 100, 120, 44,
+    32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 44, 32, 115,
+    101, 95, 114, 111, 119, 114, 97, 100, 44, 32, 99, 108, 111, 115, 105, 110,
+    103, 41, 59, 10, 32, 32, 32, 32, 111, 117, 116, 91, 105, 100, 120, 93,
+    32, 61, 32, 114, 101, 115, 105, 100, 117, 101, 32, 63, 32, 98, 105, 116,
+    109, 97, 112, 112, 101, 100, 95, 114, 101, 115, 105, 100, 117, 101, 40, 105,
+    110, 91, 105, 100, 120, 93, 44, 32, 114, 101, 115, 44, 32, 99, 108, 111,
+    115, 105, 110, 103, 41, 32, 58, 32, 114, 101, 115, 59, 10, 32, 32, 125,
+    10, 125, 10, 10, 107, 101, 114, 110, 101, 108, 32, 118, 111, 105, 100, 32,
+    98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 111, 112, 101, 110, 105, 110,
+    103, 95, 114, 101, 99, 116, 40, 103, 108, 111, 98, 97, 108, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 42, 32, 105, 110, 44, 32, 103, 108,
+    111, 98, 97, 108, 32, 105, 110, 116, 32, 42, 32, 111, 117, 116, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 114, 111,
+    119, 115, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 99,
+    111, 108, 115, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 115, 101, 95, 114, 111, 119, 114, 97, 100, 44, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 115, 101, 95, 99, 111, 108, 114, 97, 100,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 32, 117, 105, 110, 116, 32,
+    42, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 44, 32, 108, 111, 99,
+    97, 108, 32, 117, 105, 110, 116, 32, 42, 32, 108, 111, 99, 97, 108, 95,
+    116, 109, 112, 41, 10, 123, 10, 32, 32, 98, 105, 116, 109, 97, 112, 112,
+    101, 100, 95, 114, 101, 99, 116, 95, 102, 117, 115, 101, 100, 40, 105, 110,
+    44, 32, 111, 117, 116, 44, 32, 110, 114, 111, 119, 115, 44, 32, 110, 99,
+    111, 108, 115, 44, 32, 115, 101, 95, 114, 111, 119, 114, 97, 100, 44, 32,
+    115, 101, 95, 99, 111, 108, 114, 97, 100, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 44, 32, 108, 111, 99,
+    97, 108, 95, 116, 109, 112, 44, 32, 48, 44, 32, 48, 41, 59, 10, 125,
+    10, 10, 107, 101, 114, 110, 101, 108, 32, 118, 111, 105, 100, 32, 98, 105,
+    116, 109, 97, 112, 112, 101, 100, 95, 99, 108, 111, 115, 105, 110, 103, 95,
+    114, 101, 99, 116, 40, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 42, 32, 105, 110, 44, 32, 103, 108, 111, 98,
+    97, 108, 32, 105, 110, 116, 32, 42, 32, 111, 117, 116, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 114, 111, 119, 115,
+    44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 99, 111, 108,
+    115, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    115, 101, 95, 114, 111, 119, 114, 97, 100, 44, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 115, 101, 95, 99, 111, 108, 114, 97, 100, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 108, 111, 99, 97, 108, 32, 117, 105, 110, 116, 32, 42, 32,
+    108, 111, 99, 97, 108, 95, 105, 109, 103, 44, 32, 108, 111, 99, 97, 108,
+    32, 117, 105, 110, 116, 32, 42, 32, 108, 111, 99, 97, 108, 95, 116, 109,
+    112, 41, 10, 123, 10, 32, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100,
+    95, 114, 101, 99, 116, 95, 102, 117, 115, 101, 100, 40, 105, 110, 44, 32,
+    111, 117, 116, 44, 32, 110, 114, 111, 119, 115, 44, 32, 110, 99, 111, 108,
+    115, 44, 32, 115, 101, 95, 114, 111, 119, 114, 97, 100, 44, 32, 115, 101,
+    95, 99, 111, 108, 114, 97, 100, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    108, 111, 99, 97, 108, 95, 105, 109, 103, 44, 32, 108, 111, 99, 97, 108,
+    95, 116, 109, 112, 44, 32, 49, 44, 32, 48, 41, 59, 10, 125, 10, 10,
+    107, 101, 114, 110, 101, 108, 32, 118, 111, 105, 100, 32, 98, 105, 116, 109,
+    97, 112, 112, 101, 100, 95, 116, 111, 112, 104, 97, 116, 95, 114, 101, 99,
+    116, 40, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 42, 32, 105, 110, 44, 32, 103, 108, 111, 98, 97, 108, 32,
+    105, 110, 116, 32, 42, 32, 111, 117, 116, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 110, 114, 111, 119, 115, 44, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 110, 99, 111, 108, 115, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 101, 95, 114, 111,
+    119, 114, 97, 100, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    115, 101, 95, 99, 111, 108, 114, 97, 100, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 108, 111, 99,
+    97, 108, 32, 117, 105, 110, 116, 32, 42, 32, 108, 111, 99, 97, 108, 95,
+    105, 109, 103, 44, 32, 108, 111, 99, 97, 108, 32, 117, 105, 110, 116, 32,
+    42, 32, 108, 111, 99, 97, 108, 95, 116, 109, 112, 41, 10, 123, 10, 32,
+    32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 114, 101, 99, 116, 95,
+    102, 117, 115, 101, 100, 40, 105, 110, 44, 32, 111, 117, 116, 44, 32, 110,
+    114, 111, 119, 115, 44, 32, 110, 99, 111, 108, 115, 44, 32, 115, 101, 95,
+    114, 111, 119, 114, 97, 100, 44, 32, 115, 101, 95, 99, 111, 108, 114, 97,
+    100, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95,
+    105, 109, 103, 44, 32, 108, 111, 99, 97, 108, 95, 116, 109, 112, 44, 32,
+    48, 44, 32, 49, 41, 59, 10, 125, 10, 10, 107, 101, 114, 110, 101, 108,
+    32, 118, 111, 105, 100, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95,
+    98, 108, 97, 99, 107, 104, 97, 116, 95, 114, 101, 99, 116, 40, 103, 108,
+    111, 98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 42,
+    32, 105, 110, 44, 32, 103, 108, 111, 98, 97, 108, 32, 105, 110, 116, 32,
+    42, 32, 111, 117, 116, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 110, 114, 111, 119, 115, 44, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 110, 99, 111, 108, 115, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 101, 95, 114, 111,
+    119, 114, 97, 100, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    115, 101, 95, 99, 111, 108, 114, 97, 100, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 108,
+    111, 99, 97, 108, 32, 117, 105, 110, 116, 32, 42, 32, 108, 111, 99, 97,
+    108, 95, 105, 109, 103, 44, 32, 108, 111, 99, 97, 108, 32, 117, 105, 110,
+    116, 32, 42, 32, 108, 111, 99, 97, 108, 95, 116, 109, 112, 41, 10, 123,
+    10, 32, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 114, 101, 99,
+    116, 95, 102, 117, 115, 101, 100, 40, 105, 110, 44, 32, 111, 117, 116, 44,
+    32, 110, 114, 111, 119, 115, 44, 32, 110, 99, 111, 108, 115, 44, 32, 115,
+    101, 95, 114, 111, 119, 114, 97, 100, 44, 32, 115, 101, 95, 99, 111, 108,
+    114, 97, 100, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97,
+    108, 95, 105, 109, 103, 44, 32, 108, 111, 99, 97, 108, 95, 116, 109, 112,
+    44, 32, 49, 44, 32, 49, 41, 59, 10, 125, 10, 35, 101, 110, 100, 105,
+    102, 10, 10, 35, 105, 102, 100, 101, 102, 32, 67, 76, 67, 86, 95, 83,
+    69, 67, 84, 73, 79, 78, 95, 82, 85, 78, 83, 10, 47, 47, 32, 65,
+    110, 121, 32, 102, 108, 97, 116, 32, 83, 69, 44, 32, 101, 110, 99, 111,
+    100, 101, 100, 32, 97, 115, 32, 114, 117, 110, 115, 32, 40, 115, 101, 101,
+    32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 109, 111, 114, 112, 104,
+    41, 10, 117, 105, 110, 116, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100,
+    95, 114, 117, 110, 115, 40, 108, 111, 99, 97, 108, 32, 99, 111, 110, 115,
+    116, 32, 117, 105, 110, 116, 32, 42, 32, 119, 44, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111,
+    108, 115, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 42, 32, 108, 111, 99, 97, 108, 95,
+    114, 117, 110, 115, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    115, 101, 95, 110, 114, 117, 110, 115, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 101, 114, 111, 115, 105, 111, 110, 41,
+    10, 123, 10, 32, 32, 117, 105, 110, 116, 32, 97, 99, 99, 32, 61, 32,
+    101, 114, 111, 115, 105, 111, 110, 32, 63, 32, 48, 120, 70, 70, 70, 70,
+    70, 70, 70, 70, 32, 58, 32, 48, 59, 10, 32, 32, 102, 111, 114, 32,
+    40, 105, 110, 116, 32, 105, 32, 61, 32, 48, 59, 32, 105, 32, 60, 32,
+    115, 101, 95, 110, 114, 117, 110, 115, 32, 42, 32, 51, 59, 32, 105, 32,
+    43, 61, 32, 51, 41, 10, 32, 32, 123, 10, 32, 32, 32, 32, 99, 111,
+    110, 115, 116, 32, 117, 105, 110, 116, 32, 118, 32, 61, 32, 98, 105, 116,
+    109, 97, 112, 112, 101, 100, 95, 114, 117, 110, 40, 119, 32, 43, 32, 108,
+    111, 99, 97, 108, 95, 114, 117, 110, 115, 91, 105, 93, 32, 42, 32, 112,
+    97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 108, 111,
+    99, 97, 108, 95, 114, 117, 110, 115, 91, 105, 43, 49, 93, 44, 32, 108,
+    111, 99, 97, 108, 95, 114, 117, 110, 115, 91, 105, 43, 50, 93, 44, 32,
+    101, 114, 111, 115, 105, 111, 110, 41, 59, 10, 32, 32, 32, 32, 97, 99,
+    99, 32, 61, 32, 101, 114, 111, 115, 105, 111, 110, 32, 63, 32, 97, 99,
+    99, 32, 38, 32, 118, 32, 58, 32, 97, 99, 99, 32, 124, 32, 118, 59,
+    10, 32, 32, 125, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 97, 99,
+    99, 59, 10, 125, 10, 35, 101, 110, 100, 105, 102, 10, 10, 35, 105, 102,
+    100, 101, 102, 32, 67, 76, 67, 86, 95, 83, 69, 67, 84, 73, 79, 78,
+    95, 82, 85, 78, 83, 95, 70, 85, 83, 69, 68, 10, 47, 47, 32, 108,
+    111, 99, 97, 108, 95, 114, 117, 110, 115, 32, 105, 115, 32, 51, 32, 42,
+    32, 115, 101, 95, 110, 114, 117, 110, 115, 44, 32, 108, 111, 99, 97, 108,
+    95, 105, 109, 103, 32, 97, 110, 100, 32, 108, 111, 99, 97, 108, 95, 116,
+    109, 112, 32, 97, 114, 101, 10, 47, 47, 32, 40, 108, 121, 115, 105, 122,
+    101, 32, 43, 32, 52, 32, 42, 32, 115, 101, 95, 114, 111, 119, 114, 97,
+    100, 41, 32, 42, 32, 40, 108, 120, 115, 105, 122, 101, 32, 43, 32, 52,
+    32, 42, 32, 40, 115, 101, 95, 99, 111, 108, 114, 97, 100, 32, 47, 32,
+    51, 50, 32, 43, 32, 49, 41, 41, 32, 101, 97, 99, 104, 10, 118, 111,
+    105, 100, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 109, 111, 114,
+    112, 104, 95, 102, 117, 115, 101, 100, 40, 103, 108, 111, 98, 97, 108, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32, 105, 110, 44, 32,
+    103, 108, 111, 98, 97, 108, 32, 105, 110, 116, 32, 42, 32, 111, 117, 116,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 110, 114, 111, 119, 115, 44, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 110, 99, 111, 108, 115, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 103, 108, 111, 98, 97, 108,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32, 115, 101, 95,
+    114, 117, 110, 115, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    115, 101, 95, 110, 114, 117, 110, 115, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115,
+    101, 95, 114, 111, 119, 114, 97, 100, 44, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 115, 101, 95, 99, 111, 108, 114, 97, 100, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 32,
+    105, 110, 116, 32, 42, 32, 108, 111, 99, 97, 108, 95, 114, 117, 110, 115,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 108, 111, 99,
+    97, 108, 32, 117, 105, 110, 116, 32, 42, 32, 108, 111, 99, 97, 108, 95,
+    105, 109, 103, 44, 32, 108, 111, 99, 97, 108, 32, 117, 105, 110, 116, 32,
+    42, 32, 108, 111, 99, 97, 108, 95, 116, 109, 112, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 99, 108, 111, 115, 105, 110, 103, 44, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 114, 101, 115, 105, 100, 117, 101, 41, 10, 123, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 120, 32, 61, 32,
+    103, 101, 116, 95, 103, 108, 111, 98, 97, 108, 95, 105, 100, 40, 48, 41,
+    59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 121, 32,
+    61, 32, 103, 101, 116, 95, 103, 108, 111, 98, 97, 108, 95, 105, 100, 40,
+    49, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    108, 120, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 105,
+    100, 40, 48, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 108, 121, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108,
+    95, 105, 100, 40, 49, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 108, 120, 115, 105, 122, 101, 32, 61, 32, 103, 101, 116,
+    95, 108, 111, 99, 97, 108, 95, 115, 105, 122, 101, 40, 48, 41, 59, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 121, 115, 105,
+    122, 101, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 115,
+    105, 122, 101, 40, 49, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 98, 95, 110, 99, 111, 108, 115, 32, 61, 32, 110, 99,
+    111, 108, 115, 32, 62, 62, 32, 53, 59, 10, 10, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 115, 101, 95, 119, 111, 114, 100, 114, 97,
+    100, 32, 61, 32, 40, 115, 101, 95, 99, 111, 108, 114, 97, 100, 32, 62,
+    62, 32, 53, 41, 32, 43, 32, 49, 59, 10, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 99, 111, 114, 110, 101, 114, 95, 120, 32, 61,
+    32, 103, 101, 116, 95, 103, 114, 111, 117, 112, 95, 105, 100, 40, 48, 41,
+    32, 42, 32, 108, 120, 115, 105, 122, 101, 32, 45, 32, 115, 101, 95, 119,
+    111, 114, 100, 114, 97, 100, 32, 42, 32, 50, 59, 10, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 99, 111, 114, 110, 101, 114, 95, 121,
+    32, 61, 32, 103, 101, 116, 95, 103, 114, 111, 117, 112, 95, 105, 100, 40,
+    49, 41, 32, 42, 32, 108, 121, 115, 105, 122, 101, 32, 45, 32, 115, 101,
+    95, 114, 111, 119, 114, 97, 100, 32, 42, 32, 50, 59, 10, 10, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 116, 104, 114, 101, 97, 100,
+    95, 105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40, 108, 121, 44,
+    32, 108, 120, 115, 105, 122, 101, 44, 32, 108, 120, 41, 59, 10, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 98, 95, 116, 104, 114,
+    101, 97, 100, 115, 32, 61, 32, 108, 120, 115, 105, 122, 101, 32, 42, 32,
+    108, 121, 115, 105, 122, 101, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 112, 97, 100, 100, 101, 100, 95, 110, 114, 111, 119,
+    115, 32, 61, 32, 108, 121, 115, 105, 122, 101, 32, 43, 32, 115, 101, 95,
+    114, 111, 119, 114, 97, 100, 32, 42, 32, 52, 59, 10, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 112, 97, 100, 100, 101, 100, 95, 110,
+    99, 111, 108, 115, 32, 61, 32, 108, 120, 115, 105, 122, 101, 32, 43, 32,
+    115, 101, 95, 119, 111, 114, 100, 114, 97, 100, 32, 42, 32, 52, 59, 10,
+    10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 105, 122,
+    101, 32, 61, 32, 112, 97, 100, 100, 101, 100, 95, 110, 114, 111, 119, 115,
+    32, 42, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 59,
+    10, 10, 32, 32, 109, 101, 109, 99, 112, 121, 50, 108, 111, 99, 97, 108,
+    40, 108, 111, 99, 97, 108, 95, 114, 117, 110, 115, 44, 32, 115, 101, 95,
+    114, 117, 110, 115, 44, 32, 115, 101, 95, 110, 114, 117, 110, 115, 32, 42,
+    32, 51, 44, 32, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 44, 32,
+    110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 41, 59, 10, 32, 32, 47,
+    47, 32, 67, 111, 112, 121, 32, 115, 117, 98, 105, 109, 97, 103, 101, 32,
+    116, 111, 32, 108, 111, 99, 97, 108, 32, 109, 101, 109, 111, 114, 121, 10,
+    32, 32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 105, 32, 61, 32, 116,
+    104, 114, 101, 97, 100, 95, 105, 100, 120, 59, 32, 105, 32, 60, 32, 115,
+    105, 122, 101, 59, 32, 105, 32, 43, 61, 32, 110, 98, 95, 116, 104, 114,
+    101, 97, 100, 115, 41, 10, 32, 32, 123, 10, 32, 32, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 100, 105, 118, 32, 61, 32, 105, 32,
+    47, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 59, 10,
+    32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 114, 101,
+    99, 116, 95, 114, 111, 119, 32, 61, 32, 100, 105, 118, 32, 43, 32, 99,
+    111, 114, 110, 101, 114, 95, 121, 59, 10, 32, 32, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 114, 101, 99, 116, 95, 99, 111, 108, 32,
+    61, 32, 105, 32, 45, 32, 100, 105, 118, 32, 42, 32, 112, 97, 100, 100,
+    101, 100, 95, 110, 99, 111, 108, 115, 32, 43, 32, 99, 111, 114, 110, 101,
+    114, 95, 120, 59, 10, 10, 32, 32, 32, 32, 105, 102, 32, 40, 114, 101,
+    99, 116, 95, 114, 111, 119, 32, 60, 32, 48, 32, 124, 124, 32, 114, 101,
+    99, 116, 95, 114, 111, 119, 32, 62, 61, 32, 110, 114, 111, 119, 115, 32,
+    124, 124, 32, 114, 101, 99, 116, 95, 99, 111, 108, 32, 60, 32, 48, 32,
+    124, 124, 32, 114, 101, 99, 116, 95, 99, 111, 108, 32, 62, 61, 32, 98,
+    95, 110, 99, 111, 108, 115, 41, 10, 32, 32, 32, 32, 123, 10, 32, 32,
+    32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 105, 93,
+    32, 61, 32, 48, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32,
+    101, 108, 115, 101, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 112, 105, 100, 120, 32,
+    61, 32, 109, 97, 100, 50, 52, 40, 114, 101, 99, 116, 95, 114, 111, 119,
+    44, 32, 98, 95, 110, 99, 111, 108, 115, 44, 32, 114, 101, 99, 116, 95,
+    99, 111, 108, 41, 59, 10, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97,
+    108, 95, 105, 109, 103, 91, 105, 93, 32, 61, 32, 105, 110, 91, 112, 105,
+    100, 120, 93, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 32,
+    32, 98, 97, 114, 114, 105, 101, 114, 40, 67, 76, 75, 95, 76, 79, 67,
+    65, 76, 95, 77, 69, 77, 95, 70, 69, 78, 67, 69, 41, 59, 10, 10,
+    32, 32, 47, 47, 32, 70, 105, 114, 115, 116, 32, 111, 112, 101, 114, 97,
+    116, 111, 114, 32, 111, 118, 101, 114, 32, 116, 104, 101, 32, 116, 105, 108,
+    101, 32, 109, 105, 110, 117, 115, 32, 111, 110, 101, 32, 97, 112, 114, 111,
+    110, 10, 32, 32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 105, 32, 61,
+    32, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 59, 32, 105, 32, 60,
+    32, 115, 105, 122, 101, 59, 32, 105, 32, 43, 61, 32, 110, 98, 95, 116,
+    104, 114, 101, 97, 100, 115, 41, 10, 32, 32, 123, 10, 32, 32, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 100, 105, 118, 32, 61, 32,
+    105, 32, 47, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115,
+    59, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    99, 111, 108, 32, 61, 32, 105, 32, 45, 32, 100, 105, 118, 32, 42, 32,
+    112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 59, 10, 32, 32,
+    32, 32, 105, 102, 32, 40, 100, 105, 118, 32, 62, 61, 32, 115, 101, 95,
+    114, 111, 119, 114, 97, 100, 32, 38, 38, 32, 100, 105, 118, 32, 60, 32,
+    112, 97, 100, 100, 101, 100, 95, 110, 114, 111, 119, 115, 32, 45, 32, 115,
+    101, 95, 114, 111, 119, 114, 97, 100, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 38, 38, 32, 99, 111, 108, 32, 62, 61, 32, 115, 101, 95, 119, 111,
+    114, 100, 114, 97, 100, 32, 38, 38, 32, 99, 111, 108, 32, 60, 32, 112,
+    97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 32, 45, 32, 115, 101,
+    95, 119, 111, 114, 100, 114, 97, 100, 41, 10, 32, 32, 32, 32, 123, 10,
+    32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    114, 101, 99, 116, 95, 114, 111, 119, 32, 61, 32, 100, 105, 118, 32, 43,
+    32, 99, 111, 114, 110, 101, 114, 95, 121, 59, 10, 32, 32, 32, 32, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 114, 101, 99, 116, 95,
+    99, 111, 108, 32, 61, 32, 99, 111, 108, 32, 43, 32, 99, 111, 114, 110,
+    101, 114, 95, 120, 59, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32, 40,
+    114, 101, 99, 116, 95, 114, 111, 119, 32, 60, 32, 48, 32, 124, 124, 32,
+    114, 101, 99, 116, 95, 114, 111, 119, 32, 62, 61, 32, 110, 114, 111, 119,
+    115, 32, 124, 124, 32, 114, 101, 99, 116, 95, 99, 111, 108, 32, 60, 32,
+    48, 32, 124, 124, 32, 114, 101, 99, 116, 95, 99, 111, 108, 32, 62, 61,
+    32, 98, 95, 110, 99, 111, 108, 115, 41, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 108, 111, 99, 97, 108, 95, 116, 109, 112, 91, 105, 93, 32, 61,
+    32, 48, 59, 10, 32, 32, 32, 32, 32, 32, 101, 108, 115, 101, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 116, 109, 112,
+    91, 105, 93, 32, 61, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95,
+    114, 117, 110, 115, 40, 108, 111, 99, 97, 108, 95, 105, 109, 103, 32, 43,
+    32, 105, 44, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 114, 117,
+    110, 115, 44, 32, 115, 101, 95, 110, 114, 117, 110, 115, 44, 32, 33, 99,
+    108, 111, 115, 105, 110, 103, 41, 59, 10, 32, 32, 32, 32, 125, 10, 32,
+    32, 125, 10, 32, 32, 98, 97, 114, 114, 105, 101, 114, 40, 67, 76, 75,
+    95, 76, 79, 67, 65, 76, 95, 77, 69, 77, 95, 70, 69, 78, 67, 69,
+    41, 59, 10, 10, 32, 32, 47, 47, 32, 66, 97, 105, 108, 32, 111, 117,
+    116, 32, 105, 102, 32, 119, 101, 32, 97, 114, 101, 32, 111, 117, 116, 115,
+    105, 100, 101, 32, 116, 104, 101, 32, 105, 109, 97, 103, 101, 10, 32, 32,
+    105, 102, 32, 40, 120, 32, 62, 61, 32, 98, 95, 110, 99, 111, 108, 115,
+    32, 124, 124, 32, 121, 32, 62, 61, 32, 110, 114, 111, 119, 115, 41, 10,
+    32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 59, 10, 10, 32, 32, 47,
+    47, 32, 83, 101, 99, 111, 110, 100, 32, 111, 112, 101, 114, 97, 116, 111,
+    114, 10, 32, 32, 123, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 108, 105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52,
+    40, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 44, 32, 108,
+    121, 32, 43, 32, 115, 101, 95, 114, 111, 119, 114, 97, 100, 32, 42, 32,
+    50, 44, 32, 108, 120, 32, 43, 32, 115, 101, 95, 119, 111, 114, 100, 114,
+    97, 100, 32, 42, 32, 50, 41, 59, 10, 32, 32, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 105, 100, 120, 32, 61, 32, 109, 97, 100,
+    50, 52, 40, 121, 44, 32, 98, 95, 110, 99, 111, 108, 115, 44, 32, 120,
+    41, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 117, 105, 110,
+    116, 32, 114, 101, 115, 32, 61, 32, 98, 105, 116, 109, 97, 112, 112, 101,
+    100, 95, 114, 117, 110, 115, 40, 108, 111, 99, 97, 108, 95, 116, 109, 112,
+    32, 43, 32, 108, 105, 100, 120, 44, 32, 112, 97, 100, 100, 101, 100, 95,
+    110, 99, 111, 108, 115, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108,
+    95, 114, 117, 110, 115, 44, 32, 115, 101, 95, 110, 114, 117, 110, 115, 44,
+    32, 99, 108, 111, 115, 105, 110, 103, 41, 59, 10, 32, 32, 32, 32, 111,
+    117, 116, 91, 105, 100, 120, 93, 32, 61, 32, 114, 101, 115, 105, 100, 117,
+    101, 32, 63, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 114, 101,
+    115, 105, 100, 117, 101, 40, 105, 110, 91, 105, 100, 120, 93, 44, 32, 114,
+    101, 115, 44, 32, 99, 108, 111, 115, 105, 110, 103, 41, 32, 58, 32, 114,
+    101, 115, 59, 10, 32, 32, 125, 10, 125, 10, 10, 107, 101, 114, 110, 101,
+    108, 32, 118, 111, 105, 100, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100,
+    95, 111, 112, 101, 110, 105, 110, 103, 40, 103, 108, 111, 98, 97, 108, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32, 105, 110, 44, 32,
+    103, 108, 111, 98, 97, 108, 32, 105, 110, 116, 32, 42, 32, 111, 117, 116,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 114, 111, 119, 115, 44,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 99, 111, 108, 115,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 42, 32, 115, 101, 95, 114, 117, 110, 115, 44, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 115, 101, 95, 110, 114, 117, 110, 115, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 115, 101, 95, 114, 111, 119, 114, 97,
+    100, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 101, 95,
+    99, 111, 108, 114, 97, 100, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 32, 105, 110, 116, 32,
+    42, 32, 108, 111, 99, 97, 108, 95, 114, 117, 110, 115, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97,
+    108, 32, 117, 105, 110, 116, 32, 42, 32, 108, 111, 99, 97, 108, 95, 105,
+    109, 103, 44, 32, 108, 111, 99, 97, 108, 32, 117, 105, 110, 116, 32, 42,
+    32, 108, 111, 99, 97, 108, 95, 116, 109, 112, 41, 10, 123, 10, 32, 32,
+    98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 109, 111, 114, 112, 104, 95,
+    102, 117, 115, 101, 100, 40, 105, 110, 44, 32, 111, 117, 116, 44, 32, 110,
+    114, 111, 119, 115, 44, 32, 110, 99, 111, 108, 115, 44, 32, 115, 101, 95,
+    114, 117, 110, 115, 44, 32, 115, 101, 95, 110, 114, 117, 110, 115, 44, 32,
+    115, 101, 95, 114, 111, 119, 114, 97, 100, 44, 32, 115, 101, 95, 99, 111,
+    108, 114, 97, 100, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 108, 111,
+    99, 97, 108, 95, 114, 117, 110, 115, 44, 32, 108, 111, 99, 97, 108, 95,
+    105, 109, 103, 44, 32, 108, 111, 99, 97, 108, 95, 116, 109, 112, 44, 32,
+    48, 44, 32, 48, 41, 59, 10, 125, 10, 10, 107, 101, 114, 110, 101, 108,
+    32, 118, 111, 105, 100, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95,
+    99, 108, 111, 115, 105, 110, 103, 40, 103, 108, 111, 98, 97, 108, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32, 105, 110, 44, 32, 103,
+    108, 111, 98, 97, 108, 32, 105, 110, 116, 32, 42, 32, 111, 117, 116, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 114, 111, 119, 115, 44, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 99, 111, 108, 115, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 103,
+    108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    42, 32, 115, 101, 95, 114, 117, 110, 115, 44, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 115, 101, 95, 110, 114, 117, 110, 115, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 115, 101, 95, 114, 111, 119, 114, 97, 100,
+    44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 101, 95, 99,
+    111, 108, 114, 97, 100, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 32, 105, 110, 116, 32, 42,
+    32, 108, 111, 99, 97, 108, 95, 114, 117, 110, 115, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108,
+    32, 117, 105, 110, 116, 32, 42, 32, 108, 111, 99, 97, 108, 95, 105, 109,
+    103, 44, 32, 108, 111, 99, 97, 108, 32, 117, 105, 110, 116, 32, 42, 32,
+    108, 111, 99, 97, 108, 95, 116, 109, 112, 41, 10, 123, 10, 32, 32, 98,
+    105, 116, 109, 97, 112, 112, 101, 100, 95, 109, 111, 114, 112, 104, 95, 102,
+    117, 115, 101, 100, 40, 105, 110, 44, 32, 111, 117, 116, 44, 32, 110, 114,
+    111, 119, 115, 44, 32, 110, 99, 111, 108, 115, 44, 32, 115, 101, 95, 114,
+    117, 110, 115, 44, 32, 115, 101, 95, 110, 114, 117, 110, 115, 44, 32, 115,
+    101, 95, 114, 111, 119, 114, 97, 100, 44, 32, 115, 101, 95, 99, 111, 108,
+    114, 97, 100, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 108, 111, 99,
+    97, 108, 95, 114, 117, 110, 115, 44, 32, 108, 111, 99, 97, 108, 95, 105,
+    109, 103, 44, 32, 108, 111, 99, 97, 108, 95, 116, 109, 112, 44, 32, 49,
+    44, 32, 48, 41, 59, 10, 125, 10, 10, 107, 101, 114, 110, 101, 108, 32,
+    118, 111, 105, 100, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 116,
+    111, 112, 104, 97, 116, 40, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 42, 32, 105, 110, 44, 32, 103, 108, 111,
+    98, 97, 108, 32, 105, 110, 116, 32, 42, 32, 111, 117, 116, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 110, 114, 111, 119, 115, 44, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 110, 99, 111, 108, 115, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 103, 108, 111, 98, 97,
+    108, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32, 115, 101,
+    95, 114, 117, 110, 115, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 115, 101, 95, 110, 114, 117, 110, 115, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 115, 101, 95, 114, 111, 119, 114, 97, 100, 44, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 115, 101, 95, 99, 111, 108, 114, 97, 100,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 108,
+    111, 99, 97, 108, 32, 105, 110, 116, 32, 42, 32, 108, 111, 99, 97, 108,
+    95, 114, 117, 110, 115, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 108, 111, 99, 97, 108, 32, 117, 105, 110, 116, 32, 42,
+    32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 44, 32, 108, 111, 99, 97,
+    108, 32, 117, 105, 110, 116, 32, 42, 32, 108, 111, 99, 97, 108, 95, 116,
+    109, 112, 41, 10, 123, 10, 32, 32, 98, 105, 116, 109, 97, 112, 112, 101,
+    100, 95, 109, 111, 114, 112, 104, 95, 102, 117, 115, 101, 100, 40, 105, 110,
+    44, 32, 111, 117, 116, 44, 32, 110, 114, 111, 119, 115, 44, 32, 110, 99,
+    111, 108, 115, 44, 32, 115, 101, 95, 114, 117, 110, 115, 44, 32, 115, 101,
+    95, 110, 114, 117, 110, 115, 44, 32, 115, 101, 95, 114, 111, 119, 114, 97,
+    100, 44, 32, 115, 101, 95, 99, 111, 108, 114, 97, 100, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 114, 117, 110, 115,
+    44, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 44, 32, 108, 111, 99,
+    97, 108, 95, 116, 109, 112, 44, 32, 48, 44, 32, 49, 41, 59, 10, 125,
+    10, 10, 107, 101, 114, 110, 101, 108, 32, 118, 111, 105, 100, 32, 98, 105,
+    116, 109, 97, 112, 112, 101, 100, 95, 98, 108, 97, 99, 107, 104, 97, 116,
+    40, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 42, 32, 105, 110, 44, 32, 103, 108, 111, 98, 97, 108, 32, 105,
+    110, 116, 32, 42, 32, 111, 117, 116, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 110, 114, 111, 119, 115, 44, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 110, 99, 111, 108, 115, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 103, 108, 111, 98, 97, 108,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32, 115, 101, 95,
+    114, 117, 110, 115, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    115, 101, 95, 110, 114, 117, 110, 115, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 115, 101, 95, 114, 111, 119, 114, 97, 100, 44, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 115, 101, 95, 99, 111, 108, 114, 97,
+    100, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 108, 111, 99, 97, 108, 32, 105, 110, 116, 32, 42, 32, 108, 111,
+    99, 97, 108, 95, 114, 117, 110, 115, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 32, 117,
+    105, 110, 116, 32, 42, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 44,
+    32, 108, 111, 99, 97, 108, 32, 117, 105, 110, 116, 32, 42, 32, 108, 111,
+    99, 97, 108, 95, 116, 109, 112, 41, 10, 123, 10, 32, 32, 98, 105, 116,
+    109, 97, 112, 112, 101, 100, 95, 109, 111, 114, 112, 104, 95, 102, 117, 115,
+    101, 100, 40, 105, 110, 44, 32, 111, 117, 116, 44, 32, 110, 114, 111, 119,
+    115, 44, 32, 110, 99, 111, 108, 115, 44, 32, 115, 101, 95, 114, 117, 110,
+    115, 44, 32, 115, 101, 95, 110, 114, 117, 110, 115, 44, 32, 115, 101, 95,
+    114, 111, 119, 114, 97, 100, 44, 32, 115, 101, 95, 99, 111, 108, 114, 97,
+    100, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108,
+    95, 114, 117, 110, 115, 44, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103,
+    44, 32, 108, 111, 99, 97, 108, 95, 116, 109, 112, 44, 32, 49, 44, 32,
+    49, 41, 59, 10, 125, 10, 35, 101, 110, 100, 105, 102, 10, 10, 35, 105,
+    102, 100, 101, 102, 32, 67, 76, 67, 86, 95, 83, 69, 67, 84, 73, 79,
+    78, 95, 78, 65, 73, 86, 69, 10, 47, 47, 32, 84, 119, 111, 32, 110,
+    97, 105, 118, 101, 95, 109, 111, 114, 112, 104, 32, 105, 110, 32, 97, 32,
+    114, 111, 119, 32, 119, 105, 116, 104, 32, 116, 104, 101, 32, 115, 97, 109,
+    101, 32, 83, 69, 32, 40, 101, 46, 103, 46, 32, 97, 110, 32, 101, 114,
+    111, 115, 105, 111, 110, 32, 116, 104, 101, 110, 32, 97, 10, 47, 47, 32,
+    100, 105, 108, 97, 116, 105, 111, 110, 41, 46, 32, 114, 101, 115, 105, 100,
+    117, 101, 32, 49, 32, 111, 117, 116, 112, 117, 116, 115, 32, 116, 104, 101,
+    32, 105, 110, 112, 117, 116, 32, 109, 105, 110, 117, 115, 32, 116, 104, 101,
+    32, 114, 101, 115, 117, 108, 116, 32, 40, 119, 104, 105, 116, 101, 32, 116,
+    111, 112, 45, 104, 97, 116, 41, 44, 10, 47, 47, 32, 114, 101, 115, 105,
+    100, 117, 101, 32, 50, 32, 116, 104, 101, 32, 114, 101, 115, 117, 108, 116,
+    32, 109, 105, 110, 117, 115, 32, 116, 104, 101, 32, 105, 110, 112, 117, 116,
+    32, 40, 98, 108, 97, 99, 107, 32, 116, 111, 112, 45, 104, 97, 116, 41,
+    46, 32, 84, 104, 101, 32, 105, 110, 112, 117, 116, 32, 105, 115, 10, 47,
+    47, 32, 98, 105, 110, 97, 114, 121, 32, 40, 48, 47, 49, 41, 32, 108,
+    105, 107, 101, 32, 102, 111, 114, 32, 110, 97, 105, 118, 101, 95, 109, 111,
+    114, 112, 104, 46, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 32, 97,
+    110, 100, 32, 108, 111, 99, 97, 108, 95, 116, 109, 112, 32, 97, 114, 101,
+    10, 47, 47, 32, 40, 108, 121, 115, 105, 122, 101, 32, 43, 32, 52, 32,
+    42, 32, 115, 101, 95, 114, 111, 119, 114, 97, 100, 41, 32, 42, 32, 40,
+    108, 120, 115, 105, 122, 101, 32, 43, 32, 52, 32, 42, 32, 115, 101, 95,
+    99, 111, 108, 114, 97, 100, 41, 32, 101, 97, 99, 104, 10, 107, 101, 114,
+    110, 101, 108, 32, 118, 111, 105, 100, 32, 110, 97, 105, 118, 101, 95, 109,
+    111, 114, 112, 104, 95, 102, 117, 115, 101, 100, 40, 103, 108, 111, 98, 97,
+    108, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32, 105, 110,
+    44, 32, 103, 108, 111, 98, 97, 108, 32, 105, 110, 116, 32, 42, 32, 111,
+    117, 116, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 114, 111, 119,
+    115, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 99, 111,
+    108, 115, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 103, 108, 111, 98, 97, 108, 32, 105, 110, 116, 32, 42, 32, 115,
+    101, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 101, 95,
+    114, 111, 119, 114, 97, 100, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 115, 101, 95, 99, 111, 108, 114, 97, 100, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 115, 101, 95, 99, 111, 117, 110, 116, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 115, 101, 95, 116, 97, 114, 103, 101, 116,
+    115, 117, 109, 49, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    115, 101, 95, 116, 97, 114, 103, 101, 116, 115, 117, 109, 50, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 114, 101, 115, 105, 100, 117, 101, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 108, 111,
+    99, 97, 108, 32, 105, 110, 116, 32, 42, 32, 108, 111, 99, 97, 108, 95,
+    115, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 108, 111, 99, 97, 108, 32, 105, 110, 116, 32, 42, 32, 108, 111,
+    99, 97, 108, 95, 105, 109, 103, 44, 32, 108, 111, 99, 97, 108, 32, 105,
+    110, 116, 32, 42, 32, 108, 111, 99, 97, 108, 95, 116, 109, 112, 41, 10,
+    123, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 120, 32,
+    61, 32, 103, 101, 116, 95, 103, 108, 111, 98, 97, 108, 95, 105, 100, 40,
+    48, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    121, 32, 61, 32, 103, 101, 116, 95, 103, 108, 111, 98, 97, 108, 95, 105,
+    100, 40, 49, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 108, 120, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108,
+    95, 105, 100, 40, 48, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 108, 121, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99,
+    97, 108, 95, 105, 100, 40, 49, 41, 59, 10, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 108, 120, 115, 105, 122, 101, 32, 61, 32, 103,
+    101, 116, 95, 108, 111, 99, 97, 108, 95, 115, 105, 122, 101, 40, 48, 41,
+    59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 121,
+    115, 105, 122, 101, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108,
+    95, 115, 105, 122, 101, 40, 49, 41, 59, 10, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 99, 111, 114, 110, 101, 114, 95, 120, 32, 61,
+    32, 103, 101, 116, 95, 103, 114, 111, 117, 112, 95, 105, 100, 40, 48, 41,
+    32, 42, 32, 108, 120, 115, 105, 122, 101, 32, 45, 32, 115, 101, 95, 99,
+    111, 108, 114, 97, 100, 32, 42, 32, 50, 59, 10, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 99, 111, 114, 110, 101, 114, 95, 121, 32,
+    61, 32, 103, 101, 116, 95, 103, 114, 111, 117, 112, 95, 105, 100, 40, 49,
+    41, 32, 42, 32, 108, 121, 115, 105, 122, 101, 32, 45, 32, 115, 101, 95,
+    114, 111, 119, 114, 97, 100, 32, 42, 32, 50, 59, 10, 10, 32, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 116, 104, 114, 101, 97, 100, 95,
+    105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40, 108, 121, 44, 32,
+    108, 120, 115, 105, 122, 101, 44, 32, 108, 120, 41, 59, 10, 32, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 98, 95, 116, 104, 114, 101,
+    97, 100, 115, 32, 61, 32, 108, 120, 115, 105, 122, 101, 32, 42, 32, 108,
+    121, 115, 105, 122, 101, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 115, 101, 95, 115, 105, 122, 101, 32, 61, 32, 115, 101,
+    95, 99, 111, 117, 110, 116, 32, 42, 32, 50, 32, 43, 32, 115, 101, 95,
+    99, 111, 117, 110, 116, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 112, 97, 100, 100, 101, 100, 95, 110, 114, 111, 119, 115,
+    32, 61, 32, 108, 121, 115, 105, 122, 101, 32, 43, 32, 115, 101, 95, 114,
+    111, 119, 114, 97, 100, 32, 42, 32, 52, 59, 10, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99,
+    111, 108, 115, 32, 61, 32, 108, 120, 115, 105, 122, 101, 32, 43, 32, 115,
+    101, 95, 99, 111, 108, 114, 97, 100, 32, 42, 32, 52, 59, 10, 10, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 105, 122, 101, 32,
+    61, 32, 112, 97, 100, 100, 101, 100, 95, 110, 114, 111, 119, 115, 32, 42,
+    32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 59, 10, 10,
+    32, 32, 110, 97, 105, 118, 101, 95, 108, 111, 99, 97, 108, 105, 109, 103,
+    95, 115, 101, 116, 117, 112, 40, 105, 110, 44, 32, 115, 101, 44, 32, 108,
+    111, 99, 97, 108, 95, 105, 109, 103, 44, 32, 108, 111, 99, 97, 108, 95,
+    115, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 116, 104, 114, 101, 97,
+    100, 95, 105, 100, 120, 44, 32, 110, 98, 95, 116, 104, 114, 101, 97, 100,
+    115, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 110, 114, 111, 119, 115, 44,
+    32, 110, 99, 111, 108, 115, 44, 32, 112, 97, 100, 100, 101, 100, 95, 110,
+    114, 111, 119, 115, 44, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111,
+    108, 115, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 114, 110, 101,
+    114, 95, 121, 44, 32, 99, 111, 114, 110, 101, 114, 95, 120, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 115, 101, 95, 115, 105, 122, 101, 41, 59, 10,
+    10, 32, 32, 47, 47, 32, 70, 105, 114, 115, 116, 32, 111, 112, 101, 114,
+    97, 116, 111, 114, 32, 111, 118, 101, 114, 32, 116, 104, 101, 32, 116, 105,
+    108, 101, 32, 109, 105, 110, 117, 115, 32, 111, 110, 101, 32, 97, 112, 114,
+    111, 110, 46, 32, 84, 104, 101, 32, 114, 101, 115, 117, 108, 116, 32, 105,
+    115, 32, 107, 101, 112, 116, 32, 105, 110, 32, 116, 104, 101, 10, 32, 32,
+    47, 47, 32, 115, 97, 109, 101, 32, 40, 45, 49, 47, 49, 41, 32, 102,
+    111, 114, 109, 97, 116, 32, 97, 115, 32, 116, 104, 101, 32, 105, 110, 112,
+    117, 116, 32, 116, 105, 108, 101, 46, 10, 32, 32, 102, 111, 114, 32, 40,
+    105, 110, 116, 32, 105, 32, 61, 32, 116, 104, 114, 101, 97, 100, 95, 105,
+    100, 120, 59, 32, 105, 32, 60, 32, 115, 105, 122, 101, 59, 32, 105, 32,
+    43, 61, 32, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 41, 10, 32,
+    32, 123, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 100, 105, 118, 32, 61, 32, 105, 32, 47, 32, 112, 97, 100, 100, 101,
+    100, 95, 110, 99, 111, 108, 115, 59, 10, 32, 32, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 99, 111, 108, 32, 61, 32, 105, 32, 45,
+    32, 100, 105, 118, 32, 42, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99,
+    111, 108, 115, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 100, 105, 118,
+    32, 62, 61, 32, 115, 101, 95, 114, 111, 119, 114, 97, 100, 32, 38, 38,
+    32, 100, 105, 118, 32, 60, 32, 112, 97, 100, 100, 101, 100, 95, 110, 114,
+    111, 119, 115, 32, 45, 32, 115, 101, 95, 114, 111, 119, 114, 97, 100, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 38, 38, 32, 99, 111, 108, 32, 62,
+    61, 32, 115, 101, 95, 99, 111, 108, 114, 97, 100, 32, 38, 38, 32, 99,
+    111, 108, 32, 60, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108,
+    115, 32, 45, 32, 115, 101, 95, 99, 111, 108, 114, 97, 100, 41, 10, 32,
+    32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 114, 101, 99, 116, 95, 114, 111, 119, 32, 61, 32,
+    100, 105, 118, 32, 43, 32, 99, 111, 114, 110, 101, 114, 95, 121, 59, 10,
+    32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    114, 101, 99, 116, 95, 99, 111, 108, 32, 61, 32, 99, 111, 108, 32, 43,
+    32, 99, 111, 114, 110, 101, 114, 95, 120, 59, 10, 32, 32, 32, 32, 32,
+    32, 105, 110, 116, 32, 97, 99, 99, 32, 61, 32, 48, 59, 10, 32, 32,
+    32, 32, 32, 32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 106, 32, 61,
+    32, 48, 59, 32, 106, 32, 60, 32, 115, 101, 95, 115, 105, 122, 101, 59,
+    32, 106, 32, 43, 61, 32, 51, 41, 10, 32, 32, 32, 32, 32, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 114, 105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40,
+    112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 44, 32, 108, 111,
+    99, 97, 108, 95, 115, 101, 91, 106, 93, 44, 32, 105, 32, 43, 32, 108,
+    111, 99, 97, 108, 95, 115, 101, 91, 106, 43, 49, 93, 41, 59, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 97, 99, 99, 32, 61, 32, 109, 97, 100,
+    50, 52, 40, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 114, 105, 100,
+    120, 93, 44, 32, 108, 111, 99, 97, 108, 95, 115, 101, 91, 106, 43, 50,
+    93, 44, 32, 97, 99, 99, 41, 59, 10, 32, 32, 32, 32, 32, 32, 125,
+    10, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 116, 109, 112,
+    91, 105, 93, 32, 61, 32, 114, 101, 99, 116, 95, 114, 111, 119, 32, 60,
+    32, 48, 32, 124, 124, 32, 114, 101, 99, 116, 95, 114, 111, 119, 32, 62,
+    61, 32, 110, 114, 111, 119, 115, 32, 124, 124, 32, 114, 101, 99, 116, 95,
+    99, 111, 108, 32, 60, 32, 48, 32, 124, 124, 32, 114, 101, 99, 116, 95,
+    99, 111, 108, 32, 62, 61, 32, 110, 99, 111, 108, 115, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 63, 32, 45, 49, 32, 58, 32, 115, 101, 108, 101,
+    99, 116, 40, 45, 49, 44, 32, 49, 44, 32, 97, 99, 99, 32, 62, 61,
+    32, 115, 101, 95, 116, 97, 114, 103, 101, 116, 115, 117, 109, 49, 41, 59,
+    10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 32, 32, 98, 97, 114,
+    114, 105, 101, 114, 40, 67, 76, 75, 95, 76, 79, 67, 65, 76, 95, 77,
+    69, 77, 95, 70, 69, 78, 67, 69, 41, 59, 10, 10, 32, 32, 47, 47,
+    32, 83, 101, 99, 111, 110, 100, 32, 111, 112, 101, 114, 97, 116, 111, 114,
+    10, 32, 32, 123, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 108, 105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40,
+    112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 44, 32, 108, 121,
+    32, 43, 32, 115, 101, 95, 114, 111, 119, 114, 97, 100, 32, 42, 32, 50,
+    44, 32, 108, 120, 32, 43, 32, 115, 101, 95, 99, 111, 108, 114, 97, 100,
+    32, 42, 32, 50, 41, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52,
+    40, 121, 44, 32, 110, 99, 111, 108, 115, 44, 32, 120, 41, 59, 10, 32,
+    32, 32, 32, 105, 110, 116, 32, 97, 99, 99, 32, 61, 32, 48, 59, 10,
+    32, 32, 32, 32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 106, 32, 61,
+    32, 48, 59, 32, 106, 32, 60, 32, 115, 101, 95, 115, 105, 122, 101, 59,
+    32, 106, 32, 43, 61, 32, 51, 41, 10, 32, 32, 32, 32, 123, 10, 32,
+    32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 114,
+    105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40, 112, 97, 100, 100,
+    101, 100, 95, 110, 99, 111, 108, 115, 44, 32, 108, 111, 99, 97, 108, 95,
+    115, 101, 91, 106, 93, 44, 32, 108, 105, 100, 120, 32, 43, 32, 108, 111,
+    99, 97, 108, 95, 115, 101, 91, 106, 43, 49, 93, 41, 59, 10, 32, 32,
+    32, 32, 32, 32, 97, 99, 99, 32, 61, 32, 109, 97, 100, 50, 52, 40,
+    108, 111, 99, 97, 108, 95, 116, 109, 112, 91, 114, 105, 100, 120, 93, 44,
+    32, 108, 111, 99, 97, 108, 95, 115, 101, 91, 106, 43, 50, 93, 44, 32,
+    97, 99, 99, 41, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 114, 101, 115, 32, 61, 32,
+    115, 101, 108, 101, 99, 116, 40, 48, 44, 32, 49, 44, 32, 97, 99, 99,
+    32, 62, 61, 32, 115, 101, 95, 116, 97, 114, 103, 101, 116, 115, 117, 109,
+    50, 41, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 118, 32, 61, 32, 105, 110, 91, 105, 100, 120, 93, 32, 33, 61,
+    32, 48, 59, 10, 32, 32, 32, 32, 111, 117, 116, 91, 105, 100, 120, 93,
+    32, 61, 32, 114, 101, 115, 105, 100, 117, 101, 32, 61, 61, 32, 49, 32,
+    63, 32, 118, 32, 38, 32, 126, 114, 101, 115, 32, 58, 32, 114, 101, 115,
+    105, 100, 117, 101, 32, 61, 61, 32, 50, 32, 63, 32, 114, 101, 115, 32,
+    38, 32, 126, 118, 32, 58, 32, 114, 101, 115, 59, 10, 32, 32, 125, 10,
+    125, 10, 35, 101, 110, 100, 105, 102, 10, 10, 35, 105, 102, 100, 101, 102,
+    32, 67, 76, 67, 86, 95, 83, 69, 67, 84, 73, 79, 78, 95, 82, 69,
+    67, 84, 95, 70, 85, 83, 69, 68, 10, 47, 47, 32, 77, 111, 114, 112,
+    104, 111, 108, 111, 103, 105, 99, 97, 108, 32, 103, 114, 97, 100, 105, 101,
+    110, 116, 115, 58, 32, 100, 105, 108, 97, 116, 105, 111, 110, 32, 109, 105,
+    110, 117, 115, 32, 101, 114, 111, 115, 105, 111, 110, 44, 32, 102, 114, 111,
+    109, 32, 116, 104, 101, 32, 115, 97, 109, 101, 32, 116, 105, 108, 101, 10,
+    10, 47, 47, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 44, 32, 108,
+    111, 99, 97, 108, 95, 100, 105, 108, 32, 97, 110, 100, 32, 108, 111, 99,
+    97, 108, 95, 101, 114, 111, 32, 97, 114, 101, 10, 47, 47, 32, 40, 108,
+    121, 115, 105, 122, 101, 32, 43, 32, 50, 32, 42, 32, 115, 101, 95, 114,
+    111, 119, 114, 97, 100, 41, 32, 42, 32, 40, 108, 120, 115, 105, 122, 101,
+    32, 43, 32, 50, 41, 32, 101, 97, 99, 104, 32, 40, 115, 101, 95, 99,
+    111, 108, 114, 97, 100, 32, 60, 61, 32, 51, 50, 41, 10, 107, 101, 114,
+    110, 101, 108, 32, 118, 111, 105, 100, 32, 98, 105, 116, 109, 97, 112, 112,
+    101, 100, 95, 103, 114, 97, 100, 105, 101, 110, 116, 95, 114, 101, 99, 116,
+    40, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 42, 32, 105, 110, 44, 32, 103, 108, 111, 98, 97, 108, 32, 105,
+    110, 116, 32, 42, 32, 111, 117, 116, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 110, 114, 111, 119, 115, 44, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 99, 111, 108, 115, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 101,
+    95, 114, 111, 119, 114, 97, 100, 44, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 115, 101, 95, 99, 111, 108, 114, 97, 100, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 108, 111, 99, 97, 108, 32, 117, 105, 110, 116, 32, 42, 32, 108,
+    111, 99, 97, 108, 95, 105, 109, 103, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 108, 111,
+    99, 97, 108, 32, 117, 105, 110, 116, 32, 42, 32, 108, 111, 99, 97, 108,
+    95, 100, 105, 108, 44, 32, 108, 111, 99, 97, 108, 32, 117, 105, 110, 116,
+    32, 42, 32, 108, 111, 99, 97, 108, 95, 101, 114, 111, 41, 10, 123, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 120, 32, 61, 32,
+    103, 101, 116, 95, 103, 108, 111, 98, 97, 108, 95, 105, 100, 40, 48, 41,
+    59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 121, 32,
+    61, 32, 103, 101, 116, 95, 103, 108, 111, 98, 97, 108, 95, 105, 100, 40,
+    49, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    108, 120, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 105,
+    100, 40, 48, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 108, 121, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108,
+    95, 105, 100, 40, 49, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 108, 120, 115, 105, 122, 101, 32, 61, 32, 103, 101, 116,
+    95, 108, 111, 99, 97, 108, 95, 115, 105, 122, 101, 40, 48, 41, 59, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 121, 115, 105,
+    122, 101, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 115,
+    105, 122, 101, 40, 49, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 98, 95, 110, 99, 111, 108, 115, 32, 61, 32, 110, 99,
+    111, 108, 115, 32, 62, 62, 32, 53, 59, 10, 10, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 99, 111, 114, 110, 101, 114, 95, 120, 32,
+    61, 32, 103, 101, 116, 95, 103, 114, 111, 117, 112, 95, 105, 100, 40, 48,
+    41, 32, 42, 32, 108, 120, 115, 105, 122, 101, 32, 45, 32, 49, 59, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 99, 111, 114, 110,
+    101, 114, 95, 121, 32, 61, 32, 103, 101, 116, 95, 103, 114, 111, 117, 112,
+    95, 105, 100, 40, 49, 41, 32, 42, 32, 108, 121, 115, 105, 122, 101, 32,
+    45, 32, 115, 101, 95, 114, 111, 119, 114, 97, 100, 59, 10, 10, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 116, 104, 114, 101, 97, 100,
+    95, 105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40, 108, 121, 44,
+    32, 108, 120, 115, 105, 122, 101, 44, 32, 108, 120, 41, 59, 10, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 98, 95, 116, 104, 114,
+    101, 97, 100, 115, 32, 61, 32, 108, 120, 115, 105, 122, 101, 32, 42, 32,
+    108, 121, 115, 105, 122, 101, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 112, 97, 100, 100, 101, 100, 95, 110, 114, 111, 119,
+    115, 32, 61, 32, 108, 121, 115, 105, 122, 101, 32, 43, 32, 115, 101, 95,
+    114, 111, 119, 114, 97, 100, 32, 42, 32, 50, 59, 10, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 112, 97, 100, 100, 101, 100, 95, 110,
+    99, 111, 108, 115, 32, 61, 32, 108, 120, 115, 105, 122, 101, 32, 43, 32,
+    50, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    115, 105, 122, 101, 32, 61, 32, 112, 97, 100, 100, 101, 100, 95, 110, 114,
+    111, 119, 115, 32, 42, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111,
+    108, 115, 59, 10, 10, 32, 32, 47, 47, 32, 67, 111, 112, 121, 32, 115,
+    117, 98, 105, 109, 97, 103, 101, 32, 116, 111, 32, 108, 111, 99, 97, 108,
+    32, 109, 101, 109, 111, 114, 121, 10, 32, 32, 102, 111, 114, 32, 40, 105,
+    110, 116, 32, 105, 32, 61, 32, 116, 104, 114, 101, 97, 100, 95, 105, 100,
+    120, 59, 32, 105, 32, 60, 32, 115, 105, 122, 101, 59, 32, 105, 32, 43,
+    61, 32, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 41, 10, 32, 32,
+    123, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    100, 105, 118, 32, 61, 32, 105, 32, 47, 32, 112, 97, 100, 100, 101, 100,
+    95, 110, 99, 111, 108, 115, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 114, 101, 99, 116, 95, 114, 111, 119, 32, 61,
+    32, 100, 105, 118, 32, 43, 32, 99, 111, 114, 110, 101, 114, 95, 121, 59,
+    10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 114,
+    101, 99, 116, 95, 99, 111, 108, 32, 61, 32, 105, 32, 45, 32, 100, 105,
+    118, 32, 42, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115,
+    32, 43, 32, 99, 111, 114, 110, 101, 114, 95, 120, 59, 10, 10, 32, 32,
+    32, 32, 105, 102, 32, 40, 114, 101, 99, 116, 95, 114, 111, 119, 32, 60,
+    32, 48, 32, 124, 124, 32, 114, 101, 99, 116, 95, 114, 111, 119, 32, 62,
+    61, 32, 110, 114, 111, 119, 115, 32, 124, 124, 32, 114, 101, 99, 116, 95,
+    99, 111, 108, 32, 60, 32, 48, 32, 124, 124, 32, 114, 101, 99, 116, 95,
+    99, 111, 108, 32, 62, 61, 32, 98, 95, 110, 99, 111, 108, 115, 41, 10,
+    32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97,
+    108, 95, 105, 109, 103, 91, 105, 93, 32, 61, 32, 48, 59, 10, 32, 32,
+    32, 32, 125, 10, 32, 32, 32, 32, 101, 108, 115, 101, 10, 32, 32, 32,
+    32, 123, 10, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 112, 105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40,
+    114, 101, 99, 116, 95, 114, 111, 119, 44, 32, 98, 95, 110, 99, 111, 108,
+    115, 44, 32, 114, 101, 99, 116, 95, 99, 111, 108, 41, 59, 10, 32, 32,
+    32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 105, 93,
+    32, 61, 32, 105, 110, 91, 112, 105, 100, 120, 93, 59, 10, 32, 32, 32,
+    32, 125, 10, 32, 32, 125, 10, 32, 32, 98, 97, 114, 114, 105, 101, 114,
+    40, 67, 76, 75, 95, 76, 79, 67, 65, 76, 95, 77, 69, 77, 95, 70,
+    69, 78, 67, 69, 41, 59, 10, 10, 32, 32, 47, 47, 32, 72, 111, 114,
+    105, 122, 111, 110, 116, 97, 108, 32, 115, 116, 101, 112, 115, 10, 32, 32,
+    102, 111, 114, 32, 40, 105, 110, 116, 32, 105, 32, 61, 32, 116, 104, 114,
+    101, 97, 100, 95, 105, 100, 120, 59, 32, 105, 32, 60, 32, 115, 105, 122,
+    101, 59, 32, 105, 32, 43, 61, 32, 110, 98, 95, 116, 104, 114, 101, 97,
+    100, 115, 41, 10, 32, 32, 123, 10, 32, 32, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 99, 111, 108, 32, 61, 32, 105, 32, 45, 32,
+    40, 105, 32, 47, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108,
+    115, 41, 32, 42, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108,
+    115, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 99, 111, 108, 32, 62,
+    32, 48, 32, 38, 38, 32, 99, 111, 108, 32, 60, 32, 112, 97, 100, 100,
+    101, 100, 95, 110, 99, 111, 108, 115, 32, 45, 32, 49, 41, 10, 32, 32,
+    32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95,
+    100, 105, 108, 91, 105, 93, 32, 61, 32, 98, 105, 116, 109, 97, 112, 112,
+    101, 100, 95, 114, 101, 99, 116, 95, 104, 40, 108, 111, 99, 97, 108, 95,
+    105, 109, 103, 91, 105, 45, 49, 93, 44, 32, 108, 111, 99, 97, 108, 95,
+    105, 109, 103, 91, 105, 93, 44, 32, 108, 111, 99, 97, 108, 95, 105, 109,
+    103, 91, 105, 43, 49, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 115, 101,
+    95, 99, 111, 108, 114, 97, 100, 44, 32, 48, 41, 59, 10, 32, 32, 32,
+    32, 32, 32, 108, 111, 99, 97, 108, 95, 101, 114, 111, 91, 105, 93, 32,
+    61, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 114, 101, 99, 116,
+    95, 104, 40, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 105, 45, 49,
+    93, 44, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 105, 93, 44,
+    32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 105, 43, 49, 93, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 115, 101, 95, 99, 111, 108, 114, 97, 100,
+    44, 32, 49, 41, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10,
+    32, 32, 98, 97, 114, 114, 105, 101, 114, 40, 67, 76, 75, 95, 76, 79,
+    67, 65, 76, 95, 77, 69, 77, 95, 70, 69, 78, 67, 69, 41, 59, 10,
+    10, 32, 32, 47, 47, 32, 66, 97, 105, 108, 32, 111, 117, 116, 32, 105,
+    102, 32, 119, 101, 32, 97, 114, 101, 32, 111, 117, 116, 115, 105, 100, 101,
+    32, 116, 104, 101, 32, 105, 109, 97, 103, 101, 10, 32, 32, 105, 102, 32,
+    40, 120, 32, 62, 61, 32, 98, 95, 110, 99, 111, 108, 115, 32, 124, 124,
+    32, 121, 32, 62, 61, 32, 110, 114, 111, 119, 115, 41, 10, 32, 32, 32,
+    32, 114, 101, 116, 117, 114, 110, 59, 10, 10, 32, 32, 47, 47, 32, 86,
+    101, 114, 116, 105, 99, 97, 108, 32, 115, 116, 101, 112, 115, 10, 32, 32,
+    123, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    108, 105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40, 112, 97, 100,
+    100, 101, 100, 95, 110, 99, 111, 108, 115, 44, 32, 108, 121, 32, 43, 32,
+    115, 101, 95, 114, 111, 119, 114, 97, 100, 44, 32, 108, 120, 32, 43, 32,
+    49, 41, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40, 121, 44,
+    32, 98, 95, 110, 99, 111, 108, 115, 44, 32, 120, 41, 59, 10, 32, 32,
+    32, 32, 111, 117, 116, 91, 105, 100, 120, 93, 32, 61, 32, 98, 105, 116,
+    109, 97, 112, 112, 101, 100, 95, 114, 101, 99, 116, 95, 118, 40, 108, 111,
+    99, 97, 108, 95, 100, 105, 108, 32, 43, 32, 108, 105, 100, 120, 44, 32,
+    112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 44, 32, 115, 101,
+    95, 114, 111, 119, 114, 97, 100, 44, 32, 48, 41, 10, 32, 32, 32, 32,
+    32, 32, 38, 32, 126, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 114,
+    101, 99, 116, 95, 118, 40, 108, 111, 99, 97, 108, 95, 101, 114, 111, 32,
+    43, 32, 108, 105, 100, 120, 44, 32, 112, 97, 100, 100, 101, 100, 95, 110,
+    99, 111, 108, 115, 44, 32, 115, 101, 95, 114, 111, 119, 114, 97, 100, 44,
+    32, 49, 41, 59, 10, 32, 32, 125, 10, 125, 10, 35, 101, 110, 100, 105,
+    102, 10, 10, 35, 105, 102, 100, 101, 102, 32, 67, 76, 67, 86, 95, 83,
+    69, 67, 84, 73, 79, 78, 95, 82, 85, 78, 83, 95, 70, 85, 83, 69,
+    68, 10, 47, 47, 32, 83, 97, 109, 101, 32, 108, 97, 121, 111, 117, 116,
+    32, 97, 115, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 109, 111,
+    114, 112, 104, 10, 107, 101, 114, 110, 101, 108, 32, 118, 111, 105, 100, 32,
+    98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 103, 114, 97, 100, 105, 101,
+    110, 116, 40, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 42, 32, 105, 110, 44, 32, 103, 108, 111, 98, 97, 108,
+    32, 105, 110, 116, 32, 42, 32, 111, 117, 116, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 110, 114, 111, 119, 115, 44, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 110, 99, 111, 108, 115, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 103, 108, 111, 98,
+    97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32, 115,
+    101, 95, 114, 117, 110, 115, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 115, 101, 95, 110, 114, 117, 110, 115, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 115, 101, 95, 114, 111, 119, 114, 97, 100, 44, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 101, 95, 99, 111, 108,
+    114, 97, 100, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 108, 111, 99, 97, 108, 32, 105, 110, 116, 32, 42, 32,
+    108, 111, 99, 97, 108, 95, 114, 117, 110, 115, 44, 32, 108, 111, 99, 97,
+    108, 32, 117, 105, 110, 116, 32, 42, 32, 108, 111, 99, 97, 108, 95, 105,
+    109, 103, 41, 10, 123, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 120, 32, 61, 32, 103, 101, 116, 95, 103, 108, 111, 98, 97, 108,
+    95, 105, 100, 40, 48, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 121, 32, 61, 32, 103, 101, 116, 95, 103, 108, 111, 98,
+    97, 108, 95, 105, 100, 40, 49, 41, 59, 10, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 108, 120, 32, 61, 32, 103, 101, 116, 95, 108,
+    111, 99, 97, 108, 95, 105, 100, 40, 48, 41, 59, 10, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 108, 121, 32, 61, 32, 103, 101, 116,
+    95, 108, 111, 99, 97, 108, 95, 105, 100, 40, 49, 41, 59, 10, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 120, 115, 105, 122, 101,
+    32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 115, 105, 122,
+    101, 40, 48, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 108, 121, 115, 105, 122, 101, 32, 61, 32, 103, 101, 116, 95, 108,
+    111, 99, 97, 108, 95, 115, 105, 122, 101, 40, 49, 41, 59, 10, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 98, 95, 110, 99, 111, 108,
+    115, 32, 61, 32, 110, 99, 111, 108, 115, 32, 62, 62, 32, 53, 59, 10,
+    10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 101, 95,
+    119, 111, 114, 100, 114, 97, 100, 32, 61, 32, 40, 115, 101, 95, 99, 111,
+    108, 114, 97, 100, 32, 62, 62, 32, 53, 41, 32, 43, 32, 49, 59, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 99, 111, 114, 110,
+    101, 114, 95, 120, 32, 61, 32, 103, 101, 116, 95, 103, 114, 111, 117, 112,
+    95, 105, 100, 40, 48, 41, 32, 42, 32, 108, 120, 115, 105, 122, 101, 32,
+    45, 32, 115, 101, 95, 119, 111, 114, 100, 114, 97, 100, 59, 10, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 99, 111, 114, 110, 101, 114,
+    95, 121, 32, 61, 32, 103, 101, 116, 95, 103, 114, 111, 117, 112, 95, 105,
+    100, 40, 49, 41, 32, 42, 32, 108, 121, 115, 105, 122, 101, 32, 45, 32,
+    115, 101, 95, 114, 111, 119, 114, 97, 100, 59, 10, 10, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 116, 104, 114, 101, 97, 100, 95, 105,
+    100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40, 108, 121, 44, 32, 108,
+    120, 115, 105, 122, 101, 44, 32, 108, 120, 41, 59, 10, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 110, 98, 95, 116, 104, 114, 101, 97,
+    100, 115, 32, 61, 32, 108, 120, 115, 105, 122, 101, 32, 42, 32, 108, 121,
+    115, 105, 122, 101, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 112, 97, 100, 100, 101, 100, 95, 110, 114, 111, 119, 115, 32,
+    61, 32, 108, 121, 115, 105, 122, 101, 32, 43, 32, 115, 101, 95, 114, 111,
+    119, 114, 97, 100, 32, 42, 32, 50, 59, 10, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111,
+    108, 115, 32, 61, 32, 108, 120, 115, 105, 122, 101, 32, 43, 32, 115, 101,
+    95, 119, 111, 114, 100, 114, 97, 100, 32, 42, 32, 50, 59, 10, 10, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 105, 122, 101, 32,
+    61, 32, 112, 97, 100, 100, 101, 100, 95, 110, 114, 111, 119, 115, 32, 42,
+    32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 59, 10, 10,
+    32, 32, 109, 101, 109, 99, 112, 121, 50, 108, 111, 99, 97, 108, 40, 108,
+    111, 99, 97, 108, 95, 114, 117, 110, 115, 44, 32, 115, 101, 95, 114, 117,
+    110, 115, 44, 32, 115, 101, 95, 110, 114, 117, 110, 115, 32, 42, 32, 51,
+    44, 32, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 44, 32, 110, 98,
+    95, 116, 104, 114, 101, 97, 100, 115, 41, 59, 10, 32, 32, 47, 47, 32,
+    67, 111, 112, 121, 32, 115, 117, 98, 105, 109, 97, 103, 101, 32, 116, 111,
+    32, 108, 111, 99, 97, 108, 32, 109, 101, 109, 111, 114, 121, 10, 32, 32,
+    102, 111, 114, 32, 40, 105, 110, 116, 32, 105, 32, 61, 32, 116, 104, 114,
+    101, 97, 100, 95, 105, 100, 120, 59, 32, 105, 32, 60, 32, 115, 105, 122,
+    101, 59, 32, 105, 32, 43, 61, 32, 110, 98, 95, 116, 104, 114, 101, 97,
+    100, 115, 41, 10, 32, 32, 123, 10, 32, 32, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 100, 105, 118, 32, 61, 32, 105, 32, 47, 32,
+    112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 59, 10, 32, 32,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 114, 101, 99, 116,
+    95, 114, 111, 119, 32, 61, 32, 100, 105, 118, 32, 43, 32, 99, 111, 114,
+    110, 101, 114, 95, 121, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 114, 101, 99, 116, 95, 99, 111, 108, 32, 61, 32,
+    105, 32, 45, 32, 100, 105, 118, 32, 42, 32, 112, 97, 100, 100, 101, 100,
+    95, 110, 99, 111, 108, 115, 32, 43, 32, 99, 111, 114, 110, 101, 114, 95,
+    120, 59, 10, 10, 32, 32, 32, 32, 105, 102, 32, 40, 114, 101, 99, 116,
+    95, 114, 111, 119, 32, 60, 32, 48, 32, 124, 124, 32, 114, 101, 99, 116,
+    95, 114, 111, 119, 32, 62, 61, 32, 110, 114, 111, 119, 115, 32, 124, 124,
+    32, 114, 101, 99, 116, 95, 99, 111, 108, 32, 60, 32, 48, 32, 124, 124,
+    32, 114, 101, 99, 116, 95, 99, 111, 108, 32, 62, 61, 32, 98, 95, 110,
+    99, 111, 108, 115, 41, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 105, 93, 32, 61,
+    32, 48, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 101, 108,
+    115, 101, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 112, 105, 100, 120, 32, 61, 32,
+    109, 97, 100, 50, 52, 40, 114, 101, 99, 116, 95, 114, 111, 119, 44, 32,
+    98, 95, 110, 99, 111, 108, 115, 44, 32, 114, 101, 99, 116, 95, 99, 111,
+    108, 41, 59, 10, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95,
+    105, 109, 103, 91, 105, 93, 32, 61, 32, 105, 110, 91, 112, 105, 100, 120,
+    93, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 32, 32, 98,
+    97, 114, 114, 105, 101, 114, 40, 67, 76, 75, 95, 76, 79, 67, 65, 76,
+    95, 77, 69, 77, 95, 70, 69, 78, 67, 69, 41, 59, 10, 10, 32, 32,
+    47, 47, 32, 66, 97, 105, 108, 32, 111, 117, 116, 32, 105, 102, 32, 119,
+    101, 32, 97, 114, 101, 32, 111, 117, 116, 115, 105, 100, 101, 32, 116, 104,
+    101, 32, 105, 109, 97, 103, 101, 10, 32, 32, 105, 102, 32, 40, 120, 32,
+    62, 61, 32, 98, 95, 110, 99, 111, 108, 115, 32, 124, 124, 32, 121, 32,
+    62, 61, 32, 110, 114, 111, 119, 115, 41, 10, 32, 32, 32, 32, 114, 101,
+    116, 117, 114, 110, 59, 10, 10, 32, 32, 123, 10, 32, 32, 32, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 105, 100, 120, 32, 61, 32,
+    109, 97, 100, 50, 52, 40, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111,
+    108, 115, 44, 32, 108, 121, 32, 43, 32, 115, 101, 95, 114, 111, 119, 114,
+    97, 100, 44, 32, 108, 120, 32, 43, 32, 115, 101, 95, 119, 111, 114, 100,
+    114, 97, 100, 41, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40,
+    121, 44, 32, 98, 95, 110, 99, 111, 108, 115, 44, 32, 120, 41, 59, 10,
+    32, 32, 32, 32, 111, 117, 116, 91, 105, 100, 120, 93, 32, 61, 32, 98,
+    105, 116, 109, 97, 112, 112, 101, 100, 95, 114, 117, 110, 115, 40, 108, 111,
+    99, 97, 108, 95, 105, 109, 103, 32, 43, 32, 108, 105, 100, 120, 44, 32,
+    112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 44, 32, 108, 111,
+    99, 97, 108, 95, 114, 117, 110, 115, 44, 32, 115, 101, 95, 110, 114, 117,
+    110, 115, 44, 32, 48, 41, 10, 32, 32, 32, 32, 32, 32, 38, 32, 126,
+    98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 114, 117, 110, 115, 40, 108,
+    111, 99, 97, 108, 95, 105, 109, 103, 32, 43, 32, 108, 105, 100, 120, 44,
+    32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 44, 32, 108,
+    111, 99, 97, 108, 95, 114, 117, 110, 115, 44, 32, 115, 101, 95, 110, 114,
+    117, 110, 115, 44, 32, 49, 41, 59, 10, 32, 32, 125, 10, 125, 10, 35,
+    101, 110, 100, 105, 102, 10, 10, 35, 105, 102, 100, 101, 102, 32, 67, 76,
+    67, 86, 95, 83, 69, 67, 84, 73, 79, 78, 95, 78, 65, 73, 86, 69,
+    10, 47, 47, 32, 84, 104, 101, 32, 100, 105, 108, 97, 116, 105, 111, 110,
+    32, 97, 110, 100, 32, 116, 104, 101, 32, 101, 114, 111, 115, 105, 111, 110,
+    32, 115, 104, 97, 114, 101, 32, 116, 104, 101, 32, 115, 97, 109, 101, 32,
+    97, 99, 99, 117, 109, 117, 108, 97, 116, 111, 114, 10, 107, 101, 114, 110,
+    101, 108, 32, 118, 111, 105, 100, 32, 110, 97, 105, 118, 101, 95, 103, 114,
+    97, 100, 105, 101, 110, 116, 40, 103, 108, 111, 98, 97, 108, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 42, 32, 105, 110, 44, 32, 103, 108,
+    111, 98, 97, 108, 32, 105, 110, 116, 32, 42, 32, 111, 117, 116, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 110, 114, 111, 119, 115, 44, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 110, 99, 111, 108, 115, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 103, 108, 111, 98, 97, 108, 32, 105,
+    110, 116, 32, 42, 32, 115, 101, 44, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 115, 101, 95, 114, 111, 119, 114, 97, 100, 44, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 115, 101, 95, 99, 111, 108, 114, 97,
+    100, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 115, 101, 95, 99, 111, 117, 110, 116,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 115, 101, 95, 116, 97, 114, 103, 101, 116,
+    115, 117, 109, 95, 100, 105, 108, 44, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 115, 101, 95, 116, 97, 114, 103, 101, 116, 115, 117, 109, 95,
+    101, 114, 111, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    108, 111, 99, 97, 108, 32, 105, 110, 116, 32, 42, 32, 108, 111, 99, 97,
+    108, 95, 115, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 108, 111, 99, 97, 108, 32, 105, 110, 116, 32, 42, 32, 108, 111, 99,
+    97, 108, 95, 105, 109, 103, 41, 10, 123, 10, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 120, 32, 61, 32, 103, 101, 116, 95, 103, 108,
+    111, 98, 97, 108, 95, 105, 100, 40, 48, 41, 59, 10, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 121, 32, 61, 32, 103, 101, 116, 95,
+    103, 108, 111, 98, 97, 108, 95, 105, 100, 40, 49, 41, 59, 10, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 120, 32, 61, 32, 103,
+    101, 116, 95, 108, 111, 99, 97, 108, 95, 105, 100, 40, 48, 41, 59, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 121, 32, 61,
+    32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 105, 100, 40, 49, 41,
+    59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 120,
+    115, 105, 122, 101, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108,
+    95, 115, 105, 122, 101, 40, 48, 41, 59, 10, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 108, 121, 115, 105, 122, 101, 32, 61, 32, 103,
+    101, 116, 95, 108, 111, 99, 97, 108, 95, 115, 105, 122, 101, 40, 49, 41,
+    59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 99, 111,
+    114, 110, 101, 114, 95, 120, 32, 61, 32, 103, 101, 116, 95, 103, 114, 111,
+    117, 112, 95, 105, 100, 40, 48, 41, 32, 42, 32, 108, 120, 115, 105, 122,
+    101, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 99,
+    111, 114, 110, 101, 114, 95, 121, 32, 61, 32, 103, 101, 116, 95, 103, 114,
+    111, 117, 112, 95, 105, 100, 40, 49, 41, 32, 42, 32, 108, 121, 115, 105,
+    122, 101, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 32, 61, 32, 109, 97,
+    100, 50, 52, 40, 108, 121, 44, 32, 108, 120, 115, 105, 122, 101, 44, 32,
+    108, 120, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 32, 61, 32, 108, 120,
+    115, 105, 122, 101, 32, 42, 32, 108, 121, 115, 105, 122, 101, 59, 10, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 101, 95, 115,
+    105, 122, 101, 32, 61, 32, 115, 101, 95, 99, 111, 117, 110, 116, 32, 42,
+    32, 50, 32, 43, 32, 115, 101, 95, 99, 111, 117, 110, 116, 59, 10, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 112, 97, 100, 100,
+    101, 100, 95, 110, 114, 111, 119, 115, 32, 61, 32, 108, 121, 115, 105, 122,
+    101, 32, 43, 32, 115, 101, 95, 114, 111, 119, 114, 97, 100, 32, 42, 32,
+    50, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 112,
+    97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 32, 61, 32, 108, 120,
+    115, 105, 122, 101, 32, 43, 32, 115, 101, 95, 99, 111, 108, 114, 97, 100,
+    32, 42, 32, 50, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 108, 105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40,
+    112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 44, 32, 108, 121,
+    32, 43, 32, 115, 101, 95, 114, 111, 119, 114, 97, 100, 44, 32, 108, 120,
+    32, 43, 32, 115, 101, 95, 99, 111, 108, 114, 97, 100, 41, 59, 10, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 105, 100, 120, 32, 61,
+    32, 109, 97, 100, 50, 52, 40, 121, 44, 32, 110, 99, 111, 108, 115, 44,
+    32, 120, 41, 59, 10, 10, 32, 32, 110, 97, 105, 118, 101, 95, 108, 111,
+    99, 97, 108, 105, 109, 103, 95, 115, 101, 116, 117, 112, 40, 105, 110, 44,
+    32, 115, 101, 44, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 44, 32,
+    108, 111, 99, 97, 108, 95, 115, 101, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 44, 32, 110, 98, 95,
+    116, 104, 114, 101, 97, 100, 115, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    110, 114, 111, 119, 115, 44, 32, 110, 99, 111, 108, 115, 44, 32, 112, 97,
+    100, 100, 101, 100, 95, 110, 114, 111, 119, 115, 44, 32, 112, 97, 100, 100,
+    101, 100, 95, 110, 99, 111, 108, 115, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 99, 111, 114, 110, 101, 114, 95, 121, 32, 45, 32, 115, 101, 95, 114,
+    111, 119, 114, 97, 100, 44, 32, 99, 111, 114, 110, 101, 114, 95, 120, 32,
+    45, 32, 115, 101, 95, 99, 111, 108, 114, 97, 100, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 115, 101, 95, 115, 105, 122, 101, 41, 59, 10, 10, 32,
+    32, 105, 110, 116, 32, 97, 99, 99, 32, 61, 32, 48, 59, 10, 32, 32,
+    102, 111, 114, 32, 40, 105, 110, 116, 32, 105, 32, 61, 32, 48, 59, 32,
+    105, 32, 60, 32, 115, 101, 95, 115, 105, 122, 101, 59, 32, 105, 32, 43,
+    61, 32, 51, 41, 10, 32, 32, 123, 10, 32, 32, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 114, 105, 100, 120, 32, 61, 32, 109, 97,
+    100, 50, 52, 40, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115,
+    44, 32, 108, 111, 99, 97, 108, 95, 115, 101, 91, 105, 93, 44, 32, 108,
+    105, 100, 120, 32, 43, 32, 108, 111, 99, 97, 108, 95, 115, 101, 91, 105,
+    43, 49, 93, 41, 59, 10, 32, 32, 32, 32, 97, 99, 99, 32, 61, 32,
+    109, 97, 100, 50, 52, 40, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91,
+    114, 105, 100, 120, 93, 44, 32, 108, 111, 99, 97, 108, 95, 115, 101, 91,
+    105, 43, 50, 93, 44, 32, 97, 99, 99, 41, 59, 10, 32, 32, 125, 10,
+    32, 32, 111, 117, 116, 91, 105, 100, 120, 93, 32, 61, 32, 115, 101, 108,
+    101, 99, 116, 40, 48, 44, 32, 49, 44, 32, 97, 99, 99, 32, 62, 61,
+    32, 115, 101, 95, 116, 97, 114, 103, 101, 116, 115, 117, 109, 95, 100, 105,
+    108, 32, 38, 38, 32, 97, 99, 99, 32, 60, 32, 115, 101, 95, 116, 97,
+    114, 103, 101, 116, 115, 117, 109, 95, 101, 114, 111, 41, 59, 10, 125, 10,
+    35, 101, 110, 100, 105, 102, 10, 10, 35, 105, 102, 100, 101, 102, 32, 67,
+    76, 67, 86, 95, 83, 69, 67, 84, 73, 79, 78, 95, 72, 73, 84, 79,
+    82, 77, 73, 83, 83, 10, 47, 47, 32, 72, 105, 116, 45, 111, 114, 45,
+    109, 105, 115, 115, 32, 116, 114, 97, 110, 115, 102, 111, 114, 109, 115, 10,
+    47, 47, 32, 80, 105, 120, 101, 108, 115, 32, 111, 117, 116, 115, 105, 100,
+    101, 32, 116, 104, 101, 32, 105, 109, 97, 103, 101, 32, 97, 114, 101, 32,
+    98, 97, 99, 107, 103, 114, 111, 117, 110, 100, 58, 32, 116, 104, 101, 121,
+    32, 110, 101, 118, 101, 114, 32, 109, 97, 116, 99, 104, 32, 116, 104, 101,
+    10, 47, 47, 32, 102, 111, 114, 101, 103, 114, 111, 117, 110, 100, 32, 111,
+    102, 32, 116, 104, 101, 32, 83, 69, 32, 97, 110, 100, 32, 97, 108, 119,
+    97, 121, 115, 32, 109, 97, 116, 99, 104, 32, 105, 116, 115, 32, 98, 97,
+    99, 107, 103, 114, 111, 117, 110, 100, 46, 10, 10, 47, 47, 32, 115, 101,
+    95, 114, 117, 110, 115, 32, 104, 111, 108, 100, 115, 32, 116, 104, 101, 32,
+    102, 111, 114, 101, 103, 114, 111, 117, 110, 100, 32, 114, 117, 110, 115, 44,
+    32, 116, 104, 101, 110, 32, 116, 104, 101, 32, 98, 97, 99, 107, 103, 114,
+    111, 117, 110, 100, 32, 111, 110, 101, 115, 46, 32, 69, 114, 111, 115, 105,
+    111, 110, 32, 111, 102, 10, 47, 47, 32, 116, 104, 101, 32, 99, 111, 109,
+    112, 108, 101, 109, 101, 110, 116, 32, 98, 121, 32, 116, 104, 101, 32, 98,
+    97, 99, 107, 103, 114, 111, 117, 110, 100, 32, 105, 115, 32, 116, 104, 101,
+    32, 99, 111, 109, 112, 108, 101, 109, 101, 110, 116, 32, 111, 102, 32, 116,
+    104, 101, 32, 100, 105, 108, 97, 116, 105, 111, 110, 46, 10, 47, 47, 32,
+    83, 97, 109, 101, 32, 108, 97, 121, 111, 117, 116, 32, 97, 115, 32, 98,
+    105, 116, 109, 97, 112, 112, 101, 100, 95, 109, 111, 114, 112, 104, 44, 32,
+    108, 111, 99, 97, 108, 95, 114, 117, 110, 115, 32, 105, 115, 32, 51, 32,
+    42, 32, 40, 115, 101, 95, 110, 102, 103, 114, 117, 110, 115, 32, 43, 32,
+    115, 101, 95, 110, 98, 103, 114, 117, 110, 115, 41, 10, 107, 101, 114, 110,
+    101, 108, 32, 118, 111, 105, 100, 32, 98, 105, 116, 109, 97, 112, 112, 101,
+    100, 95, 104, 105, 116, 111, 114, 109, 105, 115, 115, 40, 103, 108, 111, 98,
+    97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32, 105,
+    110, 44, 32, 103, 108, 111, 98, 97, 108, 32, 105, 110, 116, 32, 42, 32,
+    111, 117, 116, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110,
+    114, 111, 119, 115, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    110, 99, 111, 108, 115, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 103, 108, 111, 98, 97, 108, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 42, 32, 115, 101, 95, 114, 117, 110,
+    115, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 101, 95,
+    110, 102, 103, 114, 117, 110, 115, 44, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 115, 101, 95, 110, 98, 103, 114, 117, 110, 115, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 101, 95, 114, 111, 119, 114,
+    97, 100, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 101,
+    95, 99, 111, 108, 114, 97, 100, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 32, 105,
+    110, 116, 32, 42, 32, 108, 111, 99, 97, 108, 95, 114, 117, 110, 115, 44,
+    32, 108, 111, 99, 97, 108, 32, 117, 105, 110, 116, 32, 42, 32, 108, 111,
+    99, 97, 108, 95, 105, 109, 103, 41, 10, 123, 10, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 120, 32, 61, 32, 103, 101, 116, 95, 103,
+    108, 111, 98, 97, 108, 95, 105, 100, 40, 48, 41, 59, 10, 32, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 121, 32, 61, 32, 103, 101, 116,
+    95, 103, 108, 111, 98, 97, 108, 95, 105, 100, 40, 49, 41, 59, 10, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 120, 32, 61, 32,
+    103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 105, 100, 40, 48, 41, 59,
+    10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 121, 32,
+    61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 105, 100, 40, 49,
+    41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108,
+    120, 115, 105, 122, 101, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97,
+    108, 95, 115, 105, 122, 101, 40, 48, 41, 59, 10, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 108, 121, 115, 105, 122, 101, 32, 61, 32,
+    103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 115, 105, 122, 101, 40, 49,
+    41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 98,
+    95, 110, 99, 111, 108, 115, 32, 61, 32, 110, 99, 111, 108, 115, 32, 62,
+    62, 32, 53, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 115, 101, 95, 119, 111, 114, 100, 114, 97, 100, 32, 61, 32, 40,
+    115, 101, 95, 99, 111, 108, 114, 97, 100, 32, 62, 62, 32, 53, 41, 32,
+    43, 32, 49, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 99, 111, 114, 110, 101, 114, 95, 120, 32, 61, 32, 103, 101, 116, 95,
+    103, 114, 111, 117, 112, 95, 105, 100, 40, 48, 41, 32, 42, 32, 108, 120,
+    115, 105, 122, 101, 32, 45, 32, 115, 101, 95, 119, 111, 114, 100, 114, 97,
+    100, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 99,
+    111, 114, 110, 101, 114, 95, 121, 32, 61, 32, 103, 101, 116, 95, 103, 114,
+    111, 117, 112, 95, 105, 100, 40, 49, 41, 32, 42, 32, 108, 121, 115, 105,
+    122, 101, 32, 45, 32, 115, 101, 95, 114, 111, 119, 114, 97, 100, 59, 10,
+    10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 116, 104, 114,
+    101, 97, 100, 95, 105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40,
+    108, 121, 44, 32, 108, 120, 115, 105, 122, 101, 44, 32, 108, 120, 41, 59,
+    10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 98, 95,
+    116, 104, 114, 101, 97, 100, 115, 32, 61, 32, 108, 120, 115, 105, 122, 101,
+    32, 42, 32, 108, 121, 115, 105, 122, 101, 59, 10, 10, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 112, 97, 100, 100, 101, 100, 95, 110,
+    114, 111, 119, 115, 32, 61, 32, 108, 121, 115, 105, 122, 101, 32, 43, 32,
+    115, 101, 95, 114, 111, 119, 114, 97, 100, 32, 42, 32, 50, 59, 10, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 112, 97, 100, 100, 101,
+    100, 95, 110, 99, 111, 108, 115, 32, 61, 32, 108, 120, 115, 105, 122, 101,
+    32, 43, 32, 115, 101, 95, 119, 111, 114, 100, 114, 97, 100, 32, 42, 32,
+    50, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    115, 105, 122, 101, 32, 61, 32, 112, 97, 100, 100, 101, 100, 95, 110, 114,
+    111, 119, 115, 32, 42, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111,
+    108, 115, 59, 10, 10, 32, 32, 109, 101, 109, 99, 112, 121, 50, 108, 111,
+    99, 97, 108, 40, 108, 111, 99, 97, 108, 95, 114, 117, 110, 115, 44, 32,
+    115, 101, 95, 114, 117, 110, 115, 44, 32, 40, 115, 101, 95, 110, 102, 103,
+    114, 117, 110, 115, 32, 43, 32, 115, 101, 95, 110, 98, 103, 114, 117, 110,
+    115, 41, 32, 42, 32, 51, 44, 32, 116, 104, 114, 101, 97, 100, 95, 105,
+    100, 120, 44, 32, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 41, 59,
+    10, 32, 32, 47, 47, 32, 67, 111, 112, 121, 32, 115, 117, 98, 105, 109,
+    97, 103, 101, 32, 116, 111, 32, 108, 111, 99, 97, 108, 32, 109, 101, 109,
+    111, 114, 121, 10, 32, 32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 105,
+    32, 61, 32, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 59, 32, 105,
+    32, 60, 32, 115, 105, 122, 101, 59, 32, 105, 32, 43, 61, 32, 110, 98,
+    95, 116, 104, 114, 101, 97, 100, 115, 41, 10, 32, 32, 123, 10, 32, 32,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 100, 105, 118, 32,
+    61, 32, 105, 32, 47, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111,
+    108, 115, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 114, 101, 99, 116, 95, 114, 111, 119, 32, 61, 32, 100, 105, 118,
+    32, 43, 32, 99, 111, 114, 110, 101, 114, 95, 121, 59, 10, 32, 32, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 114, 101, 99, 116, 95,
+    99, 111, 108, 32, 61, 32, 105, 32, 45, 32, 100, 105, 118, 32, 42, 32,
+    112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 32, 43, 32, 99,
+    111, 114, 110, 101, 114, 95, 120, 59, 10, 10, 32, 32, 32, 32, 105, 102,
+    32, 40, 114, 101, 99, 116, 95, 114, 111, 119, 32, 60, 32, 48, 32, 124,
+    124, 32, 114, 101, 99, 116, 95, 114, 111, 119, 32, 62, 61, 32, 110, 114,
+    111, 119, 115, 32, 124, 124, 32, 114, 101, 99, 116, 95, 99, 111, 108, 32,
+    60, 32, 48, 32, 124, 124, 32, 114, 101, 99, 116, 95, 99, 111, 108, 32,
+    62, 61, 32, 98, 95, 110, 99, 111, 108, 115, 41, 10, 32, 32, 32, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109,
+    103, 91, 105, 93, 32, 61, 32, 48, 59, 10, 32, 32, 32, 32, 125, 10,
+    32, 32, 32, 32, 101, 108, 115, 101, 10, 32, 32, 32, 32, 123, 10, 32,
+    32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 112,
+    105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40, 114, 101, 99, 116,
+    95, 114, 111, 119, 44, 32, 98, 95, 110, 99, 111, 108, 115, 44, 32, 114,
+    101, 99, 116, 95, 99, 111, 108, 41, 59, 10, 32, 32, 32, 32, 32, 32,
+    108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 105, 93, 32, 61, 32, 105,
+    110, 91, 112, 105, 100, 120, 93, 59, 10, 32, 32, 32, 32, 125, 10, 32,
+    32, 125, 10, 32, 32, 98, 97, 114, 114, 105, 101, 114, 40, 67, 76, 75,
+    95, 76, 79, 67, 65, 76, 95, 77, 69, 77, 95, 70, 69, 78, 67, 69,
+    41, 59, 10, 10, 32, 32, 47, 47, 32, 66, 97, 105, 108, 32, 111, 117,
+    116, 32, 105, 102, 32, 119, 101, 32, 97, 114, 101, 32, 111, 117, 116, 115,
+    105, 100, 101, 32, 116, 104, 101, 32, 105, 109, 97, 103, 101, 10, 32, 32,
+    105, 102, 32, 40, 120, 32, 62, 61, 32, 98, 95, 110, 99, 111, 108, 115,
+    32, 124, 124, 32, 121, 32, 62, 61, 32, 110, 114, 111, 119, 115, 41, 10,
+    32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 59, 10, 10, 32, 32, 123,
+    10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108,
+    105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40, 112, 97, 100, 100,
+    101, 100, 95, 110, 99, 111, 108, 115, 44, 32, 108, 121, 32, 43, 32, 115,
+    101, 95, 114, 111, 119, 114, 97, 100, 44, 32, 108, 120, 32, 43, 32, 115,
+    101, 95, 119, 111, 114, 100, 114, 97, 100, 41, 59, 10, 32, 32, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 105, 100, 120, 32, 61, 32,
+    109, 97, 100, 50, 52, 40, 121, 44, 32, 98, 95, 110, 99, 111, 108, 115,
+    44, 32, 120, 41, 59, 10, 32, 32, 32, 32, 111, 117, 116, 91, 105, 100,
+    120, 93, 32, 61, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 114,
+    117, 110, 115, 40, 108, 111, 99, 97, 108, 95, 105, 109, 103, 32, 43, 32,
+    108, 105, 100, 120, 44, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111,
+    108, 115, 44, 32, 108, 111, 99, 97, 108, 95, 114, 117, 110, 115, 44, 32,
+    115, 101, 95, 110, 102, 103, 114, 117, 110, 115, 44, 32, 49, 41, 10, 32,
+    32, 32, 32, 32, 32, 38, 32, 126, 98, 105, 116, 109, 97, 112, 112, 101,
+    100, 95, 114, 117, 110, 115, 40, 108, 111, 99, 97, 108, 95, 105, 109, 103,
+    32, 43, 32, 108, 105, 100, 120, 44, 32, 112, 97, 100, 100, 101, 100, 95,
+    110, 99, 111, 108, 115, 44, 32, 108, 111, 99, 97, 108, 95, 114, 117, 110,
+    115, 32, 43, 32, 115, 101, 95, 110, 102, 103, 114, 117, 110, 115, 32, 42,
+    32, 51, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 115, 101, 95, 110,
+    98, 103, 114, 117, 110, 115, 44, 32, 48, 41, 59, 10, 32, 32, 125, 10,
+    125, 10, 10, 47, 47, 32, 51, 120, 51, 32, 83, 69, 115, 32, 103, 105,
+    118, 101, 110, 32, 97, 115, 32, 116, 119, 111, 32, 57, 32, 98, 105, 116,
+    32, 109, 97, 115, 107, 115, 44, 32, 98, 105, 116, 32, 40, 114, 111, 119,
+    32, 43, 32, 49, 41, 32, 42, 32, 51, 32, 43, 32, 40, 99, 111, 108,
+    32, 43, 32, 49, 41, 32, 102, 111, 114, 32, 116, 104, 101, 10, 47, 47,
+    32, 112, 105, 120, 101, 108, 32, 97, 116, 32, 40, 114, 111, 119, 44, 32,
+    99, 111, 108, 41, 46, 32, 119, 32, 112, 111, 105, 110, 116, 115, 32, 116,
+    111, 32, 116, 104, 101, 32, 99, 101, 110, 116, 101, 114, 32, 119, 111, 114,
+    100, 32, 111, 102, 32, 97, 32, 116, 105, 108, 101, 32, 114, 111, 119, 46,
+    10, 117, 105, 110, 116, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95,
+    104, 105, 116, 111, 114, 109, 105, 115, 115, 51, 120, 51, 95, 119, 111, 114,
+    100, 40, 108, 111, 99, 97, 108, 32, 99, 111, 110, 115, 116, 32, 117, 105,
+    110, 116, 32, 42, 32, 119, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 102, 103, 44, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 98, 103, 41, 10, 123, 10, 32,
+    32, 117, 105, 110, 116, 32, 97, 99, 99, 32, 61, 32, 48, 120, 70, 70,
+    70, 70, 70, 70, 70, 70, 59, 10, 32, 32, 102, 111, 114, 32, 40, 105,
+    110, 116, 32, 114, 32, 61, 32, 48, 59, 32, 114, 32, 60, 32, 51, 59,
+    32, 43, 43, 114, 41, 10, 32, 32, 123, 10, 32, 32, 32, 32, 108, 111,
+    99, 97, 108, 32, 99, 111, 110, 115, 116, 32, 117, 105, 110, 116, 32, 42,
+    32, 119, 114, 32, 61, 32, 119, 32, 43, 32, 40, 114, 32, 45, 32, 49,
+    41, 32, 42, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115,
+    59, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 117, 105, 110, 116,
+    32, 110, 91, 51, 93, 32, 61, 32, 123, 32, 40, 119, 114, 91, 48, 93,
+    32, 62, 62, 32, 49, 41, 32, 124, 32, 40, 119, 114, 91, 45, 49, 93,
+    32, 60, 60, 32, 51, 49, 41, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 119, 114, 91, 48, 93, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    40, 119, 114, 91, 48, 93, 32, 60, 60, 32, 49, 41, 32, 124, 32, 40,
+    119, 114, 91, 49, 93, 32, 62, 62, 32, 51, 49, 41, 32, 125, 59, 10,
+    32, 32, 32, 32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 99, 32, 61,
+    32, 48, 59, 32, 99, 32, 60, 32, 51, 59, 32, 43, 43, 99, 41, 10,
+    32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 98, 105, 116, 32, 61, 32, 49, 32, 60, 60,
+    32, 40, 114, 32, 42, 32, 51, 32, 43, 32, 99, 41, 59, 10, 32, 32,
+    32, 32, 32, 32, 105, 102, 32, 40, 102, 103, 32, 38, 32, 98, 105, 116,
+    41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 97, 99, 99, 32, 38, 61,
+    32, 110, 91, 99, 93, 59, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32,
+    40, 98, 103, 32, 38, 32, 98, 105, 116, 41, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 97, 99, 99, 32, 38, 61, 32, 126, 110, 91, 99, 93, 59,
+    10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 32, 32, 114, 101, 116,
+    117, 114, 110, 32, 97, 99, 99, 59, 10, 125, 10, 10, 47, 47, 32, 108,
+    111, 99, 97, 108, 95, 105, 109, 103, 32, 105, 115, 32, 40, 108, 121, 115,
+    105, 122, 101, 32, 43, 32, 50, 41, 32, 42, 32, 40, 108, 120, 115, 105,
+    122, 101, 32, 43, 32, 50, 41, 10, 118, 111, 105, 100, 32, 98, 105, 116,
+    109, 97, 112, 112, 101, 100, 95, 104, 105, 116, 111, 114, 109, 105, 115, 115,
+    51, 120, 51, 95, 99, 111, 109, 109, 111, 110, 40, 103, 108, 111, 98, 97,
+    108, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32, 105, 110,
+    44, 32, 103, 108, 111, 98, 97, 108, 32, 105, 110, 116, 32, 42, 32, 111,
+    117, 116, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 110, 114, 111, 119, 115, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 110, 99, 111, 108, 115, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 102, 103, 44, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 98, 103, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 103, 108, 111, 98, 97,
+    108, 32, 105, 110, 116, 32, 42, 32, 99, 104, 97, 110, 103, 101, 100, 44,
+    32, 108, 111, 99, 97, 108, 32, 117, 105, 110, 116, 32, 42, 32, 108, 111,
+    99, 97, 108, 95, 105, 109, 103, 41, 10, 123, 10, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 120, 32, 61, 32, 103, 101, 116, 95, 103,
+    108, 111, 98, 97, 108, 95, 105, 100, 40, 48, 41, 59, 10, 32, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 121, 32, 61, 32, 103, 101, 116,
+    95, 103, 108, 111, 98, 97, 108, 95, 105, 100, 40, 49, 41, 59, 10, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 120, 32, 61, 32,
+    103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 105, 100, 40, 48, 41, 59,
+    10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 121, 32,
+    61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 105, 100, 40, 49,
+    41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108,
+    120, 115, 105, 122, 101, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97,
+    108, 95, 115, 105, 122, 101, 40, 48, 41, 59, 10, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 108, 121, 115, 105, 122, 101, 32, 61, 32,
+    103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 115, 105, 122, 101, 40, 49,
+    41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 98,
+    95, 110, 99, 111, 108, 115, 32, 61, 32, 110, 99, 111, 108, 115, 32, 62,
+    62, 32, 53, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 99, 111, 114, 110, 101, 114, 95, 120, 32, 61, 32, 103, 101, 116,
+    95, 103, 114, 111, 117, 112, 95, 105, 100, 40, 48, 41, 32, 42, 32, 108,
+    120, 115, 105, 122, 101, 32, 45, 32, 49, 59, 10, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 99, 111, 114, 110, 101, 114, 95, 121, 32,
+    61, 32, 103, 101, 116, 95, 103, 114, 111, 117, 112, 95, 105, 100, 40, 49,
+    41, 32, 42, 32, 108, 121, 115, 105, 122, 101, 32, 45, 32, 49, 59, 10,
+    10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 116, 104, 114,
+    101, 97, 100, 95, 105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40,
+    108, 121, 44, 32, 108, 120, 115, 105, 122, 101, 44, 32, 108, 120, 41, 59,
+    10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 98, 95,
+    116, 104, 114, 101, 97, 100, 115, 32, 61, 32, 108, 120, 115, 105, 122, 101,
+    32, 42, 32, 108, 121, 115, 105, 122, 101, 59, 10, 10, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 112, 97, 100, 100, 101, 100, 95, 110,
+    114, 111, 119, 115, 32, 61, 32, 108, 121, 115, 105, 122, 101, 32, 43, 32,
+    50, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 112,
+    97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 32, 61, 32, 108, 120,
+    115, 105, 122, 101, 32, 43, 32, 50, 59, 10, 10, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 115, 105, 122, 101, 32, 61, 32, 112, 97,
+    100, 100, 101, 100, 95, 110, 114, 111, 119, 115, 32, 42, 32, 112, 97, 100,
+    100, 101, 100, 95, 110, 99, 111, 108, 115, 59, 10, 10, 32, 32, 47, 47,
+    32, 67, 111, 112, 121, 32, 115, 117, 98, 105, 109, 97, 103, 101, 32, 116,
+    111, 32, 108, 111, 99, 97, 108, 32, 109, 101, 109, 111, 114, 121, 10, 32,
+    32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 105, 32, 61, 32, 116, 104,
+    114, 101, 97, 100, 95, 105, 100, 120, 59, 32, 105, 32, 60, 32, 115, 105,
+    122, 101, 59, 32, 105, 32, 43, 61, 32, 110, 98, 95, 116, 104, 114, 101,
+    97, 100, 115, 41, 10, 32, 32, 123, 10, 32, 32, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 100, 105, 118, 32, 61, 32, 105, 32, 47,
+    32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 59, 10, 32,
+    32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 114, 101, 99,
+    116, 95, 114, 111, 119, 32, 61, 32, 100, 105, 118, 32, 43, 32, 99, 111,
+    114, 110, 101, 114, 95, 121, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 114, 101, 99, 116, 95, 99, 111, 108, 32, 61,
+    32, 105, 32, 45, 32, 100, 105, 118, 32, 42, 32, 112, 97, 100, 100, 101,
+    100, 95, 110, 99, 111, 108, 115, 32, 43, 32, 99, 111, 114, 110, 101, 114,
+    95, 120, 59, 10, 10, 32, 32, 32, 32, 105, 102, 32, 40, 114, 101, 99,
+    116, 95, 114, 111, 119, 32, 60, 32, 48, 32, 124, 124, 32, 114, 101, 99,
+    116, 95, 114, 111, 119, 32, 62, 61, 32, 110, 114, 111, 119, 115, 32, 124,
+    124, 32, 114, 101, 99, 116, 95, 99, 111, 108, 32, 60, 32, 48, 32, 124,
+    124, 32, 114, 101, 99, 116, 95, 99, 111, 108, 32, 62, 61, 32, 98, 95,
+    110, 99, 111, 108, 115, 41, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32,
+    32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 105, 93, 32,
+    61, 32, 48, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 101,
+    108, 115, 101, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 112, 105, 100, 120, 32, 61,
+    32, 109, 97, 100, 50, 52, 40, 114, 101, 99, 116, 95, 114, 111, 119, 44,
+    32, 98, 95, 110, 99, 111, 108, 115, 44, 32, 114, 101, 99, 116, 95, 99,
+    111, 108, 41, 59, 10, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108,
+    95, 105, 109, 103, 91, 105, 93, 32, 61, 32, 105, 110, 91, 112, 105, 100,
+    120, 93, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 32, 32,
+    98, 97, 114, 114, 105, 101, 114, 40, 67, 76, 75, 95, 76, 79, 67, 65,
+    76, 95, 77, 69, 77, 95, 70, 69, 78, 67, 69, 41, 59, 10, 10, 32,
+    32, 47, 47, 32, 66, 97, 105, 108, 32, 111, 117, 116, 32, 105, 102, 32,
+    119, 101, 32, 97, 114, 101, 32, 111, 117, 116, 115, 105, 100, 101, 32, 116,
+    104, 101, 32, 105, 109, 97, 103, 101, 10, 32, 32, 105, 102, 32, 40, 120,
+    32, 62, 61, 32, 98, 95, 110, 99, 111, 108, 115, 32, 124, 124, 32, 121,
+    32, 62, 61, 32, 110, 114, 111, 119, 115, 41, 10, 32, 32, 32, 32, 114,
+    101, 116, 117, 114, 110, 59, 10, 10, 32, 32, 123, 10, 32, 32, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 105, 100, 120, 32, 61,
+    32, 109, 97, 100, 50, 52, 40, 112, 97, 100, 100, 101, 100, 95, 110, 99,
+    111, 108, 115, 44, 32, 108, 121, 32, 43, 32, 49, 44, 32, 108, 120, 32,
+    43, 32, 49, 41, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40,
+    121, 44, 32, 98, 95, 110, 99, 111, 108, 115, 44, 32, 120, 41, 59, 10,
+    32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 117, 105, 110, 116, 32, 104,
+    105, 116, 32, 61, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 104,
+    105, 116, 111, 114, 109, 105, 115, 115, 51, 120, 51, 95, 119, 111, 114, 100,
+    40, 108, 111, 99, 97, 108, 95, 105, 109, 103, 32, 43, 32, 108, 105, 100,
+    120, 44, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 44,
+    32, 102, 103, 44, 32, 98, 103, 41, 59, 10, 32, 32, 32, 32, 105, 102,
+    32, 40, 99, 104, 97, 110, 103, 101, 100, 41, 10, 32, 32, 32, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 47, 47, 32, 84, 104, 105, 110, 110, 105,
+    110, 103, 58, 32, 114, 101, 109, 111, 118, 101, 32, 116, 104, 101, 32, 109,
+    97, 116, 99, 104, 105, 110, 103, 32, 112, 105, 120, 101, 108, 115, 46, 32,
+    69, 118, 101, 114, 121, 32, 119, 114, 105, 116, 101, 114, 32, 115, 116, 111,
+    114, 101, 115, 32, 116, 104, 101, 32, 115, 97, 109, 101, 10, 32, 32, 32,
+    32, 32, 32, 47, 47, 32, 118, 97, 108, 117, 101, 44, 32, 110, 111, 32,
+    110, 101, 101, 100, 32, 102, 111, 114, 32, 97, 110, 32, 97, 116, 111, 109,
+    105, 99, 32, 111, 112, 101, 114, 97, 116, 105, 111, 110, 46, 10, 32, 32,
+    32, 32, 32, 32, 111, 117, 116, 91, 105, 100, 120, 93, 32, 61, 32, 108,
+    111, 99, 97, 108, 95, 105, 109, 103, 91, 108, 105, 100, 120, 93, 32, 38,
+    32, 126, 104, 105, 116, 59, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32,
+    40, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 108, 105, 100, 120, 93,
+    32, 38, 32, 104, 105, 116, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    42, 99, 104, 97, 110, 103, 101, 100, 32, 61, 32, 49, 59, 10, 32, 32,
+    32, 32, 125, 10, 32, 32, 32, 32, 101, 108, 115, 101, 10, 32, 32, 32,
+    32, 32, 32, 111, 117, 116, 91, 105, 100, 120, 93, 32, 61, 32, 104, 105,
+    116, 59, 10, 32, 32, 125, 10, 125, 10, 10, 107, 101, 114, 110, 101, 108,
+    32, 118, 111, 105, 100, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95,
+    104, 105, 116, 111, 114, 109, 105, 115, 115, 51, 120, 51, 40, 103, 108, 111,
+    98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32,
+    105, 110, 44, 32, 103, 108, 111, 98, 97, 108, 32, 105, 110, 116, 32, 42,
+    32, 111, 117, 116, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 110, 114, 111, 119, 115, 44, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 110, 99, 111, 108, 115, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 102, 103, 44, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 98, 103, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 108, 111, 99,
+    97, 108, 32, 117, 105, 110, 116, 32, 42, 32, 108, 111, 99, 97, 108, 95,
+    105, 109, 103, 41, 10, 123, 10, 32, 32, 98, 105, 116, 109, 97, 112, 112,
+    101, 100, 95, 104, 105, 116, 111, 114, 109, 105, 115, 115, 51, 120, 51, 95,
+    99, 111, 109, 109, 111, 110, 40, 105, 110, 44, 32, 111, 117, 116, 44, 32,
+    110, 114, 111, 119, 115, 44, 32, 110, 99, 111, 108, 115, 44, 32, 102, 103,
+    44, 32, 98, 103, 44, 32, 48, 44, 32, 108, 111, 99, 97, 108, 95, 105,
+    109, 103, 41, 59, 10, 125, 10, 10, 107, 101, 114, 110, 101, 108, 32, 118,
+    111, 105, 100, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 116, 104,
+    105, 110, 110, 105, 110, 103, 51, 120, 51, 40, 103, 108, 111, 98, 97, 108,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32, 105, 110, 44,
+    32, 103, 108, 111, 98, 97, 108, 32, 105, 110, 116, 32, 42, 32, 111, 117,
+    116, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110,
+    114, 111, 119, 115, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    110, 99, 111, 108, 115, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 102, 103, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 98, 103, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 103, 108, 111, 98, 97, 108, 32, 105, 110,
+    116, 32, 42, 32, 99, 104, 97, 110, 103, 101, 100, 44, 32, 108, 111, 99,
+    97, 108, 32, 117, 105, 110, 116, 32, 42, 32, 108, 111, 99, 97, 108, 95,
+    105, 109, 103, 41, 10, 123, 10, 32, 32, 98, 105, 116, 109, 97, 112, 112,
+    101, 100, 95, 104, 105, 116, 111, 114, 109, 105, 115, 115, 51, 120, 51, 95,
+    99, 111, 109, 109, 111, 110, 40, 105, 110, 44, 32, 111, 117, 116, 44, 32,
+    110, 114, 111, 119, 115, 44, 32, 110, 99, 111, 108, 115, 44, 32, 102, 103,
+    44, 32, 98, 103, 44, 32, 99, 104, 97, 110, 103, 101, 100, 44, 32, 108,
+    111, 99, 97, 108, 95, 105, 109, 103, 41, 59, 10, 125, 10, 35, 101, 110,
+    100, 105, 102, 10, 10, 35, 105, 102, 100, 101, 102, 32, 67, 76, 67, 86,
+    95, 83, 69, 67, 84, 73, 79, 78, 95, 82, 69, 67, 79, 78, 83, 84,
+    82, 85, 67, 84, 10, 47, 47, 32, 71, 101, 111, 100, 101, 115, 105, 99,
+    32, 114, 101, 99, 111, 110, 115, 116, 114, 117, 99, 116, 105, 111, 110, 32,
+    98, 121, 32, 100, 105, 108, 97, 116, 105, 111, 110, 10, 10, 47, 47, 32,
+    80, 105, 120, 101, 108, 115, 32, 111, 102, 32, 109, 97, 115, 107, 32, 99,
+    111, 110, 110, 101, 99, 116, 101, 100, 32, 116, 111, 32, 115, 101, 101, 100,
+    32, 97, 108, 111, 110, 103, 32, 116, 104, 101, 32, 114, 111, 119, 44, 32,
+    119, 105, 116, 104, 105, 110, 32, 97, 32, 119, 111, 114, 100, 10, 47, 47,
+    32, 40, 75, 111, 103, 103, 101, 45, 83, 116, 111, 110, 101, 32, 111, 99,
+    99, 108, 117, 100, 101, 100, 32, 102, 105, 108, 108, 32, 105, 110, 32, 98,
+    111, 116, 104, 32, 100, 105, 114, 101, 99, 116, 105, 111, 110, 115, 41, 10,
+    117, 105, 110, 116, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 102,
+    105, 108, 108, 95, 119, 111, 114, 100, 40, 99, 111, 110, 115, 116, 32, 117,
+    105, 110, 116, 32, 115, 101, 101, 100, 44, 32, 99, 111, 110, 115, 116, 32,
+    117, 105, 110, 116, 32, 109, 97, 115, 107, 41, 10, 123, 10, 32, 32, 117,
+    105, 110, 116, 32, 114, 32, 61, 32, 115, 101, 101, 100, 32, 38, 32, 109,
+    97, 115, 107, 59, 10, 32, 32, 117, 105, 110, 116, 32, 108, 32, 61, 32,
+    114, 59, 10, 32, 32, 117, 105, 110, 116, 32, 112, 114, 32, 61, 32, 109,
+    97, 115, 107, 59, 10, 32, 32, 117, 105, 110, 116, 32, 112, 108, 32, 61,
+    32, 109, 97, 115, 107, 59, 10, 32, 32, 102, 111, 114, 32, 40, 105, 110,
+    116, 32, 115, 32, 61, 32, 49, 59, 32, 115, 32, 60, 32, 51, 50, 59,
+    32, 115, 32, 42, 61, 32, 50, 41, 10, 32, 32, 123, 10, 32, 32, 32,
+    32, 114, 32, 124, 61, 32, 112, 114, 32, 38, 32, 40, 114, 32, 62, 62,
+    32, 115, 41, 59, 10, 32, 32, 32, 32, 112, 114, 32, 38, 61, 32, 112,
+    114, 32, 62, 62, 32, 115, 59, 10, 32, 32, 32, 32, 108, 32, 124, 61,
+    32, 112, 108, 32, 38, 32, 40, 108, 32, 60, 60, 32, 115, 41, 59, 10,
+    32, 32, 32, 32, 112, 108, 32, 38, 61, 32, 112, 108, 32, 60, 60, 32,
+    115, 59, 10, 32, 32, 125, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32,
+    114, 32, 124, 32, 108, 59, 10, 125, 10, 10, 47, 47, 32, 79, 110, 101,
+    32, 108, 97, 117, 110, 99, 104, 32, 112, 114, 111, 112, 97, 103, 97, 116,
+    101, 115, 32, 116, 104, 101, 32, 109, 97, 114, 107, 101, 114, 32, 105, 110,
+    115, 105, 100, 101, 32, 116, 104, 101, 32, 119, 111, 114, 107, 32, 103, 114,
+    111, 117, 112, 32, 116, 105, 108, 101, 32, 117, 110, 116, 105, 108, 32, 105,
+    116, 32, 105, 115, 10, 47, 47, 32, 115, 116, 97, 98, 108, 101, 44, 32,
+    116, 104, 101, 32, 97, 112, 114, 111, 110, 32, 98, 101, 105, 110, 103, 32,
+    116, 104, 101, 32, 109, 97, 114, 107, 101, 114, 32, 102, 114, 111, 109, 32,
+    116, 104, 101, 32, 112, 114, 101, 118, 105, 111, 117, 115, 32, 108, 97, 117,
+    110, 99, 104, 46, 32, 84, 104, 101, 32, 109, 97, 114, 107, 101, 114, 10,
+    47, 47, 32, 109, 117, 115, 116, 32, 98, 101, 32, 105, 110, 99, 108, 117,
+    100, 101, 100, 32, 105, 110, 32, 116, 104, 101, 32, 109, 97, 115, 107, 32,
+    40, 115, 101, 101, 32, 112, 117, 115, 104, 95, 98, 105, 116, 109, 97, 112,
+    112, 101, 100, 95, 114, 101, 99, 111, 110, 115, 116, 114, 117, 99, 116, 41,
+    46, 32, 99, 104, 97, 110, 103, 101, 100, 32, 105, 115, 10, 47, 47, 32,
+    115, 101, 116, 32, 119, 104, 101, 110, 32, 97, 32, 119, 111, 114, 100, 32,
+    100, 105, 102, 102, 101, 114, 115, 32, 102, 114, 111, 109, 32, 116, 104, 101,
+    32, 105, 110, 112, 117, 116, 32, 109, 97, 114, 107, 101, 114, 44, 32, 116,
+    104, 101, 32, 104, 111, 115, 116, 32, 114, 101, 108, 97, 117, 110, 99, 104,
+    101, 115, 32, 117, 110, 116, 105, 108, 10, 47, 47, 32, 105, 116, 32, 105,
+    115, 110, 39, 116, 46, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 32,
+    105, 115, 32, 40, 108, 121, 115, 105, 122, 101, 32, 43, 32, 50, 41, 32,
+    42, 32, 40, 108, 120, 115, 105, 122, 101, 32, 43, 32, 50, 41, 44, 32,
+    108, 111, 99, 97, 108, 95, 102, 108, 97, 103, 32, 111, 110, 101, 32, 105,
+    110, 116, 46, 10, 107, 101, 114, 110, 101, 108, 32, 118, 111, 105, 100, 32,
+    98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 114, 101, 99, 111, 110, 115,
+    116, 114, 117, 99, 116, 40, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 42, 32, 109, 97, 114, 107, 101, 114, 44,
+    32, 103, 108, 111, 98, 97, 108, 32, 105, 110, 116, 32, 42, 32, 111, 117,
+    116, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 42, 32, 109, 97, 115, 107, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 114, 111, 119, 115, 44,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 99, 111, 108, 115,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 103, 108, 111, 98, 97, 108, 32, 105, 110, 116, 32, 42,
+    32, 99, 104, 97, 110, 103, 101, 100, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97,
+    108, 32, 117, 105, 110, 116, 32, 42, 32, 108, 111, 99, 97, 108, 95, 105,
+    109, 103, 44, 32, 108, 111, 99, 97, 108, 32, 105, 110, 116, 32, 42, 32,
+    108, 111, 99, 97, 108, 95, 102, 108, 97, 103, 41, 10, 123, 10, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 120, 32, 61, 32, 103, 101,
+    116, 95, 103, 108, 111, 98, 97, 108, 95, 105, 100, 40, 48, 41, 59, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 121, 32, 61, 32,
+    103, 101, 116, 95, 103, 108, 111, 98, 97, 108, 95, 105, 100, 40, 49, 41,
+    59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 120,
+    32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 105, 100, 40,
+    48, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    108, 121, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 105,
+    100, 40, 49, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 108, 120, 115, 105, 122, 101, 32, 61, 32, 103, 101, 116, 95, 108,
+    111, 99, 97, 108, 95, 115, 105, 122, 101, 40, 48, 41, 59, 10, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 121, 115, 105, 122, 101,
+    32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 115, 105, 122,
+    101, 40, 49, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 98, 95, 110, 99, 111, 108, 115, 32, 61, 32, 110, 99, 111, 108,
+    115, 32, 62, 62, 32, 53, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 99, 111, 114, 110, 101, 114, 95, 120, 32, 61, 32,
+    103, 101, 116, 95, 103, 114, 111, 117, 112, 95, 105, 100, 40, 48, 41, 32,
+    42, 32, 108, 120, 115, 105, 122, 101, 32, 45, 32, 49, 59, 10, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 99, 111, 114, 110, 101, 114,
+    95, 121, 32, 61, 32, 103, 101, 116, 95, 103, 114, 111, 117, 112, 95, 105,
+    100, 40, 49, 41, 32, 42, 32, 108, 121, 115, 105, 122, 101, 32, 45, 32,
+    49, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 32, 61, 32, 109, 97, 100,
+    50, 52, 40, 108, 121, 44, 32, 108, 120, 115, 105, 122, 101, 44, 32, 108,
+    120, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 32, 61, 32, 108, 120, 115,
+    105, 122, 101, 32, 42, 32, 108, 121, 115, 105, 122, 101, 59, 10, 10, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 112, 97, 100, 100, 101,
+    100, 95, 110, 114, 111, 119, 115, 32, 61, 32, 108, 121, 115, 105, 122, 101,
+    32, 43, 32, 50, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 32, 61,
+    32, 108, 120, 115, 105, 122, 101, 32, 43, 32, 50, 59, 10, 10, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 105, 100, 120, 32, 61,
+    32, 109, 97, 100, 50, 52, 40, 112, 97, 100, 100, 101, 100, 95, 110, 99,
+    111, 108, 115, 44, 32, 108, 121, 32, 43, 32, 49, 44, 32, 108, 120, 32,
+    43, 32, 49, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40, 121, 44,
+    32, 98, 95, 110, 99, 111, 108, 115, 44, 32, 120, 41, 59, 10, 10, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 105, 122, 101, 32,
+    61, 32, 112, 97, 100, 100, 101, 100, 95, 110, 114, 111, 119, 115, 32, 42,
+    32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 59, 10, 10,
+    32, 32, 47, 47, 32, 67, 111, 112, 121, 32, 115, 117, 98, 105, 109, 97,
+    103, 101, 32, 116, 111, 32, 108, 111, 99, 97, 108, 32, 109, 101, 109, 111,
+    114, 121, 10, 32, 32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 105, 32,
+    61, 32, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 59, 32, 105, 32,
+    60, 32, 115, 105, 122, 101, 59, 32, 105, 32, 43, 61, 32, 110, 98, 95,
+    116, 104, 114, 101, 97, 100, 115, 41, 10, 32, 32, 123, 10, 32, 32, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 100, 105, 118, 32, 61,
+    32, 105, 32, 47, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108,
+    115, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 114, 101, 99, 116, 95, 114, 111, 119, 32, 61, 32, 100, 105, 118, 32,
+    43, 32, 99, 111, 114, 110, 101, 114, 95, 121, 59, 10, 32, 32, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 114, 101, 99, 116, 95, 99,
+    111, 108, 32, 61, 32, 105, 32, 45, 32, 100, 105, 118, 32, 42, 32, 112,
+    97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 32, 43, 32, 99, 111,
+    114, 110, 101, 114, 95, 120, 59, 10, 10, 32, 32, 32, 32, 105, 102, 32,
+    40, 114, 101, 99, 116, 95, 114, 111, 119, 32, 60, 32, 48, 32, 124, 124,
+    32, 114, 101, 99, 116, 95, 114, 111, 119, 32, 62, 61, 32, 110, 114, 111,
+    119, 115, 32, 124, 124, 32, 114, 101, 99, 116, 95, 99, 111, 108, 32, 60,
+    32, 48, 32, 124, 124, 32, 114, 101, 99, 116, 95, 99, 111, 108, 32, 62,
+    61, 32, 98, 95, 110, 99, 111, 108, 115, 41, 10, 32, 32, 32, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103,
+    91, 105, 93, 32, 61, 32, 48, 59, 10, 32, 32, 32, 32, 125, 10, 32,
+    32, 32, 32, 101, 108, 115, 101, 10, 32, 32, 32, 32, 123, 10, 32, 32,
+    32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 112, 105,
+    100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40, 114, 101, 99, 116, 95,
+    114, 111, 119, 44, 32, 98, 95, 110, 99, 111, 108, 115, 44, 32, 114, 101,
+    99, 116, 95, 99, 111, 108, 41, 59, 10, 32, 32, 32, 32, 32, 32, 108,
+    111, 99, 97, 108, 95, 105, 109, 103, 91, 105, 93, 32, 61, 32, 109, 97,
+    114, 107, 101, 114, 91, 112, 105, 100, 120, 93, 59, 10, 32, 32, 32, 32,
+    125, 10, 32, 32, 125, 10, 32, 32, 98, 97, 114, 114, 105, 101, 114, 40,
+    67, 76, 75, 95, 76, 79, 67, 65, 76, 95, 77, 69, 77, 95, 70, 69,
+    78, 67, 69, 41, 59, 10, 10, 32, 32, 47, 47, 32, 84, 104, 114, 101,
+    97, 100, 115, 32, 111, 117, 116, 115, 105, 100, 101, 32, 116, 104, 101, 32,
+    105, 109, 97, 103, 101, 32, 115, 116, 105, 108, 108, 32, 116, 97, 107, 101,
+    32, 112, 97, 114, 116, 32, 105, 110, 32, 116, 104, 101, 32, 98, 97, 114,
+    114, 105, 101, 114, 115, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 105, 110, 115, 105, 100, 101, 32, 61, 32, 120, 32, 60, 32, 98,
+    95, 110, 99, 111, 108, 115, 32, 38, 38, 32, 121, 32, 60, 32, 110, 114,
+    111, 119, 115, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 117, 105, 110,
+    116, 32, 109, 32, 61, 32, 105, 110, 115, 105, 100, 101, 32, 63, 32, 109,
+    97, 115, 107, 91, 105, 100, 120, 93, 32, 58, 32, 48, 59, 10, 32, 32,
+    99, 111, 110, 115, 116, 32, 117, 105, 110, 116, 32, 111, 114, 105, 103, 32,
+    61, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 108, 105, 100, 120,
+    93, 59, 10, 10, 32, 32, 102, 111, 114, 32, 40, 59, 59, 41, 10, 32,
+    32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 116, 104, 114, 101, 97,
+    100, 95, 105, 100, 120, 32, 61, 61, 32, 48, 41, 10, 32, 32, 32, 32,
+    32, 32, 42, 108, 111, 99, 97, 108, 95, 102, 108, 97, 103, 32, 61, 32,
+    48, 59, 10, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 117, 105,
+    110, 116, 32, 118, 32, 61, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103,
+    91, 108, 105, 100, 120, 93, 59, 10, 32, 32, 32, 32, 117, 105, 110, 116,
+    32, 97, 99, 99, 32, 61, 32, 118, 59, 10, 32, 32, 32, 32, 102, 111,
+    114, 32, 40, 105, 110, 116, 32, 114, 32, 61, 32, 45, 49, 59, 32, 114,
+    32, 60, 61, 32, 49, 59, 32, 43, 43, 114, 41, 10, 32, 32, 32, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 32, 99, 111,
+    110, 115, 116, 32, 117, 105, 110, 116, 32, 42, 32, 119, 32, 61, 32, 108,
+    111, 99, 97, 108, 95, 105, 109, 103, 32, 43, 32, 108, 105, 100, 120, 32,
+    43, 32, 114, 32, 42, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111,
+    108, 115, 59, 10, 32, 32, 32, 32, 32, 32, 97, 99, 99, 32, 124, 61,
+    32, 119, 91, 48, 93, 32, 124, 32, 40, 119, 91, 48, 93, 32, 62, 62,
+    32, 49, 41, 32, 124, 32, 40, 119, 91, 45, 49, 93, 32, 60, 60, 32,
+    51, 49, 41, 32, 124, 32, 40, 119, 91, 48, 93, 32, 60, 60, 32, 49,
+    41, 32, 124, 32, 40, 119, 91, 49, 93, 32, 62, 62, 32, 51, 49, 41,
+    59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 99, 111, 110, 115,
+    116, 32, 117, 105, 110, 116, 32, 110, 118, 32, 61, 32, 98, 105, 116, 109,
+    97, 112, 112, 101, 100, 95, 102, 105, 108, 108, 95, 119, 111, 114, 100, 40,
+    97, 99, 99, 44, 32, 109, 41, 59, 10, 32, 32, 32, 32, 98, 97, 114,
+    114, 105, 101, 114, 40, 67, 76, 75, 95, 76, 79, 67, 65, 76, 95, 77,
+    69, 77, 95, 70, 69, 78, 67, 69, 41, 59, 10, 10, 32, 32, 32, 32,
+    105, 102, 32, 40, 110, 118, 32, 33, 61, 32, 118, 41, 10, 32, 32, 32,
+    32, 123, 10, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105,
+    109, 103, 91, 108, 105, 100, 120, 93, 32, 61, 32, 110, 118, 59, 10, 32,
+    32, 32, 32, 32, 32, 42, 108, 111, 99, 97, 108, 95, 102, 108, 97, 103,
+    32, 61, 32, 49, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32,
+    98, 97, 114, 114, 105, 101, 114, 40, 67, 76, 75, 95, 76, 79, 67, 65,
+    76, 95, 77, 69, 77, 95, 70, 69, 78, 67, 69, 41, 59, 10, 10, 32,
+    32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 97, 103, 97,
+    105, 110, 32, 61, 32, 42, 108, 111, 99, 97, 108, 95, 102, 108, 97, 103,
+    59, 10, 32, 32, 32, 32, 98, 97, 114, 114, 105, 101, 114, 40, 67, 76,
+    75, 95, 76, 79, 67, 65, 76, 95, 77, 69, 77, 95, 70, 69, 78, 67,
+    69, 41, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 33, 97, 103, 97,
+    105, 110, 41, 10, 32, 32, 32, 32, 32, 32, 98, 114, 101, 97, 107, 59,
+    10, 32, 32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 33, 105, 110, 115,
+    105, 100, 101, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 59,
+    10, 32, 32, 111, 117, 116, 91, 105, 100, 120, 93, 32, 61, 32, 108, 111,
+    99, 97, 108, 95, 105, 109, 103, 91, 108, 105, 100, 120, 93, 59, 10, 32,
+    32, 47, 47, 32, 69, 118, 101, 114, 121, 32, 119, 114, 105, 116, 101, 114,
+    32, 115, 116, 111, 114, 101, 115, 32, 116, 104, 101, 32, 115, 97, 109, 101,
+    32, 118, 97, 108, 117, 101, 44, 32, 110, 111, 32, 110, 101, 101, 100, 32,
+    102, 111, 114, 32, 97, 110, 32, 97, 116, 111, 109, 105, 99, 32, 111, 112,
+    101, 114, 97, 116, 105, 111, 110, 10, 32, 32, 105, 102, 32, 40, 108, 111,
+    99, 97, 108, 95, 105, 109, 103, 91, 108, 105, 100, 120, 93, 32, 33, 61,
+    32, 111, 114, 105, 103, 41, 10, 32, 32, 32, 32, 42, 99, 104, 97, 110,
+    103, 101, 100, 32, 61, 32, 49, 59, 10, 125, 10, 35, 101, 110, 100, 105,
+    102, 10, 10, 35, 105, 102, 100, 101, 102, 32, 67, 76, 67, 86, 95, 83,
+    69, 67, 84, 73, 79, 78, 95, 66, 73, 84, 77, 65, 80, 10, 47, 47,
+    32, 83, 101, 101, 100, 115, 32, 102, 111, 114, 32, 116, 104, 101, 32, 98,
+    111, 114, 100, 101, 114, 32, 114, 101, 108, 97, 116, 101, 100, 32, 114, 101,
+    99, 111, 110, 115, 116, 114, 117, 99, 116, 105, 111, 110, 115, 58, 32, 109,
+    97, 115, 107, 32, 105, 115, 32, 116, 104, 101, 32, 105, 109, 97, 103, 101,
+    32, 40, 105, 116, 115, 10, 47, 47, 32, 99, 111, 109, 112, 108, 101, 109,
+    101, 110, 116, 32, 119, 105, 116, 104, 32, 105, 110, 118, 101, 114, 116, 41,
+    44, 32, 109, 97, 114, 107, 101, 114, 32, 116, 104, 101, 32, 112, 105, 120,
+    101, 108, 115, 32, 111, 102, 32, 109, 97, 115, 107, 32, 111, 110, 32, 116,
+    104, 101, 32, 105, 109, 97, 103, 101, 32, 98, 111, 114, 100, 101, 114, 10,
+    107, 101, 114, 110, 101, 108, 32, 118, 111, 105, 100, 32, 98, 105, 116, 109,
+    97, 112, 112, 101, 100, 95, 98, 111, 114, 100, 101, 114, 95, 109, 97, 114,
+    107, 101, 114, 40, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 42, 32, 105, 110, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 103,
+    108, 111, 98, 97, 108, 32, 105, 110, 116, 32, 42, 32, 109, 97, 114, 107,
+    101, 114, 44, 32, 103, 108, 111, 98, 97, 108, 32, 105, 110, 116, 32, 42,
+    32, 109, 97, 115, 107, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 110, 114, 111, 119, 115, 44, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 110, 99, 111, 108, 115, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 105, 110, 118, 101, 114,
+    116, 41, 10, 123, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 120, 32, 61, 32, 103, 101, 116, 95, 103, 108, 111, 98, 97, 108, 95,
+    105, 100, 40, 48, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 121, 32, 61, 32, 103, 101, 116, 95, 103, 108, 111, 98, 97,
+    108, 95, 105, 100, 40, 49, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 98, 95, 110, 99, 111, 108, 115, 32, 61, 32, 110,
+    99, 111, 108, 115, 32, 62, 62, 32, 53, 59, 10, 10, 32, 32, 105, 102,
+    32, 40, 120, 32, 62, 61, 32, 98, 95, 110, 99, 111, 108, 115, 32, 124,
+    124, 32, 121, 32, 62, 61, 32, 110, 114, 111, 119, 115, 41, 10, 32, 32,
+    32, 32, 114, 101, 116, 117, 114, 110, 59, 10, 10, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 105, 100, 120, 32, 61, 32, 109, 97, 100,
+    50, 52, 40, 121, 44, 32, 98, 95, 110, 99, 111, 108, 115, 44, 32, 120,
+    41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 117, 105, 110, 116, 32,
+    109, 32, 61, 32, 105, 110, 118, 101, 114, 116, 32, 63, 32, 126, 105, 110,
+    91, 105, 100, 120, 93, 32, 58, 32, 105, 110, 91, 105, 100, 120, 93, 59,
+    10, 32, 32, 117, 105, 110, 116, 32, 98, 111, 114, 100, 101, 114, 32, 61,
+    32, 121, 32, 61, 61, 32, 48, 32, 124, 124, 32, 121, 32, 61, 61, 32,
+    110, 114, 111, 119, 115, 32, 45, 32, 49, 32, 63, 32, 48, 120, 70, 70,
+    70, 70, 70, 70, 70, 70, 32, 58, 32, 48, 59, 10, 32, 32, 105, 102,
+    32, 40, 120, 32, 61, 61, 32, 48, 41, 10, 32, 32, 32, 32, 98, 111,
+    114, 100, 101, 114, 32, 124, 61, 32, 48, 120, 56, 48, 48, 48, 48, 48,
+    48, 48, 59, 10, 32, 32, 105, 102, 32, 40, 120, 32, 61, 61, 32, 98,
+    95, 110, 99, 111, 108, 115, 32, 45, 32, 49, 41, 10, 32, 32, 32, 32,
+    98, 111, 114, 100, 101, 114, 32, 124, 61, 32, 49, 59, 10, 32, 32, 109,
+    97, 115, 107, 91, 105, 100, 120, 93, 32, 61, 32, 109, 59, 10, 32, 32,
+    109, 97, 114, 107, 101, 114, 91, 105, 100, 120, 93, 32, 61, 32, 109, 32,
+    38, 32, 98, 111, 114, 100, 101, 114, 59, 10, 125, 10, 35, 101, 110, 100,
+    105, 102, 10, 10, 35, 105, 102, 100, 101, 102, 32, 67, 76, 67, 86, 95,
+    83, 69, 67, 84, 73, 79, 78, 95, 71, 82, 65, 89, 95, 79, 80, 10,
+    47, 47, 32, 71, 114, 97, 121, 115, 99, 97, 108, 101, 32, 40, 109, 105,
+    110, 47, 109, 97, 120, 41, 32, 109, 111, 114, 112, 104, 111, 108, 111, 103,
+    121, 32, 119, 105, 116, 104, 32, 102, 108, 97, 116, 32, 83, 69, 115, 10,
+    47, 47, 32, 80, 105, 120, 101, 108, 115, 32, 111, 117, 116, 115, 105, 100,
+    101, 32, 116, 104, 101, 32, 105, 109, 97, 103, 101, 32, 97, 114, 101, 32,
+    105, 103, 110, 111, 114, 101, 100, 44, 32, 105, 46, 101, 46, 32, 116, 104,
+    101, 121, 32, 97, 114, 101, 32, 43, 105, 110, 102, 32, 102, 111, 114, 32,
+    116, 104, 101, 10, 47, 47, 32, 101, 114, 111, 115, 105, 111, 110, 115, 32,
+    97, 110, 100, 32, 45, 105, 110, 102, 32, 102, 111, 114, 32, 116, 104, 101,
+    32, 100, 105, 108, 97, 116, 105, 111, 110, 115, 46, 10, 10, 105, 110, 116,
+    32, 103, 114, 97, 121, 95, 111, 112, 40, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 97, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    98, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 101, 114, 111,
+    115, 105, 111, 110, 41, 10, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110,
+    32, 101, 114, 111, 115, 105, 111, 110, 32, 63, 32, 109, 105, 110, 40, 97,
+    44, 32, 98, 41, 32, 58, 32, 109, 97, 120, 40, 97, 44, 32, 98, 41,
+    59, 10, 125, 10, 35, 101, 110, 100, 105, 102, 10, 10, 35, 105, 102, 100,
+    101, 102, 32, 67, 76, 67, 86, 95, 83, 69, 67, 84, 73, 79, 78, 95,
+    71, 82, 65, 89, 10, 47, 47, 32, 118, 97, 110, 32, 72, 101, 114, 107,
+    47, 71, 105, 108, 45, 87, 101, 114, 109, 97, 110, 44, 32, 102, 105, 114,
+    115, 116, 32, 112, 97, 115, 115, 58, 32, 114, 117, 110, 110, 105, 110, 103,
+    32, 109, 105, 110, 47, 109, 97, 120, 32, 102, 114, 111, 109, 32, 116, 104,
+    101, 32, 115, 116, 97, 114, 116, 32, 40, 103, 41, 32, 97, 110, 100, 10,
+    47, 47, 32, 102, 114, 111, 109, 32, 116, 104, 101, 32, 101, 110, 100, 32,
+    40, 104, 41, 32, 111, 102, 32, 101, 97, 99, 104, 32, 98, 108, 111, 99,
+    107, 32, 111, 102, 32, 50, 32, 42, 32, 115, 101, 95, 114, 97, 100, 32,
+    43, 32, 49, 32, 112, 105, 120, 101, 108, 115, 32, 111, 102, 32, 97, 32,
+    108, 105, 110, 101, 32, 40, 97, 32, 114, 111, 119, 44, 10, 47, 47, 32,
+    111, 114, 32, 97, 32, 99, 111, 108, 117, 109, 110, 32, 119, 104, 101, 110,
+    32, 118, 101, 114, 116, 105, 99, 97, 108, 41, 46, 32, 79, 110, 101, 32,
+    116, 104, 114, 101, 97, 100, 32, 112, 101, 114, 32, 98, 108, 111, 99, 107,
+    44, 32, 116, 104, 101, 32, 98, 108, 111, 99, 107, 115, 32, 97, 114, 101,
+    32, 97, 108, 111, 110, 103, 32, 116, 104, 101, 10, 47, 47, 32, 102, 105,
+    114, 115, 116, 32, 100, 105, 109, 101, 110, 115, 105, 111, 110, 32, 102, 111,
+    114, 32, 116, 104, 101, 32, 114, 111, 119, 115, 32, 97, 110, 100, 32, 97,
+    108, 111, 110, 103, 32, 116, 104, 101, 32, 115, 101, 99, 111, 110, 100, 32,
+    111, 110, 101, 32, 102, 111, 114, 32, 116, 104, 101, 32, 99, 111, 108, 117,
+    109, 110, 115, 46, 10, 107, 101, 114, 110, 101, 108, 32, 118, 111, 105, 100,
+    32, 103, 114, 97, 121, 95, 118, 104, 103, 119, 95, 115, 99, 97, 110, 40,
+    103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 42, 32, 105, 110, 44, 32, 103, 108, 111, 98, 97, 108, 32, 105, 110,
+    116, 32, 42, 32, 103, 44, 32, 103, 108, 111, 98, 97, 108, 32, 105, 110,
+    116, 32, 42, 32, 104, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 114, 111, 119,
+    115, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 99, 111,
+    108, 115, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 101, 95, 114, 97, 100, 44,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 118, 101, 114, 116, 105,
+    99, 97, 108, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 101,
+    114, 111, 115, 105, 111, 110, 41, 10, 123, 10, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 98, 108, 111, 99, 107, 32, 61, 32, 103, 101,
+    116, 95, 103, 108, 111, 98, 97, 108, 95, 105, 100, 40, 118, 101, 114, 116,
+    105, 99, 97, 108, 32, 63, 32, 49, 32, 58, 32, 48, 41, 59, 10, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 105, 110, 101, 32,
+    61, 32, 103, 101, 116, 95, 103, 108, 111, 98, 97, 108, 95, 105, 100, 40,
+    118, 101, 114, 116, 105, 99, 97, 108, 32, 63, 32, 48, 32, 58, 32, 49,
+    41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108,
+    101, 110, 32, 61, 32, 118, 101, 114, 116, 105, 99, 97, 108, 32, 63, 32,
+    110, 114, 111, 119, 115, 32, 58, 32, 110, 99, 111, 108, 115, 59, 10, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 108, 105, 110, 101,
+    115, 32, 61, 32, 118, 101, 114, 116, 105, 99, 97, 108, 32, 63, 32, 110,
+    99, 111, 108, 115, 32, 58, 32, 110, 114, 111, 119, 115, 59, 10, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 107, 32, 61, 32, 115, 101,
+    95, 114, 97, 100, 32, 42, 32, 50, 32, 43, 32, 49, 59, 10, 10, 32,
+    32, 105, 102, 32, 40, 108, 105, 110, 101, 32, 62, 61, 32, 110, 108, 105,
+    110, 101, 115, 32, 124, 124, 32, 98, 108, 111, 99, 107, 32, 42, 32, 107,
+    32, 62, 61, 32, 108, 101, 110, 41, 10, 32, 32, 32, 32, 114, 101, 116,
+    117, 114, 110, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 115, 116, 101, 112, 32, 61, 32, 118, 101, 114, 116, 105, 99, 97,
+    108, 32, 63, 32, 110, 99, 111, 108, 115, 32, 58, 32, 49, 59, 10, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 102, 105, 114, 115, 116,
+    32, 61, 32, 98, 108, 111, 99, 107, 32, 42, 32, 107, 59, 10, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 97, 115, 116, 32, 61,
+    32, 109, 105, 110, 40, 102, 105, 114, 115, 116, 32, 43, 32, 107, 44, 32,
+    108, 101, 110, 41, 32, 45, 32, 49, 59, 10, 32, 32, 105, 110, 116, 32,
+    105, 100, 120, 32, 61, 32, 118, 101, 114, 116, 105, 99, 97, 108, 32, 63,
+    32, 109, 97, 100, 50, 52, 40, 102, 105, 114, 115, 116, 44, 32, 110, 99,
+    111, 108, 115, 44, 32, 108, 105, 110, 101, 41, 32, 58, 32, 109, 97, 100,
+    50, 52, 40, 108, 105, 110, 101, 44, 32, 110, 99, 111, 108, 115, 44, 32,
+    102, 105, 114, 115, 116, 41, 59, 10, 32, 32, 105, 110, 116, 32, 97, 99,
+    99, 32, 61, 32, 105, 110, 91, 105, 100, 120, 93, 59, 10, 32, 32, 103,
+    91, 105, 100, 120, 93, 32, 61, 32, 97, 99, 99, 59, 10, 32, 32, 102,
+    111, 114, 32, 40, 105, 110, 116, 32, 105, 32, 61, 32, 102, 105, 114, 115,
+    116, 32, 43, 32, 49, 59, 32, 105, 32, 60, 61, 32, 108, 97, 115, 116,
+    59, 32, 43, 43, 105, 41, 10, 32, 32, 123, 10, 32, 32, 32, 32, 105,
+    100, 120, 32, 43, 61, 32, 115, 116, 101, 112, 59, 10, 32, 32, 32, 32,
+    97, 99, 99, 32, 61, 32, 103, 114, 97, 121, 95, 111, 112, 40, 97, 99,
+    99, 44, 32, 105, 110, 91, 105, 100, 120, 93, 44, 32, 101, 114, 111, 115,
+    105, 111, 110, 41, 59, 10, 32, 32, 32, 32, 103, 91, 105, 100, 120, 93,
+    32, 61, 32, 97, 99, 99, 59, 10, 32, 32, 125, 10, 32, 32, 97, 99,
+    99, 32, 61, 32, 105, 110, 91, 105, 100, 120, 93, 59, 10, 32, 32, 104,
+    91, 105, 100, 120, 93, 32, 61, 32, 97, 99, 99, 59, 10, 32, 32, 102,
+    111, 114, 32, 40, 105, 110, 116, 32, 105, 32, 61, 32, 108, 97, 115, 116,
+    32, 45, 32, 49, 59, 32, 105, 32, 62, 61, 32, 102, 105, 114, 115, 116,
+    59, 32, 45, 45, 105, 41, 10, 32, 32, 123, 10, 32, 32, 32, 32, 105,
+    100, 120, 32, 45, 61, 32, 115, 116, 101, 112, 59, 10, 32, 32, 32, 32,
+    97, 99, 99, 32, 61, 32, 103, 114, 97, 121, 95, 111, 112, 40, 97, 99,
+    99, 44, 32, 105, 110, 91, 105, 100, 120, 93, 44, 32, 101, 114, 111, 115,
+    105, 111, 110, 41, 59, 10, 32, 32, 32, 32, 104, 91, 105, 100, 120, 93,
+    32, 61, 32, 97, 99, 99, 59, 10, 32, 32, 125, 10, 125, 10, 10, 47,
+    47, 32, 83, 101, 99, 111, 110, 100, 32, 112, 97, 115, 115, 58, 32, 111,
+    110, 101, 32, 116, 104, 114, 101, 97, 100, 32, 112, 101, 114, 32, 112, 105,
+    120, 101, 108, 44, 32, 116, 104, 101, 32, 119, 105, 110, 100, 111, 119, 32,
+    91, 108, 111, 44, 32, 104, 105, 93, 32, 115, 112, 97, 110, 115, 32, 97,
+    116, 32, 109, 111, 115, 116, 32, 116, 119, 111, 10, 47, 47, 32, 98, 108,
+    111, 99, 107, 115, 10, 107, 101, 114, 110, 101, 108, 32, 118, 111, 105, 100,
+    32, 103, 114, 97, 121, 95, 118, 104, 103, 119, 95, 109, 101, 114, 103, 101,
+    40, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 42, 32, 103, 44, 32, 103, 108, 111, 98, 97, 108, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 42, 32, 104, 44, 32, 103, 108, 111,
+    98, 97, 108, 32, 105, 110, 116, 32, 42, 32, 111, 117, 116, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 110, 114, 111, 119, 115, 44, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 110, 99, 111, 108, 115, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 115, 101, 95, 114, 97, 100, 44, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 118, 101, 114, 116, 105, 99, 97, 108, 44, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 101, 114, 111, 115, 105, 111, 110,
+    41, 10, 123, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    120, 32, 61, 32, 103, 101, 116, 95, 103, 108, 111, 98, 97, 108, 95, 105,
+    100, 40, 48, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 121, 32, 61, 32, 103, 101, 116, 95, 103, 108, 111, 98, 97, 108,
+    95, 105, 100, 40, 49, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 120,
+    32, 62, 61, 32, 110, 99, 111, 108, 115, 32, 124, 124, 32, 121, 32, 62,
+    61, 32, 110, 114, 111, 119, 115, 41, 10, 32, 32, 32, 32, 114, 101, 116,
+    117, 114, 110, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 112, 111, 115, 32, 61, 32, 118, 101, 114, 116, 105, 99, 97, 108,
+    32, 63, 32, 121, 32, 58, 32, 120, 59, 10, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 108, 101, 110, 32, 61, 32, 118, 101, 114, 116,
+    105, 99, 97, 108, 32, 63, 32, 110, 114, 111, 119, 115, 32, 58, 32, 110,
+    99, 111, 108, 115, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 107, 32, 61, 32, 115, 101, 95, 114, 97, 100, 32, 42, 32, 50,
+    32, 43, 32, 49, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 108, 111, 32, 61, 32, 109, 97, 120, 40, 112, 111, 115, 32, 45,
+    32, 115, 101, 95, 114, 97, 100, 44, 32, 48, 41, 59, 10, 32, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 104, 105, 32, 61, 32, 109, 105,
+    110, 40, 112, 111, 115, 32, 43, 32, 115, 101, 95, 114, 97, 100, 44, 32,
+    108, 101, 110, 32, 45, 32, 49, 41, 59, 10, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 108, 111, 95, 105, 100, 120, 32, 61, 32, 118,
+    101, 114, 116, 105, 99, 97, 108, 32, 63, 32, 109, 97, 100, 50, 52, 40,
+    108, 111, 44, 32, 110, 99, 111, 108, 115, 44, 32, 120, 41, 32, 58, 32,
+    109, 97, 100, 50, 52, 40, 121, 44, 32, 110, 99, 111, 108, 115, 44, 32,
+    108, 111, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 104, 105, 95, 105, 100, 120, 32, 61, 32, 118, 101, 114, 116, 105, 99,
+    97, 108, 32, 63, 32, 109, 97, 100, 50, 52, 40, 104, 105, 44, 32, 110,
+    99, 111, 108, 115, 44, 32, 120, 41, 32, 58, 32, 109, 97, 100, 50, 52,
+    40, 121, 44, 32, 110, 99, 111, 108, 115, 44, 32, 104, 105, 41, 59, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 105, 100, 120, 32,
+    61, 32, 109, 97, 100, 50, 52, 40, 121, 44, 32, 110, 99, 111, 108, 115,
+    44, 32, 120, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 108, 111, 32,
+    47, 32, 107, 32, 33, 61, 32, 104, 105, 32, 47, 32, 107, 41, 10, 32,
+    32, 32, 32, 111, 117, 116, 91, 105, 100, 120, 93, 32, 61, 32, 103, 114,
+    97, 121, 95, 111, 112, 40, 104, 91, 108, 111, 95, 105, 100, 120, 93, 44,
+    32, 103, 91, 104, 105, 95, 105, 100, 120, 93, 44, 32, 101, 114, 111, 115,
+    105, 111, 110, 41, 59, 10, 32, 32, 101, 108, 115, 101, 10, 32, 32, 32,
+    32, 111, 117, 116, 91, 105, 100, 120, 93, 32, 61, 32, 108, 111, 32, 37,
+    32, 107, 32, 61, 61, 32, 48, 32, 63, 32, 103, 91, 104, 105, 95, 105,
+    100, 120, 93, 32, 58, 32, 104, 91, 108, 111, 95, 105, 100, 120, 93, 59,
+    10, 125, 10, 10, 47, 47, 32, 65, 110, 121, 32, 102, 108, 97, 116, 32,
+    83, 69, 32, 40, 116, 104, 101, 32, 112, 111, 105, 110, 116, 115, 32, 111,
+    102, 32, 116, 104, 101, 32, 83, 69, 44, 32, 119, 104, 97, 116, 101, 118,
+    101, 114, 32, 116, 104, 101, 105, 114, 32, 119, 101, 105, 103, 104, 116, 115,
+    41, 44, 32, 115, 97, 109, 101, 32, 108, 97, 121, 111, 117, 116, 32, 97,
+    115, 10, 47, 47, 32, 110, 97, 105, 118, 101, 95, 109, 111, 114, 112, 104,
+    10, 107, 101, 114, 110, 101, 108, 32, 118, 111, 105, 100, 32, 103, 114, 97,
+    121, 95, 109, 111, 114, 112, 104, 40, 103, 108, 111, 98, 97, 108, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32, 105, 110, 44, 32, 103,
+    108, 111, 98, 97, 108, 32, 105, 110, 116, 32, 42, 32, 111, 117, 116, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 110, 114, 111, 119, 115, 44, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 110, 99, 111, 108, 115, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 103, 108, 111, 98, 97, 108, 32, 105, 110, 116, 32, 42, 32, 115, 101,
+    44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 101, 95, 114,
+    111, 119, 114, 97, 100, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 115, 101, 95, 99, 111, 108, 114, 97, 100, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 101, 95,
+    99, 111, 117, 110, 116, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 101, 114, 111, 115, 105, 111, 110, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 108, 111, 99, 97, 108, 32, 105, 110, 116, 32, 42, 32, 108, 111, 99,
+    97, 108, 95, 115, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 108, 111,
+    99, 97, 108, 32, 105, 110, 116, 32, 42, 32, 108, 111, 99, 97, 108, 95,
+    105, 109, 103, 41, 10, 123, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 120, 32, 61, 32, 103, 101, 116, 95, 103, 108, 111, 98, 97,
+    108, 95, 105, 100, 40, 48, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 121, 32, 61, 32, 103, 101, 116, 95, 103, 108, 111,
+    98, 97, 108, 95, 105, 100, 40, 49, 41, 59, 10, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 108, 120, 32, 61, 32, 103, 101, 116, 95,
+    108, 111, 99, 97, 108, 95, 105, 100, 40, 48, 41, 59, 10, 32, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 121, 32, 61, 32, 103, 101,
+    116, 95, 108, 111, 99, 97, 108, 95, 105, 100, 40, 49, 41, 59, 10, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 120, 115, 105, 122,
+    101, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 115, 105,
+    122, 101, 40, 48, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 108, 121, 115, 105, 122, 101, 32, 61, 32, 103, 101, 116, 95,
+    108, 111, 99, 97, 108, 95, 115, 105, 122, 101, 40, 49, 41, 59, 10, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 99, 111, 114, 110, 101,
+    114, 95, 120, 32, 61, 32, 103, 101, 116, 95, 103, 114, 111, 117, 112, 95,
+    105, 100, 40, 48, 41, 32, 42, 32, 108, 120, 115, 105, 122, 101, 32, 45,
+    32, 115, 101, 95, 99, 111, 108, 114, 97, 100, 59, 10, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 99, 111, 114, 110, 101, 114, 95, 121,
+    32, 61, 32, 103, 101, 116, 95, 103, 114, 111, 117, 112, 95, 105, 100, 40,
+    49, 41, 32, 42, 32, 108, 121, 115, 105, 122, 101, 32, 45, 32, 115, 101,
+    95, 114, 111, 119, 114, 97, 100, 59, 10, 10, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120,
+    32, 61, 32, 109, 97, 100, 50, 52, 40, 108, 121, 44, 32, 108, 120, 115,
+    105, 122, 101, 44, 32, 108, 120, 41, 59, 10, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115,
+    32, 61, 32, 108, 120, 115, 105, 122, 101, 32, 42, 32, 108, 121, 115, 105,
+    122, 101, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 115, 101, 95, 115, 105, 122, 101, 32, 61, 32, 115, 101, 95, 99, 111,
+    117, 110, 116, 32, 42, 32, 50, 32, 43, 32, 115, 101, 95, 99, 111, 117,
+    110, 116, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 112, 97, 100, 100, 101, 100, 95, 110, 114, 111, 119, 115, 32, 61, 32,
+    108, 121, 115, 105, 122, 101, 32, 43, 32, 115, 101, 95, 114, 111, 119, 114,
+    97, 100, 32, 42, 32, 50, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115,
+    32, 61, 32, 108, 120, 115, 105, 122, 101, 32, 43, 32, 115, 101, 95, 99,
+    111, 108, 114, 97, 100, 32, 42, 32, 50, 59, 10, 10, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 115, 105, 122, 101, 32, 61, 32, 112,
+    97, 100, 100, 101, 100, 95, 110, 114, 111, 119, 115, 32, 42, 32, 112, 97,
+    100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 59, 10, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 111, 117, 116, 115, 105, 100, 101, 32,
+    61, 32, 101, 114, 111, 115, 105, 111, 110, 32, 63, 32, 73, 78, 84, 95,
+    77, 65, 88, 32, 58, 32, 73, 78, 84, 95, 77, 73, 78, 59, 10, 10,
+    32, 32, 47, 47, 32, 67, 111, 112, 121, 32, 116, 104, 101, 32, 83, 69,
+    32, 97, 110, 100, 32, 116, 104, 101, 32, 115, 117, 98, 32, 105, 109, 97,
+    103, 101, 32, 105, 110, 116, 111, 32, 116, 104, 101, 32, 108, 111, 99, 97,
+    108, 32, 109, 101, 109, 111, 114, 121, 10, 32, 32, 109, 101, 109, 99, 112,
+    121, 50, 108, 111, 99, 97, 108, 40, 108, 111, 99, 97, 108, 95, 115, 101,
+    44, 32, 115, 101, 44, 32, 115, 101, 95, 115, 105, 122, 101, 44, 32, 116,
+    104, 114, 101, 97, 100, 95, 105, 100, 120, 44, 32, 110, 98, 95, 116, 104,
+    114, 101, 97, 100, 115, 41, 59, 10, 32, 32, 102, 111, 114, 32, 40, 105,
+    110, 116, 32, 105, 32, 61, 32, 116, 104, 114, 101, 97, 100, 95, 105, 100,
+    120, 59, 32, 105, 32, 60, 32, 115, 105, 122, 101, 59, 32, 105, 32, 43,
+    61, 32, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 41, 10, 32, 32,
+    123, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    100, 105, 118, 32, 61, 32, 105, 32, 47, 32, 112, 97, 100, 100, 101, 100,
+    95, 110, 99, 111, 108, 115, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 114, 101, 99, 116, 95, 114, 111, 119, 32, 61,
+    32, 100, 105, 118, 32, 43, 32, 99, 111, 114, 110, 101, 114, 95, 121, 59,
+    10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 114,
+    101, 99, 116, 95, 99, 111, 108, 32, 61, 32, 105, 32, 45, 32, 100, 105,
+    118, 32, 42, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115,
+    32, 43, 32, 99, 111, 114, 110, 101, 114, 95, 120, 59, 10, 10, 32, 32,
+    32, 32, 105, 102, 32, 40, 114, 101, 99, 116, 95, 114, 111, 119, 32, 60,
+    32, 48, 32, 124, 124, 32, 114, 101, 99, 116, 95, 114, 111, 119, 32, 62,
+    61, 32, 110, 114, 111, 119, 115, 32, 124, 124, 32, 114, 101, 99, 116, 95,
+    99, 111, 108, 32, 60, 32, 48, 32, 124, 124, 32, 114, 101, 99, 116, 95,
+    99, 111, 108, 32, 62, 61, 32, 110, 99, 111, 108, 115, 41, 10, 32, 32,
+    32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 105, 93,
+    32, 61, 32, 111, 117, 116, 115, 105, 100, 101, 59, 10, 32, 32, 32, 32,
+    101, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108,
+    95, 105, 109, 103, 91, 105, 93, 32, 61, 32, 105, 110, 91, 109, 97, 100,
+    50, 52, 40, 114, 101, 99, 116, 95, 114, 111, 119, 44, 32, 110, 99, 111,
+    108, 115, 44, 32, 114, 101, 99, 116, 95, 99, 111, 108, 41, 93, 59, 10,
+    32, 32, 125, 10, 32, 32, 98, 97, 114, 114, 105, 101, 114, 40, 67, 76,
+    75, 95, 76, 79, 67, 65, 76, 95, 77, 69, 77, 95, 70, 69, 78, 67,
+    69, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 120, 32, 62, 61, 32,
+    110, 99, 111, 108, 115, 32, 124, 124, 32, 121, 32, 62, 61, 32, 110, 114,
+    111, 119, 115, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 59,
+    10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 105,
+    100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40, 112, 97, 100, 100, 101,
+    100, 95, 110, 99, 111, 108, 115, 44, 32, 108, 121, 32, 43, 32, 115, 101,
+    95, 114, 111, 119, 114, 97, 100, 44, 32, 108, 120, 32, 43, 32, 115, 101,
+    95, 99, 111, 108, 114, 97, 100, 41, 59, 10, 32, 32, 105, 110, 116, 32,
+    97, 99, 99, 32, 61, 32, 111, 117, 116, 115, 105, 100, 101, 59, 10, 32,
+    32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 105, 32, 61, 32, 48, 59,
+    32, 105, 32, 60, 32, 115, 101, 95, 115, 105, 122, 101, 59, 32, 105, 32,
+    43, 61, 32, 51, 41, 10, 32, 32, 123, 10, 32, 32, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 114, 105, 100, 120, 32, 61, 32, 109,
+    97, 100, 50, 52, 40, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108,
+    115, 44, 32, 108, 111, 99, 97, 108, 95, 115, 101, 91, 105, 93, 44, 32,
+    108, 105, 100, 120, 32, 43, 32, 108, 111, 99, 97, 108, 95, 115, 101, 91,
+    105, 43, 49, 93, 41, 59, 10, 32, 32, 32, 32, 97, 99, 99, 32, 61,
+    32, 103, 114, 97, 121, 95, 111, 112, 40, 97, 99, 99, 44, 32, 108, 111,
+    99, 97, 108, 95, 105, 109, 103, 91, 114, 105, 100, 120, 93, 44, 32, 101,
+    114, 111, 115, 105, 111, 110, 41, 59, 10, 32, 32, 125, 10, 32, 32, 111,
+    117, 116, 91, 109, 97, 100, 50, 52, 40, 121, 44, 32, 110, 99, 111, 108,
+    115, 44, 32, 120, 41, 93, 32, 61, 32, 97, 99, 99, 59, 10, 125, 10,
+    35, 101, 110, 100, 105, 102, 10, 10, 47, 47, 32, 67, 111, 110, 110, 101,
+    99, 116, 101, 100, 32, 99, 111, 109, 112, 111, 110, 101, 110, 116, 32, 108,
+    97, 98, 101, 108, 105, 110, 103, 32, 111, 102, 32, 98, 105, 116, 109, 97,
+    112, 115, 32, 40, 56, 45, 99, 111, 110, 110, 101, 120, 105, 116, 121, 41,
+    10, 47, 47, 32, 84, 104, 101, 32, 110, 111, 100, 101, 115, 32, 111, 102,
+    32, 116, 104, 101, 32, 117, 110, 105, 111, 110, 45, 102, 105, 110, 100, 32,
+    97, 114, 101, 32, 116, 104, 101, 32, 114, 117, 110, 115, 32, 111, 102, 32,
+    115, 101, 116, 32, 98, 105, 116, 115, 32, 105, 110, 115, 105, 100, 101, 32,
+    101, 97, 99, 104, 32, 119, 111, 114, 100, 44, 10, 47, 47, 32, 105, 100,
+    101, 110, 116, 105, 102, 105, 101, 100, 32, 98, 121, 32, 116, 104, 101, 32,
+    105, 110, 100, 101, 120, 32, 111, 102, 32, 116, 104, 101, 105, 114, 32, 102,
+    105, 114, 115, 116, 32, 112, 105, 120, 101, 108, 46, 32, 84, 104, 101, 32,
+    114, 111, 111, 116, 115, 32, 97, 114, 101, 32, 97, 108, 119, 97, 121, 115,
+    32, 116, 104, 101, 10, 47, 47, 32, 115, 109, 97, 108, 108, 101, 115, 116,
+    32, 105, 110, 100, 101, 120, 44, 32, 105, 46, 101, 46, 32, 116, 104, 101,
+    32, 102, 105, 114, 115, 116, 32, 114, 117, 110, 32, 111, 102, 32, 116, 104,
+    101, 32, 99, 111, 109, 112, 111, 110, 101, 110, 116, 32, 105, 110, 32, 114,
+    97, 115, 116, 101, 114, 32, 111, 114, 100, 101, 114, 46, 10, 10, 47, 47,
+    32, 79, 110, 108, 121, 32, 116, 104, 101, 32, 115, 101, 99, 116, 105, 111,
+    110, 115, 32, 117, 115, 105, 110, 103, 32, 97, 116, 111, 109, 105, 99, 115,
+    32, 114, 101, 113, 117, 105, 114, 101, 32, 116, 104, 101, 32, 101, 120, 116,
+    101, 110, 115, 105, 111, 110, 115, 10, 35, 105, 102, 32, 100, 101, 102, 105,
+    110, 101, 100, 40, 67, 76, 67, 86, 95, 83, 69, 67, 84, 73, 79, 78,
+    95, 76, 65, 66, 69, 76, 41, 32, 124, 124, 32, 100, 101, 102, 105, 110,
+    101, 100, 40, 67, 76, 67, 86, 95, 83, 69, 67, 84, 73, 79, 78, 95,
+    65, 82, 69, 65, 41, 32, 92, 10, 32, 32, 124, 124, 32, 100, 101, 102,
+    105, 110, 101, 100, 40, 67, 76, 67, 86, 95, 83, 69, 67, 84, 73, 79,
+    78, 95, 66, 73, 84, 77, 65, 80, 41, 32, 124, 124, 32, 100, 101, 102,
+    105, 110, 101, 100, 40, 67, 76, 67, 86, 95, 83, 69, 67, 84, 73, 79,
+    78, 95, 71, 82, 65, 89, 95, 82, 69, 67, 79, 78, 83, 84, 82, 85,
+    67, 84, 41, 10, 35, 32, 112, 114, 97, 103, 109, 97, 32, 79, 80, 69,
+    78, 67, 76, 32, 69, 88, 84, 69, 78, 83, 73, 79, 78, 32, 99, 108,
+    95, 107, 104, 114, 95, 103, 108, 111, 98, 97, 108, 95, 105, 110, 116, 51,
+    50, 95, 98, 97, 115, 101, 95, 97, 116, 111, 109, 105, 99, 115, 32, 58,
+    32, 101, 110, 97, 98, 108, 101, 10, 35, 32, 112, 114, 97, 103, 109, 97,
+    32, 79, 80, 69, 78, 67, 76, 32, 69, 88, 84, 69, 78, 83, 73, 79,
+    78, 32, 99, 108, 95, 107, 104, 114, 95, 103, 108, 111, 98, 97, 108, 95,
+    105, 110, 116, 51, 50, 95, 101, 120, 116, 101, 110, 100, 101, 100, 95, 97,
+    116, 111, 109, 105, 99, 115, 32, 58, 32, 101, 110, 97, 98, 108, 101, 10,
+    35, 32, 112, 114, 97, 103, 109, 97, 32, 79, 80, 69, 78, 67, 76, 32,
+    69, 88, 84, 69, 78, 83, 73, 79, 78, 32, 99, 108, 95, 107, 104, 114,
+    95, 108, 111, 99, 97, 108, 95, 105, 110, 116, 51, 50, 95, 101, 120, 116,
+    101, 110, 100, 101, 100, 95, 97, 116, 111, 109, 105, 99, 115, 32, 58, 32,
+    101, 110, 97, 98, 108, 101, 10, 35, 101, 110, 100, 105, 102, 10, 10, 35,
+    105, 102, 100, 101, 102, 32, 67, 76, 67, 86, 95, 83, 69, 67, 84, 73,
+    79, 78, 95, 76, 65, 66, 69, 76, 10, 47, 47, 32, 83, 116, 97, 114,
+    116, 115, 32, 111, 102, 32, 116, 104, 101, 32, 114, 117, 110, 115, 32, 111,
+    102, 32, 97, 32, 119, 111, 114, 100, 32, 40, 112, 111, 115, 32, 48, 32,
+    105, 115, 32, 116, 104, 101, 32, 77, 83, 66, 41, 46, 32, 84, 119, 111,
+    32, 115, 116, 97, 114, 116, 115, 32, 97, 114, 101, 32, 97, 116, 32, 108,
+    101, 97, 115, 116, 10, 47, 47, 32, 116, 119, 111, 32, 112, 111, 115, 105,
+    116, 105, 111, 110, 115, 32, 97, 112, 97, 114, 116, 44, 32, 115, 111, 32,
+    112, 111, 115, 32, 47, 32, 50, 32, 110, 117, 109, 98, 101, 114, 115, 32,
+    116, 104, 101, 32, 114, 117, 110, 115, 32, 111, 102, 32, 97, 32, 119, 111,
+    114, 100, 46, 10, 117, 105, 110, 116, 32, 98, 105, 116, 109, 97, 112, 112,
+    101, 100, 95, 115, 116, 97, 114, 116, 115, 40, 99, 111, 110, 115, 116, 32,
+    117, 105, 110, 116, 32, 119, 41, 10, 123, 10, 32, 32, 114, 101, 116, 117,
+    114, 110, 32, 119, 32, 38, 32, 126, 40, 119, 32, 62, 62, 32, 49, 41,
+    59, 10, 125, 10, 10, 47, 47, 32, 80, 111, 115, 105, 116, 105, 111, 110,
+    115, 32, 62, 61, 32, 112, 111, 115, 10, 117, 105, 110, 116, 32, 98, 105,
+    116, 109, 97, 112, 112, 101, 100, 95, 102, 114, 111, 109, 40, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 112, 111, 115, 41, 10, 123, 10, 32, 32,
+    114, 101, 116, 117, 114, 110, 32, 112, 111, 115, 32, 62, 61, 32, 51, 50,
+    32, 63, 32, 48, 32, 58, 32, 48, 120, 70, 70, 70, 70, 70, 70, 70,
+    70, 32, 62, 62, 32, 112, 111, 115, 59, 10, 125, 10, 10, 47, 47, 32,
+    70, 105, 114, 115, 116, 32, 112, 111, 115, 105, 116, 105, 111, 110, 32, 111,
+    102, 32, 116, 104, 101, 32, 114, 117, 110, 32, 99, 111, 110, 116, 97, 105,
+    110, 105, 110, 103, 32, 112, 111, 115, 10, 105, 110, 116, 32, 98, 105, 116,
+    109, 97, 112, 112, 101, 100, 95, 114, 117, 110, 95, 98, 101, 103, 105, 110,
+    40, 99, 111, 110, 115, 116, 32, 117, 105, 110, 116, 32, 119, 44, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 112, 111, 115, 41, 10, 123, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 117, 105, 110, 116, 32, 122, 101, 114,
+    111, 115, 32, 61, 32, 126, 119, 32, 38, 32, 126, 98, 105, 116, 109, 97,
+    112, 112, 101, 100, 95, 102, 114, 111, 109, 40, 112, 111, 115, 41, 59, 10,
+    32, 32, 114, 101, 116, 117, 114, 110, 32, 122, 101, 114, 111, 115, 32, 63,
+    32, 99, 108, 122, 40, 122, 101, 114, 111, 115, 32, 38, 32, 45, 122, 101,
+    114, 111, 115, 41, 32, 43, 32, 49, 32, 58, 32, 48, 59, 10, 125, 10,
+    10, 47, 47, 32, 80, 111, 115, 105, 116, 105, 111, 110, 32, 102, 111, 108,
+    108, 111, 119, 105, 110, 103, 32, 116, 104, 101, 32, 114, 117, 110, 32, 99,
+    111, 110, 116, 97, 105, 110, 105, 110, 103, 32, 112, 111, 115, 10, 105, 110,
+    116, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 114, 117, 110, 95,
+    101, 110, 100, 40, 99, 111, 110, 115, 116, 32, 117, 105, 110, 116, 32, 119,
+    44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 112, 111, 115, 41,
+    10, 123, 10, 32, 32, 99, 111, 110, 115, 116, 32, 117, 105, 110, 116, 32,
+    122, 101, 114, 111, 115, 32, 61, 32, 126, 119, 32, 38, 32, 98, 105, 116,
+    109, 97, 112, 112, 101, 100, 95, 102, 114, 111, 109, 40, 112, 111, 115, 41,
+    59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 122, 101, 114, 111, 115,
+    32, 63, 32, 99, 108, 122, 40, 122, 101, 114, 111, 115, 41, 32, 58, 32,
+    51, 50, 59, 10, 125, 10, 10, 47, 47, 32, 83, 116, 97, 114, 116, 32,
+    111, 102, 32, 116, 104, 101, 32, 114, 117, 110, 32, 110, 117, 109, 98, 101,
+    114, 101, 100, 32, 106, 32, 40, 115, 101, 101, 32, 98, 105, 116, 109, 97,
+    112, 112, 101, 100, 95, 115, 116, 97, 114, 116, 115, 41, 10, 105, 110, 116,
+    32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 114, 117, 110, 95, 115,
+    116, 97, 114, 116, 40, 99, 111, 110, 115, 116, 32, 117, 105, 110, 116, 32,
+    119, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 106, 41, 10,
+    123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 40, 98, 105, 116, 109,
+    97, 112, 112, 101, 100, 95, 115, 116, 97, 114, 116, 115, 40, 119, 41, 32,
+    38, 32, 40, 48, 120, 56, 48, 48, 48, 48, 48, 48, 48, 32, 62, 62,
+    32, 40, 106, 32, 42, 32, 50, 41, 41, 41, 32, 63, 32, 106, 32, 42,
+    32, 50, 32, 58, 32, 106, 32, 42, 32, 50, 32, 43, 32, 49, 59, 10,
+    125, 10, 10, 47, 47, 32, 80, 97, 105, 114, 115, 32, 111, 102, 32, 56,
+    45, 99, 111, 110, 110, 101, 99, 116, 101, 100, 32, 114, 117, 110, 115, 32,
+    98, 101, 116, 119, 101, 101, 110, 32, 97, 32, 119, 111, 114, 100, 32, 97,
+    110, 100, 32, 116, 104, 101, 32, 119, 111, 114, 100, 32, 97, 98, 111, 118,
+    101, 32, 105, 116, 44, 32, 97, 115, 10, 47, 47, 32, 40, 115, 116, 97,
+    114, 116, 32, 105, 110, 32, 119, 41, 32, 60, 60, 32, 56, 32, 124, 32,
+    40, 115, 116, 97, 114, 116, 32, 105, 110, 32, 117, 112, 41, 46, 32, 84,
+    104, 101, 114, 101, 32, 97, 114, 101, 32, 102, 101, 119, 101, 114, 32, 116,
+    104, 97, 110, 32, 51, 50, 46, 10, 105, 110, 116, 32, 98, 105, 116, 109,
+    97, 112, 112, 101, 100, 95, 108, 97, 98, 101, 108, 95, 112, 97, 105, 114,
+    115, 40, 99, 111, 110, 115, 116, 32, 117, 105, 110, 116, 32, 119, 44, 32,
+    99, 111, 110, 115, 116, 32, 117, 105, 110, 116, 32, 117, 112, 44, 32, 105,
+    110, 116, 32, 42, 32, 112, 97, 105, 114, 115, 41, 10, 123, 10, 32, 32,
+    105, 110, 116, 32, 110, 32, 61, 32, 48, 59, 10, 32, 32, 117, 105, 110,
+    116, 32, 115, 116, 97, 114, 116, 115, 32, 61, 32, 98, 105, 116, 109, 97,
+    112, 112, 101, 100, 95, 115, 116, 97, 114, 116, 115, 40, 119, 41, 59, 10,
+    32, 32, 119, 104, 105, 108, 101, 32, 40, 115, 116, 97, 114, 116, 115, 41,
+    10, 32, 32, 123, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 98, 101, 103, 105, 110, 32, 61, 32, 99, 108, 122, 40, 115,
+    116, 97, 114, 116, 115, 41, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 101, 110, 100, 32, 61, 32, 98, 105, 116, 109,
+    97, 112, 112, 101, 100, 95, 114, 117, 110, 95, 101, 110, 100, 40, 119, 44,
+    32, 98, 101, 103, 105, 110, 41, 59, 10, 32, 32, 32, 32, 117, 105, 110,
+    116, 32, 109, 32, 61, 32, 117, 112, 32, 38, 32, 98, 105, 116, 109, 97,
+    112, 112, 101, 100, 95, 102, 114, 111, 109, 40, 109, 97, 120, 40, 98, 101,
+    103, 105, 110, 32, 45, 32, 49, 44, 32, 48, 41, 41, 32, 38, 32, 126,
+    98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 102, 114, 111, 109, 40, 109,
+    105, 110, 40, 101, 110, 100, 32, 43, 32, 49, 44, 32, 51, 50, 41, 41,
+    59, 10, 32, 32, 32, 32, 119, 104, 105, 108, 101, 32, 40, 109, 41, 10,
+    32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 113, 32, 61, 32, 99, 108, 122, 40, 109, 41,
+    59, 10, 32, 32, 32, 32, 32, 32, 112, 97, 105, 114, 115, 91, 110, 43,
+    43, 93, 32, 61, 32, 40, 98, 101, 103, 105, 110, 32, 60, 60, 32, 56,
+    41, 32, 124, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 114, 117,
+    110, 95, 98, 101, 103, 105, 110, 40, 117, 112, 44, 32, 113, 41, 59, 10,
+    32, 32, 32, 32, 32, 32, 109, 32, 38, 61, 32, 98, 105, 116, 109, 97,
+    112, 112, 101, 100, 95, 102, 114, 111, 109, 40, 98, 105, 116, 109, 97, 112,
+    112, 101, 100, 95, 114, 117, 110, 95, 101, 110, 100, 40, 117, 112, 44, 32,
+    113, 41, 41, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 115,
+    116, 97, 114, 116, 115, 32, 38, 61, 32, 98, 105, 116, 109, 97, 112, 112,
+    101, 100, 95, 102, 114, 111, 109, 40, 101, 110, 100, 41, 59, 10, 32, 32,
+    125, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 110, 59, 10, 125, 10,
+    10, 47, 47, 32, 84, 104, 101, 32, 99, 111, 109, 112, 111, 110, 101, 110,
+    116, 115, 32, 111, 102, 32, 116, 104, 101, 32, 48, 32, 112, 105, 120, 101,
+    108, 115, 32, 119, 104, 101, 110, 32, 105, 110, 118, 101, 114, 116, 101, 100,
+    10, 117, 105, 110, 116, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95,
+    108, 97, 98, 101, 108, 95, 119, 111, 114, 100, 40, 103, 108, 111, 98, 97,
+    108, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32, 105, 110,
+    44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 105, 100, 120, 44,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 105, 110, 118, 101, 114,
+    116, 101, 100, 41, 10, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32,
+    105, 110, 118, 101, 114, 116, 101, 100, 32, 63, 32, 126, 105, 110, 91, 105,
+    100, 120, 93, 32, 58, 32, 105, 110, 91, 105, 100, 120, 93, 59, 10, 125,
+    10, 10, 105, 110, 116, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95,
+    108, 97, 98, 101, 108, 95, 102, 105, 110, 100, 95, 108, 111, 99, 97, 108,
+    40, 118, 111, 108, 97, 116, 105, 108, 101, 32, 108, 111, 99, 97, 108, 32,
+    105, 110, 116, 32, 42, 32, 112, 97, 114, 101, 110, 116, 44, 32, 105, 110,
+    116, 32, 120, 41, 10, 123, 10, 32, 32, 105, 110, 116, 32, 112, 32, 61,
+    32, 112, 97, 114, 101, 110, 116, 91, 120, 93, 59, 10, 32, 32, 119, 104,
+    105, 108, 101, 32, 40, 112, 32, 33, 61, 32, 120, 41, 10, 32, 32, 123,
+    10, 32, 32, 32, 32, 120, 32, 61, 32, 112, 59, 10, 32, 32, 32, 32,
+    112, 32, 61, 32, 112, 97, 114, 101, 110, 116, 91, 120, 93, 59, 10, 32,
+    32, 125, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 120, 59, 10, 125,
+    10, 10, 47, 47, 32, 72, 111, 111, 107, 32, 116, 104, 101, 32, 108, 97,
+    114, 103, 101, 114, 32, 114, 111, 111, 116, 32, 117, 110, 100, 101, 114, 32,
+    116, 104, 101, 32, 115, 109, 97, 108, 108, 101, 114, 32, 111, 110, 101, 46,
+    32, 87, 104, 101, 110, 32, 97, 110, 111, 116, 104, 101, 114, 32, 116, 104,
+    114, 101, 97, 100, 32, 104, 111, 111, 107, 101, 100, 10, 47, 47, 32, 105,
+    116, 32, 102, 105, 114, 115, 116, 44, 32, 114, 101, 116, 114, 121, 32, 102,
+    114, 111, 109, 32, 119, 104, 101, 114, 101, 32, 105, 116, 32, 119, 97, 115,
+    32, 104, 111, 111, 107, 101, 100, 46, 10, 118, 111, 105, 100, 32, 98, 105,
+    116, 109, 97, 112, 112, 101, 100, 95, 108, 97, 98, 101, 108, 95, 117, 110,
+    105, 111, 110, 95, 108, 111, 99, 97, 108, 40, 118, 111, 108, 97, 116, 105,
+    108, 101, 32, 108, 111, 99, 97, 108, 32, 105, 110, 116, 32, 42, 32, 112,
+    97, 114, 101, 110, 116, 44, 32, 105, 110, 116, 32, 97, 44, 32, 105, 110,
+    116, 32, 98, 41, 10, 123, 10, 32, 32, 102, 111, 114, 32, 40, 59, 59,
+    41, 10, 32, 32, 123, 10, 32, 32, 32, 32, 97, 32, 61, 32, 98, 105,
+    116, 109, 97, 112, 112, 101, 100, 95, 108, 97, 98, 101, 108, 95, 102, 105,
+    110, 100, 95, 108, 111, 99, 97, 108, 40, 112, 97, 114, 101, 110, 116, 44,
+    32, 97, 41, 59, 10, 32, 32, 32, 32, 98, 32, 61, 32, 98, 105, 116,
+    109, 97, 112, 112, 101, 100, 95, 108, 97, 98, 101, 108, 95, 102, 105, 110,
+    100, 95, 108, 111, 99, 97, 108, 40, 112, 97, 114, 101, 110, 116, 44, 32,
+    98, 41, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 97, 32, 61, 61,
+    32, 98, 41, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110,
+    59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 97, 32, 62, 32, 98, 41,
+    10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 116, 32, 61, 32, 97, 59, 10, 32, 32,
+    32, 32, 32, 32, 97, 32, 61, 32, 98, 59, 10, 32, 32, 32, 32, 32,
+    32, 98, 32, 61, 32, 116, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 111, 108, 100, 32,
+    61, 32, 97, 116, 111, 109, 105, 99, 95, 109, 105, 110, 40, 38, 112, 97,
+    114, 101, 110, 116, 91, 98, 93, 44, 32, 97, 41, 59, 10, 32, 32, 32,
+    32, 105, 102, 32, 40, 111, 108, 100, 32, 61, 61, 32, 98, 41, 10, 32,
+    32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 32,
+    32, 98, 32, 61, 32, 111, 108, 100, 59, 10, 32, 32, 125, 10, 125, 10,
+    10, 105, 110, 116, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 108,
+    97, 98, 101, 108, 95, 102, 105, 110, 100, 40, 118, 111, 108, 97, 116, 105,
+    108, 101, 32, 103, 108, 111, 98, 97, 108, 32, 105, 110, 116, 32, 42, 32,
+    112, 97, 114, 101, 110, 116, 44, 32, 105, 110, 116, 32, 120, 41, 10, 123,
+    10, 32, 32, 105, 110, 116, 32, 112, 32, 61, 32, 112, 97, 114, 101, 110,
+    116, 91, 120, 93, 59, 10, 32, 32, 119, 104, 105, 108, 101, 32, 40, 112,
+    32, 33, 61, 32, 120, 41, 10, 32, 32, 123, 10, 32, 32, 32, 32, 120,
+    32, 61, 32, 112, 59, 10, 32, 32, 32, 32, 112, 32, 61, 32, 112, 97,
+    114, 101, 110, 116, 91, 120, 93, 59, 10, 32, 32, 125, 10, 32, 32, 114,
+    101, 116, 117, 114, 110, 32, 120, 59, 10, 125, 10, 10, 118, 111, 105, 100,
+    32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 108, 97, 98, 101, 108,
+    95, 117, 110, 105, 111, 110, 40, 118, 111, 108, 97, 116, 105, 108, 101, 32,
+    103, 108, 111, 98, 97, 108, 32, 105, 110, 116, 32, 42, 32, 112, 97, 114,
+    101, 110, 116, 44, 32, 105, 110, 116, 32, 97, 44, 32, 105, 110, 116, 32,
+    98, 41, 10, 123, 10, 32, 32, 102, 111, 114, 32, 40, 59, 59, 41, 10,
+    32, 32, 123, 10, 32, 32, 32, 32, 97, 32, 61, 32, 98, 105, 116, 109,
+    97, 112, 112, 101, 100, 95, 108, 97, 98, 101, 108, 95, 102, 105, 110, 100,
+    40, 112, 97, 114, 101, 110, 116, 44, 32, 97, 41, 59, 10, 32, 32, 32,
+    32, 98, 32, 61, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 108,
+    97, 98, 101, 108, 95, 102, 105, 110, 100, 40, 112, 97, 114, 101, 110, 116,
+    44, 32, 98, 41, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 97, 32,
+    61, 61, 32, 98, 41, 10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117,
+    114, 110, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 97, 32, 62, 32,
+    98, 41, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 116, 32, 61, 32, 97, 59, 10,
+    32, 32, 32, 32, 32, 32, 97, 32, 61, 32, 98, 59, 10, 32, 32, 32,
+    32, 32, 32, 98, 32, 61, 32, 116, 59, 10, 32, 32, 32, 32, 125, 10,
+    32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 111, 108,
+    100, 32, 61, 32, 97, 116, 111, 109, 105, 99, 95, 109, 105, 110, 40, 38,
+    112, 97, 114, 101, 110, 116, 91, 98, 93, 44, 32, 97, 41, 59, 10, 32,
+    32, 32, 32, 105, 102, 32, 40, 111, 108, 100, 32, 61, 61, 32, 98, 41,
+    10, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32,
+    32, 32, 32, 98, 32, 61, 32, 111, 108, 100, 59, 10, 32, 32, 125, 10,
+    125, 10, 10, 47, 47, 32, 70, 105, 114, 115, 116, 32, 112, 97, 115, 115,
+    58, 32, 111, 110, 101, 32, 116, 104, 114, 101, 97, 100, 32, 112, 101, 114,
+    32, 119, 111, 114, 100, 44, 32, 109, 101, 114, 103, 101, 32, 116, 104, 101,
+    32, 114, 117, 110, 115, 32, 111, 102, 32, 116, 104, 101, 32, 116, 105, 108,
+    101, 32, 105, 110, 32, 108, 111, 99, 97, 108, 10, 47, 47, 32, 109, 101,
+    109, 111, 114, 121, 32, 40, 108, 111, 99, 97, 108, 95, 112, 97, 114, 101,
+    110, 116, 32, 104, 111, 108, 100, 115, 32, 49, 54, 32, 110, 111, 100, 101,
+    115, 32, 112, 101, 114, 32, 119, 111, 114, 100, 41, 44, 32, 116, 104, 101,
+    110, 32, 115, 116, 111, 114, 101, 32, 116, 104, 101, 32, 108, 111, 99, 97,
+    108, 32, 114, 111, 111, 116, 115, 10, 47, 47, 32, 105, 110, 32, 116, 104,
+    101, 32, 103, 108, 111, 98, 97, 108, 32, 112, 97, 114, 101, 110, 116, 32,
+    97, 114, 114, 97, 121, 32, 40, 111, 110, 101, 32, 101, 110, 116, 114, 121,
+    32, 112, 101, 114, 32, 112, 105, 120, 101, 108, 44, 32, 111, 110, 108, 121,
+    32, 116, 104, 101, 32, 114, 117, 110, 32, 115, 116, 97, 114, 116, 115, 32,
+    97, 114, 101, 10, 47, 47, 32, 119, 114, 105, 116, 116, 101, 110, 41, 46,
+    10, 107, 101, 114, 110, 101, 108, 32, 118, 111, 105, 100, 32, 98, 105, 116,
+    109, 97, 112, 112, 101, 100, 95, 108, 97, 98, 101, 108, 95, 108, 111, 99,
+    97, 108, 40, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 42, 32, 105, 110, 44, 32, 103, 108, 111, 98, 97, 108,
+    32, 105, 110, 116, 32, 42, 32, 112, 97, 114, 101, 110, 116, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 114, 111, 119, 115,
+    44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 99, 111, 108,
+    115, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 105, 110, 118,
+    101, 114, 116, 101, 100, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 32, 105,
+    110, 116, 32, 42, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 118, 111, 108, 97, 116, 105, 108, 101, 32, 108, 111, 99, 97, 108,
+    32, 105, 110, 116, 32, 42, 32, 108, 111, 99, 97, 108, 95, 112, 97, 114,
+    101, 110, 116, 41, 10, 123, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 120, 32, 61, 32, 103, 101, 116, 95, 103, 108, 111, 98, 97,
+    108, 95, 105, 100, 40, 48, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 121, 32, 61, 32, 103, 101, 116, 95, 103, 108, 111,
+    98, 97, 108, 95, 105, 100, 40, 49, 41, 59, 10, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 108, 120, 32, 61, 32, 103, 101, 116, 95,
+    108, 111, 99, 97, 108, 95, 105, 100, 40, 48, 41, 59, 10, 32, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 121, 32, 61, 32, 103, 101,
+    116, 95, 108, 111, 99, 97, 108, 95, 105, 100, 40, 49, 41, 59, 10, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 120, 115, 105, 122,
+    101, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 115, 105,
+    122, 101, 40, 48, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 98, 95, 110, 99, 111, 108, 115, 32, 61, 32, 110, 99, 111,
+    108, 115, 32, 47, 32, 51, 50, 59, 10, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 108, 119, 32, 61, 32, 109, 97, 100, 50, 52, 40,
+    108, 121, 44, 32, 108, 120, 115, 105, 122, 101, 44, 32, 108, 120, 41, 59,
+    10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 117, 105, 110, 116, 32, 119,
+    32, 61, 32, 120, 32, 60, 32, 98, 95, 110, 99, 111, 108, 115, 32, 38,
+    38, 32, 121, 32, 60, 32, 110, 114, 111, 119, 115, 32, 63, 32, 98, 105,
+    116, 109, 97, 112, 112, 101, 100, 95, 108, 97, 98, 101, 108, 95, 119, 111,
+    114, 100, 40, 105, 110, 44, 32, 109, 97, 100, 50, 52, 40, 121, 44, 32,
+    98, 95, 110, 99, 111, 108, 115, 44, 32, 120, 41, 44, 32, 105, 110, 118,
+    101, 114, 116, 101, 100, 41, 32, 58, 32, 48, 59, 10, 32, 32, 108, 111,
+    99, 97, 108, 95, 105, 109, 103, 91, 108, 119, 93, 32, 61, 32, 119, 59,
+    10, 32, 32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 106, 32, 61, 32,
+    48, 59, 32, 106, 32, 60, 32, 49, 54, 59, 32, 43, 43, 106, 41, 10,
+    32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 112, 97, 114, 101, 110, 116,
+    91, 108, 119, 32, 42, 32, 49, 54, 32, 43, 32, 106, 93, 32, 61, 32,
+    108, 119, 32, 42, 32, 49, 54, 32, 43, 32, 106, 59, 10, 32, 32, 98,
+    97, 114, 114, 105, 101, 114, 40, 67, 76, 75, 95, 76, 79, 67, 65, 76,
+    95, 77, 69, 77, 95, 70, 69, 78, 67, 69, 41, 59, 10, 10, 32, 32,
+    105, 102, 32, 40, 108, 120, 32, 62, 32, 48, 32, 38, 38, 32, 40, 119,
+    32, 38, 32, 48, 120, 56, 48, 48, 48, 48, 48, 48, 48, 41, 32, 38,
+    38, 32, 40, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 108, 119, 32,
+    45, 32, 49, 93, 32, 38, 32, 49, 41, 41, 10, 32, 32, 32, 32, 98,
+    105, 116, 109, 97, 112, 112, 101, 100, 95, 108, 97, 98, 101, 108, 95, 117,
+    110, 105, 111, 110, 95, 108, 111, 99, 97, 108, 40, 108, 111, 99, 97, 108,
+    95, 112, 97, 114, 101, 110, 116, 44, 32, 108, 119, 32, 42, 32, 49, 54,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 40, 108, 119, 32, 45, 32, 49, 41, 32, 42, 32, 49, 54, 32,
+    43, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 114, 117, 110, 95,
+    98, 101, 103, 105, 110, 40, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91,
+    108, 119, 32, 45, 32, 49, 93, 44, 32, 51, 49, 41, 32, 47, 32, 50,
+    41, 59, 10, 32, 32, 105, 102, 32, 40, 108, 121, 32, 62, 32, 48, 41,
+    10, 32, 32, 123, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 117, 112, 32, 61, 32, 108, 119, 32, 45, 32, 108, 120, 115,
+    105, 122, 101, 59, 10, 32, 32, 32, 32, 105, 110, 116, 32, 112, 97, 105,
+    114, 115, 91, 51, 50, 93, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 110, 32, 61, 32, 98, 105, 116, 109, 97, 112,
+    112, 101, 100, 95, 108, 97, 98, 101, 108, 95, 112, 97, 105, 114, 115, 40,
+    119, 44, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 117, 112, 93,
+    44, 32, 112, 97, 105, 114, 115, 41, 59, 10, 32, 32, 32, 32, 102, 111,
+    114, 32, 40, 105, 110, 116, 32, 105, 32, 61, 32, 48, 59, 32, 105, 32,
+    60, 32, 110, 59, 32, 43, 43, 105, 41, 10, 32, 32, 32, 32, 32, 32,
+    98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 108, 97, 98, 101, 108, 95,
+    117, 110, 105, 111, 110, 95, 108, 111, 99, 97, 108, 40, 108, 111, 99, 97,
+    108, 95, 112, 97, 114, 101, 110, 116, 44, 32, 108, 119, 32, 42, 32, 49,
+    54, 32, 43, 32, 40, 112, 97, 105, 114, 115, 91, 105, 93, 32, 62, 62,
+    32, 56, 41, 32, 47, 32, 50, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 117, 112, 32, 42, 32,
+    49, 54, 32, 43, 32, 40, 112, 97, 105, 114, 115, 91, 105, 93, 32, 38,
+    32, 48, 120, 70, 70, 41, 32, 47, 32, 50, 41, 59, 10, 32, 32, 32,
+    32, 105, 102, 32, 40, 108, 120, 32, 62, 32, 48, 32, 38, 38, 32, 40,
+    119, 32, 38, 32, 48, 120, 56, 48, 48, 48, 48, 48, 48, 48, 41, 32,
+    38, 38, 32, 40, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 117, 112,
+    32, 45, 32, 49, 93, 32, 38, 32, 49, 41, 41, 10, 32, 32, 32, 32,
+    32, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 108, 97, 98, 101,
+    108, 95, 117, 110, 105, 111, 110, 95, 108, 111, 99, 97, 108, 40, 108, 111,
+    99, 97, 108, 95, 112, 97, 114, 101, 110, 116, 44, 32, 108, 119, 32, 42,
+    32, 49, 54, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 40, 117, 112, 32, 45, 32, 49, 41, 32,
+    42, 32, 49, 54, 32, 43, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100,
+    95, 114, 117, 110, 95, 98, 101, 103, 105, 110, 40, 108, 111, 99, 97, 108,
+    95, 105, 109, 103, 91, 117, 112, 32, 45, 32, 49, 93, 44, 32, 51, 49,
+    41, 32, 47, 32, 50, 41, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40,
+    108, 120, 32, 60, 32, 108, 120, 115, 105, 122, 101, 32, 45, 32, 49, 32,
+    38, 38, 32, 40, 119, 32, 38, 32, 49, 41, 32, 38, 38, 32, 40, 108,
+    111, 99, 97, 108, 95, 105, 109, 103, 91, 117, 112, 32, 43, 32, 49, 93,
+    32, 38, 32, 48, 120, 56, 48, 48, 48, 48, 48, 48, 48, 41, 41, 10,
+    32, 32, 32, 32, 32, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95,
+    108, 97, 98, 101, 108, 95, 117, 110, 105, 111, 110, 95, 108, 111, 99, 97,
+    108, 40, 108, 111, 99, 97, 108, 95, 112, 97, 114, 101, 110, 116, 44, 32,
+    108, 119, 32, 42, 32, 49, 54, 32, 43, 32, 98, 105, 116, 109, 97, 112,
+    112, 101, 100, 95, 114, 117, 110, 95, 98, 101, 103, 105, 110, 40, 119, 44,
+    32, 51, 49, 41, 32, 47, 32, 50, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 40, 117, 112, 32,
+    43, 32, 49, 41, 32, 42, 32, 49, 54, 41, 59, 10, 32, 32, 125, 10,
+    32, 32, 98, 97, 114, 114, 105, 101, 114, 40, 67, 76, 75, 95, 76, 79,
+    67, 65, 76, 95, 77, 69, 77, 95, 70, 69, 78, 67, 69, 41, 59, 10,
+    10, 32, 32, 105, 102, 32, 40, 120, 32, 62, 61, 32, 98, 95, 110, 99,
+    111, 108, 115, 32, 124, 124, 32, 121, 32, 62, 61, 32, 110, 114, 111, 119,
+    115, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 59, 10, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 99, 111, 114, 110,
+    101, 114, 95, 120, 32, 61, 32, 103, 101, 116, 95, 103, 114, 111, 117, 112,
+    95, 105, 100, 40, 48, 41, 32, 42, 32, 108, 120, 115, 105, 122, 101, 59,
+    10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 99, 111, 114,
+    110, 101, 114, 95, 121, 32, 61, 32, 103, 101, 116, 95, 103, 114, 111, 117,
+    112, 95, 105, 100, 40, 49, 41, 32, 42, 32, 103, 101, 116, 95, 108, 111,
+    99, 97, 108, 95, 115, 105, 122, 101, 40, 49, 41, 59, 10, 32, 32, 117,
+    105, 110, 116, 32, 115, 116, 97, 114, 116, 115, 32, 61, 32, 98, 105, 116,
+    109, 97, 112, 112, 101, 100, 95, 115, 116, 97, 114, 116, 115, 40, 119, 41,
+    59, 10, 32, 32, 119, 104, 105, 108, 101, 32, 40, 115, 116, 97, 114, 116,
+    115, 41, 10, 32, 32, 123, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 98, 101, 103, 105, 110, 32, 61, 32, 99, 108, 122,
+    40, 115, 116, 97, 114, 116, 115, 41, 59, 10, 32, 32, 32, 32, 115, 116,
+    97, 114, 116, 115, 32, 38, 61, 32, 126, 40, 48, 120, 56, 48, 48, 48,
+    48, 48, 48, 48, 32, 62, 62, 32, 98, 101, 103, 105, 110, 41, 59, 10,
+    32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 114, 111,
+    111, 116, 32, 61, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 108,
+    97, 98, 101, 108, 95, 102, 105, 110, 100, 95, 108, 111, 99, 97, 108, 40,
+    108, 111, 99, 97, 108, 95, 112, 97, 114, 101, 110, 116, 44, 32, 108, 119,
+    32, 42, 32, 49, 54, 32, 43, 32, 98, 101, 103, 105, 110, 32, 47, 32,
+    50, 41, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 114, 119, 32, 61, 32, 114, 111, 111, 116, 32, 47, 32, 49, 54,
+    59, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    114, 100, 105, 118, 32, 61, 32, 114, 119, 32, 47, 32, 108, 120, 115, 105,
+    122, 101, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 114, 120, 32, 61, 32, 99, 111, 114, 110, 101, 114, 95, 120, 32,
+    43, 32, 114, 119, 32, 45, 32, 114, 100, 105, 118, 32, 42, 32, 108, 120,
+    115, 105, 122, 101, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 114, 121, 32, 61, 32, 99, 111, 114, 110, 101, 114, 95,
+    121, 32, 43, 32, 114, 100, 105, 118, 59, 10, 32, 32, 32, 32, 112, 97,
+    114, 101, 110, 116, 91, 109, 97, 100, 50, 52, 40, 121, 44, 32, 110, 99,
+    111, 108, 115, 44, 32, 120, 32, 42, 32, 51, 50, 32, 43, 32, 98, 101,
+    103, 105, 110, 41, 93, 32, 61, 10, 32, 32, 32, 32, 32, 32, 109, 97,
+    100, 50, 52, 40, 114, 121, 44, 32, 110, 99, 111, 108, 115, 44, 32, 114,
+    120, 32, 42, 32, 51, 50, 32, 43, 32, 98, 105, 116, 109, 97, 112, 112,
+    101, 100, 95, 114, 117, 110, 95, 115, 116, 97, 114, 116, 40, 108, 111, 99,
+    97, 108, 95, 105, 109, 103, 91, 114, 119, 93, 44, 32, 114, 111, 111, 116,
+    32, 37, 32, 49, 54, 41, 41, 59, 10, 32, 32, 125, 10, 125, 10, 10,
+    47, 47, 32, 83, 101, 99, 111, 110, 100, 32, 112, 97, 115, 115, 58, 32,
+    115, 97, 109, 101, 32, 103, 101, 111, 109, 101, 116, 114, 121, 44, 32, 109,
+    101, 114, 103, 101, 32, 116, 104, 101, 32, 114, 117, 110, 115, 32, 97, 99,
+    114, 111, 115, 115, 32, 116, 104, 101, 32, 116, 105, 108, 101, 32, 98, 111,
+    114, 100, 101, 114, 115, 10, 107, 101, 114, 110, 101, 108, 32, 118, 111, 105,
+    100, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 108, 97, 98, 101,
+    108, 95, 109, 101, 114, 103, 101, 40, 103, 108, 111, 98, 97, 108, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32, 105, 110, 44, 32, 118,
+    111, 108, 97, 116, 105, 108, 101, 32, 103, 108, 111, 98, 97, 108, 32, 105,
+    110, 116, 32, 42, 32, 112, 97, 114, 101, 110, 116, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 114, 111, 119, 115, 44, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 99, 111, 108, 115, 44,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 105, 110, 118, 101, 114,
+    116, 101, 100, 41, 10, 123, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 120, 32, 61, 32, 103, 101, 116, 95, 103, 108, 111, 98, 97,
+    108, 95, 105, 100, 40, 48, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 121, 32, 61, 32, 103, 101, 116, 95, 103, 108, 111,
+    98, 97, 108, 95, 105, 100, 40, 49, 41, 59, 10, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 108, 120, 32, 61, 32, 103, 101, 116, 95,
+    108, 111, 99, 97, 108, 95, 105, 100, 40, 48, 41, 59, 10, 32, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 121, 32, 61, 32, 103, 101,
+    116, 95, 108, 111, 99, 97, 108, 95, 105, 100, 40, 49, 41, 59, 10, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 120, 115, 105, 122,
+    101, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 115, 105,
+    122, 101, 40, 48, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 98, 95, 110, 99, 111, 108, 115, 32, 61, 32, 110, 99, 111,
+    108, 115, 32, 47, 32, 51, 50, 59, 10, 10, 32, 32, 105, 102, 32, 40,
+    120, 32, 62, 61, 32, 98, 95, 110, 99, 111, 108, 115, 32, 124, 124, 32,
+    121, 32, 62, 61, 32, 110, 114, 111, 119, 115, 41, 10, 32, 32, 32, 32,
+    114, 101, 116, 117, 114, 110, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52,
+    40, 121, 44, 32, 98, 95, 110, 99, 111, 108, 115, 44, 32, 120, 41, 59,
+    10, 32, 32, 99, 111, 110, 115, 116, 32, 117, 105, 110, 116, 32, 119, 32,
+    61, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 108, 97, 98, 101,
+    108, 95, 119, 111, 114, 100, 40, 105, 110, 44, 32, 105, 100, 120, 44, 32,
+    105, 110, 118, 101, 114, 116, 101, 100, 41, 59, 10, 32, 32, 105, 102, 32,
+    40, 33, 119, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 59,
+    10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 98, 97,
+    115, 101, 32, 61, 32, 109, 97, 100, 50, 52, 40, 121, 44, 32, 110, 99,
+    111, 108, 115, 44, 32, 120, 32, 42, 32, 51, 50, 41, 59, 10, 32, 32,
+    105, 102, 32, 40, 108, 120, 32, 61, 61, 32, 48, 32, 38, 38, 32, 120,
+    32, 62, 32, 48, 32, 38, 38, 32, 40, 119, 32, 38, 32, 48, 120, 56,
+    48, 48, 48, 48, 48, 48, 48, 41, 41, 10, 32, 32, 123, 10, 32, 32,
+    32, 32, 99, 111, 110, 115, 116, 32, 117, 105, 110, 116, 32, 108, 101, 102,
+    116, 32, 61, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 108, 97,
+    98, 101, 108, 95, 119, 111, 114, 100, 40, 105, 110, 44, 32, 105, 100, 120,
+    32, 45, 32, 49, 44, 32, 105, 110, 118, 101, 114, 116, 101, 100, 41, 59,
+    10, 32, 32, 32, 32, 105, 102, 32, 40, 108, 101, 102, 116, 32, 38, 32,
+    49, 41, 10, 32, 32, 32, 32, 32, 32, 98, 105, 116, 109, 97, 112, 112,
+    101, 100, 95, 108, 97, 98, 101, 108, 95, 117, 110, 105, 111, 110, 40, 112,
+    97, 114, 101, 110, 116, 44, 32, 98, 97, 115, 101, 44, 32, 98, 97, 115,
+    101, 32, 45, 32, 51, 50, 32, 43, 32, 98, 105, 116, 109, 97, 112, 112,
+    101, 100, 95, 114, 117, 110, 95, 98, 101, 103, 105, 110, 40, 108, 101, 102,
+    116, 44, 32, 51, 49, 41, 41, 59, 10, 32, 32, 125, 10, 32, 32, 105,
+    102, 32, 40, 121, 32, 62, 32, 48, 41, 10, 32, 32, 123, 10, 32, 32,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 117, 112, 32, 61,
+    32, 105, 100, 120, 32, 45, 32, 98, 95, 110, 99, 111, 108, 115, 59, 10,
+    32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 117, 112,
+    95, 98, 97, 115, 101, 32, 61, 32, 98, 97, 115, 101, 32, 45, 32, 110,
+    99, 111, 108, 115, 59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 108, 121,
+    32, 61, 61, 32, 48, 41, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32,
+    32, 32, 32, 105, 110, 116, 32, 112, 97, 105, 114, 115, 91, 51, 50, 93,
+    59, 10, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 110, 32, 61, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95,
+    108, 97, 98, 101, 108, 95, 112, 97, 105, 114, 115, 40, 119, 44, 32, 98,
+    105, 116, 109, 97, 112, 112, 101, 100, 95, 108, 97, 98, 101, 108, 95, 119,
+    111, 114, 100, 40, 105, 110, 44, 32, 117, 112, 44, 32, 105, 110, 118, 101,
+    114, 116, 101, 100, 41, 44, 32, 112, 97, 105, 114, 115, 41, 59, 10, 32,
+    32, 32, 32, 32, 32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 105, 32,
+    61, 32, 48, 59, 32, 105, 32, 60, 32, 110, 59, 32, 43, 43, 105, 41,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 98, 105, 116, 109, 97, 112, 112,
+    101, 100, 95, 108, 97, 98, 101, 108, 95, 117, 110, 105, 111, 110, 40, 112,
+    97, 114, 101, 110, 116, 44, 32, 98, 97, 115, 101, 32, 43, 32, 40, 112,
+    97, 105, 114, 115, 91, 105, 93, 32, 62, 62, 32, 56, 41, 44, 32, 117,
+    112, 95, 98, 97, 115, 101, 32, 43, 32, 40, 112, 97, 105, 114, 115, 91,
+    105, 93, 32, 38, 32, 48, 120, 70, 70, 41, 41, 59, 10, 32, 32, 32,
+    32, 125, 10, 32, 32, 32, 32, 105, 102, 32, 40, 40, 108, 121, 32, 61,
+    61, 32, 48, 32, 124, 124, 32, 108, 120, 32, 61, 61, 32, 48, 41, 32,
+    38, 38, 32, 120, 32, 62, 32, 48, 32, 38, 38, 32, 40, 119, 32, 38,
+    32, 48, 120, 56, 48, 48, 48, 48, 48, 48, 48, 41, 41, 10, 32, 32,
+    32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32,
+    117, 105, 110, 116, 32, 117, 112, 95, 108, 101, 102, 116, 32, 61, 32, 98,
+    105, 116, 109, 97, 112, 112, 101, 100, 95, 108, 97, 98, 101, 108, 95, 119,
+    111, 114, 100, 40, 105, 110, 44, 32, 117, 112, 32, 45, 32, 49, 44, 32,
+    105, 110, 118, 101, 114, 116, 101, 100, 41, 59, 10, 32, 32, 32, 32, 32,
+    32, 105, 102, 32, 40, 117, 112, 95, 108, 101, 102, 116, 32, 38, 32, 49,
+    41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 98, 105, 116, 109, 97, 112,
+    112, 101, 100, 95, 108, 97, 98, 101, 108, 95, 117, 110, 105, 111, 110, 40,
+    112, 97, 114, 101, 110, 116, 44, 32, 98, 97, 115, 101, 44, 32, 117, 112,
+    95, 98, 97, 115, 101, 32, 45, 32, 51, 50, 32, 43, 32, 98, 105, 116,
+    109, 97, 112, 112, 101, 100, 95, 114, 117, 110, 95, 98, 101, 103, 105, 110,
+    40, 117, 112, 95, 108, 101, 102, 116, 44, 32, 51, 49, 41, 41, 59, 10,
+    32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 105, 102, 32, 40, 40, 108,
+    121, 32, 61, 61, 32, 48, 32, 124, 124, 32, 108, 120, 32, 61, 61, 32,
+    108, 120, 115, 105, 122, 101, 32, 45, 32, 49, 41, 32, 38, 38, 32, 120,
+    32, 60, 32, 98, 95, 110, 99, 111, 108, 115, 32, 45, 32, 49, 32, 38,
+    38, 32, 40, 119, 32, 38, 32, 49, 41, 41, 10, 32, 32, 32, 32, 123,
+    10, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 117, 105, 110,
+    116, 32, 117, 112, 95, 114, 105, 103, 104, 116, 32, 61, 32, 98, 105, 116,
+    109, 97, 112, 112, 101, 100, 95, 108, 97, 98, 101, 108, 95, 119, 111, 114,
+    100, 40, 105, 110, 44, 32, 117, 112, 32, 43, 32, 49, 44, 32, 105, 110,
+    118, 101, 114, 116, 101, 100, 41, 59, 10, 32, 32, 32, 32, 32, 32, 105,
+    102, 32, 40, 117, 112, 95, 114, 105, 103, 104, 116, 32, 38, 32, 48, 120,
+    56, 48, 48, 48, 48, 48, 48, 48, 41, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 108, 97, 98, 101,
+    108, 95, 117, 110, 105, 111, 110, 40, 112, 97, 114, 101, 110, 116, 44, 32,
+    98, 97, 115, 101, 32, 43, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100,
+    95, 114, 117, 110, 95, 98, 101, 103, 105, 110, 40, 119, 44, 32, 51, 49,
+    41, 44, 32, 117, 112, 95, 98, 97, 115, 101, 32, 43, 32, 51, 50, 41,
+    59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 125, 10, 10, 47,
+    47, 32, 76, 97, 115, 116, 32, 112, 97, 115, 115, 58, 32, 111, 110, 101,
+    32, 116, 104, 114, 101, 97, 100, 32, 112, 101, 114, 32, 112, 105, 120, 101,
+    108, 44, 32, 116, 104, 101, 32, 108, 97, 98, 101, 108, 32, 105, 115, 32,
+    49, 32, 43, 32, 116, 104, 101, 32, 105, 110, 100, 101, 120, 32, 111, 102,
+    32, 116, 104, 101, 32, 102, 105, 114, 115, 116, 10, 47, 47, 32, 112, 105,
+    120, 101, 108, 32, 111, 102, 32, 116, 104, 101, 32, 99, 111, 109, 112, 111,
+    110, 101, 110, 116, 32, 105, 110, 32, 114, 97, 115, 116, 101, 114, 32, 111,
+    114, 100, 101, 114, 44, 32, 48, 32, 102, 111, 114, 32, 116, 104, 101, 32,
+    98, 97, 99, 107, 103, 114, 111, 117, 110, 100, 10, 107, 101, 114, 110, 101,
+    108, 32, 118, 111, 105, 100, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100,
+    95, 108, 97, 98, 101, 108, 95, 102, 105, 110, 97, 108, 40, 103, 108, 111,
+    98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32,
+    105, 110, 44, 32, 118, 111, 108, 97, 116, 105, 108, 101, 32, 103, 108, 111,
+    98, 97, 108, 32, 105, 110, 116, 32, 42, 32, 112, 97, 114, 101, 110, 116,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 103, 108, 111, 98, 97, 108, 32, 105, 110, 116, 32, 42,
+    32, 108, 97, 98, 101, 108, 115, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 110, 114, 111, 119, 115, 44, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 110, 99, 111, 108, 115, 44, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 105, 110, 118, 101, 114, 116, 101, 100, 41,
+    10, 123, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 120,
+    32, 61, 32, 103, 101, 116, 95, 103, 108, 111, 98, 97, 108, 95, 105, 100,
+    40, 48, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 121, 32, 61, 32, 103, 101, 116, 95, 103, 108, 111, 98, 97, 108, 95,
+    105, 100, 40, 49, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 120, 32,
+    62, 61, 32, 110, 99, 111, 108, 115, 32, 124, 124, 32, 121, 32, 62, 61,
+    32, 110, 114, 111, 119, 115, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117,
+    114, 110, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 98, 95, 110, 99, 111, 108, 115, 32, 61, 32, 110, 99, 111, 108, 115,
+    32, 47, 32, 51, 50, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 117,
+    105, 110, 116, 32, 119, 32, 61, 32, 98, 105, 116, 109, 97, 112, 112, 101,
+    100, 95, 108, 97, 98, 101, 108, 95, 119, 111, 114, 100, 40, 105, 110, 44,
+    32, 109, 97, 100, 50, 52, 40, 121, 44, 32, 98, 95, 110, 99, 111, 108,
+    115, 44, 32, 120, 32, 47, 32, 51, 50, 41, 44, 32, 105, 110, 118, 101,
+    114, 116, 101, 100, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 112, 111, 115, 32, 61, 32, 120, 32, 38, 32, 51, 49, 59,
+    10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 105, 100, 120,
+    32, 61, 32, 109, 97, 100, 50, 52, 40, 121, 44, 32, 110, 99, 111, 108,
+    115, 44, 32, 120, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 33, 40,
+    119, 32, 38, 32, 40, 48, 120, 56, 48, 48, 48, 48, 48, 48, 48, 32,
+    62, 62, 32, 112, 111, 115, 41, 41, 41, 10, 32, 32, 32, 32, 108, 97,
+    98, 101, 108, 115, 91, 105, 100, 120, 93, 32, 61, 32, 48, 59, 10, 32,
+    32, 101, 108, 115, 101, 10, 32, 32, 32, 32, 108, 97, 98, 101, 108, 115,
+    91, 105, 100, 120, 93, 32, 61, 32, 98, 105, 116, 109, 97, 112, 112, 101,
+    100, 95, 108, 97, 98, 101, 108, 95, 102, 105, 110, 100, 40, 112, 97, 114,
+    101, 110, 116, 44, 32, 105, 100, 120, 32, 45, 32, 112, 111, 115, 32, 43,
+    32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 114, 117, 110, 95, 98,
+    101, 103, 105, 110, 40, 119, 44, 32, 112, 111, 115, 41, 41, 32, 43, 32,
+    49, 59, 10, 125, 10, 35, 101, 110, 100, 105, 102, 10, 10, 35, 105, 102,
+    100, 101, 102, 32, 67, 76, 67, 86, 95, 83, 69, 67, 84, 73, 79, 78,
+    95, 69, 68, 84, 10, 47, 47, 32, 69, 120, 97, 99, 116, 32, 69, 117,
+    99, 108, 105, 100, 101, 97, 110, 32, 100, 105, 115, 116, 97, 110, 99, 101,
+    32, 116, 114, 97, 110, 115, 102, 111, 114, 109, 32, 40, 77, 101, 105, 106,
+    115, 116, 101, 114, 44, 32, 82, 111, 101, 114, 100, 105, 110, 107, 32, 97,
+    110, 100, 32, 72, 101, 115, 115, 101, 108, 105, 110, 107, 41, 44, 10, 47,
+    47, 32, 115, 113, 117, 97, 114, 101, 100, 32, 100, 105, 115, 116, 97, 110,
+    99, 101, 115, 32, 116, 111, 32, 116, 104, 101, 32, 110, 101, 97, 114, 101,
+    115, 116, 32, 116, 97, 114, 103, 101, 116, 32, 112, 105, 120, 101, 108, 58,
+    32, 116, 104, 101, 32, 48, 32, 112, 105, 120, 101, 108, 115, 44, 32, 111,
+    114, 32, 116, 104, 101, 32, 49, 10, 47, 47, 32, 112, 105, 120, 101, 108,
+    115, 32, 119, 104, 101, 110, 32, 105, 110, 118, 101, 114, 116, 101, 100, 46,
+    32, 87, 105, 116, 104, 111, 117, 116, 32, 97, 110, 121, 32, 116, 97, 114,
+    103, 101, 116, 32, 116, 104, 101, 32, 100, 105, 115, 116, 97, 110, 99, 101,
+    115, 32, 97, 114, 101, 32, 97, 116, 32, 108, 101, 97, 115, 116, 10, 47,
+    47, 32, 40, 110, 114, 111, 119, 115, 32, 43, 32, 110, 99, 111, 108, 115,
+    41, 94, 50, 46, 10, 10, 105, 110, 116, 32, 101, 100, 116, 95, 105, 115,
+    95, 116, 97, 114, 103, 101, 116, 40, 103, 108, 111, 98, 97, 108, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32, 105, 110, 44, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 121, 44, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 120, 44, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 110, 99, 111, 108, 115, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 44,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 105, 110, 118, 101, 114,
+    116, 101, 100, 41, 10, 123, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 118, 32, 61, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100,
+    32, 63, 10, 32, 32, 32, 32, 40, 105, 110, 91, 109, 97, 100, 50, 52,
+    40, 121, 44, 32, 110, 99, 111, 108, 115, 32, 47, 32, 51, 50, 44, 32,
+    120, 32, 47, 32, 51, 50, 41, 93, 32, 62, 62, 32, 40, 51, 49, 32,
+    45, 32, 40, 120, 32, 38, 32, 51, 49, 41, 41, 41, 32, 38, 32, 49,
+    10, 32, 32, 32, 32, 58, 32, 105, 110, 91, 109, 97, 100, 50, 52, 40,
+    121, 44, 32, 110, 99, 111, 108, 115, 44, 32, 120, 41, 93, 32, 33, 61,
+    32, 48, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 118, 32, 61,
+    61, 32, 105, 110, 118, 101, 114, 116, 101, 100, 59, 10, 125, 10, 10, 47,
+    47, 32, 70, 105, 114, 115, 116, 32, 112, 97, 115, 115, 58, 32, 111, 110,
+    101, 32, 116, 104, 114, 101, 97, 100, 32, 112, 101, 114, 32, 99, 111, 108,
+    117, 109, 110, 44, 32, 100, 105, 115, 116, 97, 110, 99, 101, 32, 116, 111,
+    32, 116, 104, 101, 32, 110, 101, 97, 114, 101, 115, 116, 32, 116, 97, 114,
+    103, 101, 116, 32, 111, 102, 32, 116, 104, 101, 10, 47, 47, 32, 99, 111,
+    108, 117, 109, 110, 10, 107, 101, 114, 110, 101, 108, 32, 118, 111, 105, 100,
+    32, 101, 100, 116, 95, 99, 111, 108, 117, 109, 110, 115, 40, 103, 108, 111,
+    98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32,
+    105, 110, 44, 32, 103, 108, 111, 98, 97, 108, 32, 105, 110, 116, 32, 42,
+    32, 103, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 110, 114, 111, 119, 115, 44, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 110, 99, 111, 108, 115, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    98, 105, 116, 109, 97, 112, 112, 101, 100, 44, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 105, 110, 118, 101, 114, 116, 101, 100, 41, 10, 123,
+    10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 120, 32, 61,
+    32, 103, 101, 116, 95, 103, 108, 111, 98, 97, 108, 95, 105, 100, 40, 48,
+    41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 120, 32, 62, 61, 32, 110,
+    99, 111, 108, 115, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110,
+    59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 105,
+    110, 102, 32, 61, 32, 110, 114, 111, 119, 115, 32, 43, 32, 110, 99, 111,
+    108, 115, 59, 10, 32, 32, 105, 110, 116, 32, 100, 32, 61, 32, 105, 110,
+    102, 59, 10, 32, 32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 121, 32,
+    61, 32, 48, 59, 32, 121, 32, 60, 32, 110, 114, 111, 119, 115, 59, 32,
+    43, 43, 121, 41, 10, 32, 32, 123, 10, 32, 32, 32, 32, 100, 32, 61,
+    32, 101, 100, 116, 95, 105, 115, 95, 116, 97, 114, 103, 101, 116, 40, 105,
+    110, 44, 32, 121, 44, 32, 120, 44, 32, 110, 99, 111, 108, 115, 44, 32,
+    98, 105, 116, 109, 97, 112, 112, 101, 100, 44, 32, 105, 110, 118, 101, 114,
+    116, 101, 100, 41, 32, 63, 32, 48, 32, 58, 32, 109, 105, 110, 40, 100,
+    32, 43, 32, 49, 44, 32, 105, 110, 102, 41, 59, 10, 32, 32, 32, 32,
+    103, 91, 109, 97, 100, 50, 52, 40, 121, 44, 32, 110, 99, 111, 108, 115,
+    44, 32, 120, 41, 93, 32, 61, 32, 100, 59, 10, 32, 32, 125, 10, 32,
+    32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 121, 32, 61, 32, 110, 114,
+    111, 119, 115, 32, 45, 32, 50, 59, 32, 121, 32, 62, 61, 32, 48, 59,
+    32, 45, 45, 121, 41, 10, 32, 32, 123, 10, 32, 32, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 105, 100, 120, 32, 61, 32, 109, 97,
+    100, 50, 52, 40, 121, 44, 32, 110, 99, 111, 108, 115, 44, 32, 120, 41,
+    59, 10, 32, 32, 32, 32, 100, 32, 61, 32, 109, 105, 110, 40, 100, 32,
+    43, 32, 49, 44, 32, 105, 110, 102, 41, 59, 10, 32, 32, 32, 32, 105,
+    102, 32, 40, 100, 32, 60, 32, 103, 91, 105, 100, 120, 93, 41, 10, 32,
+    32, 32, 32, 32, 32, 103, 91, 105, 100, 120, 93, 32, 61, 32, 100, 59,
+    10, 32, 32, 32, 32, 101, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32,
+    100, 32, 61, 32, 103, 91, 105, 100, 120, 93, 59, 10, 32, 32, 125, 10,
+    125, 10, 10, 47, 47, 32, 83, 101, 99, 111, 110, 100, 32, 112, 97, 115,
+    115, 58, 32, 111, 110, 101, 32, 116, 104, 114, 101, 97, 100, 32, 112, 101,
+    114, 32, 114, 111, 119, 44, 32, 108, 111, 119, 101, 114, 32, 101, 110, 118,
+    101, 108, 111, 112, 101, 32, 111, 102, 32, 116, 104, 101, 32, 112, 97, 114,
+    97, 98, 111, 108, 97, 115, 10, 47, 47, 32, 40, 120, 32, 45, 32, 105,
+    41, 94, 50, 32, 43, 32, 103, 40, 105, 41, 94, 50, 46, 32, 84, 104,
+    101, 32, 115, 116, 97, 99, 107, 32, 111, 102, 32, 112, 97, 114, 97, 98,
+    111, 108, 97, 115, 32, 40, 115, 41, 32, 97, 110, 100, 32, 111, 102, 32,
+    116, 104, 101, 32, 112, 111, 115, 105, 116, 105, 111, 110, 115, 32, 119, 104,
+    101, 114, 101, 10, 47, 47, 32, 116, 104, 101, 121, 32, 115, 116, 97, 114,
+    116, 32, 116, 111, 32, 98, 101, 32, 116, 104, 101, 32, 108, 111, 119, 101,
+    115, 116, 32, 111, 110, 101, 32, 40, 116, 41, 32, 97, 114, 101, 32, 115,
+    116, 111, 114, 101, 100, 32, 98, 121, 32, 99, 111, 108, 117, 109, 110, 44,
+    32, 115, 111, 32, 116, 104, 97, 116, 32, 116, 104, 101, 10, 47, 47, 32,
+    116, 104, 114, 101, 97, 100, 115, 32, 97, 99, 99, 101, 115, 115, 32, 99,
+    111, 110, 115, 101, 99, 117, 116, 105, 118, 101, 32, 97, 100, 100, 114, 101,
+    115, 115, 101, 115, 46, 10, 107, 101, 114, 110, 101, 108, 32, 118, 111, 105,
+    100, 32, 101, 100, 116, 95, 114, 111, 119, 115, 40, 103, 108, 111, 98, 97,
+    108, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32, 103, 44,
+    32, 103, 108, 111, 98, 97, 108, 32, 105, 110, 116, 32, 42, 32, 111, 117,
+    116, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 103, 108, 111, 98, 97, 108, 32, 105,
+    110, 116, 32, 42, 32, 115, 44, 32, 103, 108, 111, 98, 97, 108, 32, 105,
+    110, 116, 32, 42, 32, 116, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 110, 114, 111, 119, 115, 44, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 110, 99, 111, 108, 115, 41, 10, 123,
+    10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 121, 32, 61,
+    32, 103, 101, 116, 95, 103, 108, 111, 98, 97, 108, 95, 105, 100, 40, 48,
+    41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 121, 32, 62, 61, 32, 110,
+    114, 111, 119, 115, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110,
+    59, 10, 10, 32, 32, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 42, 32, 103, 121, 32, 61, 32, 103, 32, 43,
+    32, 121, 32, 42, 32, 110, 99, 111, 108, 115, 59, 10, 32, 32, 105, 110,
+    116, 32, 113, 32, 61, 32, 48, 59, 10, 32, 32, 115, 91, 121, 93, 32,
+    61, 32, 48, 59, 10, 32, 32, 116, 91, 121, 93, 32, 61, 32, 48, 59,
+    10, 32, 32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 117, 32, 61, 32,
+    49, 59, 32, 117, 32, 60, 32, 110, 99, 111, 108, 115, 59, 32, 43, 43,
+    117, 41, 10, 32, 32, 123, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 103, 117, 32, 61, 32, 103, 121, 91, 117, 93, 32,
+    42, 32, 103, 121, 91, 117, 93, 59, 10, 32, 32, 32, 32, 119, 104, 105,
+    108, 101, 32, 40, 113, 32, 62, 61, 32, 48, 41, 10, 32, 32, 32, 32,
+    123, 10, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 115, 113, 32, 61, 32, 115, 91, 109, 97, 100, 50, 52, 40, 113,
+    44, 32, 110, 114, 111, 119, 115, 44, 32, 121, 41, 93, 59, 10, 32, 32,
+    32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 116, 113,
+    32, 61, 32, 116, 91, 109, 97, 100, 50, 52, 40, 113, 44, 32, 110, 114,
+    111, 119, 115, 44, 32, 121, 41, 93, 59, 10, 32, 32, 32, 32, 32, 32,
+    105, 102, 32, 40, 40, 116, 113, 32, 45, 32, 115, 113, 41, 32, 42, 32,
+    40, 116, 113, 32, 45, 32, 115, 113, 41, 32, 43, 32, 103, 121, 91, 115,
+    113, 93, 32, 42, 32, 103, 121, 91, 115, 113, 93, 32, 60, 61, 32, 40,
+    116, 113, 32, 45, 32, 117, 41, 32, 42, 32, 40, 116, 113, 32, 45, 32,
+    117, 41, 32, 43, 32, 103, 117, 41, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 98, 114, 101, 97, 107, 59, 10, 32, 32, 32, 32, 32, 32, 45, 45,
+    113, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 105, 102, 32,
+    40, 113, 32, 60, 32, 48, 41, 10, 32, 32, 32, 32, 123, 10, 32, 32,
+    32, 32, 32, 32, 113, 32, 61, 32, 48, 59, 10, 32, 32, 32, 32, 32,
+    32, 115, 91, 121, 93, 32, 61, 32, 117, 59, 10, 32, 32, 32, 32, 125,
+    10, 32, 32, 32, 32, 101, 108, 115, 101, 10, 32, 32, 32, 32, 123, 10,
+    32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    115, 113, 32, 61, 32, 115, 91, 109, 97, 100, 50, 52, 40, 113, 44, 32,
+    110, 114, 111, 119, 115, 44, 32, 121, 41, 93, 59, 10, 32, 32, 32, 32,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 119, 32, 61, 32,
+    49, 32, 43, 32, 40, 117, 32, 42, 32, 117, 32, 45, 32, 115, 113, 32,
+    42, 32, 115, 113, 32, 43, 32, 103, 117, 32, 45, 32, 103, 121, 91, 115,
+    113, 93, 32, 42, 32, 103, 121, 91, 115, 113, 93, 41, 32, 47, 32, 40,
+    50, 32, 42, 32, 40, 117, 32, 45, 32, 115, 113, 41, 41, 59, 10, 32,
+    32, 32, 32, 32, 32, 105, 102, 32, 40, 119, 32, 60, 32, 110, 99, 111,
+    108, 115, 41, 10, 32, 32, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 43, 43, 113, 59, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 115, 91, 109, 97, 100, 50, 52, 40, 113, 44, 32, 110, 114, 111, 119,
+    115, 44, 32, 121, 41, 93, 32, 61, 32, 117, 59, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 116, 91, 109, 97, 100, 50, 52, 40, 113, 44, 32, 110,
+    114, 111, 119, 115, 44, 32, 121, 41, 93, 32, 61, 32, 119, 59, 10, 32,
+    32, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125,
+    10, 32, 32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 117, 32, 61, 32,
+    110, 99, 111, 108, 115, 32, 45, 32, 49, 59, 32, 117, 32, 62, 61, 32,
+    48, 59, 32, 45, 45, 117, 41, 10, 32, 32, 123, 10, 32, 32, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 113, 32, 61, 32, 115,
+    91, 109, 97, 100, 50, 52, 40, 113, 44, 32, 110, 114, 111, 119, 115, 44,
+    32, 121, 41, 93, 59, 10, 32, 32, 32, 32, 111, 117, 116, 91, 109, 97,
+    100, 50, 52, 40, 121, 44, 32, 110, 99, 111, 108, 115, 44, 32, 117, 41,
+    93, 32, 61, 32, 40, 117, 32, 45, 32, 115, 113, 41, 32, 42, 32, 40,
+    117, 32, 45, 32, 115, 113, 41, 32, 43, 32, 103, 121, 91, 115, 113, 93,
+    32, 42, 32, 103, 121, 91, 115, 113, 93, 59, 10, 32, 32, 32, 32, 105,
+    102, 32, 40, 117, 32, 61, 61, 32, 116, 91, 109, 97, 100, 50, 52, 40,
+    113, 44, 32, 110, 114, 111, 119, 115, 44, 32, 121, 41, 93, 41, 10, 32,
+    32, 32, 32, 32, 32, 45, 45, 113, 59, 10, 32, 32, 125, 10, 125, 10,
+    10, 47, 47, 32, 68, 105, 115, 107, 115, 32, 111, 102, 32, 114, 97, 100,
+    105, 117, 115, 32, 114, 32, 102, 114, 111, 109, 32, 116, 104, 101, 32, 115,
+    113, 117, 97, 114, 101, 100, 32, 100, 105, 115, 116, 97, 110, 99, 101, 32,
+    109, 97, 112, 115, 58, 32, 116, 104, 101, 32, 100, 105, 108, 97, 116, 105,
+    111, 110, 32, 107, 101, 101, 112, 115, 32, 116, 104, 101, 10, 47, 47, 32,
+    112, 105, 120, 101, 108, 115, 32, 119, 104, 111, 115, 101, 32, 110, 101, 97,
+    114, 101, 115, 116, 32, 49, 32, 112, 105, 120, 101, 108, 32, 105, 115, 32,
+    119, 105, 116, 104, 105, 110, 32, 114, 44, 32, 116, 104, 101, 32, 101, 114,
+    111, 115, 105, 111, 110, 32, 116, 104, 111, 115, 101, 32, 119, 104, 111, 115,
+    101, 32, 110, 101, 97, 114, 101, 115, 116, 10, 47, 47, 32, 48, 32, 112,
+    105, 120, 101, 108, 44, 32, 105, 110, 115, 105, 100, 101, 32, 111, 114, 32,
+    111, 117, 116, 115, 105, 100, 101, 32, 116, 104, 101, 32, 105, 109, 97, 103,
+    101, 44, 32, 105, 115, 32, 102, 97, 114, 116, 104, 101, 114, 32, 116, 104,
+    97, 110, 32, 114, 46, 10, 105, 110, 116, 32, 101, 100, 116, 95, 100, 105,
+    115, 107, 40, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 100, 44, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 121, 44, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 120, 44, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 110, 114, 111, 119, 115, 44, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 110, 99, 111, 108, 115, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 115, 113, 114, 97, 100, 44, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 101, 114, 111, 115, 105, 111, 110, 41, 10, 123, 10, 32,
+    32, 105, 102, 32, 40, 33, 101, 114, 111, 115, 105, 111, 110, 41, 10, 32,
+    32, 32, 32, 114, 101, 116, 117, 114, 110, 32, 100, 32, 60, 61, 32, 115,
+    113, 114, 97, 100, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 98, 111, 114, 100, 101, 114, 32, 61, 32, 109, 105, 110, 40, 109,
+    105, 110, 40, 121, 44, 32, 110, 114, 111, 119, 115, 32, 45, 32, 49, 32,
+    45, 32, 121, 41, 44, 32, 109, 105, 110, 40, 120, 44, 32, 110, 99, 111,
+    108, 115, 32, 45, 32, 49, 32, 45, 32, 120, 41, 41, 32, 43, 32, 49,
+    59, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 100, 32, 62, 32, 115,
+    113, 114, 97, 100, 32, 38, 38, 32, 98, 111, 114, 100, 101, 114, 32, 42,
+    32, 98, 111, 114, 100, 101, 114, 32, 62, 32, 115, 113, 114, 97, 100, 59,
+    10, 125, 10, 10, 107, 101, 114, 110, 101, 108, 32, 118, 111, 105, 100, 32,
+    101, 100, 116, 95, 116, 104, 114, 101, 115, 104, 111, 108, 100, 40, 103, 108,
+    111, 98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 42,
+    32, 105, 110, 44, 32, 103, 108, 111, 98, 97, 108, 32, 105, 110, 116, 32,
+    42, 32, 111, 117, 116, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 114, 111, 119, 115,
+    44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 99, 111, 108,
+    115, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 115, 113, 114, 97, 100, 44, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 101, 114, 111, 115, 105, 111, 110, 41,
+    10, 123, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 120,
+    32, 61, 32, 103, 101, 116, 95, 103, 108, 111, 98, 97, 108, 95, 105, 100,
+    40, 48, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 121, 32, 61, 32, 103, 101, 116, 95, 103, 108, 111, 98, 97, 108, 95,
+    105, 100, 40, 49, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 120, 32,
+    62, 61, 32, 110, 99, 111, 108, 115, 32, 124, 124, 32, 121, 32, 62, 61,
+    32, 110, 114, 111, 119, 115, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117,
+    114, 110, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40, 121, 44, 32,
+    110, 99, 111, 108, 115, 44, 32, 120, 41, 59, 10, 32, 32, 111, 117, 116,
+    91, 105, 100, 120, 93, 32, 61, 32, 101, 100, 116, 95, 100, 105, 115, 107,
+    40, 105, 110, 91, 105, 100, 120, 93, 44, 32, 121, 44, 32, 120, 44, 32,
+    110, 114, 111, 119, 115, 44, 32, 110, 99, 111, 108, 115, 44, 32, 115, 113,
+    114, 97, 100, 44, 32, 101, 114, 111, 115, 105, 111, 110, 41, 59, 10, 125,
+    10, 10, 47, 47, 32, 83, 97, 109, 101, 32, 116, 104, 105, 110, 103, 44,
+    32, 111, 110, 101, 32, 116, 104, 114, 101, 97, 100, 32, 112, 101, 114, 32,
+    119, 111, 114, 100, 32, 111, 102, 32, 116, 104, 101, 32, 111, 117, 116, 112,
+    117, 116, 32, 98, 105, 116, 109, 97, 112, 10, 107, 101, 114, 110, 101, 108,
+    32, 118, 111, 105, 100, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95,
+    101, 100, 116, 95, 116, 104, 114, 101, 115, 104, 111, 108, 100, 40, 103, 108,
+    111, 98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 42,
+    32, 105, 110, 44, 32, 103, 108, 111, 98, 97, 108, 32, 105, 110, 116, 32,
+    42, 32, 111, 117, 116, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 110, 114, 111, 119, 115, 44, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 110, 99, 111, 108, 115, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 113, 114, 97, 100,
+    44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 101, 114, 111, 115,
+    105, 111, 110, 41, 10, 123, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 120, 32, 61, 32, 103, 101, 116, 95, 103, 108, 111, 98, 97,
+    108, 95, 105, 100, 40, 48, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 121, 32, 61, 32, 103, 101, 116, 95, 103, 108, 111,
+    98, 97, 108, 95, 105, 100, 40, 49, 41, 59, 10, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 98, 95, 110, 99, 111, 108, 115, 32, 61,
+    32, 110, 99, 111, 108, 115, 32, 47, 32, 51, 50, 59, 10, 10, 32, 32,
+    105, 102, 32, 40, 120, 32, 62, 61, 32, 98, 95, 110, 99, 111, 108, 115,
+    32, 124, 124, 32, 121, 32, 62, 61, 32, 110, 114, 111, 119, 115, 41, 10,
+    32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 59, 10, 10, 32, 32, 103,
+    108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    42, 32, 100, 32, 61, 32, 105, 110, 32, 43, 32, 109, 97, 100, 50, 52,
+    40, 121, 44, 32, 110, 99, 111, 108, 115, 44, 32, 120, 32, 42, 32, 51,
+    50, 41, 59, 10, 32, 32, 117, 105, 110, 116, 32, 119, 32, 61, 32, 48,
+    59, 10, 32, 32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 105, 32, 61,
+    32, 48, 59, 32, 105, 32, 60, 32, 51, 50, 59, 32, 43, 43, 105, 41,
+    10, 32, 32, 32, 32, 119, 32, 61, 32, 40, 119, 32, 60, 60, 32, 49,
+    41, 32, 124, 32, 101, 100, 116, 95, 100, 105, 115, 107, 40, 100, 91, 105,
+    93, 44, 32, 121, 44, 32, 120, 32, 42, 32, 51, 50, 32, 43, 32, 105,
+    44, 32, 110, 114, 111, 119, 115, 44, 32, 110, 99, 111, 108, 115, 44, 32,
+    115, 113, 114, 97, 100, 44, 32, 101, 114, 111, 115, 105, 111, 110, 41, 59,
+    10, 32, 32, 111, 117, 116, 91, 109, 97, 100, 50, 52, 40, 121, 44, 32,
+    98, 95, 110, 99, 111, 108, 115, 44, 32, 120, 41, 93, 32, 61, 32, 119,
+    59, 10, 125, 10, 35, 101, 110, 100, 105, 102, 10, 10, 35, 105, 102, 100,
+    101, 102, 32, 67, 76, 67, 86, 95, 83, 69, 67, 84, 73, 79, 78, 95,
+    65, 82, 69, 65, 10, 47, 47, 32, 65, 114, 101, 97, 32, 111, 112, 101,
+    110, 105, 110, 103, 58, 32, 116, 104, 101, 32, 97, 114, 101, 97, 115, 32,
+    40, 105, 110, 100, 101, 120, 101, 100, 32, 98, 121, 32, 108, 97, 98, 101,
+    108, 32, 45, 32, 49, 41, 32, 97, 114, 101, 32, 114, 101, 115, 101, 116,
+    32, 97, 116, 32, 116, 104, 101, 32, 102, 105, 114, 115, 116, 10, 47, 47,
+    32, 112, 105, 120, 101, 108, 32, 111, 102, 32, 101, 97, 99, 104, 32, 99,
+    111, 109, 112, 111, 110, 101, 110, 116, 44, 32, 116, 104, 101, 110, 32, 99,
+    111, 117, 110, 116, 101, 100, 10, 107, 101, 114, 110, 101, 108, 32, 118, 111,
+    105, 100, 32, 108, 97, 98, 101, 108, 95, 97, 114, 101, 97, 95, 114, 101,
+    115, 101, 116, 40, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 42, 32, 108, 97, 98, 101, 108, 115, 44, 32, 103,
+    108, 111, 98, 97, 108, 32, 105, 110, 116, 32, 42, 32, 97, 114, 101, 97,
+    115, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 114, 111, 119, 115, 44,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 99, 111, 108, 115,
+    41, 10, 123, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    120, 32, 61, 32, 103, 101, 116, 95, 103, 108, 111, 98, 97, 108, 95, 105,
+    100, 40, 48, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 121, 32, 61, 32, 103, 101, 116, 95, 103, 108, 111, 98, 97, 108,
+    95, 105, 100, 40, 49, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 120,
+    32, 62, 61, 32, 110, 99, 111, 108, 115, 32, 124, 124, 32, 121, 32, 62,
+    61, 32, 110, 114, 111, 119, 115, 41, 10, 32, 32, 32, 32, 114, 101, 116,
+    117, 114, 110, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40, 121, 44,
+    32, 110, 99, 111, 108, 115, 44, 32, 120, 41, 59, 10, 32, 32, 105, 102,
+    32, 40, 108, 97, 98, 101, 108, 115, 91, 105, 100, 120, 93, 32, 61, 61,
+    32, 105, 100, 120, 32, 43, 32, 49, 41, 10, 32, 32, 32, 32, 97, 114,
+    101, 97, 115, 91, 105, 100, 120, 93, 32, 61, 32, 48, 59, 10, 125, 10,
+    10, 107, 101, 114, 110, 101, 108, 32, 118, 111, 105, 100, 32, 108, 97, 98,
+    101, 108, 95, 97, 114, 101, 97, 95, 99, 111, 117, 110, 116, 40, 103, 108,
+    111, 98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 42,
+    32, 108, 97, 98, 101, 108, 115, 44, 32, 118, 111, 108, 97, 116, 105, 108,
+    101, 32, 103, 108, 111, 98, 97, 108, 32, 105, 110, 116, 32, 42, 32, 97,
+    114, 101, 97, 115, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 114, 111,
+    119, 115, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 99,
+    111, 108, 115, 41, 10, 123, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 120, 32, 61, 32, 103, 101, 116, 95, 103, 108, 111, 98, 97,
+    108, 95, 105, 100, 40, 48, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 121, 32, 61, 32, 103, 101, 116, 95, 103, 108, 111,
+    98, 97, 108, 95, 105, 100, 40, 49, 41, 59, 10, 10, 32, 32, 105, 102,
+    32, 40, 120, 32, 62, 61, 32, 110, 99, 111, 108, 115, 32, 124, 124, 32,
+    121, 32, 62, 61, 32, 110, 114, 111, 119, 115, 41, 10, 32, 32, 32, 32,
+    114, 101, 116, 117, 114, 110, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 108, 97, 98, 101, 108, 32, 61, 32, 108, 97, 98,
+    101, 108, 115, 91, 109, 97, 100, 50, 52, 40, 121, 44, 32, 110, 99, 111,
+    108, 115, 44, 32, 120, 41, 93, 59, 10, 32, 32, 105, 102, 32, 40, 108,
+    97, 98, 101, 108, 41, 10, 32, 32, 32, 32, 97, 116, 111, 109, 105, 99,
+    95, 105, 110, 99, 40, 38, 97, 114, 101, 97, 115, 91, 108, 97, 98, 101,
+    108, 32, 45, 32, 49, 93, 41, 59, 10, 125, 10, 10, 47, 47, 32, 79,
+    110, 101, 32, 116, 104, 114, 101, 97, 100, 32, 112, 101, 114, 32, 119, 111,
+    114, 100, 44, 32, 107, 101, 101, 112, 32, 116, 104, 101, 32, 112, 105, 120,
+    101, 108, 115, 32, 111, 102, 32, 116, 104, 101, 32, 99, 111, 109, 112, 111,
+    110, 101, 110, 116, 115, 32, 111, 102, 32, 97, 116, 32, 108, 101, 97, 115,
+    116, 10, 47, 47, 32, 109, 105, 110, 95, 97, 114, 101, 97, 32, 112, 105,
+    120, 101, 108, 115, 46, 32, 87, 104, 101, 110, 32, 116, 104, 101, 32, 108,
+    97, 98, 101, 108, 115, 32, 97, 114, 101, 32, 116, 104, 111, 115, 101, 32,
+    111, 102, 32, 116, 104, 101, 32, 48, 32, 112, 105, 120, 101, 108, 115, 32,
+    40, 105, 110, 118, 101, 114, 116, 101, 100, 41, 44, 10, 47, 47, 32, 102,
+    105, 108, 108, 32, 116, 104, 101, 32, 115, 109, 97, 108, 108, 101, 114, 32,
+    99, 111, 109, 112, 111, 110, 101, 110, 116, 115, 32, 105, 110, 115, 116, 101,
+    97, 100, 46, 10, 107, 101, 114, 110, 101, 108, 32, 118, 111, 105, 100, 32,
+    98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 97, 114, 101, 97, 95, 102,
+    105, 108, 116, 101, 114, 40, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 42, 32, 108, 97, 98, 101, 108, 115, 44,
+    32, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 42, 32, 97, 114, 101, 97, 115, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 103, 108, 111,
+    98, 97, 108, 32, 105, 110, 116, 32, 42, 32, 111, 117, 116, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 114, 111, 119, 115,
+    44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 99, 111, 108,
+    115, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 109,
+    105, 110, 95, 97, 114, 101, 97, 44, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 105, 110, 118, 101, 114, 116, 101, 100, 41, 10, 123, 10, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 120, 32, 61, 32, 103,
+    101, 116, 95, 103, 108, 111, 98, 97, 108, 95, 105, 100, 40, 48, 41, 59,
+    10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 121, 32, 61,
+    32, 103, 101, 116, 95, 103, 108, 111, 98, 97, 108, 95, 105, 100, 40, 49,
+    41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 98,
+    95, 110, 99, 111, 108, 115, 32, 61, 32, 110, 99, 111, 108, 115, 32, 47,
+    32, 51, 50, 59, 10, 10, 32, 32, 105, 102, 32, 40, 120, 32, 62, 61,
+    32, 98, 95, 110, 99, 111, 108, 115, 32, 124, 124, 32, 121, 32, 62, 61,
+    32, 110, 114, 111, 119, 115, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117,
+    114, 110, 59, 10, 10, 32, 32, 103, 108, 111, 98, 97, 108, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 42, 32, 108, 32, 61, 32, 108, 97,
+    98, 101, 108, 115, 32, 43, 32, 109, 97, 100, 50, 52, 40, 121, 44, 32,
+    110, 99, 111, 108, 115, 44, 32, 120, 32, 42, 32, 51, 50, 41, 59, 10,
+    32, 32, 117, 105, 110, 116, 32, 119, 32, 61, 32, 48, 59, 10, 32, 32,
+    102, 111, 114, 32, 40, 105, 110, 116, 32, 105, 32, 61, 32, 48, 59, 32,
+    105, 32, 60, 32, 51, 50, 59, 32, 43, 43, 105, 41, 10, 32, 32, 32,
+    32, 119, 32, 61, 32, 40, 119, 32, 60, 60, 32, 49, 41, 32, 124, 32,
+    40, 108, 91, 105, 93, 32, 38, 38, 32, 97, 114, 101, 97, 115, 91, 108,
+    91, 105, 93, 32, 45, 32, 49, 93, 32, 62, 61, 32, 109, 105, 110, 95,
+    97, 114, 101, 97, 41, 59, 10, 32, 32, 111, 117, 116, 91, 109, 97, 100,
+    50, 52, 40, 121, 44, 32, 98, 95, 110, 99, 111, 108, 115, 44, 32, 120,
+    41, 93, 32, 61, 32, 105, 110, 118, 101, 114, 116, 101, 100, 32, 63, 32,
+    126, 119, 32, 58, 32, 119, 59, 10, 125, 10, 35, 101, 110, 100, 105, 102,
+    10, 10, 35, 105, 102, 100, 101, 102, 32, 67, 76, 67, 86, 95, 83, 69,
+    67, 84, 73, 79, 78, 95, 66, 73, 84, 77, 65, 80, 10, 47, 47, 32,
+    78, 117, 109, 98, 101, 114, 32, 111, 102, 32, 115, 101, 116, 32, 98, 105,
+    116, 115, 32, 40, 112, 111, 112, 99, 111, 117, 110, 116, 32, 105, 115, 32,
+    79, 112, 101, 110, 67, 76, 32, 49, 46, 50, 41, 10, 105, 110, 116, 32,
+    98, 105, 116, 99, 111, 117, 110, 116, 40, 117, 105, 110, 116, 32, 119, 41,
+    10, 123, 10, 32, 32, 119, 32, 61, 32, 119, 32, 45, 32, 40, 40, 119,
+    32, 62, 62, 32, 49, 41, 32, 38, 32, 48, 120, 53, 53, 53, 53, 53,
+    53, 53, 53, 41, 59, 10, 32, 32, 119, 32, 61, 32, 40, 119, 32, 38,
+    32, 48, 120, 51, 51, 51, 51, 51, 51, 51, 51, 41, 32, 43, 32, 40,
+    40, 119, 32, 62, 62, 32, 50, 41, 32, 38, 32, 48, 120, 51, 51, 51,
+    51, 51, 51, 51, 51, 41, 59, 10, 32, 32, 119, 32, 61, 32, 40, 119,
+    32, 43, 32, 40, 119, 32, 62, 62, 32, 52, 41, 41, 32, 38, 32, 48,
+    120, 48, 70, 48, 70, 48, 70, 48, 70, 59, 10, 32, 32, 114, 101, 116,
+    117, 114, 110, 32, 40, 119, 32, 42, 32, 48, 120, 48, 49, 48, 49, 48,
+    49, 48, 49, 41, 32, 62, 62, 32, 50, 52, 59, 10, 125, 10, 10, 47,
+    47, 32, 65, 100, 100, 32, 116, 104, 101, 32, 110, 117, 109, 98, 101, 114,
+    32, 111, 102, 32, 115, 101, 116, 32, 112, 105, 120, 101, 108, 115, 32, 111,
+    102, 32, 97, 32, 98, 105, 116, 109, 97, 112, 32, 111, 102, 32, 115, 105,
+    122, 101, 32, 119, 111, 114, 100, 115, 32, 116, 111, 32, 99, 111, 117, 110,
+    116, 115, 91, 105, 110, 100, 101, 120, 93, 46, 10, 47, 47, 32, 69, 97,
+    99, 104, 32, 116, 104, 114, 101, 97, 100, 32, 115, 117, 109, 115, 32, 97,
+    32, 115, 116, 114, 105, 100, 101, 100, 32, 112, 97, 114, 116, 32, 111, 102,
+    32, 116, 104, 101, 32, 98, 105, 116, 109, 97, 112, 44, 32, 116, 104, 101,
+    110, 32, 101, 97, 99, 104, 32, 119, 111, 114, 107, 45, 103, 114, 111, 117,
+    112, 10, 47, 47, 32, 114, 101, 100, 117, 99, 101, 115, 32, 105, 110, 32,
+    108, 111, 99, 97, 108, 32, 109, 101, 109, 111, 114, 121, 32, 40, 116, 104,
+    101, 32, 108, 111, 99, 97, 108, 32, 115, 105, 122, 101, 32, 109, 117, 115,
+    116, 32, 98, 101, 32, 97, 32, 112, 111, 119, 101, 114, 32, 111, 102, 32,
+    50, 41, 32, 97, 110, 100, 32, 97, 100, 100, 115, 10, 47, 47, 32, 105,
+    116, 115, 32, 116, 111, 116, 97, 108, 32, 119, 105, 116, 104, 32, 111, 110,
+    101, 32, 97, 116, 111, 109, 105, 99, 46, 10, 107, 101, 114, 110, 101, 108,
+    32, 118, 111, 105, 100, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95,
+    99, 111, 117, 110, 116, 40, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 42, 32, 105, 110, 44, 32, 118, 111, 108,
+    97, 116, 105, 108, 101, 32, 103, 108, 111, 98, 97, 108, 32, 105, 110, 116,
+    32, 42, 32, 99, 111, 117, 110, 116, 115, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 115, 105, 122, 101, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 105, 110, 100, 101, 120, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 108, 111, 99, 97, 108, 32, 105, 110, 116, 32, 42, 32,
+    108, 111, 99, 97, 108, 95, 115, 117, 109, 41, 10, 123, 10, 32, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 105, 100, 32, 61, 32, 103,
+    101, 116, 95, 108, 111, 99, 97, 108, 95, 105, 100, 40, 48, 41, 59, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 115, 105, 122,
+    101, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 115, 105,
+    122, 101, 40, 48, 41, 59, 10, 10, 32, 32, 105, 110, 116, 32, 115, 117,
+    109, 32, 61, 32, 48, 59, 10, 32, 32, 102, 111, 114, 32, 40, 105, 110,
+    116, 32, 105, 32, 61, 32, 103, 101, 116, 95, 103, 108, 111, 98, 97, 108,
+    95, 105, 100, 40, 48, 41, 59, 32, 105, 32, 60, 32, 115, 105, 122, 101,
+    59, 32, 105, 32, 43, 61, 32, 103, 101, 116, 95, 103, 108, 111, 98, 97,
+    108, 95, 115, 105, 122, 101, 40, 48, 41, 41, 10, 32, 32, 32, 32, 115,
+    117, 109, 32, 43, 61, 32, 98, 105, 116, 99, 111, 117, 110, 116, 40, 105,
+    110, 91, 105, 93, 41, 59, 10, 32, 32, 108, 111, 99, 97, 108, 95, 115,
+    117, 109, 91, 108, 105, 100, 93, 32, 61, 32, 115, 117, 109, 59, 10, 32,
+    32, 98, 97, 114, 114, 105, 101, 114, 40, 67, 76, 75, 95, 76, 79, 67,
+    65, 76, 95, 77, 69, 77, 95, 70, 69, 78, 67, 69, 41, 59, 10, 10,
+    32, 32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 115, 32, 61, 32, 108,
+    115, 105, 122, 101, 32, 47, 32, 50, 59, 32, 115, 32, 62, 32, 48, 59,
+    32, 115, 32, 62, 62, 61, 32, 49, 41, 10, 32, 32, 123, 10, 32, 32,
+    32, 32, 105, 102, 32, 40, 108, 105, 100, 32, 60, 32, 115, 41, 10, 32,
+    32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 115, 117, 109, 91, 108,
+    105, 100, 93, 32, 43, 61, 32, 108, 111, 99, 97, 108, 95, 115, 117, 109,
+    91, 108, 105, 100, 32, 43, 32, 115, 93, 59, 10, 32, 32, 32, 32, 98,
+    97, 114, 114, 105, 101, 114, 40, 67, 76, 75, 95, 76, 79, 67, 65, 76,
+    95, 77, 69, 77, 95, 70, 69, 78, 67, 69, 41, 59, 10, 32, 32, 125,
+    10, 32, 32, 105, 102, 32, 40, 108, 105, 100, 32, 61, 61, 32, 48, 41,
+    10, 32, 32, 32, 32, 97, 116, 111, 109, 105, 99, 95, 97, 100, 100, 40,
+    38, 99, 111, 117, 110, 116, 115, 91, 105, 110, 100, 101, 120, 93, 44, 32,
+    108, 111, 99, 97, 108, 95, 115, 117, 109, 91, 48, 93, 41, 59, 10, 125,
+    10, 35, 101, 110, 100, 105, 102, 10, 10, 35, 105, 102, 100, 101, 102, 32,
+    67, 76, 67, 86, 95, 83, 69, 67, 84, 73, 79, 78, 95, 83, 72, 73,
+    70, 84, 10, 47, 47, 32, 82, 111, 119, 32, 119, 111, 114, 100, 115, 32,
+    115, 104, 105, 102, 116, 101, 100, 32, 98, 121, 32, 115, 32, 112, 105, 120,
+    101, 108, 115, 58, 32, 112, 111, 115, 32, 112, 32, 111, 102, 32, 116, 104,
+    101, 32, 114, 101, 115, 117, 108, 116, 32, 105, 115, 32, 112, 111, 115, 32,
+    112, 32, 43, 32, 115, 32, 111, 102, 32, 116, 104, 101, 10, 47, 47, 32,
+    114, 111, 119, 32, 40, 108, 101, 102, 116, 44, 32, 119, 44, 32, 114, 105,
+    103, 104, 116, 41, 44, 32, 45, 51, 50, 32, 60, 61, 32, 115, 32, 60,
+    61, 32, 51, 50, 10, 117, 105, 110, 116, 32, 98, 105, 116, 109, 97, 112,
+    112, 101, 100, 95, 115, 104, 105, 102, 116, 40, 99, 111, 110, 115, 116, 32,
+    117, 105, 110, 116, 32, 108, 101, 102, 116, 44, 32, 99, 111, 110, 115, 116,
+    32, 117, 105, 110, 116, 32, 119, 44, 32, 99, 111, 110, 115, 116, 32, 117,
+    105, 110, 116, 32, 114, 105, 103, 104, 116, 44, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 115, 41, 10, 123, 10, 32, 32, 105, 102, 32, 40,
+    115, 32, 61, 61, 32, 48, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117,
+    114, 110, 32, 119, 59, 10, 32, 32, 105, 102, 32, 40, 115, 32, 62, 61,
+    32, 51, 50, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32,
+    114, 105, 103, 104, 116, 59, 10, 32, 32, 105, 102, 32, 40, 115, 32, 60,
+    61, 32, 45, 51, 50, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114,
+    110, 32, 108, 101, 102, 116, 59, 10, 32, 32, 114, 101, 116, 117, 114, 110,
+    32, 115, 32, 62, 32, 48, 32, 63, 32, 40, 119, 32, 60, 60, 32, 115,
+    41, 32, 124, 32, 40, 114, 105, 103, 104, 116, 32, 62, 62, 32, 40, 51,
+    50, 32, 45, 32, 115, 41, 41, 32, 58, 32, 40, 119, 32, 62, 62, 32,
+    45, 115, 41, 32, 124, 32, 40, 108, 101, 102, 116, 32, 60, 60, 32, 40,
+    51, 50, 32, 43, 32, 115, 41, 41, 59, 10, 125, 10, 35, 101, 110, 100,
+    105, 102, 10, 10, 35, 105, 102, 100, 101, 102, 32, 67, 76, 67, 86, 95,
+    83, 69, 67, 84, 73, 79, 78, 95, 68, 73, 65, 71, 10, 47, 47, 32,
+    68, 105, 97, 103, 111, 110, 97, 108, 32, 115, 101, 103, 109, 101, 110, 116,
+    115, 32, 40, 115, 101, 95, 114, 97, 100, 32, 60, 61, 32, 51, 50, 41,
+    58, 32, 114, 111, 119, 32, 121, 32, 43, 32, 107, 32, 105, 115, 32, 115,
+    104, 105, 102, 116, 101, 100, 32, 98, 121, 32, 107, 32, 112, 105, 120, 101,
+    108, 115, 32, 97, 108, 111, 110, 103, 10, 47, 47, 32, 40, 49, 44, 32,
+    49, 41, 32, 40, 100, 105, 114, 32, 49, 41, 44, 32, 111, 114, 32, 98,
+    121, 32, 45, 107, 32, 112, 105, 120, 101, 108, 115, 32, 97, 108, 111, 110,
+    103, 32, 40, 49, 44, 32, 45, 49, 41, 32, 40, 100, 105, 114, 32, 45,
+    49, 41, 10, 118, 111, 105, 100, 32, 98, 105, 116, 109, 97, 112, 112, 101,
+    100, 95, 109, 111, 114, 112, 104, 95, 100, 105, 97, 103, 40, 103, 108, 111,
+    98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32,
+    105, 110, 44, 32, 103, 108, 111, 98, 97, 108, 32, 105, 110, 116, 32, 42,
+    32, 111, 117, 116, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 114, 111, 119, 115, 44,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 99, 111, 108, 115,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 115, 101, 95, 114, 97, 100, 44, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 100, 105, 114, 44, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 101, 114, 111, 115, 105, 111, 110, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 32,
+    117, 105, 110, 116, 32, 42, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103,
+    41, 10, 123, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    120, 32, 61, 32, 103, 101, 116, 95, 103, 108, 111, 98, 97, 108, 95, 105,
+    100, 40, 48, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 121, 32, 61, 32, 103, 101, 116, 95, 103, 108, 111, 98, 97, 108,
+    95, 105, 100, 40, 49, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 108, 120, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99,
+    97, 108, 95, 105, 100, 40, 48, 41, 59, 10, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 108, 121, 32, 61, 32, 103, 101, 116, 95, 108,
+    111, 99, 97, 108, 95, 105, 100, 40, 49, 41, 59, 10, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 108, 120, 115, 105, 122, 101, 32, 61,
+    32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 115, 105, 122, 101, 40,
+    48, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    108, 121, 115, 105, 122, 101, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99,
+    97, 108, 95, 115, 105, 122, 101, 40, 49, 41, 59, 10, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 98, 95, 110, 99, 111, 108, 115, 32,
+    61, 32, 110, 99, 111, 108, 115, 32, 62, 62, 32, 53, 59, 10, 10, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 99, 111, 114, 110, 101,
+    114, 95, 120, 32, 61, 32, 103, 101, 116, 95, 103, 114, 111, 117, 112, 95,
+    105, 100, 40, 48, 41, 32, 42, 32, 108, 120, 115, 105, 122, 101, 32, 45,
+    32, 49, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    99, 111, 114, 110, 101, 114, 95, 121, 32, 61, 32, 103, 101, 116, 95, 103,
+    114, 111, 117, 112, 95, 105, 100, 40, 49, 41, 32, 42, 32, 108, 121, 115,
+    105, 122, 101, 32, 45, 32, 115, 101, 95, 114, 97, 100, 59, 10, 10, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 116, 104, 114, 101, 97,
+    100, 95, 105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40, 108, 121,
+    44, 32, 108, 120, 115, 105, 122, 101, 44, 32, 108, 120, 41, 59, 10, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 98, 95, 116, 104,
+    114, 101, 97, 100, 115, 32, 61, 32, 108, 120, 115, 105, 122, 101, 32, 42,
+    32, 108, 121, 115, 105, 122, 101, 59, 10, 10, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 112, 97, 100, 100, 101, 100, 95, 110, 114, 111,
+    119, 115, 32, 61, 32, 108, 121, 115, 105, 122, 101, 32, 43, 32, 115, 101,
+    95, 114, 97, 100, 32, 42, 32, 50, 59, 10, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111,
+    108, 115, 32, 61, 32, 108, 120, 115, 105, 122, 101, 32, 43, 32, 50, 59,
+    10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 105,
+    100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40, 112, 97, 100, 100, 101,
+    100, 95, 110, 99, 111, 108, 115, 44, 32, 108, 121, 32, 43, 32, 115, 101,
+    95, 114, 97, 100, 44, 32, 108, 120, 32, 43, 32, 49, 41, 59, 10, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 105, 122, 101, 32,
+    61, 32, 112, 97, 100, 100, 101, 100, 95, 110, 114, 111, 119, 115, 32, 42,
+    32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 59, 10, 10,
+    32, 32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 105, 32, 61, 32, 116,
+    104, 114, 101, 97, 100, 95, 105, 100, 120, 59, 32, 105, 32, 60, 32, 115,
+    105, 122, 101, 59, 32, 105, 32, 43, 61, 32, 110, 98, 95, 116, 104, 114,
+    101, 97, 100, 115, 41, 10, 32, 32, 123, 10, 32, 32, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 100, 105, 118, 32, 61, 32, 105, 32,
+    47, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 59, 10,
+    32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 114, 101,
+    99, 116, 95, 114, 111, 119, 32, 61, 32, 100, 105, 118, 32, 43, 32, 99,
+    111, 114, 110, 101, 114, 95, 121, 59, 10, 32, 32, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 114, 101, 99, 116, 95, 99, 111, 108, 32,
+    61, 32, 105, 32, 45, 32, 100, 105, 118, 32, 42, 32, 112, 97, 100, 100,
+    101, 100, 95, 110, 99, 111, 108, 115, 32, 43, 32, 99, 111, 114, 110, 101,
+    114, 95, 120, 59, 10, 10, 32, 32, 32, 32, 105, 102, 32, 40, 114, 101,
+    99, 116, 95, 114, 111, 119, 32, 60, 32, 48, 32, 124, 124, 32, 114, 101,
+    99, 116, 95, 114, 111, 119, 32, 62, 61, 32, 110, 114, 111, 119, 115, 32,
+    124, 124, 32, 114, 101, 99, 116, 95, 99, 111, 108, 32, 60, 32, 48, 32,
+    124, 124, 32, 114, 101, 99, 116, 95, 99, 111, 108, 32, 62, 61, 32, 98,
+    95, 110, 99, 111, 108, 115, 41, 10, 32, 32, 32, 32, 32, 32, 108, 111,
+    99, 97, 108, 95, 105, 109, 103, 91, 105, 93, 32, 61, 32, 48, 59, 10,
+    32, 32, 32, 32, 101, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 108,
+    111, 99, 97, 108, 95, 105, 109, 103, 91, 105, 93, 32, 61, 32, 105, 110,
+    91, 109, 97, 100, 50, 52, 40, 114, 101, 99, 116, 95, 114, 111, 119, 44,
+    32, 98, 95, 110, 99, 111, 108, 115, 44, 32, 114, 101, 99, 116, 95, 99,
+    111, 108, 41, 93, 59, 10, 32, 32, 125, 10, 32, 32, 98, 97, 114, 114,
+    105, 101, 114, 40, 67, 76, 75, 95, 76, 79, 67, 65, 76, 95, 77, 69,
+    77, 95, 70, 69, 78, 67, 69, 41, 59, 10, 10, 32, 32, 105, 102, 32,
+    40, 120, 32, 62, 61, 32, 98, 95, 110, 99, 111, 108, 115, 32, 124, 124,
+    32, 121, 32, 62, 61, 32, 110, 114, 111, 119, 115, 41, 10, 32, 32, 32,
+    32, 114, 101, 116, 117, 114, 110, 59, 10, 10, 32, 32, 117, 105, 110, 116,
+    32, 97, 99, 99, 32, 61, 32, 101, 114, 111, 115, 105, 111, 110, 32, 63,
+    32, 48, 120, 70, 70, 70, 70, 70, 70, 70, 70, 32, 58, 32, 48, 59,
+    10, 32, 32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 107, 32, 61, 32,
+    45, 115, 101, 95, 114, 97, 100, 59, 32, 107, 32, 60, 61, 32, 115, 101,
+    95, 114, 97, 100, 59, 32, 43, 43, 107, 41, 10, 32, 32, 123, 10, 32,
+    32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 32, 61,
+    32, 109, 97, 100, 50, 52, 40, 107, 44, 32, 112, 97, 100, 100, 101, 100,
+    95, 110, 99, 111, 108, 115, 44, 32, 108, 105, 100, 120, 41, 59, 10, 32,
+    32, 32, 32, 99, 111, 110, 115, 116, 32, 117, 105, 110, 116, 32, 115, 32,
+    61, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 115, 104, 105, 102,
+    116, 40, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 108, 32, 45, 32,
+    49, 93, 44, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 108, 93,
+    44, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 108, 32, 43, 32,
+    49, 93, 44, 32, 107, 32, 42, 32, 100, 105, 114, 41, 59, 10, 32, 32,
+    32, 32, 97, 99, 99, 32, 61, 32, 101, 114, 111, 115, 105, 111, 110, 32,
+    63, 32, 97, 99, 99, 32, 38, 32, 115, 32, 58, 32, 97, 99, 99, 32,
+    124, 32, 115, 59, 10, 32, 32, 125, 10, 32, 32, 111, 117, 116, 91, 109,
+    97, 100, 50, 52, 40, 121, 44, 32, 98, 95, 110, 99, 111, 108, 115, 44,
+    32, 120, 41, 93, 32, 61, 32, 97, 99, 99, 59, 10, 125, 10, 10, 107,
+    101, 114, 110, 101, 108, 32, 118, 111, 105, 100, 32, 98, 105, 116, 109, 97,
+    112, 112, 101, 100, 95, 100, 105, 108, 97, 116, 105, 111, 110, 95, 100, 105,
+    97, 103, 40, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 42, 32, 105, 110, 44, 32, 103, 108, 111, 98, 97, 108,
+    32, 105, 110, 116, 32, 42, 32, 111, 117, 116, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 114, 111, 119, 115, 44,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 99, 111, 108, 115,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    115, 101, 95, 114, 97, 100, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 100, 105, 114, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108,
+    32, 117, 105, 110, 116, 32, 42, 32, 108, 111, 99, 97, 108, 95, 105, 109,
+    103, 41, 10, 123, 10, 32, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100,
+    95, 109, 111, 114, 112, 104, 95, 100, 105, 97, 103, 40, 105, 110, 44, 32,
+    111, 117, 116, 44, 32, 110, 114, 111, 119, 115, 44, 32, 110, 99, 111, 108,
+    115, 44, 32, 115, 101, 95, 114, 97, 100, 44, 32, 100, 105, 114, 44, 32,
+    48, 44, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 41, 59, 10, 125,
+    10, 10, 107, 101, 114, 110, 101, 108, 32, 118, 111, 105, 100, 32, 98, 105,
+    116, 109, 97, 112, 112, 101, 100, 95, 101, 114, 111, 115, 105, 111, 110, 95,
+    100, 105, 97, 103, 40, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 42, 32, 105, 110, 44, 32, 103, 108, 111, 98,
+    97, 108, 32, 105, 110, 116, 32, 42, 32, 111, 117, 116, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 114, 111, 119, 115,
+    44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 99, 111, 108,
+    115, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    115, 101, 95, 114, 97, 100, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 100, 105, 114, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 32,
+    117, 105, 110, 116, 32, 42, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103,
+    41, 10, 123, 10, 32, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95,
+    109, 111, 114, 112, 104, 95, 100, 105, 97, 103, 40, 105, 110, 44, 32, 111,
+    117, 116, 44, 32, 110, 114, 111, 119, 115, 44, 32, 110, 99, 111, 108, 115,
+    44, 32, 115, 101, 95, 114, 97, 100, 44, 32, 100, 105, 114, 44, 32, 49,
+    44, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 41, 59, 10, 125, 10,
+    35, 101, 110, 100, 105, 102, 10, 10, 35, 105, 102, 100, 101, 102, 32, 67,
+    76, 67, 86, 95, 83, 69, 67, 84, 73, 79, 78, 95, 77, 79, 82, 80,
+    72, 95, 51, 88, 51, 10, 47, 47, 32, 51, 120, 51, 32, 83, 69, 115,
+    58, 32, 116, 104, 101, 32, 52, 45, 99, 111, 110, 110, 101, 120, 105, 116,
+    121, 32, 99, 114, 111, 115, 115, 44, 32, 119, 104, 105, 99, 104, 32, 102,
+    105, 108, 108, 115, 32, 116, 104, 101, 32, 104, 111, 108, 101, 115, 32, 111,
+    102, 32, 116, 104, 101, 32, 115, 117, 109, 115, 32, 111, 102, 10, 47, 47,
+    32, 100, 105, 97, 103, 111, 110, 97, 108, 32, 115, 101, 103, 109, 101, 110,
+    116, 115, 44, 32, 111, 114, 32, 116, 104, 101, 32, 56, 45, 99, 111, 110,
+    110, 101, 120, 105, 116, 121, 32, 115, 113, 117, 97, 114, 101, 46, 32, 119,
+    32, 112, 111, 105, 110, 116, 115, 32, 116, 111, 32, 116, 104, 101, 32, 99,
+    101, 110, 116, 101, 114, 32, 119, 111, 114, 100, 10, 47, 47, 32, 111, 102,
+    32, 97, 32, 116, 105, 108, 101, 32, 119, 105, 116, 104, 32, 97, 32, 111,
+    110, 101, 32, 119, 111, 114, 100, 32, 97, 112, 114, 111, 110, 46, 10, 117,
+    105, 110, 116, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 109, 111,
+    114, 112, 104, 95, 51, 120, 51, 95, 119, 111, 114, 100, 40, 108, 111, 99,
+    97, 108, 32, 99, 111, 110, 115, 116, 32, 117, 105, 110, 116, 32, 42, 32,
+    119, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 112, 97, 100,
+    100, 101, 100, 95, 110, 99, 111, 108, 115, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 99, 56, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 101, 114, 111, 115, 105, 111, 110, 41, 10, 123, 10, 32, 32, 117, 105,
+    110, 116, 32, 97, 99, 99, 32, 61, 32, 101, 114, 111, 115, 105, 111, 110,
+    32, 63, 32, 48, 120, 70, 70, 70, 70, 70, 70, 70, 70, 32, 58, 32,
+    48, 59, 10, 32, 32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 114, 32,
+    61, 32, 45, 49, 59, 32, 114, 32, 60, 61, 32, 49, 59, 32, 43, 43,
+    114, 41, 10, 32, 32, 123, 10, 32, 32, 32, 32, 108, 111, 99, 97, 108,
+    32, 99, 111, 110, 115, 116, 32, 117, 105, 110, 116, 32, 42, 32, 119, 114,
+    32, 61, 32, 119, 32, 43, 32, 114, 32, 42, 32, 112, 97, 100, 100, 101,
+    100, 95, 110, 99, 111, 108, 115, 59, 10, 32, 32, 32, 32, 117, 105, 110,
+    116, 32, 114, 111, 119, 32, 61, 32, 119, 114, 91, 48, 93, 59, 10, 32,
+    32, 32, 32, 105, 102, 32, 40, 99, 56, 32, 124, 124, 32, 114, 32, 61,
+    61, 32, 48, 41, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32,
+    32, 99, 111, 110, 115, 116, 32, 117, 105, 110, 116, 32, 108, 101, 102, 116,
+    32, 61, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 115, 104, 105,
+    102, 116, 40, 119, 114, 91, 45, 49, 93, 44, 32, 119, 114, 91, 48, 93,
+    44, 32, 119, 114, 91, 49, 93, 44, 32, 45, 49, 41, 59, 10, 32, 32,
+    32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 117, 105, 110, 116, 32, 114,
+    105, 103, 104, 116, 32, 61, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100,
+    95, 115, 104, 105, 102, 116, 40, 119, 114, 91, 45, 49, 93, 44, 32, 119,
+    114, 91, 48, 93, 44, 32, 119, 114, 91, 49, 93, 44, 32, 49, 41, 59,
+    10, 32, 32, 32, 32, 32, 32, 114, 111, 119, 32, 61, 32, 101, 114, 111,
+    115, 105, 111, 110, 32, 63, 32, 108, 101, 102, 116, 32, 38, 32, 114, 111,
+    119, 32, 38, 32, 114, 105, 103, 104, 116, 32, 58, 32, 108, 101, 102, 116,
+    32, 124, 32, 114, 111, 119, 32, 124, 32, 114, 105, 103, 104, 116, 59, 10,
+    32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 97, 99, 99, 32, 61, 32,
+    101, 114, 111, 115, 105, 111, 110, 32, 63, 32, 97, 99, 99, 32, 38, 32,
+    114, 111, 119, 32, 58, 32, 97, 99, 99, 32, 124, 32, 114, 111, 119, 59,
+    10, 32, 32, 125, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 97, 99,
+    99, 59, 10, 125, 10, 10, 118, 111, 105, 100, 32, 98, 105, 116, 109, 97,
+    112, 112, 101, 100, 95, 109, 111, 114, 112, 104, 95, 51, 120, 51, 40, 103,
+    108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    42, 32, 105, 110, 44, 32, 103, 108, 111, 98, 97, 108, 32, 105, 110, 116,
+    32, 42, 32, 111, 117, 116, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 114, 111, 119, 115,
+    44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 99, 111, 108,
+    115, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 99, 56, 44, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 101, 114, 111, 115, 105, 111, 110, 44, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 32, 117, 105, 110, 116,
+    32, 42, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 41, 10, 123, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 120, 32, 61, 32,
+    103, 101, 116, 95, 103, 108, 111, 98, 97, 108, 95, 105, 100, 40, 48, 41,
+    59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 121, 32,
+    61, 32, 103, 101, 116, 95, 103, 108, 111, 98, 97, 108, 95, 105, 100, 40,
+    49, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    108, 120, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 105,
+    100, 40, 48, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 108, 121, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108,
+    95, 105, 100, 40, 49, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 108, 120, 115, 105, 122, 101, 32, 61, 32, 103, 101, 116,
+    95, 108, 111, 99, 97, 108, 95, 115, 105, 122, 101, 40, 48, 41, 59, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 121, 115, 105,
+    122, 101, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 115,
+    105, 122, 101, 40, 49, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 98, 95, 110, 99, 111, 108, 115, 32, 61, 32, 110, 99,
+    111, 108, 115, 32, 62, 62, 32, 53, 59, 10, 10, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 99, 111, 114, 110, 101, 114, 95, 120, 32,
+    61, 32, 103, 101, 116, 95, 103, 114, 111, 117, 112, 95, 105, 100, 40, 48,
+    41, 32, 42, 32, 108, 120, 115, 105, 122, 101, 32, 45, 32, 49, 59, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 99, 111, 114, 110,
+    101, 114, 95, 121, 32, 61, 32, 103, 101, 116, 95, 103, 114, 111, 117, 112,
+    95, 105, 100, 40, 49, 41, 32, 42, 32, 108, 121, 115, 105, 122, 101, 32,
+    45, 32, 49, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 32, 61, 32, 109,
+    97, 100, 50, 52, 40, 108, 121, 44, 32, 108, 120, 115, 105, 122, 101, 44,
+    32, 108, 120, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 32, 61, 32, 108,
+    120, 115, 105, 122, 101, 32, 42, 32, 108, 121, 115, 105, 122, 101, 59, 10,
+    10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 112, 97, 100,
+    100, 101, 100, 95, 110, 99, 111, 108, 115, 32, 61, 32, 108, 120, 115, 105,
+    122, 101, 32, 43, 32, 50, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 108, 105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52,
+    40, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 44, 32, 108,
+    121, 32, 43, 32, 49, 44, 32, 108, 120, 32, 43, 32, 49, 41, 59, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 105, 122, 101,
+    32, 61, 32, 40, 108, 121, 115, 105, 122, 101, 32, 43, 32, 50, 41, 32,
+    42, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 59, 10,
+    10, 32, 32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 105, 32, 61, 32,
+    116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 59, 32, 105, 32, 60, 32,
+    115, 105, 122, 101, 59, 32, 105, 32, 43, 61, 32, 110, 98, 95, 116, 104,
+    114, 101, 97, 100, 115, 41, 10, 32, 32, 123, 10, 32, 32, 32, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 100, 105, 118, 32, 61, 32, 105,
+    32, 47, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 59,
+    10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 114,
+    101, 99, 116, 95, 114, 111, 119, 32, 61, 32, 100, 105, 118, 32, 43, 32,
+    99, 111, 114, 110, 101, 114, 95, 121, 59, 10, 32, 32, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 114, 101, 99, 116, 95, 99, 111, 108,
+    32, 61, 32, 105, 32, 45, 32, 100, 105, 118, 32, 42, 32, 112, 97, 100,
+    100, 101, 100, 95, 110, 99, 111, 108, 115, 32, 43, 32, 99, 111, 114, 110,
+    101, 114, 95, 120, 59, 10, 10, 32, 32, 32, 32, 105, 102, 32, 40, 114,
+    101, 99, 116, 95, 114, 111, 119, 32, 60, 32, 48, 32, 124, 124, 32, 114,
+    101, 99, 116, 95, 114, 111, 119, 32, 62, 61, 32, 110, 114, 111, 119, 115,
+    32, 124, 124, 32, 114, 101, 99, 116, 95, 99, 111, 108, 32, 60, 32, 48,
+    32, 124, 124, 32, 114, 101, 99, 116, 95, 99, 111, 108, 32, 62, 61, 32,
+    98, 95, 110, 99, 111, 108, 115, 41, 10, 32, 32, 32, 32, 32, 32, 108,
+    111, 99, 97, 108, 95, 105, 109, 103, 91, 105, 93, 32, 61, 32, 48, 59,
+    10, 32, 32, 32, 32, 101, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32,
+    108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 105, 93, 32, 61, 32, 105,
+    110, 91, 109, 97, 100, 50, 52, 40, 114, 101, 99, 116, 95, 114, 111, 119,
+    44, 32, 98, 95, 110, 99, 111, 108, 115, 44, 32, 114, 101, 99, 116, 95,
+    99, 111, 108, 41, 93, 59, 10, 32, 32, 125, 10, 32, 32, 98, 97, 114,
+    114, 105, 101, 114, 40, 67, 76, 75, 95, 76, 79, 67, 65, 76, 95, 77,
+    69, 77, 95, 70, 69, 78, 67, 69, 41, 59, 10, 10, 32, 32, 105, 102,
+    32, 40, 120, 32, 62, 61, 32, 98, 95, 110, 99, 111, 108, 115, 32, 124,
+    124, 32, 121, 32, 62, 61, 32, 110, 114, 111, 119, 115, 41, 10, 32, 32,
+    32, 32, 114, 101, 116, 117, 114, 110, 59, 10, 10, 32, 32, 111, 117, 116,
+    91, 109, 97, 100, 50, 52, 40, 121, 44, 32, 98, 95, 110, 99, 111, 108,
+    115, 44, 32, 120, 41, 93, 32, 61, 32, 98, 105, 116, 109, 97, 112, 112,
+    101, 100, 95, 109, 111, 114, 112, 104, 95, 51, 120, 51, 95, 119, 111, 114,
+    100, 40, 108, 111, 99, 97, 108, 95, 105, 109, 103, 32, 43, 32, 108, 105,
+    100, 120, 44, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 56, 44, 32, 101, 114, 111,
+    115, 105, 111, 110, 41, 59, 10, 125, 10, 10, 107, 101, 114, 110, 101, 108,
+    32, 118, 111, 105, 100, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95,
+    100, 105, 108, 97, 116, 105, 111, 110, 95, 99, 52, 40, 103, 108, 111, 98,
+    97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32, 105,
+    110, 44, 32, 103, 108, 111, 98, 97, 108, 32, 105, 110, 116, 32, 42, 32,
+    111, 117, 116, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 110, 114, 111, 119, 115, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 110, 99, 111, 108, 115, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108,
+    32, 117, 105, 110, 116, 32, 42, 32, 108, 111, 99, 97, 108, 95, 105, 109,
+    103, 41, 10, 123, 10, 32, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100,
+    95, 109, 111, 114, 112, 104, 95, 51, 120, 51, 40, 105, 110, 44, 32, 111,
+    117, 116, 44, 32, 110, 114, 111, 119, 115, 44, 32, 110, 99, 111, 108, 115,
+    44, 32, 48, 44, 32, 48, 44, 32, 108, 111, 99, 97, 108, 95, 105, 109,
+    103, 41, 59, 10, 125, 10, 10, 107, 101, 114, 110, 101, 108, 32, 118, 111,
+    105, 100, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 101, 114, 111,
+    115, 105, 111, 110, 95, 99, 52, 40, 103, 108, 111, 98, 97, 108, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32, 105, 110, 44, 32, 103,
+    108, 111, 98, 97, 108, 32, 105, 110, 116, 32, 42, 32, 111, 117, 116, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 114, 111, 119,
+    115, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 99, 111,
+    108, 115, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 32, 117, 105, 110, 116, 32,
+    42, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 41, 10, 123, 10, 32,
+    32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 109, 111, 114, 112, 104,
+    95, 51, 120, 51, 40, 105, 110, 44, 32, 111, 117, 116, 44, 32, 110, 114,
+    111, 119, 115, 44, 32, 110, 99, 111, 108, 115, 44, 32, 48, 44, 32, 49,
+    44, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 41, 59, 10, 125, 10,
+    10, 107, 101, 114, 110, 101, 108, 32, 118, 111, 105, 100, 32, 98, 105, 116,
+    109, 97, 112, 112, 101, 100, 95, 100, 105, 108, 97, 116, 105, 111, 110, 95,
+    99, 56, 40, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 42, 32, 105, 110, 44, 32, 103, 108, 111, 98, 97, 108,
+    32, 105, 110, 116, 32, 42, 32, 111, 117, 116, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 110, 114, 111, 119, 115, 44, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 99, 111, 108, 115, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 108, 111, 99, 97, 108, 32, 117, 105, 110, 116, 32, 42, 32, 108,
+    111, 99, 97, 108, 95, 105, 109, 103, 41, 10, 123, 10, 32, 32, 98, 105,
+    116, 109, 97, 112, 112, 101, 100, 95, 109, 111, 114, 112, 104, 95, 51, 120,
+    51, 40, 105, 110, 44, 32, 111, 117, 116, 44, 32, 110, 114, 111, 119, 115,
+    44, 32, 110, 99, 111, 108, 115, 44, 32, 49, 44, 32, 48, 44, 32, 108,
+    111, 99, 97, 108, 95, 105, 109, 103, 41, 59, 10, 125, 10, 10, 107, 101,
+    114, 110, 101, 108, 32, 118, 111, 105, 100, 32, 98, 105, 116, 109, 97, 112,
+    112, 101, 100, 95, 101, 114, 111, 115, 105, 111, 110, 95, 99, 56, 40, 103,
+    108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    42, 32, 105, 110, 44, 32, 103, 108, 111, 98, 97, 108, 32, 105, 110, 116,
+    32, 42, 32, 111, 117, 116, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 110, 114, 111, 119, 115, 44, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 110, 99, 111, 108, 115, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97,
+    108, 32, 117, 105, 110, 116, 32, 42, 32, 108, 111, 99, 97, 108, 95, 105,
+    109, 103, 41, 10, 123, 10, 32, 32, 98, 105, 116, 109, 97, 112, 112, 101,
+    100, 95, 109, 111, 114, 112, 104, 95, 51, 120, 51, 40, 105, 110, 44, 32,
+    111, 117, 116, 44, 32, 110, 114, 111, 119, 115, 44, 32, 110, 99, 111, 108,
+    115, 44, 32, 49, 44, 32, 49, 44, 32, 108, 111, 99, 97, 108, 95, 105,
+    109, 103, 41, 59, 10, 125, 10, 35, 101, 110, 100, 105, 102, 10, 10, 35,
+    105, 102, 100, 101, 102, 32, 67, 76, 67, 86, 95, 83, 69, 67, 84, 73,
+    79, 78, 95, 82, 65, 78, 75, 10, 47, 47, 32, 82, 97, 110, 107, 32,
+    102, 105, 108, 116, 101, 114, 32, 111, 110, 32, 98, 105, 116, 109, 97, 112,
+    115, 58, 32, 97, 32, 112, 105, 120, 101, 108, 32, 105, 115, 32, 115, 101,
+    116, 32, 119, 104, 101, 110, 32, 97, 116, 32, 108, 101, 97, 115, 116, 32,
+    114, 97, 110, 107, 32, 112, 111, 105, 110, 116, 115, 32, 111, 102, 32, 116,
+    104, 101, 32, 83, 69, 10, 47, 47, 32, 40, 116, 104, 111, 115, 101, 32,
+    111, 102, 32, 112, 111, 115, 105, 116, 105, 118, 101, 32, 119, 101, 105, 103,
+    104, 116, 41, 32, 104, 105, 116, 32, 115, 101, 116, 32, 112, 105, 120, 101,
+    108, 115, 46, 32, 84, 104, 101, 32, 104, 105, 116, 115, 32, 111, 102, 32,
+    116, 104, 101, 32, 51, 50, 32, 112, 105, 120, 101, 108, 115, 32, 111, 102,
+    32, 97, 10, 47, 47, 32, 119, 111, 114, 100, 32, 97, 114, 101, 32, 115,
+    117, 109, 109, 101, 100, 32, 105, 110, 32, 98, 105, 116, 32, 115, 108, 105,
+    99, 101, 100, 32, 99, 111, 117, 110, 116, 101, 114, 115, 58, 32, 115, 108,
+    105, 99, 101, 32, 106, 32, 104, 111, 108, 100, 115, 32, 116, 104, 101, 32,
+    98, 105, 116, 32, 106, 32, 111, 102, 32, 116, 104, 101, 32, 51, 50, 10,
+    47, 47, 32, 99, 111, 117, 110, 116, 115, 44, 32, 97, 100, 100, 105, 110,
+    103, 32, 97, 32, 119, 111, 114, 100, 32, 105, 115, 32, 97, 32, 114, 105,
+    112, 112, 108, 101, 32, 111, 102, 32, 104, 97, 108, 102, 32, 97, 100, 100,
+    101, 114, 115, 46, 32, 115, 101, 95, 99, 111, 108, 114, 97, 100, 32, 60,
+    61, 32, 51, 50, 44, 32, 97, 116, 32, 109, 111, 115, 116, 10, 47, 47,
+    32, 54, 53, 53, 51, 53, 32, 112, 111, 105, 110, 116, 115, 46, 10, 107,
+    101, 114, 110, 101, 108, 32, 118, 111, 105, 100, 32, 98, 105, 116, 109, 97,
+    112, 112, 101, 100, 95, 114, 97, 110, 107, 40, 103, 108, 111, 98, 97, 108,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32, 105, 110, 44,
+    32, 103, 108, 111, 98, 97, 108, 32, 105, 110, 116, 32, 42, 32, 111, 117,
+    116, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 110, 114, 111, 119, 115, 44, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 99, 111, 108, 115, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 103, 108, 111, 98, 97,
+    108, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32, 115, 101,
+    44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 101, 95, 114,
+    111, 119, 114, 97, 100, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 101, 95, 99,
+    111, 117, 110, 116, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    114, 97, 110, 107, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 108, 111, 99, 97, 108, 32, 105, 110, 116, 32, 42, 32, 108, 111, 99,
+    97, 108, 95, 115, 101, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 108, 111, 99, 97, 108, 32, 117, 105, 110, 116, 32, 42, 32, 108,
+    111, 99, 97, 108, 95, 105, 109, 103, 41, 10, 123, 10, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 120, 32, 61, 32, 103, 101, 116, 95,
+    103, 108, 111, 98, 97, 108, 95, 105, 100, 40, 48, 41, 59, 10, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 121, 32, 61, 32, 103, 101,
+    116, 95, 103, 108, 111, 98, 97, 108, 95, 105, 100, 40, 49, 41, 59, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 120, 32, 61,
+    32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 105, 100, 40, 48, 41,
+    59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 121,
+    32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 105, 100, 40,
+    49, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    108, 120, 115, 105, 122, 101, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99,
+    97, 108, 95, 115, 105, 122, 101, 40, 48, 41, 59, 10, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 108, 121, 115, 105, 122, 101, 32, 61,
+    32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 115, 105, 122, 101, 40,
+    49, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    98, 95, 110, 99, 111, 108, 115, 32, 61, 32, 110, 99, 111, 108, 115, 32,
+    62, 62, 32, 53, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 99, 111, 114, 110, 101, 114, 95, 120, 32, 61, 32, 103, 101,
+    116, 95, 103, 114, 111, 117, 112, 95, 105, 100, 40, 48, 41, 32, 42, 32,
+    108, 120, 115, 105, 122, 101, 32, 45, 32, 49, 59, 10, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 99, 111, 114, 110, 101, 114, 95, 121,
+    32, 61, 32, 103, 101, 116, 95, 103, 114, 111, 117, 112, 95, 105, 100, 40,
+    49, 41, 32, 42, 32, 108, 121, 115, 105, 122, 101, 32, 45, 32, 115, 101,
+    95, 114, 111, 119, 114, 97, 100, 59, 10, 10, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120,
+    32, 61, 32, 109, 97, 100, 50, 52, 40, 108, 121, 44, 32, 108, 120, 115,
+    105, 122, 101, 44, 32, 108, 120, 41, 59, 10, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115,
+    32, 61, 32, 108, 120, 115, 105, 122, 101, 32, 42, 32, 108, 121, 115, 105,
+    122, 101, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 115, 101, 95, 115, 105, 122, 101, 32, 61, 32, 115, 101, 95, 99, 111,
+    117, 110, 116, 32, 42, 32, 51, 59, 10, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108,
+    115, 32, 61, 32, 108, 120, 115, 105, 122, 101, 32, 43, 32, 50, 59, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 105, 100, 120,
+    32, 61, 32, 109, 97, 100, 50, 52, 40, 112, 97, 100, 100, 101, 100, 95,
+    110, 99, 111, 108, 115, 44, 32, 108, 121, 32, 43, 32, 115, 101, 95, 114,
+    111, 119, 114, 97, 100, 44, 32, 108, 120, 32, 43, 32, 49, 41, 59, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 105, 122, 101,
+    32, 61, 32, 40, 108, 121, 115, 105, 122, 101, 32, 43, 32, 115, 101, 95,
+    114, 111, 119, 114, 97, 100, 32, 42, 32, 50, 41, 32, 42, 32, 112, 97,
+    100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 59, 10, 10, 32, 32, 109,
+    101, 109, 99, 112, 121, 50, 108, 111, 99, 97, 108, 40, 108, 111, 99, 97,
+    108, 95, 115, 101, 44, 32, 115, 101, 44, 32, 115, 101, 95, 115, 105, 122,
+    101, 44, 32, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 44, 32, 110,
+    98, 95, 116, 104, 114, 101, 97, 100, 115, 41, 59, 10, 32, 32, 102, 111,
+    114, 32, 40, 105, 110, 116, 32, 105, 32, 61, 32, 116, 104, 114, 101, 97,
+    100, 95, 105, 100, 120, 59, 32, 105, 32, 60, 32, 115, 105, 122, 101, 59,
+    32, 105, 32, 43, 61, 32, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115,
+    41, 10, 32, 32, 123, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 100, 105, 118, 32, 61, 32, 105, 32, 47, 32, 112, 97,
+    100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 59, 10, 32, 32, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 114, 101, 99, 116, 95, 114,
+    111, 119, 32, 61, 32, 100, 105, 118, 32, 43, 32, 99, 111, 114, 110, 101,
+    114, 95, 121, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 114, 101, 99, 116, 95, 99, 111, 108, 32, 61, 32, 105, 32,
+    45, 32, 100, 105, 118, 32, 42, 32, 112, 97, 100, 100, 101, 100, 95, 110,
+    99, 111, 108, 115, 32, 43, 32, 99, 111, 114, 110, 101, 114, 95, 120, 59,
+    10, 10, 32, 32, 32, 32, 105, 102, 32, 40, 114, 101, 99, 116, 95, 114,
+    111, 119, 32, 60, 32, 48, 32, 124, 124, 32, 114, 101, 99, 116, 95, 114,
+    111, 119, 32, 62, 61, 32, 110, 114, 111, 119, 115, 32, 124, 124, 32, 114,
+    101, 99, 116, 95, 99, 111, 108, 32, 60, 32, 48, 32, 124, 124, 32, 114,
+    101, 99, 116, 95, 99, 111, 108, 32, 62, 61, 32, 98, 95, 110, 99, 111,
+    108, 115, 41, 10, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95,
+    105, 109, 103, 91, 105, 93, 32, 61, 32, 48, 59, 10, 32, 32, 32, 32,
+    101, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108,
+    95, 105, 109, 103, 91, 105, 93, 32, 61, 32, 105, 110, 91, 109, 97, 100,
+    50, 52, 40, 114, 101, 99, 116, 95, 114, 111, 119, 44, 32, 98, 95, 110,
+    99, 111, 108, 115, 44, 32, 114, 101, 99, 116, 95, 99, 111, 108, 41, 93,
+    59, 10, 32, 32, 125, 10, 32, 32, 98, 97, 114, 114, 105, 101, 114, 40,
+    67, 76, 75, 95, 76, 79, 67, 65, 76, 95, 77, 69, 77, 95, 70, 69,
+    78, 67, 69, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 120, 32, 62,
+    61, 32, 98, 95, 110, 99, 111, 108, 115, 32, 124, 124, 32, 121, 32, 62,
+    61, 32, 110, 114, 111, 119, 115, 41, 10, 32, 32, 32, 32, 114, 101, 116,
+    117, 114, 110, 59, 10, 10, 32, 32, 105, 110, 116, 32, 110, 115, 108, 105,
+    99, 101, 115, 32, 61, 32, 48, 59, 10, 32, 32, 102, 111, 114, 32, 40,
+    105, 110, 116, 32, 110, 32, 61, 32, 115, 101, 95, 99, 111, 117, 110, 116,
+    59, 32, 110, 59, 32, 110, 32, 62, 62, 61, 32, 49, 41, 10, 32, 32,
+    32, 32, 43, 43, 110, 115, 108, 105, 99, 101, 115, 59, 10, 10, 32, 32,
+    117, 105, 110, 116, 32, 115, 108, 105, 99, 101, 115, 91, 49, 54, 93, 59,
+    10, 32, 32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 106, 32, 61, 32,
+    48, 59, 32, 106, 32, 60, 32, 110, 115, 108, 105, 99, 101, 115, 59, 32,
+    43, 43, 106, 41, 10, 32, 32, 32, 32, 115, 108, 105, 99, 101, 115, 91,
+    106, 93, 32, 61, 32, 48, 59, 10, 32, 32, 105, 110, 116, 32, 115, 101,
+    95, 112, 111, 115, 105, 116, 105, 118, 101, 32, 61, 32, 48, 59, 10, 32,
+    32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 105, 32, 61, 32, 48, 59,
+    32, 105, 32, 60, 32, 115, 101, 95, 115, 105, 122, 101, 59, 32, 105, 32,
+    43, 61, 32, 51, 41, 10, 32, 32, 123, 10, 32, 32, 32, 32, 105, 102,
+    32, 40, 108, 111, 99, 97, 108, 95, 115, 101, 91, 105, 32, 43, 32, 50,
+    93, 32, 60, 61, 32, 48, 41, 10, 32, 32, 32, 32, 32, 32, 99, 111,
+    110, 116, 105, 110, 117, 101, 59, 10, 32, 32, 32, 32, 43, 43, 115, 101,
+    95, 112, 111, 115, 105, 116, 105, 118, 101, 59, 10, 32, 32, 32, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 32, 61, 32, 109, 97, 100,
+    50, 52, 40, 108, 111, 99, 97, 108, 95, 115, 101, 91, 105, 93, 44, 32,
+    112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 44, 32, 108, 105,
+    100, 120, 41, 59, 10, 32, 32, 32, 32, 117, 105, 110, 116, 32, 99, 97,
+    114, 114, 121, 32, 61, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95,
+    115, 104, 105, 102, 116, 40, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91,
+    108, 32, 45, 32, 49, 93, 44, 32, 108, 111, 99, 97, 108, 95, 105, 109,
+    103, 91, 108, 93, 44, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91,
+    108, 32, 43, 32, 49, 93, 44, 32, 108, 111, 99, 97, 108, 95, 115, 101,
+    91, 105, 32, 43, 32, 49, 93, 41, 59, 10, 32, 32, 32, 32, 102, 111,
+    114, 32, 40, 105, 110, 116, 32, 106, 32, 61, 32, 48, 59, 32, 106, 32,
+    60, 32, 110, 115, 108, 105, 99, 101, 115, 32, 38, 38, 32, 99, 97, 114,
+    114, 121, 59, 32, 43, 43, 106, 41, 10, 32, 32, 32, 32, 123, 10, 32,
+    32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 117, 105, 110, 116, 32,
+    116, 32, 61, 32, 115, 108, 105, 99, 101, 115, 91, 106, 93, 32, 38, 32,
+    99, 97, 114, 114, 121, 59, 10, 32, 32, 32, 32, 32, 32, 115, 108, 105,
+    99, 101, 115, 91, 106, 93, 32, 94, 61, 32, 99, 97, 114, 114, 121, 59,
+    10, 32, 32, 32, 32, 32, 32, 99, 97, 114, 114, 121, 32, 61, 32, 116,
+    59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 125, 10, 10, 32, 32, 47,
+    47, 32, 99, 111, 117, 110, 116, 115, 32, 62, 61, 32, 114, 97, 110, 107,
+    44, 32, 102, 114, 111, 109, 32, 116, 104, 101, 32, 109, 111, 115, 116, 32,
+    115, 105, 103, 110, 105, 102, 105, 99, 97, 110, 116, 32, 115, 108, 105, 99,
+    101, 10, 32, 32, 117, 105, 110, 116, 32, 103, 101, 32, 61, 32, 48, 59,
+    10, 32, 32, 117, 105, 110, 116, 32, 101, 113, 32, 61, 32, 48, 120, 70,
+    70, 70, 70, 70, 70, 70, 70, 59, 10, 32, 32, 102, 111, 114, 32, 40,
+    105, 110, 116, 32, 106, 32, 61, 32, 110, 115, 108, 105, 99, 101, 115, 32,
+    45, 32, 49, 59, 32, 106, 32, 62, 61, 32, 48, 59, 32, 45, 45, 106,
+    41, 10, 32, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 40, 114,
+    97, 110, 107, 32, 62, 62, 32, 106, 41, 32, 38, 32, 49, 41, 10, 32,
+    32, 32, 32, 32, 32, 101, 113, 32, 38, 61, 32, 115, 108, 105, 99, 101,
+    115, 91, 106, 93, 59, 10, 32, 32, 32, 32, 101, 108, 115, 101, 10, 32,
+    32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 103, 101, 32, 124, 61,
+    32, 101, 113, 32, 38, 32, 115, 108, 105, 99, 101, 115, 91, 106, 93, 59,
+    10, 32, 32, 32, 32, 32, 32, 101, 113, 32, 38, 61, 32, 126, 115, 108,
+    105, 99, 101, 115, 91, 106, 93, 59, 10, 32, 32, 32, 32, 125, 10, 32,
+    32, 125, 10, 32, 32, 47, 47, 32, 84, 104, 101, 32, 115, 108, 105, 99,
+    101, 115, 32, 111, 110, 108, 121, 32, 104, 111, 108, 100, 32, 116, 104, 101,
+    32, 108, 111, 119, 32, 98, 105, 116, 115, 32, 111, 102, 32, 114, 97, 110,
+    107, 10, 32, 32, 111, 117, 116, 91, 109, 97, 100, 50, 52, 40, 121, 44,
+    32, 98, 95, 110, 99, 111, 108, 115, 44, 32, 120, 41, 93, 32, 61, 32,
+    114, 97, 110, 107, 32, 62, 32, 115, 101, 95, 112, 111, 115, 105, 116, 105,
+    118, 101, 32, 63, 32, 48, 32, 58, 32, 114, 97, 110, 107, 32, 60, 61,
+    32, 48, 32, 63, 32, 48, 120, 70, 70, 70, 70, 70, 70, 70, 70, 32,
+    58, 32, 103, 101, 32, 124, 32, 101, 113, 59, 10, 125, 10, 35, 101, 110,
+    100, 105, 102, 10, 10, 35, 105, 102, 100, 101, 102, 32, 67, 76, 67, 86,
+    95, 83, 69, 67, 84, 73, 79, 78, 95, 76, 85, 84, 10, 47, 47, 32,
+    65, 110, 121, 32, 51, 120, 51, 32, 110, 101, 105, 103, 104, 98, 111, 114,
+    104, 111, 111, 100, 32, 111, 112, 101, 114, 97, 116, 111, 114, 44, 32, 103,
+    105, 118, 101, 110, 32, 97, 115, 32, 97, 32, 53, 49, 50, 32, 98, 105,
+    116, 32, 108, 111, 111, 107, 117, 112, 32, 116, 97, 98, 108, 101, 32, 40,
+    49, 54, 32, 119, 111, 114, 100, 115, 44, 10, 47, 47, 32, 101, 110, 116,
+    114, 121, 32, 107, 32, 105, 115, 32, 98, 105, 116, 32, 107, 32, 38, 32,
+    51, 49, 32, 111, 102, 32, 108, 117, 116, 91, 107, 32, 62, 62, 32, 53,
+    93, 41, 46, 32, 69, 110, 116, 114, 121, 32, 107, 32, 105, 115, 32, 105,
+    110, 100, 101, 120, 101, 100, 32, 98, 121, 32, 116, 104, 101, 32, 51, 32,
+    114, 111, 119, 115, 32, 111, 102, 10, 47, 47, 32, 116, 104, 101, 32, 110,
+    101, 105, 103, 104, 98, 111, 114, 104, 111, 111, 100, 32, 102, 114, 111, 109,
+    32, 116, 111, 112, 32, 116, 111, 32, 98, 111, 116, 116, 111, 109, 44, 32,
+    101, 97, 99, 104, 32, 97, 115, 32, 51, 32, 98, 105, 116, 115, 32, 102,
+    114, 111, 109, 32, 108, 101, 102, 116, 32, 40, 77, 83, 66, 41, 32, 116,
+    111, 10, 47, 47, 32, 114, 105, 103, 104, 116, 46, 32, 67, 104, 97, 110,
+    103, 101, 115, 32, 97, 114, 101, 32, 102, 108, 97, 103, 103, 101, 100, 32,
+    102, 111, 114, 32, 116, 104, 101, 32, 105, 116, 101, 114, 97, 116, 105, 111,
+    110, 115, 46, 10, 107, 101, 114, 110, 101, 108, 32, 118, 111, 105, 100, 32,
+    98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 108, 117, 116, 51, 120, 51,
+    40, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 42, 32, 105, 110, 44, 32, 103, 108, 111, 98, 97, 108, 32, 105,
+    110, 116, 32, 42, 32, 111, 117, 116, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 110, 114, 111, 119, 115, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 110, 99, 111, 108, 115, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 42, 32, 108, 117, 116, 44, 32, 103, 108,
+    111, 98, 97, 108, 32, 105, 110, 116, 32, 42, 32, 99, 104, 97, 110, 103,
+    101, 100, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 108, 111, 99, 97, 108, 32, 105, 110, 116, 32, 42, 32, 108, 111, 99,
+    97, 108, 95, 108, 117, 116, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 32, 117, 105, 110, 116, 32,
+    42, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 41, 10, 123, 10, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 120, 32, 61, 32, 103,
+    101, 116, 95, 103, 108, 111, 98, 97, 108, 95, 105, 100, 40, 48, 41, 59,
+    10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 121, 32, 61,
+    32, 103, 101, 116, 95, 103, 108, 111, 98, 97, 108, 95, 105, 100, 40, 49,
+    41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108,
+    120, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 105, 100,
+    40, 48, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 108, 121, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95,
+    105, 100, 40, 49, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 108, 120, 115, 105, 122, 101, 32, 61, 32, 103, 101, 116, 95,
+    108, 111, 99, 97, 108, 95, 115, 105, 122, 101, 40, 48, 41, 59, 10, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 121, 115, 105, 122,
+    101, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 115, 105,
+    122, 101, 40, 49, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 98, 95, 110, 99, 111, 108, 115, 32, 61, 32, 110, 99, 111,
+    108, 115, 32, 62, 62, 32, 53, 59, 10, 10, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 99, 111, 114, 110, 101, 114, 95, 120, 32, 61,
+    32, 103, 101, 116, 95, 103, 114, 111, 117, 112, 95, 105, 100, 40, 48, 41,
+    32, 42, 32, 108, 120, 115, 105, 122, 101, 32, 45, 32, 49, 59, 10, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 99, 111, 114, 110, 101,
+    114, 95, 121, 32, 61, 32, 103, 101, 116, 95, 103, 114, 111, 117, 112, 95,
+    105, 100, 40, 49, 41, 32, 42, 32, 108, 121, 115, 105, 122, 101, 32, 45,
+    32, 49, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 32, 61, 32, 109, 97,
+    100, 50, 52, 40, 108, 121, 44, 32, 108, 120, 115, 105, 122, 101, 44, 32,
+    108, 120, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 32, 61, 32, 108, 120,
+    115, 105, 122, 101, 32, 42, 32, 108, 121, 115, 105, 122, 101, 59, 10, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 112, 97, 100, 100,
+    101, 100, 95, 110, 99, 111, 108, 115, 32, 61, 32, 108, 120, 115, 105, 122,
+    101, 32, 43, 32, 50, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 108, 105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40,
+    112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 44, 32, 108, 121,
+    32, 43, 32, 49, 44, 32, 108, 120, 32, 43, 32, 49, 41, 59, 10, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 105, 122, 101, 32,
+    61, 32, 40, 108, 121, 115, 105, 122, 101, 32, 43, 32, 50, 41, 32, 42,
+    32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 59, 10, 10,
+    32, 32, 109, 101, 109, 99, 112, 121, 50, 108, 111, 99, 97, 108, 40, 108,
+    111, 99, 97, 108, 95, 108, 117, 116, 44, 32, 108, 117, 116, 44, 32, 49,
+    54, 44, 32, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 44, 32, 110,
+    98, 95, 116, 104, 114, 101, 97, 100, 115, 41, 59, 10, 32, 32, 102, 111,
+    114, 32, 40, 105, 110, 116, 32, 105, 32, 61, 32, 116, 104, 114, 101, 97,
+    100, 95, 105, 100, 120, 59, 32, 105, 32, 60, 32, 115, 105, 122, 101, 59,
+    32, 105, 32, 43, 61, 32, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115,
+    41, 10, 32, 32, 123, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 100, 105, 118, 32, 61, 32, 105, 32, 47, 32, 112, 97,
+    100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 59, 10, 32, 32, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 114, 101, 99, 116, 95, 114,
+    111, 119, 32, 61, 32, 100, 105, 118, 32, 43, 32, 99, 111, 114, 110, 101,
+    114, 95, 121, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 114, 101, 99, 116, 95, 99, 111, 108, 32, 61, 32, 105, 32,
+    45, 32, 100, 105, 118, 32, 42, 32, 112, 97, 100, 100, 101, 100, 95, 110,
+    99, 111, 108, 115, 32, 43, 32, 99, 111, 114, 110, 101, 114, 95, 120, 59,
+    10, 10, 32, 32, 32, 32, 105, 102, 32, 40, 114, 101, 99, 116, 95, 114,
+    111, 119, 32, 60, 32, 48, 32, 124, 124, 32, 114, 101, 99, 116, 95, 114,
+    111, 119, 32, 62, 61, 32, 110, 114, 111, 119, 115, 32, 124, 124, 32, 114,
+    101, 99, 116, 95, 99, 111, 108, 32, 60, 32, 48, 32, 124, 124, 32, 114,
+    101, 99, 116, 95, 99, 111, 108, 32, 62, 61, 32, 98, 95, 110, 99, 111,
+    108, 115, 41, 10, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95,
+    105, 109, 103, 91, 105, 93, 32, 61, 32, 48, 59, 10, 32, 32, 32, 32,
+    101, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108,
+    95, 105, 109, 103, 91, 105, 93, 32, 61, 32, 105, 110, 91, 109, 97, 100,
+    50, 52, 40, 114, 101, 99, 116, 95, 114, 111, 119, 44, 32, 98, 95, 110,
+    99, 111, 108, 115, 44, 32, 114, 101, 99, 116, 95, 99, 111, 108, 41, 93,
+    59, 10, 32, 32, 125, 10, 32, 32, 98, 97, 114, 114, 105, 101, 114, 40,
+    67, 76, 75, 95, 76, 79, 67, 65, 76, 95, 77, 69, 77, 95, 70, 69,
+    78, 67, 69, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 120, 32, 62,
+    61, 32, 98, 95, 110, 99, 111, 108, 115, 32, 124, 124, 32, 121, 32, 62,
+    61, 32, 110, 114, 111, 119, 115, 41, 10, 32, 32, 32, 32, 114, 101, 116,
+    117, 114, 110, 59, 10, 10, 32, 32, 47, 47, 32, 69, 97, 99, 104, 32,
+    114, 111, 119, 32, 97, 115, 32, 51, 52, 32, 98, 105, 116, 115, 58, 32,
+    116, 104, 101, 32, 108, 97, 115, 116, 32, 112, 105, 120, 101, 108, 32, 111,
+    102, 32, 116, 104, 101, 32, 108, 101, 102, 116, 32, 119, 111, 114, 100, 44,
+    32, 116, 104, 101, 32, 119, 111, 114, 100, 44, 32, 116, 104, 101, 10, 32,
+    32, 47, 47, 32, 102, 105, 114, 115, 116, 32, 112, 105, 120, 101, 108, 32,
+    111, 102, 32, 116, 104, 101, 32, 114, 105, 103, 104, 116, 32, 119, 111, 114,
+    100, 10, 32, 32, 117, 108, 111, 110, 103, 32, 114, 111, 119, 115, 91, 51,
+    93, 59, 10, 32, 32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 114, 32,
+    61, 32, 48, 59, 32, 114, 32, 60, 32, 51, 59, 32, 43, 43, 114, 41,
+    10, 32, 32, 123, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 108, 32, 61, 32, 109, 97, 100, 50, 52, 40, 114, 32, 45,
+    32, 49, 44, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115,
+    44, 32, 108, 105, 100, 120, 41, 59, 10, 32, 32, 32, 32, 114, 111, 119,
+    115, 91, 114, 93, 32, 61, 32, 40, 40, 117, 108, 111, 110, 103, 41, 40,
+    108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 108, 32, 45, 32, 49, 93,
+    32, 38, 32, 49, 41, 32, 60, 60, 32, 51, 51, 41, 32, 124, 32, 40,
+    40, 117, 108, 111, 110, 103, 41, 108, 111, 99, 97, 108, 95, 105, 109, 103,
+    91, 108, 93, 32, 60, 60, 32, 49, 41, 10, 32, 32, 32, 32, 32, 32,
+    124, 32, 40, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 108, 32, 43,
+    32, 49, 93, 32, 62, 62, 32, 51, 49, 41, 59, 10, 32, 32, 125, 10,
+    32, 32, 117, 105, 110, 116, 32, 97, 99, 99, 32, 61, 32, 48, 59, 10,
+    32, 32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 115, 32, 61, 32, 51,
+    49, 59, 32, 115, 32, 62, 61, 32, 48, 59, 32, 45, 45, 115, 41, 10,
+    32, 32, 123, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 107, 32, 61, 32, 40, 105, 110, 116, 41, 40, 40, 114, 111, 119,
+    115, 91, 48, 93, 32, 62, 62, 32, 115, 41, 32, 38, 32, 55, 41, 32,
+    60, 60, 32, 54, 32, 124, 32, 40, 105, 110, 116, 41, 40, 40, 114, 111,
+    119, 115, 91, 49, 93, 32, 62, 62, 32, 115, 41, 32, 38, 32, 55, 41,
+    32, 60, 60, 32, 51, 10, 32, 32, 32, 32, 32, 32, 124, 32, 40, 105,
+    110, 116, 41, 40, 40, 114, 111, 119, 115, 91, 50, 93, 32, 62, 62, 32,
+    115, 41, 32, 38, 32, 55, 41, 59, 10, 32, 32, 32, 32, 97, 99, 99,
+    32, 61, 32, 40, 97, 99, 99, 32, 60, 60, 32, 49, 41, 32, 124, 32,
+    40, 40, 108, 111, 99, 97, 108, 95, 108, 117, 116, 91, 107, 32, 62, 62,
+    32, 53, 93, 32, 62, 62, 32, 40, 107, 32, 38, 32, 51, 49, 41, 41,
+    32, 38, 32, 49, 41, 59, 10, 32, 32, 125, 10, 32, 32, 111, 117, 116,
+    91, 109, 97, 100, 50, 52, 40, 121, 44, 32, 98, 95, 110, 99, 111, 108,
+    115, 44, 32, 120, 41, 93, 32, 61, 32, 97, 99, 99, 59, 10, 32, 32,
+    47, 47, 32, 69, 118, 101, 114, 121, 32, 119, 114, 105, 116, 101, 114, 32,
+    115, 116, 111, 114, 101, 115, 32, 116, 104, 101, 32, 115, 97, 109, 101, 32,
+    118, 97, 108, 117, 101, 44, 32, 110, 111, 32, 110, 101, 101, 100, 32, 102,
+    111, 114, 32, 97, 110, 32, 97, 116, 111, 109, 105, 99, 32, 111, 112, 101,
+    114, 97, 116, 105, 111, 110, 10, 32, 32, 105, 102, 32, 40, 97, 99, 99,
+    32, 33, 61, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 108, 105,
+    100, 120, 93, 41, 10, 32, 32, 32, 32, 42, 99, 104, 97, 110, 103, 101,
+    100, 32, 61, 32, 49, 59, 10, 125, 10, 35, 101, 110, 100, 105, 102, 10,
+    10, 35, 105, 102, 100, 101, 102, 32, 67, 76, 67, 86, 95, 83, 69, 67,
+    84, 73, 79, 78, 95, 83, 75, 69, 76, 69, 84, 79, 78, 10, 47, 47,
+    32, 76, 97, 110, 116, 117, 101, 106, 111, 117, 108, 32, 115, 107, 101, 108,
+    101, 116, 111, 110, 44, 32, 111, 110, 101, 32, 108, 101, 118, 101, 108, 58,
+    32, 101, 114, 111, 100, 101, 100, 32, 105, 115, 32, 116, 104, 101, 32, 101,
+    114, 111, 115, 105, 111, 110, 32, 111, 102, 32, 108, 101, 118, 101, 108, 32,
+    98, 121, 32, 116, 104, 101, 32, 51, 120, 51, 10, 47, 47, 32, 83, 69,
+    44, 32, 116, 104, 101, 32, 111, 112, 101, 110, 105, 110, 103, 32, 111, 102,
+    32, 108, 101, 118, 101, 108, 32, 105, 116, 115, 32, 100, 105, 108, 97, 116,
+    105, 111, 110, 46, 32, 87, 104, 97, 116, 32, 116, 104, 101, 32, 111, 112,
+    101, 110, 105, 110, 103, 32, 109, 105, 115, 115, 101, 115, 32, 111, 102, 32,
+    108, 101, 118, 101, 108, 10, 47, 47, 32, 106, 111, 105, 110, 115, 32, 116,
+    104, 101, 32, 115, 107, 101, 108, 101, 116, 111, 110, 44, 32, 105, 116, 115,
+    32, 112, 105, 120, 101, 108, 115, 32, 103, 101, 116, 32, 108, 101, 118, 101,
+    108, 95, 105, 110, 100, 101, 120, 32, 43, 32, 49, 32, 105, 110, 32, 116,
+    104, 101, 32, 113, 117, 101, 110, 99, 104, 32, 102, 117, 110, 99, 116, 105,
+    111, 110, 10, 47, 47, 32, 40, 119, 104, 101, 110, 32, 119, 105, 116, 104,
+    95, 113, 117, 101, 110, 99, 104, 41, 46, 32, 76, 101, 118, 101, 108, 32,
+    48, 32, 105, 110, 105, 116, 105, 97, 108, 105, 122, 101, 115, 32, 116, 104,
+    101, 32, 115, 107, 101, 108, 101, 116, 111, 110, 32, 97, 110, 100, 32, 116,
+    104, 101, 32, 113, 117, 101, 110, 99, 104, 10, 47, 47, 32, 102, 117, 110,
+    99, 116, 105, 111, 110, 46, 32, 99, 104, 97, 110, 103, 101, 100, 32, 105,
+    115, 32, 115, 101, 116, 32, 119, 104, 105, 108, 101, 32, 116, 104, 101, 32,
+    101, 114, 111, 115, 105, 111, 110, 115, 32, 97, 114, 101, 110, 39, 116, 32,
+    101, 109, 112, 116, 121, 46, 10, 107, 101, 114, 110, 101, 108, 32, 118, 111,
+    105, 100, 32, 98, 105, 116, 109, 97, 112, 112, 101, 100, 95, 115, 107, 101,
+    108, 101, 116, 111, 110, 40, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 42, 32, 108, 101, 118, 101, 108, 44, 32,
+    103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 42, 32, 101, 114, 111, 100, 101, 100, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 103, 108, 111, 98, 97, 108,
+    32, 105, 110, 116, 32, 42, 32, 115, 107, 101, 108, 44, 32, 103, 108, 111,
+    98, 97, 108, 32, 105, 110, 116, 32, 42, 32, 113, 117, 101, 110, 99, 104,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 114, 111, 119, 115,
+    44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 99, 111, 108,
+    115, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 99, 56, 44, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 101, 118, 101, 108, 95,
+    105, 110, 100, 101, 120, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    119, 105, 116, 104, 95, 113, 117, 101, 110, 99, 104, 44, 32, 103, 108, 111,
+    98, 97, 108, 32, 105, 110, 116, 32, 42, 32, 99, 104, 97, 110, 103, 101,
+    100, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 108, 111, 99, 97, 108, 32, 117, 105, 110, 116, 32, 42, 32, 108,
+    111, 99, 97, 108, 95, 105, 109, 103, 41, 10, 123, 10, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 120, 32, 61, 32, 103, 101, 116, 95,
+    103, 108, 111, 98, 97, 108, 95, 105, 100, 40, 48, 41, 59, 10, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 121, 32, 61, 32, 103, 101,
+    116, 95, 103, 108, 111, 98, 97, 108, 95, 105, 100, 40, 49, 41, 59, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 120, 32, 61,
+    32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 105, 100, 40, 48, 41,
+    59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 121,
+    32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 105, 100, 40,
+    49, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    108, 120, 115, 105, 122, 101, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99,
+    97, 108, 95, 115, 105, 122, 101, 40, 48, 41, 59, 10, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 108, 121, 115, 105, 122, 101, 32, 61,
+    32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 115, 105, 122, 101, 40,
+    49, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    98, 95, 110, 99, 111, 108, 115, 32, 61, 32, 110, 99, 111, 108, 115, 32,
+    62, 62, 32, 53, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 99, 111, 114, 110, 101, 114, 95, 120, 32, 61, 32, 103, 101,
+    116, 95, 103, 114, 111, 117, 112, 95, 105, 100, 40, 48, 41, 32, 42, 32,
+    108, 120, 115, 105, 122, 101, 32, 45, 32, 49, 59, 10, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 99, 111, 114, 110, 101, 114, 95, 121,
+    32, 61, 32, 103, 101, 116, 95, 103, 114, 111, 117, 112, 95, 105, 100, 40,
+    49, 41, 32, 42, 32, 108, 121, 115, 105, 122, 101, 32, 45, 32, 49, 59,
+    10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 116, 104,
+    114, 101, 97, 100, 95, 105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52,
+    40, 108, 121, 44, 32, 108, 120, 115, 105, 122, 101, 44, 32, 108, 120, 41,
+    59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 98,
+    95, 116, 104, 114, 101, 97, 100, 115, 32, 61, 32, 108, 120, 115, 105, 122,
+    101, 32, 42, 32, 108, 121, 115, 105, 122, 101, 59, 10, 10, 32, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 112, 97, 100, 100, 101, 100, 95,
+    110, 99, 111, 108, 115, 32, 61, 32, 108, 120, 115, 105, 122, 101, 32, 43,
+    32, 50, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    108, 105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40, 112, 97, 100,
+    100, 101, 100, 95, 110, 99, 111, 108, 115, 44, 32, 108, 121, 32, 43, 32,
+    49, 44, 32, 108, 120, 32, 43, 32, 49, 41, 59, 10, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 115, 105, 122, 101, 32, 61, 32, 40,
+    108, 121, 115, 105, 122, 101, 32, 43, 32, 50, 41, 32, 42, 32, 112, 97,
+    100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 59, 10, 10, 32, 32, 102,
+    111, 114, 32, 40, 105, 110, 116, 32, 105, 32, 61, 32, 116, 104, 114, 101,
+    97, 100, 95, 105, 100, 120, 59, 32, 105, 32, 60, 32, 115, 105, 122, 101,
+    59, 32, 105, 32, 43, 61, 32, 110, 98, 95, 116, 104, 114, 101, 97, 100,
+    115, 41, 10, 32, 32, 123, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 100, 105, 118, 32, 61, 32, 105, 32, 47, 32, 112,
+    97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 59, 10, 32, 32, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 114, 101, 99, 116, 95,
+    114, 111, 119, 32, 61, 32, 100, 105, 118, 32, 43, 32, 99, 111, 114, 110,
+    101, 114, 95, 121, 59, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 114, 101, 99, 116, 95, 99, 111, 108, 32, 61, 32, 105,
+    32, 45, 32, 100, 105, 118, 32, 42, 32, 112, 97, 100, 100, 101, 100, 95,
+    110, 99, 111, 108, 115, 32, 43, 32, 99, 111, 114, 110, 101, 114, 95, 120,
+    59, 10, 10, 32, 32, 32, 32, 105, 102, 32, 40, 114, 101, 99, 116, 95,
+    114, 111, 119, 32, 60, 32, 48, 32, 124, 124, 32, 114, 101, 99, 116, 95,
+    114, 111, 119, 32, 62, 61, 32, 110, 114, 111, 119, 115, 32, 124, 124, 32,
+    114, 101, 99, 116, 95, 99, 111, 108, 32, 60, 32, 48, 32, 124, 124, 32,
+    114, 101, 99, 116, 95, 99, 111, 108, 32, 62, 61, 32, 98, 95, 110, 99,
+    111, 108, 115, 41, 10, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108,
+    95, 105, 109, 103, 91, 105, 93, 32, 61, 32, 48, 59, 10, 32, 32, 32,
+    32, 101, 108, 115, 101, 10, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97,
+    108, 95, 105, 109, 103, 91, 105, 93, 32, 61, 32, 101, 114, 111, 100, 101,
+    100, 91, 109, 97, 100, 50, 52, 40, 114, 101, 99, 116, 95, 114, 111, 119,
+    44, 32, 98, 95, 110, 99, 111, 108, 115, 44, 32, 114, 101, 99, 116, 95,
+    99, 111, 108, 41, 93, 59, 10, 32, 32, 125, 10, 32, 32, 98, 97, 114,
+    114, 105, 101, 114, 40, 67, 76, 75, 95, 76, 79, 67, 65, 76, 95, 77,
+    69, 77, 95, 70, 69, 78, 67, 69, 41, 59, 10, 10, 32, 32, 105, 102,
+    32, 40, 120, 32, 62, 61, 32, 98, 95, 110, 99, 111, 108, 115, 32, 124,
+    124, 32, 121, 32, 62, 61, 32, 110, 114, 111, 119, 115, 41, 10, 32, 32,
+    32, 32, 114, 101, 116, 117, 114, 110, 59, 10, 10, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 105, 100, 120, 32, 61, 32, 109, 97, 100,
+    50, 52, 40, 121, 44, 32, 98, 95, 110, 99, 111, 108, 115, 44, 32, 120,
+    41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 117, 105, 110, 116, 32,
+    111, 112, 101, 110, 101, 100, 32, 61, 32, 98, 105, 116, 109, 97, 112, 112,
+    101, 100, 95, 109, 111, 114, 112, 104, 95, 51, 120, 51, 95, 119, 111, 114,
+    100, 40, 108, 111, 99, 97, 108, 95, 105, 109, 103, 32, 43, 32, 108, 105,
+    100, 120, 44, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115,
+    44, 32, 99, 56, 44, 32, 48, 41, 59, 10, 32, 32, 99, 111, 110, 115,
+    116, 32, 117, 105, 110, 116, 32, 114, 101, 115, 105, 100, 117, 101, 32, 61,
+    32, 108, 101, 118, 101, 108, 91, 105, 100, 120, 93, 32, 38, 32, 126, 111,
+    112, 101, 110, 101, 100, 59, 10, 32, 32, 115, 107, 101, 108, 91, 105, 100,
+    120, 93, 32, 61, 32, 108, 101, 118, 101, 108, 95, 105, 110, 100, 101, 120,
+    32, 61, 61, 32, 48, 32, 63, 32, 114, 101, 115, 105, 100, 117, 101, 32,
+    58, 32, 115, 107, 101, 108, 91, 105, 100, 120, 93, 32, 124, 32, 114, 101,
+    115, 105, 100, 117, 101, 59, 10, 32, 32, 105, 102, 32, 40, 119, 105, 116,
+    104, 95, 113, 117, 101, 110, 99, 104, 32, 38, 38, 32, 40, 114, 101, 115,
+    105, 100, 117, 101, 32, 124, 124, 32, 108, 101, 118, 101, 108, 95, 105, 110,
+    100, 101, 120, 32, 61, 61, 32, 48, 41, 41, 10, 32, 32, 123, 10, 32,
+    32, 32, 32, 103, 108, 111, 98, 97, 108, 32, 105, 110, 116, 32, 42, 32,
+    113, 32, 61, 32, 113, 117, 101, 110, 99, 104, 32, 43, 32, 109, 97, 100,
+    50, 52, 40, 121, 44, 32, 110, 99, 111, 108, 115, 44, 32, 120, 32, 60,
+    60, 32, 53, 41, 59, 10, 32, 32, 32, 32, 102, 111, 114, 32, 40, 105,
+    110, 116, 32, 105, 32, 61, 32, 48, 59, 32, 105, 32, 60, 32, 51, 50,
+    59, 32, 43, 43, 105, 41, 10, 32, 32, 32, 32, 32, 32, 105, 102, 32,
+    40, 40, 114, 101, 115, 105, 100, 117, 101, 32, 60, 60, 32, 105, 41, 32,
+    38, 32, 48, 120, 56, 48, 48, 48, 48, 48, 48, 48, 41, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 113, 91, 105, 93, 32, 61, 32, 108, 101, 118,
+    101, 108, 95, 105, 110, 100, 101, 120, 32, 43, 32, 49, 59, 10, 32, 32,
+    32, 32, 32, 32, 101, 108, 115, 101, 32, 105, 102, 32, 40, 108, 101, 118,
+    101, 108, 95, 105, 110, 100, 101, 120, 32, 61, 61, 32, 48, 41, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 113, 91, 105, 93, 32, 61, 32, 48, 59,
+    10, 32, 32, 125, 10, 32, 32, 47, 47, 32, 69, 118, 101, 114, 121, 32,
+    119, 114, 105, 116, 101, 114, 32, 115, 116, 111, 114, 101, 115, 32, 116, 104,
+    101, 32, 115, 97, 109, 101, 32, 118, 97, 108, 117, 101, 44, 32, 110, 111,
+    32, 110, 101, 101, 100, 32, 102, 111, 114, 32, 97, 110, 32, 97, 116, 111,
+    109, 105, 99, 32, 111, 112, 101, 114, 97, 116, 105, 111, 110, 10, 32, 32,
+    105, 102, 32, 40, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 108, 105,
+    100, 120, 93, 41, 10, 32, 32, 32, 32, 42, 99, 104, 97, 110, 103, 101,
+    100, 32, 61, 32, 49, 59, 10, 125, 10, 35, 101, 110, 100, 105, 102, 10,
+    10, 35, 105, 102, 100, 101, 102, 32, 67, 76, 67, 86, 95, 83, 69, 67,
+    84, 73, 79, 78, 95, 71, 82, 65, 89, 95, 82, 69, 67, 79, 78, 83,
+    84, 82, 85, 67, 84, 10, 47, 47, 32, 71, 114, 97, 121, 115, 99, 97,
+    108, 101, 32, 103, 101, 111, 100, 101, 115, 105, 99, 32, 114, 101, 99, 111,
+    110, 115, 116, 114, 117, 99, 116, 105, 111, 110, 32, 40, 56, 45, 99, 111,
+    110, 110, 101, 120, 105, 116, 121, 41, 44, 32, 98, 121, 32, 100, 105, 108,
+    97, 116, 105, 111, 110, 32, 111, 102, 32, 97, 32, 109, 97, 114, 107, 101,
+    114, 10, 47, 47, 32, 117, 110, 100, 101, 114, 32, 97, 32, 109, 97, 115,
+    107, 44, 32, 111, 114, 32, 98, 121, 32, 101, 114, 111, 115, 105, 111, 110,
+    32, 111, 102, 32, 97, 32, 109, 97, 114, 107, 101, 114, 32, 97, 98, 111,
+    118, 101, 32, 105, 116, 46, 32, 72, 121, 98, 114, 105, 100, 32, 97, 108,
+    103, 111, 114, 105, 116, 104, 109, 58, 32, 97, 32, 102, 101, 119, 10, 47,
+    47, 32, 112, 97, 115, 115, 101, 115, 32, 112, 114, 111, 112, 97, 103, 97,
+    116, 101, 32, 105, 110, 115, 105, 100, 101, 32, 108, 111, 99, 97, 108, 32,
+    116, 105, 108, 101, 115, 44, 32, 116, 104, 101, 110, 32, 97, 32, 70, 73,
+    70, 79, 32, 111, 102, 32, 116, 104, 101, 32, 112, 105, 120, 101, 108, 115,
+    32, 119, 104, 105, 99, 104, 32, 99, 97, 110, 10, 47, 47, 32, 115, 116,
+    105, 108, 108, 32, 105, 109, 112, 114, 111, 118, 101, 32, 97, 32, 110, 101,
+    105, 103, 104, 98, 111, 114, 32, 102, 105, 110, 105, 115, 104, 101, 115, 32,
+    116, 104, 101, 32, 112, 114, 111, 112, 97, 103, 97, 116, 105, 111, 110, 46,
+    10, 10, 47, 47, 32, 84, 104, 101, 32, 103, 101, 111, 100, 101, 115, 105,
+    99, 32, 115, 116, 101, 112, 58, 32, 118, 32, 112, 114, 111, 112, 97, 103,
+    97, 116, 101, 100, 32, 116, 111, 32, 97, 32, 110, 101, 105, 103, 104, 98,
+    111, 114, 32, 111, 102, 32, 109, 97, 115, 107, 32, 118, 97, 108, 117, 101,
+    32, 109, 10, 105, 110, 116, 32, 103, 114, 97, 121, 95, 103, 101, 111, 100,
+    101, 115, 105, 99, 40, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 118,
+    44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 109, 44, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 101, 114, 111, 115, 105, 111, 110,
+    41, 10, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 101, 114, 111,
+    115, 105, 111, 110, 32, 63, 32, 109, 97, 120, 40, 118, 44, 32, 109, 41,
+    32, 58, 32, 109, 105, 110, 40, 118, 44, 32, 109, 41, 59, 10, 125, 10,
+    10, 105, 110, 116, 32, 103, 114, 97, 121, 95, 105, 109, 112, 114, 111, 118,
+    101, 115, 40, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 118, 44, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 111, 108, 100, 44, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 101, 114, 111, 115, 105, 111, 110,
+    41, 10, 123, 10, 32, 32, 114, 101, 116, 117, 114, 110, 32, 101, 114, 111,
+    115, 105, 111, 110, 32, 63, 32, 118, 32, 60, 32, 111, 108, 100, 32, 58,
+    32, 118, 32, 62, 32, 111, 108, 100, 59, 10, 125, 10, 10, 47, 47, 32,
+    80, 114, 111, 112, 97, 103, 97, 116, 101, 115, 32, 117, 110, 116, 105, 108,
+    32, 116, 104, 101, 32, 116, 105, 108, 101, 32, 105, 115, 32, 115, 116, 97,
+    98, 108, 101, 44, 32, 116, 104, 101, 32, 97, 112, 114, 111, 110, 32, 40,
+    116, 104, 101, 32, 110, 101, 105, 103, 104, 98, 111, 114, 32, 116, 105, 108,
+    101, 115, 32, 97, 115, 32, 111, 102, 10, 47, 47, 32, 116, 104, 101, 32,
+    108, 97, 117, 110, 99, 104, 41, 32, 100, 111, 101, 115, 110, 39, 116, 32,
+    99, 104, 97, 110, 103, 101, 46, 32, 84, 104, 101, 32, 109, 97, 114, 107,
+    101, 114, 32, 105, 115, 32, 102, 105, 114, 115, 116, 32, 99, 108, 105, 112,
+    112, 101, 100, 32, 98, 121, 32, 116, 104, 101, 32, 109, 97, 115, 107, 46,
+    10, 107, 101, 114, 110, 101, 108, 32, 118, 111, 105, 100, 32, 103, 114, 97,
+    121, 95, 114, 101, 99, 111, 110, 115, 116, 114, 117, 99, 116, 95, 116, 105,
+    108, 101, 40, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 42, 32, 109, 97, 114, 107, 101, 114, 44, 32, 103, 108,
+    111, 98, 97, 108, 32, 105, 110, 116, 32, 42, 32, 111, 117, 116, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 42, 32, 109, 97, 115, 107, 44, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 110, 114, 111, 119, 115, 44, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 110, 99, 111, 108, 115, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 101, 114, 111, 115, 105,
+    111, 110, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 32, 105, 110, 116, 32,
+    42, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 44, 32, 108, 111, 99,
+    97, 108, 32, 105, 110, 116, 32, 42, 32, 108, 111, 99, 97, 108, 95, 102,
+    108, 97, 103, 41, 10, 123, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 120, 32, 61, 32, 103, 101, 116, 95, 103, 108, 111, 98, 97,
+    108, 95, 105, 100, 40, 48, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 121, 32, 61, 32, 103, 101, 116, 95, 103, 108, 111,
+    98, 97, 108, 95, 105, 100, 40, 49, 41, 59, 10, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 108, 120, 32, 61, 32, 103, 101, 116, 95,
+    108, 111, 99, 97, 108, 95, 105, 100, 40, 48, 41, 59, 10, 32, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 121, 32, 61, 32, 103, 101,
+    116, 95, 108, 111, 99, 97, 108, 95, 105, 100, 40, 49, 41, 59, 10, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 120, 115, 105, 122,
+    101, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108, 95, 115, 105,
+    122, 101, 40, 48, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 108, 121, 115, 105, 122, 101, 32, 61, 32, 103, 101, 116, 95,
+    108, 111, 99, 97, 108, 95, 115, 105, 122, 101, 40, 49, 41, 59, 10, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 99, 111, 114, 110,
+    101, 114, 95, 120, 32, 61, 32, 103, 101, 116, 95, 103, 114, 111, 117, 112,
+    95, 105, 100, 40, 48, 41, 32, 42, 32, 108, 120, 115, 105, 122, 101, 32,
+    45, 32, 49, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 99, 111, 114, 110, 101, 114, 95, 121, 32, 61, 32, 103, 101, 116, 95,
+    103, 114, 111, 117, 112, 95, 105, 100, 40, 49, 41, 32, 42, 32, 108, 121,
+    115, 105, 122, 101, 32, 45, 32, 49, 59, 10, 10, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 116, 104, 114, 101, 97, 100, 95, 105, 100,
+    120, 32, 61, 32, 109, 97, 100, 50, 52, 40, 108, 121, 44, 32, 108, 120,
+    115, 105, 122, 101, 44, 32, 108, 120, 41, 59, 10, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 110, 98, 95, 116, 104, 114, 101, 97, 100,
+    115, 32, 61, 32, 108, 120, 115, 105, 122, 101, 32, 42, 32, 108, 121, 115,
+    105, 122, 101, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 32, 61,
+    32, 108, 120, 115, 105, 122, 101, 32, 43, 32, 50, 59, 10, 32, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 105, 100, 120, 32, 61, 32,
+    109, 97, 100, 50, 52, 40, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111,
+    108, 115, 44, 32, 108, 121, 32, 43, 32, 49, 44, 32, 108, 120, 32, 43,
+    32, 49, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 115, 105, 122, 101, 32, 61, 32, 40, 108, 121, 115, 105, 122, 101, 32,
+    43, 32, 50, 41, 32, 42, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99,
+    111, 108, 115, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 111, 117, 116, 115, 105, 100, 101, 32, 61, 32, 101, 114, 111, 115, 105,
+    111, 110, 32, 63, 32, 73, 78, 84, 95, 77, 65, 88, 32, 58, 32, 73,
+    78, 84, 95, 77, 73, 78, 59, 10, 10, 32, 32, 102, 111, 114, 32, 40,
+    105, 110, 116, 32, 105, 32, 61, 32, 116, 104, 114, 101, 97, 100, 95, 105,
+    100, 120, 59, 32, 105, 32, 60, 32, 115, 105, 122, 101, 59, 32, 105, 32,
+    43, 61, 32, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 41, 10, 32,
+    32, 123, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 100, 105, 118, 32, 61, 32, 105, 32, 47, 32, 112, 97, 100, 100, 101,
+    100, 95, 110, 99, 111, 108, 115, 59, 10, 32, 32, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 114, 101, 99, 116, 95, 114, 111, 119, 32,
+    61, 32, 100, 105, 118, 32, 43, 32, 99, 111, 114, 110, 101, 114, 95, 121,
+    59, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    114, 101, 99, 116, 95, 99, 111, 108, 32, 61, 32, 105, 32, 45, 32, 100,
+    105, 118, 32, 42, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108,
+    115, 32, 43, 32, 99, 111, 114, 110, 101, 114, 95, 120, 59, 10, 10, 32,
+    32, 32, 32, 105, 102, 32, 40, 114, 101, 99, 116, 95, 114, 111, 119, 32,
+    60, 32, 48, 32, 124, 124, 32, 114, 101, 99, 116, 95, 114, 111, 119, 32,
+    62, 61, 32, 110, 114, 111, 119, 115, 32, 124, 124, 32, 114, 101, 99, 116,
+    95, 99, 111, 108, 32, 60, 32, 48, 32, 124, 124, 32, 114, 101, 99, 116,
+    95, 99, 111, 108, 32, 62, 61, 32, 110, 99, 111, 108, 115, 41, 10, 32,
+    32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 105,
+    93, 32, 61, 32, 111, 117, 116, 115, 105, 100, 101, 59, 10, 32, 32, 32,
+    32, 101, 108, 115, 101, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 112, 105, 100, 120,
+    32, 61, 32, 109, 97, 100, 50, 52, 40, 114, 101, 99, 116, 95, 114, 111,
+    119, 44, 32, 110, 99, 111, 108, 115, 44, 32, 114, 101, 99, 116, 95, 99,
+    111, 108, 41, 59, 10, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108,
+    95, 105, 109, 103, 91, 105, 93, 32, 61, 32, 103, 114, 97, 121, 95, 103,
+    101, 111, 100, 101, 115, 105, 99, 40, 109, 97, 114, 107, 101, 114, 91, 112,
+    105, 100, 120, 93, 44, 32, 109, 97, 115, 107, 91, 112, 105, 100, 120, 93,
+    44, 32, 101, 114, 111, 115, 105, 111, 110, 41, 59, 10, 32, 32, 32, 32,
+    125, 10, 32, 32, 125, 10, 32, 32, 98, 97, 114, 114, 105, 101, 114, 40,
+    67, 76, 75, 95, 76, 79, 67, 65, 76, 95, 77, 69, 77, 95, 70, 69,
+    78, 67, 69, 41, 59, 10, 10, 32, 32, 47, 47, 32, 84, 104, 114, 101,
+    97, 100, 115, 32, 111, 117, 116, 115, 105, 100, 101, 32, 116, 104, 101, 32,
+    105, 109, 97, 103, 101, 32, 115, 116, 105, 108, 108, 32, 116, 97, 107, 101,
+    32, 112, 97, 114, 116, 32, 105, 110, 32, 116, 104, 101, 32, 98, 97, 114,
+    114, 105, 101, 114, 115, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 105, 110, 115, 105, 100, 101, 32, 61, 32, 120, 32, 60, 32, 110,
+    99, 111, 108, 115, 32, 38, 38, 32, 121, 32, 60, 32, 110, 114, 111, 119,
+    115, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 105,
+    100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40, 121, 44, 32, 110, 99,
+    111, 108, 115, 44, 32, 120, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 109, 32, 61, 32, 105, 110, 115, 105, 100, 101, 32,
+    63, 32, 109, 97, 115, 107, 91, 105, 100, 120, 93, 32, 58, 32, 111, 117,
+    116, 115, 105, 100, 101, 59, 10, 10, 32, 32, 102, 111, 114, 32, 40, 59,
+    59, 41, 10, 32, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 116,
+    104, 114, 101, 97, 100, 95, 105, 100, 120, 32, 61, 61, 32, 48, 41, 10,
+    32, 32, 32, 32, 32, 32, 42, 108, 111, 99, 97, 108, 95, 102, 108, 97,
+    103, 32, 61, 32, 48, 59, 10, 10, 32, 32, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 118, 32, 61, 32, 108, 111, 99, 97, 108, 95,
+    105, 109, 103, 91, 108, 105, 100, 120, 93, 59, 10, 32, 32, 32, 32, 105,
+    110, 116, 32, 97, 99, 99, 32, 61, 32, 118, 59, 10, 32, 32, 32, 32,
+    102, 111, 114, 32, 40, 105, 110, 116, 32, 114, 32, 61, 32, 45, 49, 59,
+    32, 114, 32, 60, 61, 32, 49, 59, 32, 43, 43, 114, 41, 10, 32, 32,
+    32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32, 119, 32, 61, 32,
+    108, 111, 99, 97, 108, 95, 105, 109, 103, 32, 43, 32, 108, 105, 100, 120,
+    32, 43, 32, 114, 32, 42, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99,
+    111, 108, 115, 59, 10, 32, 32, 32, 32, 32, 32, 97, 99, 99, 32, 61,
+    32, 103, 114, 97, 121, 95, 111, 112, 40, 97, 99, 99, 44, 32, 103, 114,
+    97, 121, 95, 111, 112, 40, 119, 91, 45, 49, 93, 44, 32, 103, 114, 97,
+    121, 95, 111, 112, 40, 119, 91, 48, 93, 44, 32, 119, 91, 49, 93, 44,
+    32, 101, 114, 111, 115, 105, 111, 110, 41, 44, 32, 101, 114, 111, 115, 105,
+    111, 110, 41, 44, 32, 101, 114, 111, 115, 105, 111, 110, 41, 59, 10, 32,
+    32, 32, 32, 125, 10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 110, 118, 32, 61, 32, 105, 110, 115, 105, 100, 101, 32, 63,
+    32, 103, 114, 97, 121, 95, 103, 101, 111, 100, 101, 115, 105, 99, 40, 97,
+    99, 99, 44, 32, 109, 44, 32, 101, 114, 111, 115, 105, 111, 110, 41, 32,
+    58, 32, 118, 59, 10, 32, 32, 32, 32, 98, 97, 114, 114, 105, 101, 114,
+    40, 67, 76, 75, 95, 76, 79, 67, 65, 76, 95, 77, 69, 77, 95, 70,
+    69, 78, 67, 69, 41, 59, 10, 10, 32, 32, 32, 32, 105, 102, 32, 40,
+    110, 118, 32, 33, 61, 32, 118, 41, 10, 32, 32, 32, 32, 123, 10, 32,
+    32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 105, 109, 103, 91, 108,
+    105, 100, 120, 93, 32, 61, 32, 110, 118, 59, 10, 32, 32, 32, 32, 32,
+    32, 42, 108, 111, 99, 97, 108, 95, 102, 108, 97, 103, 32, 61, 32, 49,
+    59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 98, 97, 114, 114,
+    105, 101, 114, 40, 67, 76, 75, 95, 76, 79, 67, 65, 76, 95, 77, 69,
+    77, 95, 70, 69, 78, 67, 69, 41, 59, 10, 10, 32, 32, 32, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 97, 103, 97, 105, 110, 32, 61,
+    32, 42, 108, 111, 99, 97, 108, 95, 102, 108, 97, 103, 59, 10, 32, 32,
+    32, 32, 98, 97, 114, 114, 105, 101, 114, 40, 67, 76, 75, 95, 76, 79,
+    67, 65, 76, 95, 77, 69, 77, 95, 70, 69, 78, 67, 69, 41, 59, 10,
+    32, 32, 32, 32, 105, 102, 32, 40, 33, 97, 103, 97, 105, 110, 41, 10,
+    32, 32, 32, 32, 32, 32, 98, 114, 101, 97, 107, 59, 10, 32, 32, 125,
+    10, 10, 32, 32, 105, 102, 32, 40, 33, 105, 110, 115, 105, 100, 101, 41,
+    10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 59, 10, 10, 32, 32,
+    111, 117, 116, 91, 105, 100, 120, 93, 32, 61, 32, 108, 111, 99, 97, 108,
+    95, 105, 109, 103, 91, 108, 105, 100, 120, 93, 59, 10, 125, 10, 10, 47,
+    47, 32, 87, 104, 101, 116, 104, 101, 114, 32, 116, 104, 101, 32, 118, 97,
+    108, 117, 101, 32, 118, 32, 111, 102, 32, 116, 104, 101, 32, 112, 105, 120,
+    101, 108, 32, 40, 120, 44, 32, 121, 41, 32, 99, 97, 110, 32, 105, 109,
+    112, 114, 111, 118, 101, 32, 111, 110, 101, 32, 111, 102, 32, 105, 116, 115,
+    32, 110, 101, 105, 103, 104, 98, 111, 114, 115, 10, 105, 110, 116, 32, 103,
+    114, 97, 121, 95, 99, 97, 110, 95, 112, 114, 111, 112, 97, 103, 97, 116,
+    101, 40, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 42, 32, 109, 97, 114, 107, 101, 114, 44, 32, 103, 108, 111,
+    98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32,
+    109, 97, 115, 107, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 110, 114, 111, 119, 115, 44, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 110, 99, 111, 108, 115, 44, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    120, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 121, 44, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 118, 44, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 101, 114, 111, 115, 105, 111, 110, 41, 10,
+    123, 10, 32, 32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 114, 32, 61,
+    32, 109, 97, 120, 40, 121, 32, 45, 32, 49, 44, 32, 48, 41, 59, 32,
+    114, 32, 60, 61, 32, 109, 105, 110, 40, 121, 32, 43, 32, 49, 44, 32,
+    110, 114, 111, 119, 115, 32, 45, 32, 49, 41, 59, 32, 43, 43, 114, 41,
+    10, 32, 32, 32, 32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 99, 32,
+    61, 32, 109, 97, 120, 40, 120, 32, 45, 32, 49, 44, 32, 48, 41, 59,
+    32, 99, 32, 60, 61, 32, 109, 105, 110, 40, 120, 32, 43, 32, 49, 44,
+    32, 110, 99, 111, 108, 115, 32, 45, 32, 49, 41, 59, 32, 43, 43, 99,
+    41, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 113, 32, 61, 32, 109, 97, 100, 50,
+    52, 40, 114, 44, 32, 110, 99, 111, 108, 115, 44, 32, 99, 41, 59, 10,
+    32, 32, 32, 32, 32, 32, 105, 102, 32, 40, 103, 114, 97, 121, 95, 105,
+    109, 112, 114, 111, 118, 101, 115, 40, 103, 114, 97, 121, 95, 103, 101, 111,
+    100, 101, 115, 105, 99, 40, 118, 44, 32, 109, 97, 115, 107, 91, 113, 93,
+    44, 32, 101, 114, 111, 115, 105, 111, 110, 41, 44, 32, 109, 97, 114, 107,
+    101, 114, 91, 113, 93, 44, 32, 101, 114, 111, 115, 105, 111, 110, 41, 41,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 32,
+    49, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 114, 101, 116, 117, 114,
+    110, 32, 48, 59, 10, 125, 10, 10, 47, 47, 32, 70, 105, 108, 108, 115,
+    32, 116, 104, 101, 32, 70, 73, 70, 79, 32, 119, 105, 116, 104, 32, 116,
+    104, 101, 32, 112, 105, 120, 101, 108, 115, 32, 119, 104, 105, 99, 104, 32,
+    99, 97, 110, 32, 105, 109, 112, 114, 111, 118, 101, 32, 97, 32, 110, 101,
+    105, 103, 104, 98, 111, 114, 44, 32, 97, 110, 100, 32, 114, 101, 115, 101,
+    116, 115, 10, 47, 47, 32, 116, 104, 101, 32, 115, 116, 97, 109, 112, 115,
+    32, 40, 116, 104, 101, 32, 108, 97, 115, 116, 32, 114, 111, 117, 110, 100,
+    32, 101, 97, 99, 104, 32, 112, 105, 120, 101, 108, 32, 119, 97, 115, 32,
+    113, 117, 101, 117, 101, 100, 32, 105, 110, 41, 10, 107, 101, 114, 110, 101,
+    108, 32, 118, 111, 105, 100, 32, 103, 114, 97, 121, 95, 114, 101, 99, 111,
+    110, 115, 116, 114, 117, 99, 116, 95, 115, 101, 101, 100, 40, 103, 108, 111,
+    98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32,
+    109, 97, 114, 107, 101, 114, 44, 32, 103, 108, 111, 98, 97, 108, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32, 109, 97, 115, 107, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 103, 108, 111, 98, 97, 108, 32, 105, 110, 116, 32, 42, 32,
+    113, 117, 101, 117, 101, 44, 32, 103, 108, 111, 98, 97, 108, 32, 105, 110,
+    116, 32, 42, 32, 99, 111, 117, 110, 116, 115, 44, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 103, 108,
+    111, 98, 97, 108, 32, 105, 110, 116, 32, 42, 32, 115, 116, 97, 109, 112,
+    115, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110,
+    114, 111, 119, 115, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    110, 99, 111, 108, 115, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 101, 114, 111, 115, 105, 111, 110, 41, 10, 123, 10, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 120, 32, 61, 32, 103, 101,
+    116, 95, 103, 108, 111, 98, 97, 108, 95, 105, 100, 40, 48, 41, 59, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 121, 32, 61, 32,
+    103, 101, 116, 95, 103, 108, 111, 98, 97, 108, 95, 105, 100, 40, 49, 41,
+    59, 10, 10, 32, 32, 105, 102, 32, 40, 120, 32, 62, 61, 32, 110, 99,
+    111, 108, 115, 32, 124, 124, 32, 121, 32, 62, 61, 32, 110, 114, 111, 119,
+    115, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 59, 10, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 105, 100, 120, 32,
+    61, 32, 109, 97, 100, 50, 52, 40, 121, 44, 32, 110, 99, 111, 108, 115,
+    44, 32, 120, 41, 59, 10, 32, 32, 115, 116, 97, 109, 112, 115, 91, 105,
+    100, 120, 93, 32, 61, 32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 103,
+    114, 97, 121, 95, 99, 97, 110, 95, 112, 114, 111, 112, 97, 103, 97, 116,
+    101, 40, 109, 97, 114, 107, 101, 114, 44, 32, 109, 97, 115, 107, 44, 32,
+    110, 114, 111, 119, 115, 44, 32, 110, 99, 111, 108, 115, 44, 32, 120, 44,
+    32, 121, 44, 32, 109, 97, 114, 107, 101, 114, 91, 105, 100, 120, 93, 44,
+    32, 101, 114, 111, 115, 105, 111, 110, 41, 41, 10, 32, 32, 32, 32, 113,
+    117, 101, 117, 101, 91, 97, 116, 111, 109, 105, 99, 95, 105, 110, 99, 40,
+    99, 111, 117, 110, 116, 115, 41, 93, 32, 61, 32, 105, 100, 120, 59, 10,
+    125, 10, 10, 47, 47, 32, 79, 110, 101, 32, 114, 111, 117, 110, 100, 32,
+    111, 102, 32, 116, 104, 101, 32, 70, 73, 70, 79, 58, 32, 116, 104, 101,
+    32, 112, 105, 120, 101, 108, 115, 32, 111, 102, 32, 113, 117, 101, 117, 101,
+    95, 105, 110, 32, 40, 99, 111, 117, 110, 116, 115, 91, 105, 110, 95, 105,
+    110, 100, 101, 120, 93, 32, 111, 102, 32, 116, 104, 101, 109, 41, 10, 47,
+    47, 32, 112, 114, 111, 112, 97, 103, 97, 116, 101, 32, 116, 111, 32, 116,
+    104, 101, 105, 114, 32, 110, 101, 105, 103, 104, 98, 111, 114, 115, 44, 32,
+    116, 104, 101, 32, 105, 109, 112, 114, 111, 118, 101, 100, 32, 111, 110, 101,
+    115, 32, 97, 114, 101, 32, 113, 117, 101, 117, 101, 100, 32, 105, 110, 32,
+    113, 117, 101, 117, 101, 95, 111, 117, 116, 10, 47, 47, 32, 40, 111, 110,
+    99, 101, 32, 112, 101, 114, 32, 114, 111, 117, 110, 100, 44, 32, 116, 104,
+    97, 110, 107, 115, 32, 116, 111, 32, 116, 104, 101, 32, 115, 116, 97, 109,
+    112, 115, 41, 46, 32, 65, 110, 121, 32, 110, 117, 109, 98, 101, 114, 32,
+    111, 102, 32, 116, 104, 114, 101, 97, 100, 115, 46, 32, 84, 104, 101, 32,
+    109, 97, 114, 107, 101, 114, 10, 47, 47, 32, 111, 110, 108, 121, 32, 109,
+    111, 118, 101, 115, 32, 116, 111, 119, 97, 114, 100, 115, 32, 116, 104, 101,
+    32, 114, 101, 115, 117, 108, 116, 44, 32, 116, 104, 101, 32, 97, 116, 111,
+    109, 105, 99, 32, 117, 112, 100, 97, 116, 101, 115, 32, 107, 101, 101, 112,
+    32, 116, 104, 101, 32, 98, 101, 115, 116, 32, 118, 97, 108, 117, 101, 46,
+    10, 107, 101, 114, 110, 101, 108, 32, 118, 111, 105, 100, 32, 103, 114, 97,
+    121, 95, 114, 101, 99, 111, 110, 115, 116, 114, 117, 99, 116, 95, 102, 105,
+    102, 111, 40, 103, 108, 111, 98, 97, 108, 32, 105, 110, 116, 32, 42, 32,
+    109, 97, 114, 107, 101, 114, 44, 32, 103, 108, 111, 98, 97, 108, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32, 109, 97, 115, 107, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 42, 32, 113, 117, 101, 117, 101, 95, 105, 110, 44, 32,
+    103, 108, 111, 98, 97, 108, 32, 105, 110, 116, 32, 42, 32, 113, 117, 101,
+    117, 101, 95, 111, 117, 116, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 103, 108, 111, 98, 97, 108,
+    32, 105, 110, 116, 32, 42, 32, 99, 111, 117, 110, 116, 115, 44, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 105, 110, 95, 105, 110, 100, 101,
+    120, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 103, 108, 111, 98, 97, 108, 32, 105, 110, 116, 32,
+    42, 32, 115, 116, 97, 109, 112, 115, 44, 10, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 110, 114, 111, 119, 115, 44, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 110, 99, 111, 108, 115, 44, 10, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 101, 114, 111, 115, 105, 111,
+    110, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 102, 105, 102,
+    111, 95, 114, 111, 117, 110, 100, 41, 10, 123, 10, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 99, 111, 117, 110, 116, 32, 61, 32, 99,
+    111, 117, 110, 116, 115, 91, 105, 110, 95, 105, 110, 100, 101, 120, 93, 59,
+    10, 32, 32, 103, 108, 111, 98, 97, 108, 32, 105, 110, 116, 32, 42, 32,
+    111, 117, 116, 95, 99, 111, 117, 110, 116, 32, 61, 32, 99, 111, 117, 110,
+    116, 115, 32, 43, 32, 49, 32, 45, 32, 105, 110, 95, 105, 110, 100, 101,
+    120, 59, 10, 10, 32, 32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 105,
+    32, 61, 32, 103, 101, 116, 95, 103, 108, 111, 98, 97, 108, 95, 105, 100,
+    40, 48, 41, 59, 32, 105, 32, 60, 32, 99, 111, 117, 110, 116, 59, 32,
+    105, 32, 43, 61, 32, 103, 101, 116, 95, 103, 108, 111, 98, 97, 108, 95,
+    115, 105, 122, 101, 40, 48, 41, 41, 10, 32, 32, 123, 10, 32, 32, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 112, 32, 61, 32, 113,
+    117, 101, 117, 101, 95, 105, 110, 91, 105, 93, 59, 10, 32, 32, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 121, 32, 61, 32, 112, 32,
+    47, 32, 110, 99, 111, 108, 115, 59, 10, 32, 32, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 120, 32, 61, 32, 112, 32, 45, 32, 121,
+    32, 42, 32, 110, 99, 111, 108, 115, 59, 10, 32, 32, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 118, 32, 61, 32, 109, 97, 114, 107,
+    101, 114, 91, 112, 93, 59, 10, 32, 32, 32, 32, 102, 111, 114, 32, 40,
+    105, 110, 116, 32, 114, 32, 61, 32, 109, 97, 120, 40, 121, 32, 45, 32,
+    49, 44, 32, 48, 41, 59, 32, 114, 32, 60, 61, 32, 109, 105, 110, 40,
+    121, 32, 43, 32, 49, 44, 32, 110, 114, 111, 119, 115, 32, 45, 32, 49,
+    41, 59, 32, 43, 43, 114, 41, 10, 32, 32, 32, 32, 32, 32, 102, 111,
+    114, 32, 40, 105, 110, 116, 32, 99, 32, 61, 32, 109, 97, 120, 40, 120,
+    32, 45, 32, 49, 44, 32, 48, 41, 59, 32, 99, 32, 60, 61, 32, 109,
+    105, 110, 40, 120, 32, 43, 32, 49, 44, 32, 110, 99, 111, 108, 115, 32,
+    45, 32, 49, 41, 59, 32, 43, 43, 99, 41, 10, 32, 32, 32, 32, 32,
+    32, 123, 10, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 113, 32, 61, 32, 109, 97, 100, 50, 52, 40, 114,
+    44, 32, 110, 99, 111, 108, 115, 44, 32, 99, 41, 59, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110,
+    118, 32, 61, 32, 103, 114, 97, 121, 95, 103, 101, 111, 100, 101, 115, 105,
+    99, 40, 118, 44, 32, 109, 97, 115, 107, 91, 113, 93, 44, 32, 101, 114,
+    111, 115, 105, 111, 110, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32,
+    105, 102, 32, 40, 33, 103, 114, 97, 121, 95, 105, 109, 112, 114, 111, 118,
+    101, 115, 40, 110, 118, 44, 32, 109, 97, 114, 107, 101, 114, 91, 113, 93,
+    44, 32, 101, 114, 111, 115, 105, 111, 110, 41, 41, 10, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 99, 111, 110, 116, 105, 110, 117, 101, 59, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 111, 108, 100, 32, 61, 32, 101, 114, 111, 115, 105, 111, 110, 32,
+    63, 32, 97, 116, 111, 109, 105, 99, 95, 109, 105, 110, 40, 109, 97, 114,
+    107, 101, 114, 32, 43, 32, 113, 44, 32, 110, 118, 41, 32, 58, 32, 97,
+    116, 111, 109, 105, 99, 95, 109, 97, 120, 40, 109, 97, 114, 107, 101, 114,
+    32, 43, 32, 113, 44, 32, 110, 118, 41, 59, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 105, 102, 32, 40, 103, 114, 97, 121, 95, 105, 109, 112, 114,
+    111, 118, 101, 115, 40, 110, 118, 44, 32, 111, 108, 100, 44, 32, 101, 114,
+    111, 115, 105, 111, 110, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 38, 38, 32, 97, 116, 111, 109, 105, 99, 95, 120, 99, 104,
+    103, 40, 115, 116, 97, 109, 112, 115, 32, 43, 32, 113, 44, 32, 102, 105,
+    102, 111, 95, 114, 111, 117, 110, 100, 41, 32, 33, 61, 32, 102, 105, 102,
+    111, 95, 114, 111, 117, 110, 100, 41, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 113, 117, 101, 117, 101, 95, 111, 117, 116, 91, 97, 116, 111,
+    109, 105, 99, 95, 105, 110, 99, 40, 111, 117, 116, 95, 99, 111, 117, 110,
+    116, 41, 93, 32, 61, 32, 113, 59, 10, 32, 32, 32, 32, 32, 32, 125,
+    10, 32, 32, 125, 10, 125, 10, 10, 47, 47, 32, 67, 111, 110, 115, 116,
+    97, 110, 116, 32, 111, 102, 102, 115, 101, 116, 44, 32, 115, 97, 116, 117,
+    114, 97, 116, 101, 100, 10, 107, 101, 114, 110, 101, 108, 32, 118, 111, 105,
+    100, 32, 103, 114, 97, 121, 95, 97, 100, 100, 95, 99, 111, 110, 115, 116,
+    40, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 42, 32, 105, 110, 44, 32, 103, 108, 111, 98, 97, 108, 32, 105,
+    110, 116, 32, 42, 32, 111, 117, 116, 44, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 118, 97, 108, 117, 101, 41, 10, 123, 10, 32, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 105, 100, 120, 32, 61, 32, 103,
+    101, 116, 95, 103, 108, 111, 98, 97, 108, 95, 105, 100, 40, 48, 41, 59,
+    10, 32, 32, 111, 117, 116, 91, 105, 100, 120, 93, 32, 61, 32, 97, 100,
+    100, 95, 115, 97, 116, 40, 105, 110, 91, 105, 100, 120, 93, 44, 32, 118,
+    97, 108, 117, 101, 41, 59, 10, 125, 10, 10, 107, 101, 114, 110, 101, 108,
+    32, 118, 111, 105, 100, 32, 103, 114, 97, 121, 95, 115, 117, 98, 40, 103,
+    108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    42, 32, 97, 44, 32, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 42, 32, 98, 44, 32, 103, 108, 111, 98, 97,
+    108, 32, 105, 110, 116, 32, 42, 32, 111, 117, 116, 41, 10, 123, 10, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 105, 100, 120, 32, 61,
+    32, 103, 101, 116, 95, 103, 108, 111, 98, 97, 108, 95, 105, 100, 40, 48,
+    41, 59, 10, 32, 32, 111, 117, 116, 91, 105, 100, 120, 93, 32, 61, 32,
+    115, 117, 98, 95, 115, 97, 116, 40, 97, 91, 105, 100, 120, 93, 44, 32,
+    98, 91, 105, 100, 120, 93, 41, 59, 10, 125, 10, 10, 47, 47, 32, 77,
+    97, 114, 107, 101, 114, 32, 111, 102, 32, 116, 104, 101, 32, 114, 101, 99,
+    111, 110, 115, 116, 114, 117, 99, 116, 105, 111, 110, 115, 32, 102, 114, 111,
+    109, 32, 116, 104, 101, 32, 98, 111, 114, 100, 101, 114, 58, 32, 116, 104,
+    101, 32, 105, 109, 97, 103, 101, 32, 111, 110, 32, 116, 104, 101, 32, 98,
+    111, 114, 100, 101, 114, 44, 10, 47, 47, 32, 118, 97, 108, 117, 101, 32,
+    101, 108, 115, 101, 119, 104, 101, 114, 101, 10, 107, 101, 114, 110, 101, 108,
+    32, 118, 111, 105, 100, 32, 103, 114, 97, 121, 95, 98, 111, 114, 100, 101,
+    114, 95, 109, 97, 114, 107, 101, 114, 40, 103, 108, 111, 98, 97, 108, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32, 105, 110, 44, 32,
+    103, 108, 111, 98, 97, 108, 32, 105, 110, 116, 32, 42, 32, 111, 117, 116,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 114, 111, 119, 115,
+    44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 110, 99, 111, 108,
+    115, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 118, 97, 108,
+    117, 101, 41, 10, 123, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 120, 32, 61, 32, 103, 101, 116, 95, 103, 108, 111, 98, 97, 108,
+    95, 105, 100, 40, 48, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 121, 32, 61, 32, 103, 101, 116, 95, 103, 108, 111, 98,
+    97, 108, 95, 105, 100, 40, 49, 41, 59, 10, 10, 32, 32, 105, 102, 32,
+    40, 120, 32, 62, 61, 32, 110, 99, 111, 108, 115, 32, 124, 124, 32, 121,
+    32, 62, 61, 32, 110, 114, 111, 119, 115, 41, 10, 32, 32, 32, 32, 114,
+    101, 116, 117, 114, 110, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40,
+    121, 44, 32, 110, 99, 111, 108, 115, 44, 32, 120, 41, 59, 10, 32, 32,
+    99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 98, 111, 114, 100, 101, 114,
+    32, 61, 32, 120, 32, 61, 61, 32, 48, 32, 124, 124, 32, 121, 32, 61,
+    61, 32, 48, 32, 124, 124, 32, 120, 32, 61, 61, 32, 110, 99, 111, 108,
+    115, 32, 45, 32, 49, 32, 124, 124, 32, 121, 32, 61, 61, 32, 110, 114,
+    111, 119, 115, 32, 45, 32, 49, 59, 10, 32, 32, 111, 117, 116, 91, 105,
+    100, 120, 93, 32, 61, 32, 98, 111, 114, 100, 101, 114, 32, 63, 32, 105,
+    110, 91, 105, 100, 120, 93, 32, 58, 32, 118, 97, 108, 117, 101, 59, 10,
+    125, 10, 35, 101, 110, 100, 105, 102, 10, 10, 35, 105, 102, 100, 101, 102,
+    32, 67, 76, 67, 86, 95, 83, 69, 67, 84, 73, 79, 78, 95, 87, 65,
+    84, 69, 82, 83, 72, 69, 68, 10, 47, 47, 32, 77, 97, 114, 107, 101,
+    114, 45, 99, 111, 110, 116, 114, 111, 108, 108, 101, 100, 32, 119, 97, 116,
+    101, 114, 115, 104, 101, 100, 32, 40, 56, 45, 99, 111, 110, 110, 101, 120,
+    105, 116, 121, 41, 44, 32, 97, 115, 32, 116, 104, 101, 32, 105, 109, 97,
+    103, 101, 32, 102, 111, 114, 101, 115, 116, 105, 110, 103, 10, 47, 47, 32,
+    116, 114, 97, 110, 115, 102, 111, 114, 109, 32, 111, 102, 32, 116, 104, 101,
+    32, 103, 114, 97, 100, 105, 101, 110, 116, 32, 119, 105, 116, 104, 32, 116,
+    104, 101, 32, 109, 97, 120, 32, 112, 97, 116, 104, 32, 99, 111, 115, 116,
+    58, 32, 101, 97, 99, 104, 32, 112, 105, 120, 101, 108, 32, 116, 97, 107,
+    101, 115, 32, 116, 104, 101, 10, 47, 47, 32, 108, 97, 98, 101, 108, 32,
+    111, 102, 32, 116, 104, 101, 32, 109, 97, 114, 107, 101, 114, 32, 105, 116,
+    32, 99, 97, 110, 32, 98, 101, 32, 114, 101, 97, 99, 104, 101, 100, 32,
+    102, 114, 111, 109, 32, 119, 105, 116, 104, 32, 116, 104, 101, 32, 108, 111,
+    119, 101, 115, 116, 32, 109, 97, 120, 105, 109, 117, 109, 10, 47, 47, 32,
+    103, 114, 97, 100, 105, 101, 110, 116, 32, 97, 108, 111, 110, 103, 32, 116,
+    104, 101, 32, 112, 97, 116, 104, 46, 32, 79, 110, 32, 116, 104, 101, 32,
+    112, 108, 97, 116, 101, 97, 117, 115, 32, 116, 104, 101, 32, 100, 105, 115,
+    116, 97, 110, 99, 101, 32, 115, 105, 110, 99, 101, 32, 116, 104, 101, 32,
+    108, 97, 115, 116, 10, 47, 47, 32, 99, 108, 105, 109, 98, 32, 115, 112,
+    108, 105, 116, 115, 32, 116, 104, 101, 32, 116, 105, 101, 115, 44, 32, 116,
+    104, 101, 110, 32, 116, 104, 101, 32, 115, 109, 97, 108, 108, 101, 115, 116,
+    32, 108, 97, 98, 101, 108, 46, 32, 69, 97, 99, 104, 32, 112, 105, 120,
+    101, 108, 32, 114, 101, 99, 111, 109, 112, 117, 116, 101, 115, 32, 105, 116,
+    115, 10, 47, 47, 32, 118, 97, 108, 117, 101, 32, 102, 114, 111, 109, 32,
+    105, 116, 115, 32, 110, 101, 105, 103, 104, 98, 111, 114, 115, 32, 111, 110,
+    108, 121, 44, 32, 115, 111, 32, 116, 104, 97, 116, 32, 116, 104, 101, 32,
+    114, 101, 108, 97, 120, 97, 116, 105, 111, 110, 32, 104, 97, 115, 32, 97,
+    32, 115, 105, 110, 103, 108, 101, 32, 102, 105, 120, 101, 100, 10, 47, 47,
+    32, 112, 111, 105, 110, 116, 32, 119, 104, 97, 116, 101, 118, 101, 114, 32,
+    116, 104, 101, 32, 111, 114, 100, 101, 114, 32, 111, 102, 32, 116, 104, 101,
+    32, 117, 112, 100, 97, 116, 101, 115, 32, 40, 116, 104, 101, 32, 108, 97,
+    98, 101, 108, 115, 32, 111, 102, 32, 116, 104, 101, 32, 116, 105, 101, 115,
+    32, 105, 110, 99, 108, 117, 100, 101, 100, 41, 46, 10, 10, 47, 47, 32,
+    79, 102, 102, 101, 114, 32, 111, 102, 32, 116, 104, 101, 32, 110, 101, 105,
+    103, 104, 98, 111, 114, 32, 40, 99, 111, 115, 116, 44, 32, 100, 105, 115,
+    116, 44, 32, 108, 97, 98, 101, 108, 41, 32, 116, 111, 32, 97, 32, 112,
+    105, 120, 101, 108, 32, 111, 102, 32, 103, 114, 97, 100, 105, 101, 110, 116,
+    32, 103, 44, 10, 47, 47, 32, 107, 101, 112, 116, 32, 119, 104, 101, 110,
+    32, 98, 101, 116, 116, 101, 114, 32, 116, 104, 97, 110, 32, 40, 98, 101,
+    115, 116, 95, 99, 111, 115, 116, 44, 32, 98, 101, 115, 116, 95, 100, 105,
+    115, 116, 44, 32, 98, 101, 115, 116, 95, 108, 97, 98, 101, 108, 41, 10,
+    118, 111, 105, 100, 32, 119, 97, 116, 101, 114, 115, 104, 101, 100, 95, 111,
+    102, 102, 101, 114, 40, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 99,
+    111, 115, 116, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 100,
+    105, 115, 116, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108,
+    97, 98, 101, 108, 44, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    103, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 105, 110, 116, 32, 42, 32, 98, 101,
+    115, 116, 95, 99, 111, 115, 116, 44, 32, 105, 110, 116, 32, 42, 32, 98,
+    101, 115, 116, 95, 100, 105, 115, 116, 44, 32, 105, 110, 116, 32, 42, 32,
+    98, 101, 115, 116, 95, 108, 97, 98, 101, 108, 41, 10, 123, 10, 32, 32,
+    105, 102, 32, 40, 108, 97, 98, 101, 108, 32, 61, 61, 32, 48, 41, 10,
+    32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 59, 10, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 99, 32, 61, 32, 109, 97, 120, 40,
+    99, 111, 115, 116, 44, 32, 103, 41, 59, 10, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 100, 32, 61, 32, 103, 32, 60, 61, 32, 99,
+    111, 115, 116, 32, 63, 32, 100, 105, 115, 116, 32, 43, 32, 49, 32, 58,
+    32, 48, 59, 10, 32, 32, 105, 102, 32, 40, 99, 32, 60, 32, 42, 98,
+    101, 115, 116, 95, 99, 111, 115, 116, 10, 32, 32, 32, 32, 32, 32, 124,
+    124, 32, 40, 99, 32, 61, 61, 32, 42, 98, 101, 115, 116, 95, 99, 111,
+    115, 116, 32, 38, 38, 32, 40, 100, 32, 60, 32, 42, 98, 101, 115, 116,
+    95, 100, 105, 115, 116, 32, 124, 124, 32, 40, 100, 32, 61, 61, 32, 42,
+    98, 101, 115, 116, 95, 100, 105, 115, 116, 32, 38, 38, 32, 108, 97, 98,
+    101, 108, 32, 60, 32, 42, 98, 101, 115, 116, 95, 108, 97, 98, 101, 108,
+    41, 41, 41, 41, 10, 32, 32, 123, 10, 32, 32, 32, 32, 42, 98, 101,
+    115, 116, 95, 99, 111, 115, 116, 32, 61, 32, 99, 59, 10, 32, 32, 32,
+    32, 42, 98, 101, 115, 116, 95, 100, 105, 115, 116, 32, 61, 32, 100, 59,
+    10, 32, 32, 32, 32, 42, 98, 101, 115, 116, 95, 108, 97, 98, 101, 108,
+    32, 61, 32, 108, 97, 98, 101, 108, 59, 10, 32, 32, 125, 10, 125, 10,
+    10, 47, 47, 32, 84, 104, 101, 32, 109, 97, 114, 107, 101, 114, 115, 32,
+    115, 116, 97, 114, 116, 32, 97, 116, 32, 116, 104, 101, 105, 114, 32, 103,
+    114, 97, 100, 105, 101, 110, 116, 32, 119, 105, 116, 104, 32, 97, 32, 100,
+    105, 115, 116, 97, 110, 99, 101, 32, 111, 102, 32, 45, 49, 44, 32, 119,
+    104, 105, 99, 104, 32, 110, 111, 116, 104, 105, 110, 103, 10, 47, 47, 32,
+    101, 108, 115, 101, 32, 99, 97, 110, 32, 98, 101, 97, 116, 46, 32, 69,
+    118, 101, 114, 121, 116, 104, 105, 110, 103, 32, 101, 108, 115, 101, 32, 105,
+    115, 32, 117, 110, 114, 101, 97, 99, 104, 101, 100, 46, 10, 107, 101, 114,
+    110, 101, 108, 32, 118, 111, 105, 100, 32, 119, 97, 116, 101, 114, 115, 104,
+    101, 100, 95, 105, 110, 105, 116, 40, 103, 108, 111, 98, 97, 108, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32, 103, 114, 97, 100, 105,
+    101, 110, 116, 44, 32, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 42, 32, 108, 97, 98, 101, 108, 115, 44, 10,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 103, 108, 111, 98, 97,
+    108, 32, 105, 110, 116, 32, 42, 32, 99, 111, 115, 116, 44, 32, 103, 108,
+    111, 98, 97, 108, 32, 105, 110, 116, 32, 42, 32, 100, 105, 115, 116, 44,
+    10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 110, 114, 111, 119, 115, 44, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 110, 99, 111, 108, 115, 41, 10, 123, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 120, 32, 61, 32,
+    103, 101, 116, 95, 103, 108, 111, 98, 97, 108, 95, 105, 100, 40, 48, 41,
+    59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 121, 32,
+    61, 32, 103, 101, 116, 95, 103, 108, 111, 98, 97, 108, 95, 105, 100, 40,
+    49, 41, 59, 10, 10, 32, 32, 105, 102, 32, 40, 120, 32, 62, 61, 32,
+    110, 99, 111, 108, 115, 32, 124, 124, 32, 121, 32, 62, 61, 32, 110, 114,
+    111, 119, 115, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 59,
+    10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 105, 100,
+    120, 32, 61, 32, 109, 97, 100, 50, 52, 40, 121, 44, 32, 110, 99, 111,
+    108, 115, 44, 32, 120, 41, 59, 10, 32, 32, 99, 111, 115, 116, 91, 105,
+    100, 120, 93, 32, 61, 32, 108, 97, 98, 101, 108, 115, 91, 105, 100, 120,
+    93, 32, 63, 32, 103, 114, 97, 100, 105, 101, 110, 116, 91, 105, 100, 120,
+    93, 32, 58, 32, 73, 78, 84, 95, 77, 65, 88, 59, 10, 32, 32, 100,
+    105, 115, 116, 91, 105, 100, 120, 93, 32, 61, 32, 108, 97, 98, 101, 108,
+    115, 91, 105, 100, 120, 93, 32, 63, 32, 45, 49, 32, 58, 32, 48, 59,
+    10, 125, 10, 10, 47, 47, 32, 82, 101, 108, 97, 120, 101, 115, 32, 117,
+    110, 116, 105, 108, 32, 116, 104, 101, 32, 116, 105, 108, 101, 32, 105, 115,
+    32, 115, 116, 97, 98, 108, 101, 44, 32, 116, 104, 101, 32, 97, 112, 114,
+    111, 110, 32, 40, 116, 104, 101, 32, 110, 101, 105, 103, 104, 98, 111, 114,
+    32, 116, 105, 108, 101, 115, 32, 97, 115, 32, 111, 102, 32, 116, 104, 101,
+    10, 47, 47, 32, 108, 97, 117, 110, 99, 104, 41, 32, 100, 111, 101, 115,
+    110, 39, 116, 32, 99, 104, 97, 110, 103, 101, 10, 107, 101, 114, 110, 101,
+    108, 32, 118, 111, 105, 100, 32, 119, 97, 116, 101, 114, 115, 104, 101, 100,
+    40, 103, 108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 42, 32, 99, 111, 115, 116, 95, 105, 110, 44, 32, 103, 108, 111,
+    98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32,
+    100, 105, 115, 116, 95, 105, 110, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 103,
+    108, 111, 98, 97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    42, 32, 108, 97, 98, 101, 108, 95, 105, 110, 44, 32, 103, 108, 111, 98,
+    97, 108, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 42, 32, 103,
+    114, 97, 100, 105, 101, 110, 116, 44, 10, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 103,
+    108, 111, 98, 97, 108, 32, 105, 110, 116, 32, 42, 32, 99, 111, 115, 116,
+    95, 111, 117, 116, 44, 32, 103, 108, 111, 98, 97, 108, 32, 105, 110, 116,
+    32, 42, 32, 100, 105, 115, 116, 95, 111, 117, 116, 44, 32, 103, 108, 111,
+    98, 97, 108, 32, 105, 110, 116, 32, 42, 32, 108, 97, 98, 101, 108, 95,
+    111, 117, 116, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 110, 114, 111, 119, 115, 44, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 110, 99, 111, 108, 115, 44, 32, 103, 108, 111,
+    98, 97, 108, 32, 105, 110, 116, 32, 42, 32, 99, 104, 97, 110, 103, 101,
+    100, 44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 32, 105,
+    110, 116, 32, 42, 32, 108, 111, 99, 97, 108, 95, 99, 111, 115, 116, 44,
+    32, 108, 111, 99, 97, 108, 32, 105, 110, 116, 32, 42, 32, 108, 111, 99,
+    97, 108, 95, 100, 105, 115, 116, 44, 32, 108, 111, 99, 97, 108, 32, 105,
+    110, 116, 32, 42, 32, 108, 111, 99, 97, 108, 95, 108, 97, 98, 101, 108,
+    44, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 32, 105, 110,
+    116, 32, 42, 32, 108, 111, 99, 97, 108, 95, 102, 108, 97, 103, 41, 10,
+    123, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 120, 32,
+    61, 32, 103, 101, 116, 95, 103, 108, 111, 98, 97, 108, 95, 105, 100, 40,
+    48, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32,
+    121, 32, 61, 32, 103, 101, 116, 95, 103, 108, 111, 98, 97, 108, 95, 105,
+    100, 40, 49, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 108, 120, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108,
+    95, 105, 100, 40, 48, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 108, 121, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99,
+    97, 108, 95, 105, 100, 40, 49, 41, 59, 10, 32, 32, 99, 111, 110, 115,
+    116, 32, 105, 110, 116, 32, 108, 120, 115, 105, 122, 101, 32, 61, 32, 103,
+    101, 116, 95, 108, 111, 99, 97, 108, 95, 115, 105, 122, 101, 40, 48, 41,
+    59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 108, 121,
+    115, 105, 122, 101, 32, 61, 32, 103, 101, 116, 95, 108, 111, 99, 97, 108,
+    95, 115, 105, 122, 101, 40, 49, 41, 59, 10, 10, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 99, 111, 114, 110, 101, 114, 95, 120, 32,
+    61, 32, 103, 101, 116, 95, 103, 114, 111, 117, 112, 95, 105, 100, 40, 48,
+    41, 32, 42, 32, 108, 120, 115, 105, 122, 101, 32, 45, 32, 49, 59, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 99, 111, 114, 110,
+    101, 114, 95, 121, 32, 61, 32, 103, 101, 116, 95, 103, 114, 111, 117, 112,
+    95, 105, 100, 40, 49, 41, 32, 42, 32, 108, 121, 115, 105, 122, 101, 32,
+    45, 32, 49, 59, 10, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 32, 61, 32, 109,
+    97, 100, 50, 52, 40, 108, 121, 44, 32, 108, 120, 115, 105, 122, 101, 44,
+    32, 108, 120, 41, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110,
+    116, 32, 110, 98, 95, 116, 104, 114, 101, 97, 100, 115, 32, 61, 32, 108,
+    120, 115, 105, 122, 101, 32, 42, 32, 108, 121, 115, 105, 122, 101, 59, 10,
+    10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 112, 97, 100,
+    100, 101, 100, 95, 110, 99, 111, 108, 115, 32, 61, 32, 108, 120, 115, 105,
+    122, 101, 32, 43, 32, 50, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 108, 105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52,
+    40, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 44, 32, 108,
+    121, 32, 43, 32, 49, 44, 32, 108, 120, 32, 43, 32, 49, 41, 59, 10,
+    32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 115, 105, 122, 101,
+    32, 61, 32, 40, 108, 121, 115, 105, 122, 101, 32, 43, 32, 50, 41, 32,
+    42, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 59, 10,
+    10, 32, 32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 105, 32, 61, 32,
+    116, 104, 114, 101, 97, 100, 95, 105, 100, 120, 59, 32, 105, 32, 60, 32,
+    115, 105, 122, 101, 59, 32, 105, 32, 43, 61, 32, 110, 98, 95, 116, 104,
+    114, 101, 97, 100, 115, 41, 10, 32, 32, 123, 10, 32, 32, 32, 32, 99,
+    111, 110, 115, 116, 32, 105, 110, 116, 32, 100, 105, 118, 32, 61, 32, 105,
+    32, 47, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 59,
+    10, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 114,
+    101, 99, 116, 95, 114, 111, 119, 32, 61, 32, 100, 105, 118, 32, 43, 32,
+    99, 111, 114, 110, 101, 114, 95, 121, 59, 10, 32, 32, 32, 32, 99, 111,
+    110, 115, 116, 32, 105, 110, 116, 32, 114, 101, 99, 116, 95, 99, 111, 108,
+    32, 61, 32, 105, 32, 45, 32, 100, 105, 118, 32, 42, 32, 112, 97, 100,
+    100, 101, 100, 95, 110, 99, 111, 108, 115, 32, 43, 32, 99, 111, 114, 110,
+    101, 114, 95, 120, 59, 10, 10, 32, 32, 32, 32, 105, 102, 32, 40, 114,
+    101, 99, 116, 95, 114, 111, 119, 32, 60, 32, 48, 32, 124, 124, 32, 114,
+    101, 99, 116, 95, 114, 111, 119, 32, 62, 61, 32, 110, 114, 111, 119, 115,
+    32, 124, 124, 32, 114, 101, 99, 116, 95, 99, 111, 108, 32, 60, 32, 48,
+    32, 124, 124, 32, 114, 101, 99, 116, 95, 99, 111, 108, 32, 62, 61, 32,
+    110, 99, 111, 108, 115, 41, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32,
+    32, 32, 32, 108, 111, 99, 97, 108, 95, 99, 111, 115, 116, 91, 105, 93,
+    32, 61, 32, 73, 78, 84, 95, 77, 65, 88, 59, 10, 32, 32, 32, 32,
+    32, 32, 108, 111, 99, 97, 108, 95, 100, 105, 115, 116, 91, 105, 93, 32,
+    61, 32, 48, 59, 10, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108,
+    95, 108, 97, 98, 101, 108, 91, 105, 93, 32, 61, 32, 48, 59, 10, 32,
+    32, 32, 32, 125, 10, 32, 32, 32, 32, 101, 108, 115, 101, 10, 32, 32,
+    32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 112, 105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52,
+    40, 114, 101, 99, 116, 95, 114, 111, 119, 44, 32, 110, 99, 111, 108, 115,
+    44, 32, 114, 101, 99, 116, 95, 99, 111, 108, 41, 59, 10, 32, 32, 32,
+    32, 32, 32, 108, 111, 99, 97, 108, 95, 99, 111, 115, 116, 91, 105, 93,
+    32, 61, 32, 99, 111, 115, 116, 95, 105, 110, 91, 112, 105, 100, 120, 93,
+    59, 10, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 100, 105,
+    115, 116, 91, 105, 93, 32, 61, 32, 100, 105, 115, 116, 95, 105, 110, 91,
+    112, 105, 100, 120, 93, 59, 10, 32, 32, 32, 32, 32, 32, 108, 111, 99,
+    97, 108, 95, 108, 97, 98, 101, 108, 91, 105, 93, 32, 61, 32, 108, 97,
+    98, 101, 108, 95, 105, 110, 91, 112, 105, 100, 120, 93, 59, 10, 32, 32,
+    32, 32, 125, 10, 32, 32, 125, 10, 32, 32, 98, 97, 114, 114, 105, 101,
+    114, 40, 67, 76, 75, 95, 76, 79, 67, 65, 76, 95, 77, 69, 77, 95,
+    70, 69, 78, 67, 69, 41, 59, 10, 10, 32, 32, 47, 47, 32, 84, 104,
+    114, 101, 97, 100, 115, 32, 111, 117, 116, 115, 105, 100, 101, 32, 116, 104,
+    101, 32, 105, 109, 97, 103, 101, 32, 115, 116, 105, 108, 108, 32, 116, 97,
+    107, 101, 32, 112, 97, 114, 116, 32, 105, 110, 32, 116, 104, 101, 32, 98,
+    97, 114, 114, 105, 101, 114, 115, 10, 32, 32, 99, 111, 110, 115, 116, 32,
+    105, 110, 116, 32, 105, 110, 115, 105, 100, 101, 32, 61, 32, 120, 32, 60,
+    32, 110, 99, 111, 108, 115, 32, 38, 38, 32, 121, 32, 60, 32, 110, 114,
+    111, 119, 115, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116,
+    32, 105, 100, 120, 32, 61, 32, 109, 97, 100, 50, 52, 40, 121, 44, 32,
+    110, 99, 111, 108, 115, 44, 32, 120, 41, 59, 10, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 103, 32, 61, 32, 105, 110, 115, 105, 100,
+    101, 32, 63, 32, 103, 114, 97, 100, 105, 101, 110, 116, 91, 105, 100, 120,
+    93, 32, 58, 32, 48, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 111, 114, 105, 103, 95, 99, 111, 115, 116, 32, 61, 32, 108,
+    111, 99, 97, 108, 95, 99, 111, 115, 116, 91, 108, 105, 100, 120, 93, 59,
+    10, 32, 32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 111, 114, 105,
+    103, 95, 100, 105, 115, 116, 32, 61, 32, 108, 111, 99, 97, 108, 95, 100,
+    105, 115, 116, 91, 108, 105, 100, 120, 93, 59, 10, 32, 32, 99, 111, 110,
+    115, 116, 32, 105, 110, 116, 32, 111, 114, 105, 103, 95, 108, 97, 98, 101,
+    108, 32, 61, 32, 108, 111, 99, 97, 108, 95, 108, 97, 98, 101, 108, 91,
+    108, 105, 100, 120, 93, 59, 10, 32, 32, 99, 111, 110, 115, 116, 32, 105,
+    110, 116, 32, 102, 105, 120, 101, 100, 32, 61, 32, 33, 105, 110, 115, 105,
+    100, 101, 32, 124, 124, 32, 111, 114, 105, 103, 95, 100, 105, 115, 116, 32,
+    60, 32, 48, 59, 10, 10, 32, 32, 102, 111, 114, 32, 40, 59, 59, 41,
+    10, 32, 32, 123, 10, 32, 32, 32, 32, 105, 102, 32, 40, 116, 104, 114,
+    101, 97, 100, 95, 105, 100, 120, 32, 61, 61, 32, 48, 41, 10, 32, 32,
+    32, 32, 32, 32, 42, 108, 111, 99, 97, 108, 95, 102, 108, 97, 103, 32,
+    61, 32, 48, 59, 10, 10, 32, 32, 32, 32, 105, 110, 116, 32, 99, 32,
+    61, 32, 73, 78, 84, 95, 77, 65, 88, 59, 10, 32, 32, 32, 32, 105,
+    110, 116, 32, 100, 32, 61, 32, 48, 59, 10, 32, 32, 32, 32, 105, 110,
+    116, 32, 108, 32, 61, 32, 48, 59, 10, 32, 32, 32, 32, 105, 102, 32,
+    40, 33, 102, 105, 120, 101, 100, 41, 10, 32, 32, 32, 32, 32, 32, 102,
+    111, 114, 32, 40, 105, 110, 116, 32, 114, 32, 61, 32, 45, 49, 59, 32,
+    114, 32, 60, 61, 32, 49, 59, 32, 43, 43, 114, 41, 10, 32, 32, 32,
+    32, 32, 32, 32, 32, 102, 111, 114, 32, 40, 105, 110, 116, 32, 107, 32,
+    61, 32, 45, 49, 59, 32, 107, 32, 60, 61, 32, 49, 59, 32, 43, 43,
+    107, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 105, 102, 32,
+    40, 114, 32, 33, 61, 32, 48, 32, 124, 124, 32, 107, 32, 33, 61, 32,
+    48, 41, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 123, 10, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 99, 111, 110, 115, 116,
+    32, 105, 110, 116, 32, 110, 32, 61, 32, 109, 97, 100, 50, 52, 40, 114,
+    44, 32, 112, 97, 100, 100, 101, 100, 95, 110, 99, 111, 108, 115, 44, 32,
+    108, 105, 100, 120, 32, 43, 32, 107, 41, 59, 10, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 119, 97, 116, 101, 114, 115, 104, 101, 100,
+    95, 111, 102, 102, 101, 114, 40, 108, 111, 99, 97, 108, 95, 99, 111, 115,
+    116, 91, 110, 93, 44, 32, 108, 111, 99, 97, 108, 95, 100, 105, 115, 116,
+    91, 110, 93, 44, 32, 108, 111, 99, 97, 108, 95, 108, 97, 98, 101, 108,
+    91, 110, 93, 44, 32, 103, 44, 32, 38, 99, 44, 32, 38, 100, 44, 32,
+    38, 108, 41, 59, 10, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 125,
+    10, 32, 32, 32, 32, 98, 97, 114, 114, 105, 101, 114, 40, 67, 76, 75,
+    95, 76, 79, 67, 65, 76, 95, 77, 69, 77, 95, 70, 69, 78, 67, 69,
+    41, 59, 10, 10, 32, 32, 32, 32, 105, 102, 32, 40, 33, 102, 105, 120,
+    101, 100, 32, 38, 38, 32, 40, 99, 32, 33, 61, 32, 108, 111, 99, 97,
+    108, 95, 99, 111, 115, 116, 91, 108, 105, 100, 120, 93, 32, 124, 124, 32,
+    100, 32, 33, 61, 32, 108, 111, 99, 97, 108, 95, 100, 105, 115, 116, 91,
+    108, 105, 100, 120, 93, 32, 124, 124, 32, 108, 32, 33, 61, 32, 108, 111,
+    99, 97, 108, 95, 108, 97, 98, 101, 108, 91, 108, 105, 100, 120, 93, 41,
+    41, 10, 32, 32, 32, 32, 123, 10, 32, 32, 32, 32, 32, 32, 108, 111,
+    99, 97, 108, 95, 99, 111, 115, 116, 91, 108, 105, 100, 120, 93, 32, 61,
+    32, 99, 59, 10, 32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95,
+    100, 105, 115, 116, 91, 108, 105, 100, 120, 93, 32, 61, 32, 100, 59, 10,
+    32, 32, 32, 32, 32, 32, 108, 111, 99, 97, 108, 95, 108, 97, 98, 101,
+    108, 91, 108, 105, 100, 120, 93, 32, 61, 32, 108, 59, 10, 32, 32, 32,
+    32, 32, 32, 42, 108, 111, 99, 97, 108, 95, 102, 108, 97, 103, 32, 61,
+    32, 49, 59, 10, 32, 32, 32, 32, 125, 10, 32, 32, 32, 32, 98, 97,
+    114, 114, 105, 101, 114, 40, 67, 76, 75, 95, 76, 79, 67, 65, 76, 95,
+    77, 69, 77, 95, 70, 69, 78, 67, 69, 41, 59, 10, 10, 32, 32, 32,
+    32, 99, 111, 110, 115, 116, 32, 105, 110, 116, 32, 97, 103, 97, 105, 110,
+    32, 61, 32, 42, 108, 111, 99, 97, 108, 95, 102, 108, 97, 103, 59, 10,
+    32, 32, 32, 32, 98, 97, 114, 114, 105, 101, 114, 40, 67, 76, 75, 95,
+    76, 79, 67, 65, 76, 95, 77, 69, 77, 95, 70, 69, 78, 67, 69, 41,
+    59, 10, 32, 32, 32, 32, 105, 102, 32, 40, 33, 97, 103, 97, 105, 110,
+    41, 10, 32, 32, 32, 32, 32, 32, 98, 114, 101, 97, 107, 59, 10, 32,
+    32, 125, 10, 10, 32, 32, 105, 102, 32, 40, 33, 105, 110, 115, 105, 100,
+    101, 41, 10, 32, 32, 32, 32, 114, 101, 116, 117, 114, 110, 59, 10, 10,
+    32, 32, 99, 111, 115, 116, 95, 111, 117, 116, 91, 105, 100, 120, 93, 32,
+    61, 32, 108, 111, 99, 97, 108, 95, 99, 111, 115, 116, 91, 108, 105, 100,
+    120, 93, 59, 10, 32, 32, 100, 105, 115, 116, 95, 111, 117, 116, 91, 105,
+    100, 120, 93, 32, 61, 32, 108, 111, 99, 97, 108, 95, 100, 105, 115, 116,
+    91, 108, 105, 100, 120, 93, 59, 10, 32, 32, 108, 97, 98, 101, 108, 95,
+    111, 117, 116, 91, 105, 100, 120, 93, 32, 61, 32, 108, 111, 99, 97, 108,
+    95, 108, 97, 98, 101, 108, 91, 108, 105, 100, 120, 93, 59, 10, 32, 32,
+    47, 47, 32, 69, 118, 101, 114, 121, 32, 119, 114, 105, 116, 101, 114, 32,
+    115, 116, 111, 114, 101, 115, 32, 116, 104, 101, 32, 115, 97, 109, 101, 32,
+    118, 97, 108, 117, 101, 44, 32, 110, 111, 32, 110, 101, 101, 100, 32, 102,
+    111, 114, 32, 97, 110, 32, 97, 116, 111, 109, 105, 99, 32, 111, 112, 101,
+    114, 97, 116, 105, 111, 110, 10, 32, 32, 105, 102, 32, 40, 108, 111, 99,
+    97, 108, 95, 99, 111, 115, 116, 91, 108, 105, 100, 120, 93, 32, 33, 61,
+    32, 111, 114, 105, 103, 95, 99, 111, 115, 116, 32, 124, 124, 32, 108, 111,
+    99, 97, 108, 95, 100, 105, 115, 116, 91, 108, 105, 100, 120, 93, 32, 33,
+    61, 32, 111, 114, 105, 103, 95, 100, 105, 115, 116, 10, 32, 32, 32, 32,
+    32, 32, 124, 124, 32, 108, 111, 99, 97, 108, 95, 108, 97, 98, 101, 108,
+    91, 108, 105, 100, 120, 93, 32, 33, 61, 32, 111, 114, 105, 103, 95, 108,
+    97, 98, 101, 108, 41, 10, 32, 32, 32, 32, 42, 99, 104, 97, 110, 103,
+    101, 100, 32, 61, 32, 49, 59, 10, 125, 10, 35, 101, 110, 100, 105, 102,
+    10,
+    0
+  };
+}
+
+#endif
@@ -16,7 +16,12 @@
 #include <stdexcept>
 #include <fstream>
 #include <iostream>
+#include <sstream>
+#include <cstdio>
+#include <cstdlib>
 #include <assert.h>
+#include <unistd.h>
+#include <sys/stat.h>
 #include <clcv/clinit.h>
 
 using namespace std;
@@ -65,6 +70,118 @@ namespace clcv
     return cl::CommandQueue(context, devices[0], CL_QUEUE_PROFILING_ENABLE);
   }
   
+  // FNV-1a, 64 bits
+  static unsigned long long hash_string(const string & s)
+  {
+    unsigned long long h = 14695981039346656037ULL;
+    for (string::size_type i = 0; i < s.size(); ++i)
+    {
+      h ^= (unsigned char)s[i];
+      h *= 1099511628211ULL;
+    }
+    return h;
+  }
+
+  static string to_hex(unsigned long long v)
+  {
+    ostringstream os;
+    os << hex << v;
+    return os.str();
+  }
+
+  // CLCV_CACHE_DIR, or ~/.clcv. Empty when caching is disabled (an empty
+  // CLCV_CACHE_DIR) or impossible.
+  static string get_cache_dir()
+  {
+    const char * dir = getenv("CLCV_CACHE_DIR");
+    string path;
+    if (dir != NULL)
+      path = dir;
+    else if (getenv("HOME") != NULL)
+      path = string(getenv("HOME")) + "/.clcv";
+    if (!path.empty())
+      mkdir(path.c_str(), 0755);
+    return path;
+  }
+
+  // The key is stored at the beginning of the file, a hash collision is
+  // just a miss
+  static string get_cache_header(const string & key)
+  {
+    return string("CLCV1\n") + key + '\0';
+  }
+
+  static bool read_cached_binary(const string & file, const string & key, string & binary)
+  {
+    ifstream in(file.c_str(), ios::binary);
+    if (!in.is_open())
+      return false;
+    const string content((istreambuf_iterator<char>(in)), istreambuf_iterator<char>());
+    const string header = get_cache_header(key);
+    if (content.size() <= header.size() || content.compare(0, header.size(), header) != 0)
+      return false;
+    binary = content.substr(header.size());
+    return true;
+  }
+
+  // Written to a temporary file first, so that concurrent processes never
+  // read a partial binary
+  static void write_cached_binary(const string & file, const string & key,
+                                  cl::Program & program)
+  {
+    const vector< ::size_t> sizes = program.getInfo<CL_PROGRAM_BINARY_SIZES>();
+    if (sizes.size() != 1 || sizes[0] == 0)
+      return;
+    vector<char> binary(sizes[0]);
+    vector<char *> binaries(1, &binary[0]);
+    program.getInfo(CL_PROGRAM_BINARIES, &binaries);
+
+    // mkstemp picks a name no other process or thread is using (and creates
+    // it 0600, readable by the owner only)
+    string tmp_name = file + ".XXXXXX";
+    vector<char> tmp(tmp_name.begin(), tmp_name.end());
+    tmp.push_back('\0');
+    const int fd = mkstemp(&tmp[0]);
+    if (fd < 0)
+      return;
+    fchmod(fd, 0644);
+    close(fd);
+    tmp_name = &tmp[0];
+    {
+      ofstream out(tmp_name.c_str(), ios::binary);
+      if (!out.is_open())
+      {
+        remove(tmp_name.c_str());
+        return;
+      }
+      const string header = get_cache_header(key);
+      out.write(header.data(), header.size());
+      out.write(&binary[0], binary.size());
+      if (!out.good())
+      {
+        out.close();
+        remove(tmp_name.c_str());
+        return;
+      }
+    }
+    if (rename(tmp_name.c_str(), file.c_str()) != 0)
+      remove(tmp_name.c_str());
+  }
+
+  static void build_program(cl::Program & program, vector<cl::Device> & devices,
+                            const char * options)
+  {
+    try {
+      program.build(devices, options);
+    } catch(cl::Error & err) {
+      // Get the build log
+      cerr << "Build failed! " << endl;
+      cerr << "Build log:" << endl;
+      cerr << program.getBuildInfo<CL_PROGRAM_BUILD_LOG>(devices[0]) << endl;
+      throw err;
+    }
+  }
+
   cl::Program load_program(cl::Context & context, const char * path, const char * options)
   {  
     ifstream file(path);
@@ -77,18 +194,51 @@ namespace clcv
     }
     
     string prog(istreambuf_iterator<char>(file), (istreambuf_iterator<char>()));
+    return load_program_source(context, prog, options);
+  }
+
+  // The binaries are cached in get_cache_dir(), keyed by the device, the
+  // driver, the build options and the source. Only single device contexts
+  // use the cache.
+  cl::Program load_program_source(cl::Context & context, const string & prog,
+                                  const char * options)
+  {
+    vector<cl::Device> devices = context.getInfo<CL_CONTEXT_DEVICES>();
+
+    const string cache_dir = devices.size() == 1 ? get_cache_dir() : string();
+    string key, cache_file;
+    if (!cache_dir.empty())
+    {
+      key = devices[0].getInfo<CL_DEVICE_NAME>() + '\n'
+        + devices[0].getInfo<CL_DRIVER_VERSION>() + '\n'
+        + (options ? options : "") + '\n'
+        + to_hex(hash_string(prog));
+      cache_file = cache_dir + "/" + to_hex(hash_string(key)) + ".clbin";
+
+      string binary;
+      if (read_cached_binary(cache_file, key, binary))
+      {
+        // A stale or corrupted binary is just rebuilt from the source
+        try {
+          cl::Program::Binaries binaries(1, make_pair((const void *)binary.data(),
+                                                      binary.size()));
+          cl::Program program(context, devices, binaries);
+          program.build(devices, options);
+          return program;
+        } catch(cl::Error &) {
+        }
+      }
+    }
     
     cl::Program::Sources source(1, make_pair(prog.c_str(), prog.length()));
     cl::Program program = cl::Program(context, source);
-    vector<cl::Device> devices = context.getInfo<CL_CONTEXT_DEVICES>();
-    try {
-      program.build(devices, options);
-    } catch(cl::Error & err) {
-      // Get the build log
-      cerr << "Build failed! " << endl;
-      cerr << "Build log:" << endl;
-      cerr << program.getBuildInfo<CL_PROGRAM_BUILD_LOG>(devices[0]) << endl;
-      throw err;
+    build_program(program, devices, options);
+    if (!cache_dir.empty())
+    {
+      try {
+        write_cached_binary(cache_file, key, program);
+      } catch(cl::Error &) {
+      }
     }
     
     return program;
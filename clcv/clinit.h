@@ -32,7 +32,11 @@ namespace clcv
   cl::Context get_context(cl_device_id device);
   cl::CommandQueue get_command_queue(cl::Context & context);
   
+  // The program binaries are cached on disk, in $CLCV_CACHE_DIR (~/.clcv by
+  // default, disabled when empty), and only rebuilt from the source on a miss
   cl::Program load_program(cl::Context & context, const char * path, const char * options = NULL);
+  cl::Program load_program_source(cl::Context & context, const std::string & source,
+                                  const char * options = NULL);
   
   cl::Buffer create_buffer(cl::Context & context, size_t size, cl_mem_flags flags);
   cl::Event write_mem(cl::CommandQueue & cmd_queue,
@@ -0,0 +1,88 @@
+// Copyright (c) 2010 iZsh - izsh at fail0verflow.com
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CLCV_DECOMPOSE_H__
+#define CLCV_DECOMPOSE_H__
+
+#include <set>
+#include <vector>
+#include <clcv/win2d.h>
+
+// Largest SE (number of points) searched for a sum of segments, the search
+// grows with the fourth power of the radius
+#ifndef CLCV_DECOMPOSE_MAX_COUNT
+# define CLCV_DECOMPOSE_MAX_COUNT 512
+#endif
+
+namespace clcv
+{
+  // Decomposition of a flat (all weights == 1) structuring element into
+  // smaller ones. The SE is the union of the Minkowski sums of each chain:
+  //   win = (c0[0] + c0[1] + ...) U (c1[0] + c1[1] + ...) U ...
+  // so that an erosion/dilation can be computed as a sequence of cheaper
+  // erosions/dilations.
+  template<typename T>
+  class win2d_decomposition
+  {
+  public:
+    enum shape { none, rect, line, cross, diamond, segment_union, segment_sum };
+    typedef std::vector<win2d<T> > chain;
+    typedef std::vector<chain> chains;
+
+    win2d_decomposition();
+    win2d_decomposition(const win2d<T> & win);
+
+    shape get_shape() const;
+    const chains & get_chains() const;
+    // Chained dilations give the same result as the original SE near the
+    // image borders (the chained erosions always do)
+    bool exact_dilation() const;
+    // Number of SE points visited per pixel
+    unsigned cost() const;
+
+    // Centered horizontal/vertical segments, i.e. what the bitmapped
+    // operators can handle
+    static bool is_hsegment(const win2d<T> & win, unsigned & colrad);
+    static bool is_vsegment(const win2d<T> & win, unsigned & rowrad);
+
+  protected:
+    typedef std::set<point2d> point_set;
+
+    static bool is_flat(const win2d<T> & win);
+    static point_set to_set(const win2d<T> & win);
+    static win2d<T> to_win(const point_set & s);
+    static point_set segment(coord drow, coord dcol, unsigned rad);
+    static point_set erode(const point_set & s, const point_set & se);
+    static point_set dilate(const point_set & s, const point_set & se);
+    static unsigned max_segment(const point_set & s, coord drow, coord dcol);
+    static bool is_symmetric(const point_set & s);
+
+    bool find_rect(const win2d<T> & win, const point_set & s);
+    bool find_line(const point_set & s);
+    bool find_cross(const point_set & s);
+    bool find_diamond(const win2d<T> & win, const point_set & s);
+    bool find_segment_union(const point_set & s);
+    bool find_segment_sum(const point_set & s);
+
+  private:
+    shape m_shape;
+    chains m_chains;
+    bool m_exact_dilation;
+  };
+}
+
+#include <clcv/decompose.hxx>
+
+#endif
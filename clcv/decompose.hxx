@@ -0,0 +1,357 @@
+// Copyright (c) 2010 iZsh - izsh at fail0verflow.com
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CLCV_DECOMPOSE_HXX__
+#define CLCV_DECOMPOSE_HXX__
+
+#include <cstdlib>
+#include <algorithm>
+
+namespace clcv
+{
+  template<typename T>
+  inline
+  win2d_decomposition<T>::win2d_decomposition()
+  : m_shape(none), m_chains(), m_exact_dilation(false)
+  {
+  }
+
+  template<typename T>
+  inline
+  win2d_decomposition<T>::win2d_decomposition(const win2d<T> & win)
+  : m_shape(none), m_chains(), m_exact_dilation(false)
+  {
+    if (win.count() == 0 || !is_flat(win))
+      return;
+    point_set s = to_set(win);
+    find_rect(win, s) || find_line(s) || find_cross(s) || find_diamond(win, s)
+    || find_segment_union(s) || find_segment_sum(s);
+  }
+
+  template<typename T>
+  inline
+  typename win2d_decomposition<T>::shape win2d_decomposition<T>::get_shape() const
+  {
+    return m_shape;
+  }
+
+  template<typename T>
+  inline
+  const typename win2d_decomposition<T>::chains & win2d_decomposition<T>::get_chains() const
+  {
+    return m_chains;
+  }
+
+  template<typename T>
+  inline
+  bool win2d_decomposition<T>::exact_dilation() const
+  {
+    return m_exact_dilation;
+  }
+
+  template<typename T>
+  inline
+  unsigned win2d_decomposition<T>::cost() const
+  {
+    unsigned cost = 0;
+    for (unsigned i = 0; i < m_chains.size(); ++i)
+      for (unsigned j = 0; j < m_chains[i].size(); ++j)
+        cost += m_chains[i][j].count();
+    return cost;
+  }
+
+  template<typename T>
+  inline
+  bool win2d_decomposition<T>::is_hsegment(const win2d<T> & win, unsigned & colrad)
+  {
+    if (win.count() == 0 || !is_flat(win) || win.nrows() != 1 || win.minrow() != 0
+        || win.mincol() != -win.maxcol() || win.count() != win.ncols())
+      return false;
+    colrad = win.maxcol();
+    return true;
+  }
+
+  template<typename T>
+  inline
+  bool win2d_decomposition<T>::is_vsegment(const win2d<T> & win, unsigned & rowrad)
+  {
+    if (win.count() == 0 || !is_flat(win) || win.ncols() != 1 || win.mincol() != 0
+        || win.minrow() != -win.maxrow() || win.count() != win.nrows())
+      return false;
+    rowrad = win.maxrow();
+    return true;
+  }
+
+  template<typename T>
+  inline
+  bool win2d_decomposition<T>::is_flat(const win2d<T> & win)
+  {
+    for (typename win2d<T>::const_iter it = win.begin(); it != win.end(); ++it)
+      if (it->second != 1)
+        return false;
+    return true;
+  }
+
+  template<typename T>
+  inline
+  typename win2d_decomposition<T>::point_set win2d_decomposition<T>::to_set(const win2d<T> & win)
+  {
+    point_set s;
+    for (typename win2d<T>::const_iter it = win.begin(); it != win.end(); ++it)
+      s.insert(it->first);
+    return s;
+  }
+
+  template<typename T>
+  inline
+  win2d<T> win2d_decomposition<T>::to_win(const point_set & s)
+  {
+    win2d<T> win;
+    for (typename point_set::const_iterator it = s.begin(); it != s.end(); ++it)
+      win.add(*it, 1);
+    return win;
+  }
+
+  template<typename T>
+  inline
+  typename win2d_decomposition<T>::point_set win2d_decomposition<T>::segment(coord drow, coord dcol, unsigned rad)
+  {
+    point_set s;
+    for (coord i = - (coord)rad; i <= (coord)rad; ++i)
+      s.insert(point2d(i * drow, i * dcol));
+    return s;
+  }
+
+  template<typename T>
+  inline
+  typename win2d_decomposition<T>::point_set win2d_decomposition<T>::erode(const point_set & s, const point_set & se)
+  {
+    point_set res;
+    const point2d & q0 = *se.begin();
+    for (typename point_set::const_iterator it = s.begin(); it != s.end(); ++it)
+    {
+      const point2d p(it->row() - q0.row(), it->col() - q0.col());
+      bool in = true;
+      for (typename point_set::const_iterator q = se.begin(); in && q != se.end(); ++q)
+        in = s.count(point2d(p.row() + q->row(), p.col() + q->col())) != 0;
+      if (in)
+        res.insert(p);
+    }
+    return res;
+  }
+
+  template<typename T>
+  inline
+  typename win2d_decomposition<T>::point_set win2d_decomposition<T>::dilate(const point_set & s, const point_set & se)
+  {
+    point_set res;
+    for (typename point_set::const_iterator it = s.begin(); it != s.end(); ++it)
+      for (typename point_set::const_iterator q = se.begin(); q != se.end(); ++q)
+        res.insert(point2d(it->row() + q->row(), it->col() + q->col()));
+    return res;
+  }
+
+  // Radius of the longest centered segment along (drow, dcol) included in s
+  template<typename T>
+  inline
+  unsigned win2d_decomposition<T>::max_segment(const point_set & s, coord drow, coord dcol)
+  {
+    if (s.count(point2d(0, 0)) == 0)
+      return 0;
+    unsigned rad = 0;
+    while (s.count(point2d((rad + 1) * drow, (rad + 1) * dcol))
+           && s.count(point2d(- (coord)(rad + 1) * drow, - (coord)(rad + 1) * dcol)))
+      ++rad;
+    return rad;
+  }
+
+  // Centered symmetric: p in s <=> -p in s
+  template<typename T>
+  inline
+  bool win2d_decomposition<T>::is_symmetric(const point_set & s)
+  {
+    for (typename point_set::const_iterator it = s.begin(); it != s.end(); ++it)
+      if (s.count(point2d(-it->row(), -it->col())) == 0)
+        return false;
+    return true;
+  }
+
+  // Rectangles (of any size and position) are the sum of one horizontal and
+  // one vertical segment
+  template<typename T>
+  inline
+  bool win2d_decomposition<T>::find_rect(const win2d<T> & win, const point_set & s)
+  {
+    if (s.size() != win.nrows() * win.ncols())
+      return false;
+    if (win.nrows() == 1 || win.ncols() == 1)
+    {
+      m_shape = line;
+      m_chains.push_back(chain(1, win));
+    }
+    else
+    {
+      win2d<T> h, v;
+      for (coord col = win.mincol(); col <= win.maxcol(); ++col)
+        h.add(0, col, 1);
+      for (coord row = win.minrow(); row <= win.maxrow(); ++row)
+        v.add(row, 0, 1);
+      m_shape = rect;
+      m_chains.push_back(chain());
+      m_chains.back().push_back(h);
+      m_chains.back().push_back(v);
+    }
+    m_exact_dilation = true;
+    return true;
+  }
+
+  // Any direction, including periodic lines. Nothing to decompose, but it
+  // is worth knowing.
+  template<typename T>
+  inline
+  bool win2d_decomposition<T>::find_line(const point_set & s)
+  {
+    if (s.size() < 2)
+      return false;
+    typename point_set::const_iterator it = s.begin();
+    const point2d p0 = *it++;
+    const coord drow = it->row() - p0.row();
+    const coord dcol = it->col() - p0.col();
+    for (coord i = 0; i < (coord)s.size(); ++i)
+      if (!s.count(point2d(p0.row() + i * drow, p0.col() + i * dcol)))
+        return false;
+    m_shape = line;
+    m_chains.push_back(chain(1, to_win(s)));
+    m_exact_dilation = true;
+    return true;
+  }
+
+  template<typename T>
+  inline
+  bool win2d_decomposition<T>::find_cross(const point_set & s)
+  {
+    const unsigned colrad = max_segment(s, 0, 1);
+    const unsigned rowrad = max_segment(s, 1, 0);
+    if (colrad == 0 || rowrad == 0 || s.size() != 2 * (colrad + rowrad) + 1)
+      return false;
+    m_shape = cross;
+    m_chains.push_back(chain(1, to_win(segment(0, 1, colrad))));
+    m_chains.push_back(chain(1, to_win(segment(1, 0, rowrad))));
+    m_exact_dilation = true;
+    return true;
+  }
+
+  // A diamond of radius r is r times the 4-connexity cross
+  template<typename T>
+  inline
+  bool win2d_decomposition<T>::find_diamond(const win2d<T> & win, const point_set & s)
+  {
+    const coord rad = win.maxrow();
+    if (rad < 2 || win.minrow() != -rad || win.mincol() != -rad || win.maxcol() != rad
+        || s.size() != (unsigned)(2 * rad * rad + 2 * rad + 1))
+      return false;
+    for (typename point_set::const_iterator it = s.begin(); it != s.end(); ++it)
+      if (std::abs(it->row()) + std::abs(it->col()) > rad)
+        return false;
+    m_shape = diamond;
+    m_chains.push_back(chain(rad, win_c4p<T>()));
+    m_exact_dilation = true;
+    return true;
+  }
+
+  // Stars: centered segments along the horizontal, vertical and diagonal
+  // directions
+  template<typename T>
+  inline
+  bool win2d_decomposition<T>::find_segment_union(const point_set & s)
+  {
+    static const coord dirs[4][2] = { {0, 1}, {1, 0}, {1, 1}, {1, -1} };
+    point_set u;
+    chains c;
+    for (unsigned d = 0; d < 4; ++d)
+    {
+      const unsigned rad = max_segment(s, dirs[d][0], dirs[d][1]);
+      if (rad == 0)
+        continue;
+      const point_set seg = segment(dirs[d][0], dirs[d][1], rad);
+      u.insert(seg.begin(), seg.end());
+      c.push_back(chain(1, to_win(seg)));
+    }
+    if (c.size() < 2 || u != s)
+      return false;
+    m_shape = segment_union;
+    m_chains = c;
+    m_exact_dilation = true;
+    return true;
+  }
+
+  // Centered symmetric shapes (octagons, hexagons...) that are the sum of
+  // horizontal, vertical and diagonal segments, and of 4-connexity crosses.
+  // Greedily peel the longest segment s can be opened by without changing.
+  // Such sums are symmetric, and larger SEs aren't searched at all (see
+  // CLCV_DECOMPOSE_MAX_COUNT).
+  template<typename T>
+  inline
+  bool win2d_decomposition<T>::find_segment_sum(const point_set & s)
+  {
+    if (s.size() > CLCV_DECOMPOSE_MAX_COUNT || s.count(point2d(0, 0)) == 0
+        || !is_symmetric(s))
+      return false;
+    static const coord dirs[4][2] = { {0, 1}, {1, 0}, {1, 1}, {1, -1} };
+    point_set rest = s;
+    chain c;
+    bool exact = true;
+    bool progress = true;
+    while (rest.size() > 1 && progress)
+    {
+      progress = false;
+      for (unsigned d = 0; d < 4 && rest.size() > 1; ++d)
+      {
+        for (unsigned rad = max_segment(rest, dirs[d][0], dirs[d][1]); rad > 0; --rad)
+        {
+          const point_set seg = segment(dirs[d][0], dirs[d][1], rad);
+          const point_set eroded = erode(rest, seg);
+          if (!eroded.empty() && dilate(eroded, seg) == rest)
+          {
+            c.push_back(to_win(seg));
+            exact = exact && (dirs[d][0] == 0 || dirs[d][1] == 0);
+            rest = eroded;
+            progress = true;
+            break;
+          }
+        }
+      }
+      if (!progress && rest.size() > 1)
+      {
+        const point_set c4 = to_set(win_c4p<T>());
+        const point_set eroded = erode(rest, c4);
+        if (!eroded.empty() && dilate(eroded, c4) == rest)
+        {
+          c.push_back(win_c4p<T>());
+          rest = eroded;
+          progress = true;
+        }
+      }
+    }
+    if (c.size() < 2 || rest.size() != 1 || rest.count(point2d(0, 0)) == 0)
+      return false;
+    m_shape = segment_sum;
+    m_chains.push_back(c);
+    m_exact_dilation = exact;
+    return true;
+  }
+}
+
+#endif
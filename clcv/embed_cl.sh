@@ -0,0 +1,45 @@
+#!/bin/sh
+# Copyright (c) 2010 iZsh - izsh at fail0verflow.com
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+# Embeds the kernels in the library: generates clcv_cl.h (the source of
+# clcv.cl as a NUL terminated char array, string literals that long exceed
+# the limits of some compilers) next to clcv.cl. Run it again after each
+# change of clcv.cl, before building.
+#   usage: clcv/embed_cl.sh [clcv.cl [clcv_cl.h]]
+
+set -e
+dir=`dirname "$0"`
+in=${1:-$dir/clcv.cl}
+out=${2:-$dir/clcv_cl.h}
+
+{
+  echo "// Generated from clcv.cl by embed_cl.sh, do not edit"
+  echo
+  echo "#ifndef CLCV_CLCV_CL_H__"
+  echo "#define CLCV_CLCV_CL_H__"
+  echo
+  echo "namespace clcv"
+  echo "{"
+  echo "  static const char clcv_cl_source[] = {"
+  od -An -v -td1 "$in" |
+    awk '{ s = "   "; for (i = 1; i <= NF; ++i) s = s " " $i ","; print s }'
+  echo "    0"
+  echo "  };"
+  echo "}"
+  echo
+  echo "#endif"
+} > "$out.tmp"
+mv "$out.tmp" "$out"
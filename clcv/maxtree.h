@@ -0,0 +1,111 @@
+// Copyright (c) 2010 iZsh - izsh at fail0verflow.com
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CLCV_MAXTREE_H__
+#define CLCV_MAXTREE_H__
+
+#include <cstddef>
+#include <vector>
+#include <clcv/image2d.h>
+
+namespace clcv
+{
+  // Max-tree (8-connexity) of a grayscale image, built on the host with
+  // POSIX threads. Each thread builds the tree of a stripe of rows
+  // (union-find in decreasing order of the values), then the stripe trees
+  // are merged pairwise along their borders, also in parallel. The
+  // attributes are computed once, so that the attribute openings cost the
+  // same whatever the threshold.
+  //
+  // The nodes are represented by one of their pixels (the level root), the
+  // other pixels of a node point to it, and the level roots to the level
+  // root of their parent node (the root of the tree to itself).
+  template<typename T>
+  class maxtree
+  {
+  public:
+    maxtree(const image2d<T> & img, unsigned nthreads = 4);
+
+    unsigned nrows() const;
+    unsigned ncols() const;
+    unsigned nnodes() const;
+
+    // Attribute openings (direct rule): the nodes whose attribute is below
+    // the threshold take the value of their closest kept ancestor
+    image2d<T> area_opening(const unsigned min_area) const;
+    // Largest side of the bounding box
+    image2d<T> extent_opening(const unsigned min_extent) const;
+    // Highest value of the node (its subtree) minus its own value
+    image2d<T> contrast_opening(const T min_contrast) const;
+
+  protected:
+    typedef std::vector<unsigned> index_vector;
+
+    struct stripe_task
+    {
+      maxtree<T> * tree;
+      unsigned first_row;
+      unsigned last_row;
+    };
+    struct merge_task
+    {
+      maxtree<T> * tree;
+      unsigned first_row;
+      unsigned middle_row;
+      unsigned last_row;
+    };
+
+    static void * build_stripe(void * arg);
+    static void * merge_stripes(void * arg);
+    template<typename Task>
+    static void run(std::vector<Task> & tasks, void * (* fn)(void *));
+
+    bool is_level_root(const unsigned p) const;
+    unsigned level_root(unsigned p) const;
+    unsigned find_root(index_vector & zpar, unsigned offset, unsigned p) const;
+    void connect(unsigned x, unsigned y);
+    void compute_attributes();
+    template<typename A>
+    image2d<T> filter(const std::vector<A> & attribute, const A & threshold) const;
+
+    // Sort the pixels by decreasing value
+    struct greater_value
+    {
+      const std::vector<T> * values;
+      bool operator()(const unsigned a, const unsigned b) const
+      {
+        return (*values)[a] > (*values)[b];
+      }
+    };
+
+  private:
+    unsigned m_nrows;
+    unsigned m_ncols;
+    std::vector<T> m_values;
+    index_vector m_parent;
+    // All the pixels, by decreasing value
+    index_vector m_sorted;
+    unsigned m_nnodes;
+
+    // Attributes, indexed by the level roots
+    std::vector<unsigned> m_area;
+    std::vector<unsigned> m_extent;
+    std::vector<T> m_contrast;
+  };
+}
+
+#include <clcv/maxtree.hxx>
+
+#endif
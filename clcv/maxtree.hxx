@@ -0,0 +1,336 @@
+// Copyright (c) 2010 iZsh - izsh at fail0verflow.com
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef CLCV_MAXTREE_HXX__
+#define CLCV_MAXTREE_HXX__
+
+#include <assert.h>
+#include <pthread.h>
+#include <algorithm>
+
+namespace clcv
+{
+  template<typename T>
+  inline
+  maxtree<T>::maxtree(const image2d<T> & img, unsigned nthreads)
+  : m_nrows(img.nrows()), m_ncols(img.ncols()),
+    m_values(img.nrows() * img.ncols()), m_parent(img.nrows() * img.ncols()),
+    m_sorted(img.nrows() * img.ncols()), m_nnodes(0)
+  {
+    assert(m_nrows > 0 && m_ncols > 0);
+    for (unsigned r = 0; r < m_nrows; ++r)
+      for (unsigned c = 0; c < m_ncols; ++c)
+        m_values[r * m_ncols + c] = img(r, c);
+
+    // Stripes of (about) the same number of rows
+    const unsigned nstripes = std::max(1u, std::min(nthreads, m_nrows));
+    std::vector<unsigned> bounds;
+    for (unsigned i = 0; i <= nstripes; ++i)
+      bounds.push_back(m_nrows * i / nstripes);
+
+    std::vector<stripe_task> stripes;
+    for (unsigned i = 0; i < nstripes; ++i)
+    {
+      const stripe_task task = { this, bounds[i], bounds[i + 1] };
+      stripes.push_back(task);
+    }
+    run(stripes, build_stripe);
+
+    // Stripes i and i + step were built (or merged) independently, and so
+    // are all the pairs of a round
+    for (unsigned step = 1; step < nstripes; step *= 2)
+    {
+      std::vector<merge_task> merges;
+      for (unsigned i = 0; i + step < nstripes; i += 2 * step)
+      {
+        const merge_task task =
+          { this, bounds[i], bounds[i + step], bounds[std::min(i + 2 * step, nstripes)] };
+        merges.push_back(task);
+      }
+      run(merges, merge_stripes);
+    }
+
+    // The merges leave chains of level roots at the same level
+    for (unsigned p = 0; p < m_parent.size(); ++p)
+      m_parent[p] = is_level_root(p) ? level_root(m_parent[p]) : level_root(p);
+    compute_attributes();
+  }
+
+  template<typename T>
+  inline
+  unsigned maxtree<T>::nrows() const
+  {
+    return m_nrows;
+  }
+
+  template<typename T>
+  inline
+  unsigned maxtree<T>::ncols() const
+  {
+    return m_ncols;
+  }
+
+  template<typename T>
+  inline
+  unsigned maxtree<T>::nnodes() const
+  {
+    return m_nnodes;
+  }
+
+  template<typename T>
+  inline
+  image2d<T> maxtree<T>::area_opening(const unsigned min_area) const
+  {
+    return filter(m_area, min_area);
+  }
+
+  template<typename T>
+  inline
+  image2d<T> maxtree<T>::extent_opening(const unsigned min_extent) const
+  {
+    return filter(m_extent, min_extent);
+  }
+
+  template<typename T>
+  inline
+  image2d<T> maxtree<T>::contrast_opening(const T min_contrast) const
+  {
+    return filter(m_contrast, min_contrast);
+  }
+
+  template<typename T>
+  template<typename Task>
+  inline
+  void maxtree<T>::run(std::vector<Task> & tasks, void * (* fn)(void *))
+  {
+    if (tasks.size() == 1)
+    {
+      fn(&tasks[0]);
+      return;
+    }
+    std::vector<pthread_t> threads(tasks.size());
+    for (unsigned i = 0; i < tasks.size(); ++i)
+    {
+      const int err = pthread_create(&threads[i], NULL, fn, &tasks[i]);
+      assert(err == 0);
+      (void)err;
+    }
+    for (unsigned i = 0; i < tasks.size(); ++i)
+      pthread_join(threads[i], NULL);
+  }
+
+  // Berger et al.: the pixels are added by decreasing value, each one
+  // becomes the parent of the trees of its already added neighbors. zpar
+  // is the union-find forest of the stripe (with path compression), ~0 for
+  // the pixels not added yet.
+  template<typename T>
+  inline
+  void * maxtree<T>::build_stripe(void * arg)
+  {
+    const stripe_task & task = *static_cast<stripe_task *>(arg);
+    maxtree<T> & tree = *task.tree;
+    const unsigned ncols = tree.m_ncols;
+    const unsigned begin = task.first_row * ncols;
+    const unsigned end = task.last_row * ncols;
+
+    for (unsigned p = begin; p < end; ++p)
+      tree.m_sorted[p] = p;
+    const greater_value cmp = { &tree.m_values };
+    std::stable_sort(tree.m_sorted.begin() + begin, tree.m_sorted.begin() + end, cmp);
+
+    index_vector zpar(end - begin, ~0u);
+    for (unsigned i = begin; i < end; ++i)
+    {
+      const unsigned p = tree.m_sorted[i];
+      const unsigned row = p / ncols;
+      const unsigned col = p - row * ncols;
+      tree.m_parent[p] = p;
+      zpar[p - begin] = p;
+      for (unsigned r = std::max(row, task.first_row + 1) - 1;
+           r <= std::min(row + 1, task.last_row - 1); ++r)
+        for (unsigned c = std::max(col, 1u) - 1; c <= std::min(col + 1, ncols - 1); ++c)
+        {
+          const unsigned n = r * ncols + c;
+          if (zpar[n - begin] == ~0u)
+            continue;
+          const unsigned root = tree.find_root(zpar, begin, n);
+          if (root != p)
+          {
+            tree.m_parent[root] = p;
+            zpar[root - begin] = p;
+          }
+        }
+    }
+
+    // By increasing value, the parents first: point to the level roots
+    for (unsigned i = end; i-- > begin; )
+    {
+      const unsigned p = tree.m_sorted[i];
+      const unsigned q = tree.m_parent[p];
+      if (tree.m_values[tree.m_parent[q]] == tree.m_values[q])
+        tree.m_parent[p] = tree.m_parent[q];
+    }
+    return NULL;
+  }
+
+  // Wilkinson et al.: connects the trees of the stripes [first_row,
+  // middle_row[ and [middle_row, last_row[ along their border, then merges
+  // their sorted pixels
+  template<typename T>
+  inline
+  void * maxtree<T>::merge_stripes(void * arg)
+  {
+    const merge_task & task = *static_cast<merge_task *>(arg);
+    maxtree<T> & tree = *task.tree;
+    const unsigned ncols = tree.m_ncols;
+
+    const unsigned above = (task.middle_row - 1) * ncols;
+    const unsigned below = task.middle_row * ncols;
+    for (unsigned col = 0; col < ncols; ++col)
+      for (unsigned c = std::max(col, 1u) - 1; c <= std::min(col + 1, ncols - 1); ++c)
+        tree.connect(above + col, below + c);
+
+    const greater_value cmp = { &tree.m_values };
+    std::inplace_merge(tree.m_sorted.begin() + task.first_row * ncols,
+                       tree.m_sorted.begin() + below,
+                       tree.m_sorted.begin() + task.last_row * ncols, cmp);
+    return NULL;
+  }
+
+  template<typename T>
+  inline
+  bool maxtree<T>::is_level_root(const unsigned p) const
+  {
+    return m_parent[p] == p || m_values[m_parent[p]] != m_values[p];
+  }
+
+  template<typename T>
+  inline
+  unsigned maxtree<T>::level_root(unsigned p) const
+  {
+    while (!is_level_root(p))
+      p = m_parent[p];
+    return p;
+  }
+
+  template<typename T>
+  inline
+  unsigned maxtree<T>::find_root(index_vector & zpar, unsigned offset, unsigned p) const
+  {
+    unsigned root = p;
+    while (zpar[root - offset] != root)
+      root = zpar[root - offset];
+    while (p != root)
+    {
+      const unsigned next = zpar[p - offset];
+      zpar[p - offset] = root;
+      p = next;
+    }
+    return root;
+  }
+
+  // Walks down the two branches at once, from the highest level, inserting
+  // the nodes of one branch between those of the other. x is always the
+  // highest, y becomes ~0 below the root.
+  template<typename T>
+  inline
+  void maxtree<T>::connect(unsigned x, unsigned y)
+  {
+    x = level_root(x);
+    y = level_root(y);
+    if (m_values[y] > m_values[x])
+      std::swap(x, y);
+    while (x != y && y != ~0u)
+    {
+      const unsigned z = m_parent[x] == x ? ~0u : level_root(m_parent[x]);
+      if (z != ~0u && m_values[z] >= m_values[y])
+        x = z;
+      else
+      {
+        m_parent[x] = y;
+        x = y;
+        y = z;
+      }
+    }
+  }
+
+  // The pixels first, to the level roots, then the nodes by decreasing
+  // value: a node only gets its attributes from higher ones
+  template<typename T>
+  inline
+  void maxtree<T>::compute_attributes()
+  {
+    const unsigned size = m_parent.size();
+    std::vector<unsigned> minrow(size, m_nrows), maxrow(size, 0);
+    std::vector<unsigned> mincol(size, m_ncols), maxcol(size, 0);
+    std::vector<T> maxval(m_values);
+    m_area.assign(size, 0);
+    m_extent.assign(size, 0);
+    m_contrast.assign(size, T());
+
+    m_nnodes = 0;
+    for (unsigned p = 0; p < size; ++p)
+    {
+      const unsigned node = is_level_root(p) ? p : m_parent[p];
+      const unsigned row = p / m_ncols;
+      const unsigned col = p - row * m_ncols;
+      m_nnodes += node == p;
+      ++m_area[node];
+      minrow[node] = std::min(minrow[node], row);
+      maxrow[node] = std::max(maxrow[node], row);
+      mincol[node] = std::min(mincol[node], col);
+      maxcol[node] = std::max(maxcol[node], col);
+    }
+    for (unsigned i = 0; i < size; ++i)
+    {
+      const unsigned p = m_sorted[i];
+      if (!is_level_root(p))
+        continue;
+      m_extent[p] = std::max(maxrow[p] - minrow[p], maxcol[p] - mincol[p]) + 1;
+      m_contrast[p] = maxval[p] - m_values[p];
+      const unsigned q = m_parent[p];
+      if (q == p)
+        continue;
+      m_area[q] += m_area[p];
+      minrow[q] = std::min(minrow[q], minrow[p]);
+      maxrow[q] = std::max(maxrow[q], maxrow[p]);
+      mincol[q] = std::min(mincol[q], mincol[p]);
+      maxcol[q] = std::max(maxcol[q], maxcol[p]);
+      maxval[q] = std::max(maxval[q], maxval[p]);
+    }
+  }
+
+  // By increasing value, the parents first. The root is always kept.
+  template<typename T>
+  template<typename A>
+  inline
+  image2d<T> maxtree<T>::filter(const std::vector<A> & attribute, const A & threshold) const
+  {
+    std::vector<T> out(m_values.size());
+    for (unsigned i = m_sorted.size(); i-- > 0; )
+    {
+      const unsigned p = m_sorted[i];
+      if (is_level_root(p))
+        out[p] = m_parent[p] == p || !(attribute[p] < threshold) ?
+          m_values[p] : out[m_parent[p]];
+    }
+    image2d<T> img(m_nrows, m_ncols);
+    for (unsigned p = 0; p < out.size(); ++p)
+      img(p / m_ncols, p % m_ncols) = is_level_root(p) ? out[p] : out[m_parent[p]];
+    return img;
+  }
+}
+
+#endif
@@ -43,6 +43,8 @@ namespace clcv
     coord m_value[2];
   };  
 
+  bool operator==(const point2d & l, const point2d & r);
+  bool operator!=(const point2d & l, const point2d & r);
   std::ostream & operator<<(std::ostream & o, const clcv::point2d & p);
 
 }
@@ -68,6 +68,18 @@ namespace clcv
     return m_value[1];
   }
 
+  inline
+  bool operator==(const point2d & l, const point2d & r)
+  {
+    return l.row() == r.row() && l.col() == r.col();
+  }
+
+  inline
+  bool operator!=(const point2d & l, const point2d & r)
+  {
+    return !(l == r);
+  }
+
   inline
   std::ostream & operator<<(std::ostream & o, const clcv::point2d & p)
   {
@@ -41,7 +41,7 @@ namespace clcv
   inline
   win2d<T> & win2d<T>::add(const point2d & p, const T weight)
   {
-    m_points.insert(make_pair(p, weight));
+    m_points.insert(std::make_pair(p, weight));
     return *this;
   }
   
@@ -49,7 +49,7 @@ namespace clcv
   inline
   win2d<T> & win2d<T>::add(const coord row, const coord col, const T weight)
   {
-    m_points.insert(make_pair(point2d(row, col), weight));
+    m_points.insert(std::make_pair(point2d(row, col), weight));
     return *this;
   }
 